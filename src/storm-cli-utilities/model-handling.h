@@ -22,6 +22,8 @@
 
 #include "storm/builder/BuilderType.h"
 
+#include "storm/logic/FragmentChecker.h"
+
 #include "storm/models/ModelBase.h"
 
 #include "storm/environment/Environment.h"
@@ -467,6 +469,19 @@ std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const&
     options.setReservedBitsForUnboundedVariables(buildSettings.getBitsForUnboundedVariables());
 
     options.setAddOutOfBoundsState(buildSettings.isBuildOutOfBoundsStateSet());
+    options.setSymmetryReduction(buildSettings.isSymmetryReductionSet());
+    if (buildSettings.isPartialOrderReductionSet()) {
+        // The reduction only preserves properties that are invariant under stuttering.
+        storm::logic::FragmentSpecification stutterInvariantFragment = storm::logic::pctlstar();
+        stutterInvariantFragment.setNextFormulasAllowed(false).setBoundedUntilFormulasAllowed(false).setHOAPathFormulasAllowed(false);
+        stutterInvariantFragment.setNestedOperatorsAllowed(false);
+        storm::logic::FragmentChecker fragmentChecker;
+        bool stutterInvariant = std::all_of(input.properties.begin(), input.properties.end(), [&](storm::jani::Property const& property) {
+            return fragmentChecker.conformsToSpecification(*property.getRawFormula(), stutterInvariantFragment);
+        });
+        STORM_LOG_WARN_COND(stutterInvariant, "Partial-order reduction is not applied as some properties are not LTL properties without next operators.");
+        options.setPartialOrderReduction(stutterInvariant);
+    }
     if (buildSettings.isBuildFullModelSet()) {
         options.clearTerminalStates();
         options.setApplyMaximalProgressAssumption(false);
@@ -496,6 +511,8 @@ std::shared_ptr<storm::models::ModelBase> buildModelExplicit(storm::settings::mo
         storm::parser::DirectEncodingParserOptions options;
         options.buildChoiceLabeling = buildSettings.isBuildChoiceLabelsSet();
         result = storm::api::buildExplicitDRNModel<ValueType>(ioSettings.getExplicitDRNFilename(), options);
+    } else if (ioSettings.isExplicitBinarySet()) {
+        result = storm::api::buildExplicitBinaryModel<ValueType>(ioSettings.getExplicitBinaryFilename());
     } else {
         STORM_LOG_THROW(ioSettings.isExplicitIMCASet(), storm::exceptions::InvalidSettingsException, "Unexpected explicit model input type.");
         result = storm::api::buildExplicitIMCAModel<ValueType>(ioSettings.getExplicitIMCAFilename());
@@ -517,7 +534,7 @@ std::shared_ptr<storm::models::ModelBase> buildModel(SymbolicInput const& input,
         } else if (builderType == storm::builder::BuilderType::Explicit || builderType == storm::builder::BuilderType::Jit) {
             result = buildModelSparse<ValueType>(input, buildSettings, builderType == storm::builder::BuilderType::Jit);
         }
-    } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitIMCASet()) {
+    } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitBinarySet() || ioSettings.isExplicitIMCASet()) {
         STORM_LOG_THROW(mpi.engine == storm::utility::Engine::Sparse, storm::exceptions::InvalidSettingsException,
                         "Can only use sparse engine with explicit input.");
         result = buildModelExplicit<ValueType>(ioSettings, buildSettings);
@@ -620,6 +637,9 @@ void exportSparseModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>
                                                    input.model ? input.model.get().getParameterNames() : std::vector<std::string>(),
                                                    !ioSettings.isExplicitExportPlaceholdersDisabled());
                 break;
+            case storm::exporter::ModelExportFormat::Drb:
+                storm::api::exportSparseModelAsBinary(model, ioSettings.getExportBuildFilename());
+                break;
             case storm::exporter::ModelExportFormat::Json:
                 storm::api::exportSparseModelAsJson(model, ioSettings.getExportBuildFilename());
                 break;
@@ -1094,6 +1114,19 @@ void verifyWithExplorationEngine(SymbolicInput const& input, ModelProcessingInfo
         });
 }
 
+template<typename ValueType>
+void verifyWithStatisticalEngine(SymbolicInput const& input, ModelProcessingInformation const& mpi) {
+    STORM_LOG_ASSERT(input.model, "Expected symbolic model description.");
+    STORM_LOG_THROW((std::is_same<ValueType, double>::value), storm::exceptions::NotSupportedException,
+                    "Statistical model checking does not support other data-types than floating points.");
+    verifyProperties<ValueType>(
+        input, [&input, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+            STORM_LOG_THROW(states->isInitialFormula(), storm::exceptions::NotSupportedException,
+                            "Statistical model checking can only filter initial states.");
+            return storm::api::verifyWithStatisticalEngine<ValueType>(mpi.env, input.model.get(), storm::api::createTask<ValueType>(formula, true));
+        });
+}
+
 template<typename ValueType>
 void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
     auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
@@ -1320,6 +1353,8 @@ void processInputWithValueTypeAndDdlib(SymbolicInput const& input, ModelProcessi
         verifyWithAbstractionRefinementEngine<DdType, VerificationValueType>(input, mpi);
     } else if (mpi.engine == storm::utility::Engine::Exploration) {
         verifyWithExplorationEngine<VerificationValueType>(input, mpi);
+    } else if (mpi.engine == storm::utility::Engine::Statistical) {
+        verifyWithStatisticalEngine<VerificationValueType>(input, mpi);
     } else {
         std::shared_ptr<storm::models::ModelBase> model =
             buildPreprocessExportModelWithValueTypeAndDdlib<DdType, BuildValueType, VerificationValueType>(input, mpi);
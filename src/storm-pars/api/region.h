@@ -8,6 +8,7 @@
 
 #include "storm-pars/modelchecker/results/RegionCheckResult.h"
 #include "storm-pars/modelchecker/results/RegionRefinementCheckResult.h"
+#include "storm-pars/modelchecker/region/ParallelRegionRefinement.h"
 #include "storm-pars/modelchecker/region/RegionCheckEngine.h"
 #include "storm-pars/modelchecker/region/SparseDtmcParameterLiftingModelChecker.h"
 #include "storm-pars/modelchecker/region/SparseMdpParameterLiftingModelChecker.h"
@@ -20,6 +21,7 @@
 #include "storm-pars/utility/parameterlifting.h"
 
 #include "storm/environment/Environment.h"
+#include "storm/environment/ParallelEnvironment.h"
 
 #include "storm/api/transformation.h"
 #include "storm/io/file.h"
@@ -209,6 +211,10 @@ namespace storm {
         template <typename ValueType>
         std::unique_ptr<storm::modelchecker::RegionCheckResult<ValueType>> checkRegionsWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::vector<storm::storage::ParameterRegion<ValueType>> const& regions, storm::modelchecker::RegionCheckEngine engine, std::vector<storm::modelchecker::RegionResultHypothesis> const& hypotheses, bool sampleVerticesOfRegions) {
             Environment env;
+            if (env.parallel().isParallel() && regions.size() > 1) {
+                storm::modelchecker::ParallelRegionRefinement<ValueType> parallelRefinement([&]() { return initializeRegionModelChecker(env, model, task, engine); }, std::min<uint64_t>(env.parallel().getNumberOfThreads(), regions.size()));
+                return parallelRefinement.analyzeRegions(env, regions, hypotheses, sampleVerticesOfRegions);
+            }
             auto regionChecker = initializeRegionModelChecker(env, model, task, engine);
             return regionChecker->analyzeRegions(env, regions, hypotheses, sampleVerticesOfRegions);
         }
@@ -228,10 +234,16 @@ namespace storm {
          * @param allowModelSimplification
          * @param useMonotonicity
          * @param monThresh if given, determines at which depth to start using monotonicity
+         *
+         * If more than one thread is used (and monotonicity is not), the regions are analyzed in parallel, where each thread owns a region model checker.
          */
         template <typename ValueType>
         std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> checkAndRefineRegionWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, storm::storage::ParameterRegion<ValueType> const& region, storm::modelchecker::RegionCheckEngine engine, boost::optional<ValueType> const& coverageThreshold, boost::optional<uint64_t> const& refinementDepthThreshold = boost::none, storm::modelchecker::RegionResultHypothesis hypothesis = storm::modelchecker::RegionResultHypothesis::Unknown, bool allowModelSimplification = true, MonotonicitySetting monotonicitySetting = MonotonicitySetting(), uint64_t monThresh = 0) {
             Environment env;
+            if (env.parallel().isParallel() && !monotonicitySetting.useMonotonicity) {
+                storm::modelchecker::ParallelRegionRefinement<ValueType> parallelRefinement([&]() { return initializeRegionModelChecker(env, model, task, engine, true, allowModelSimplification, monotonicitySetting); }, env.parallel().getNumberOfThreads());
+                return parallelRefinement.performRegionRefinement(env, region, coverageThreshold, refinementDepthThreshold, hypothesis);
+            }
             auto regionChecker = initializeRegionModelChecker(env, model, task, engine, true, allowModelSimplification, monotonicitySetting);
             return regionChecker->performRegionRefinement(env, region, coverageThreshold, refinementDepthThreshold, hypothesis, monThresh);
         }
@@ -63,9 +63,24 @@ namespace storm {
             instantiationWatch.start();
 
             // Write results into the placeholders
-            for(auto& functionResult : this->functions) {
-                functionResult.second=storm::utility::convertNumber<ConstantType>(
-                        storm::utility::parametric::evaluate(functionResult.first, valuation));
+            if constexpr (std::is_same<ConstantType, double>::value) {
+                if (!compiledFunctions) {
+                    std::vector<FunctionType> occurringFunctions;
+                    for (auto& functionResult : this->functions) {
+                        occurringFunctions.push_back(functionResult.first);
+                        compiledPlaceholders.push_back(&functionResult.second);
+                    }
+                    compiledFunctions = utility::parametric::CompiledRationalFunctions(occurringFunctions);
+                }
+                compiledFunctions->evaluate(valuation, compiledResults);
+                for (uint_fast64_t i = 0; i < compiledPlaceholders.size(); ++i) {
+                    *compiledPlaceholders[i] = compiledResults[i];
+                }
+            } else {
+                for(auto& functionResult : this->functions) {
+                    functionResult.second=storm::utility::convertNumber<ConstantType>(
+                            storm::utility::parametric::evaluate(functionResult.first, valuation));
+                }
             }
 
             auto deltaConstrainedMatrixInstantiated = deltaConstrainedMatricesInstantiated->at(parameter);
@@ -107,6 +122,9 @@ namespace storm {
                 Environment const& env, 
                 modelchecker::CheckTask<storm::logic::Formula, FunctionType> const& checkTask)  {
             this->currentFormula = checkTask.getFormula().asSharedPointer();
+            // The occurring functions might change, so they are compiled again upon the next check
+            this->compiledFunctions = boost::none;
+            this->compiledPlaceholders.clear();
             this->currentCheckTask = std::make_unique<storm::modelchecker::CheckTask<storm::logic::Formula, FunctionType>>(checkTask.substituteFormula(*currentFormula).template convertValueType<FunctionType>());
             this->parameters = storm::models::sparse::getProbabilityParameters(model);
             if (checkTask.getFormula().isRewardOperatorFormula()) {
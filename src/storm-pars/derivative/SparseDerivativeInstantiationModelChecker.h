@@ -6,6 +6,7 @@
 #include "logic/Formula.h"
 #include "modelchecker/CheckTask.h"
 #include "solver/LinearEquationSolver.h"
+#include "storm-pars/utility/CompiledRationalFunctions.h"
 #include "storm-pars/utility/parametric.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/utility/Stopwatch.h"
@@ -52,6 +53,10 @@ namespace storm {
             std::map<typename utility::parametric::VariableType<FunctionType>::type, std::unique_ptr<storm::solver::LinearEquationSolver<ConstantType>>> linearEquationSolvers;
             std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>> matrixMapping; 
             std::unordered_map<FunctionType, ConstantType> functions; 
+            // For instantiations with doubles, the functions are compiled upon the first check and evaluated all at once
+            boost::optional<utility::parametric::CompiledRationalFunctions> compiledFunctions;
+            std::vector<ConstantType*> compiledPlaceholders;
+            std::vector<double> compiledResults;
             storage::SparseMatrix<FunctionType> constrainedMatrixEquationSystem;
             storage::SparseMatrix<ConstantType> constrainedMatrixInstantiated;
             std::unique_ptr<std::map<typename utility::parametric::VariableType<FunctionType>::type, storage::SparseMatrix<FunctionType>>> deltaConstrainedMatrices;
@@ -1,21 +1,45 @@
 #include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
 
+#include <algorithm>
+#include <type_traits>
+#include <unordered_map>
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/logic/FragmentSpecification.h"
+#include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/graph.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/InvalidStateException.h"
+#include "storm/exceptions/NotSupportedException.h"
 namespace storm {
     namespace modelchecker {
+
+        namespace {
+            // The number of valuations whose equation systems are solved together.
+            uint64_t const valuationsPerBatch = 64;
+        }
         
         template <typename SparseModelType, typename ConstantType>
-        SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::SparseDtmcInstantiationModelChecker(SparseModelType const& parametricModel) : SparseInstantiationModelChecker<SparseModelType, ConstantType>(parametricModel), modelInstantiator(parametricModel) {
+        SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::SparseDtmcInstantiationModelChecker(SparseModelType const& parametricModel) : SparseInstantiationModelChecker<SparseModelType, ConstantType>(parametricModel), modelInstantiator(parametricModel), batchDataInitialized(false) {
             //Intentionally left empty
         }
 
+        template <typename SparseModelType, typename ConstantType>
+        void SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::specifyFormula(CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask) {
+            SparseInstantiationModelChecker<SparseModelType, ConstantType>::specifyFormula(checkTask);
+            batchData = boost::none;
+            batchDataInitialized = false;
+        }
+
         template <typename SparseModelType, typename ConstantType>
         std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) {
             STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
@@ -162,6 +186,287 @@ namespace storm {
             return result;
         }
         
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<std::vector<ConstantType>> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) {
+            STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
+            std::vector<std::vector<ConstantType>> results(valuations.size());
+
+            // The transition functions can only be evaluated with doubles
+            if constexpr (std::is_same<ConstantType, double>::value) {
+                if (!batchDataInitialized) {
+                    if (!initializeBatchData(env)) {
+                        STORM_LOG_INFO("The formula " << this->currentCheckTask->getFormula() << " is not supported for batch checking. The valuations are checked one after another.");
+                    }
+                    batchDataInitialized = true;
+                }
+            }
+            if (!batchData) {
+                for (uint64_t valuation = 0; valuation < valuations.size(); ++valuation) {
+                    results[valuation] = checkIndividually(env, valuations[valuation]);
+                }
+                return results;
+            }
+
+            if constexpr (std::is_same<ConstantType, double>::value) {
+                auto const& variables = batchData->functions.getVariables();
+                std::vector<double> points, functionValues, x;
+                for (uint64_t firstValuation = 0; firstValuation < valuations.size(); firstValuation += valuationsPerBatch) {
+                    uint64_t const numberOfValuations = std::min<uint64_t>(valuationsPerBatch, valuations.size() - firstValuation);
+                    points.resize(variables.size() * numberOfValuations);
+                    for (uint64_t variableIndex = 0; variableIndex < variables.size(); ++variableIndex) {
+                        for (uint64_t valuation = 0; valuation < numberOfValuations; ++valuation) {
+                            auto const& currentValuation = valuations[firstValuation + valuation];
+                            auto valuationIt = currentValuation.find(variables[variableIndex]);
+                            STORM_LOG_THROW(valuationIt != currentValuation.end(), storm::exceptions::InvalidArgumentException, "The valuation does not assign a value to parameter " << variables[variableIndex] << ".");
+                            points[variableIndex * numberOfValuations + valuation] = storm::utility::convertNumber<double>(valuationIt->second);
+                        }
+                    }
+                    batchData->functions.evaluateBatch(points, numberOfValuations, functionValues);
+
+                    // Determine the valuations that preserve the graph structure, i.e., for which all transition functions are positive
+                    storm::storage::BitVector graphPreserving(numberOfValuations, true);
+                    for (uint64_t function = 0; function < batchData->numberOfTransitionFunctions; ++function) {
+                        for (uint64_t valuation = 0; valuation < numberOfValuations; ++valuation) {
+                            if (!(functionValues[function * numberOfValuations + valuation] > 0.0)) {
+                                graphPreserving.set(valuation, false);
+                            }
+                        }
+                    }
+                    if (!graphPreserving.empty()) {
+                        // The remaining valuations get the function values of a graph preserving valuation so that they do not disturb the iterations.
+                        uint64_t const representative = *graphPreserving.begin();
+                        for (auto valuation : ~graphPreserving) {
+                            for (uint64_t function = 0; function < batchData->functions.getNumberOfFunctions(); ++function) {
+                                functionValues[function * numberOfValuations + valuation] = functionValues[function * numberOfValuations + representative];
+                            }
+                        }
+                        solveBatch(env, functionValues, numberOfValuations, x);
+                    }
+
+                    for (uint64_t valuation = 0; valuation < numberOfValuations; ++valuation) {
+                        auto& result = results[firstValuation + valuation];
+                        if (graphPreserving.get(valuation)) {
+                            result = batchData->resultsForNonMaybeStates;
+                            for (auto const& state : batchData->maybeStates) {
+                                result[state] = x[batchData->maybeStateIndices[state] * numberOfValuations + valuation];
+                            }
+                        } else {
+                            STORM_LOG_INFO("Valuation #" << (firstValuation + valuation) << " does not preserve the graph structure and is checked individually.");
+                            result = checkIndividually(env, valuations[firstValuation + valuation]);
+                        }
+                    }
+                }
+            }
+            return results;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        bool SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::initializeBatchData(Environment const& env) {
+            typedef typename SparseModelType::ValueType ParametricType;
+            auto const& formula = this->currentCheckTask->getFormula();
+            if (!formula.isProbabilityOperatorFormula() && !formula.isRewardOperatorFormula()) {
+                return false;
+            }
+            auto const& subformula = formula.asOperatorFormula().getSubformula();
+            auto const& transitionMatrix = this->parametricModel.getTransitionMatrix();
+            uint64_t const numberOfStates = this->parametricModel.getNumberOfStates();
+            storm::modelchecker::SparsePropositionalModelChecker<SparseModelType> propositionalChecker(this->parametricModel);
+
+            BatchData data;
+            storm::storage::BitVector targetStates;
+            // The states with probability one (only for probabilities)
+            storm::storage::BitVector oneStates(numberOfStates, false);
+            std::vector<ParametricType> rewardVector;
+            if (formula.isProbabilityOperatorFormula()) {
+                storm::storage::BitVector phiStates(numberOfStates, true);
+                if (subformula.isUntilFormula()) {
+                    auto const& untilFormula = subformula.asUntilFormula();
+                    if (!propositionalChecker.canHandle(untilFormula.getLeftSubformula()) || !propositionalChecker.canHandle(untilFormula.getRightSubformula())) {
+                        return false;
+                    }
+                    phiStates = std::move(propositionalChecker.check(untilFormula.getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector());
+                    targetStates = std::move(propositionalChecker.check(untilFormula.getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector());
+                } else if (subformula.isEventuallyFormula()) {
+                    if (!propositionalChecker.canHandle(subformula.asEventuallyFormula().getSubformula())) {
+                        return false;
+                    }
+                    targetStates = std::move(propositionalChecker.check(subformula.asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector());
+                } else {
+                    return false;
+                }
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 = storm::utility::graph::performProb01(this->parametricModel.getBackwardTransitions(), phiStates, targetStates);
+                data.maybeStates = ~(statesWithProbability01.first | statesWithProbability01.second);
+                oneStates = std::move(statesWithProbability01.second);
+                data.resultsForNonMaybeStates = std::vector<ConstantType>(numberOfStates, storm::utility::zero<ConstantType>());
+                storm::utility::vector::setVectorValues(data.resultsForNonMaybeStates, oneStates, storm::utility::one<ConstantType>());
+            } else {
+                auto const& rewardOperatorFormula = formula.asRewardOperatorFormula();
+                if (rewardOperatorFormula.getMeasureType() != storm::logic::RewardMeasureType::Expectation || !subformula.isReachabilityRewardFormula() || !propositionalChecker.canHandle(subformula.asEventuallyFormula().getSubformula())) {
+                    return false;
+                }
+                STORM_LOG_THROW((this->currentCheckTask->isRewardModelSet() && this->parametricModel.hasRewardModel(this->currentCheckTask->getRewardModel())) || (!this->currentCheckTask->isRewardModelSet() && this->parametricModel.hasUniqueRewardModel()), storm::exceptions::InvalidPropertyException, "The reward model specified by the CheckTask is not available in the given model.");
+                auto const& rewardModel = this->currentCheckTask->isRewardModelSet() ? this->parametricModel.getRewardModel(this->currentCheckTask->getRewardModel()) : this->parametricModel.getUniqueRewardModel();
+                rewardVector = rewardModel.getTotalRewardVector(transitionMatrix);
+
+                targetStates = std::move(propositionalChecker.check(subformula.asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector());
+                storm::storage::BitVector infinityStates = storm::utility::graph::performProb1(this->parametricModel.getBackwardTransitions(), storm::storage::BitVector(numberOfStates, true), targetStates);
+                infinityStates.complement();
+                data.maybeStates = ~(targetStates | infinityStates);
+                data.resultsForNonMaybeStates = std::vector<ConstantType>(numberOfStates, storm::utility::zero<ConstantType>());
+                storm::utility::vector::setVectorValues(data.resultsForNonMaybeStates, infinityStates, storm::utility::infinity<ConstantType>());
+            }
+
+            // Gather the distinct functions. The graph analysis remains valid as long as the transition functions of all non-target states are positive.
+            std::unordered_map<ParametricType, uint64_t> functionIndices;
+            std::vector<ParametricType> functions;
+            auto getFunctionIndex = [&functionIndices, &functions](ParametricType const& function) {
+                auto insertionRes = functionIndices.emplace(function, functions.size());
+                if (insertionRes.second) {
+                    functions.push_back(function);
+                }
+                return insertionRes.first->second;
+            };
+            for (auto const& state : ~targetStates) {
+                for (auto const& entry : transitionMatrix.getRow(state)) {
+                    getFunctionIndex(entry.getValue());
+                }
+            }
+            data.numberOfTransitionFunctions = functions.size();
+
+            // Build the equation systems of the maybe states
+            data.maybeStateIndices = std::vector<uint64_t>(numberOfStates, 0);
+            uint64_t maybeStateIndex = 0;
+            for (auto const& state : data.maybeStates) {
+                data.maybeStateIndices[state] = maybeStateIndex++;
+            }
+            data.rowIndications.push_back(0);
+            data.offsetIndications.push_back(0);
+            for (auto const& state : data.maybeStates) {
+                for (auto const& entry : transitionMatrix.getRow(state)) {
+                    if (data.maybeStates.get(entry.getColumn())) {
+                        data.entryTargets.push_back(data.maybeStateIndices[entry.getColumn()]);
+                        data.entryFunctions.push_back(getFunctionIndex(entry.getValue()));
+                    } else if (oneStates.get(entry.getColumn())) {
+                        data.offsetFunctions.push_back(getFunctionIndex(entry.getValue()));
+                    }
+                }
+                if (!rewardVector.empty() && !storm::utility::isZero(rewardVector[state])) {
+                    data.offsetFunctions.push_back(getFunctionIndex(rewardVector[state]));
+                }
+                data.rowIndications.push_back(data.entryTargets.size());
+                data.offsetIndications.push_back(data.offsetFunctions.size());
+            }
+
+            // Sort the maybe states topologically w.r.t. their SCCs
+            storm::storage::StronglyConnectedComponentDecomposition<ParametricType> sccDecomposition(env, transitionMatrix.getSubmatrix(false, data.maybeStates, data.maybeStates), storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort());
+            data.sccIndications.push_back(0);
+            for (auto const& scc : sccDecomposition) {
+                data.sccStates.insert(data.sccStates.end(), scc.begin(), scc.end());
+                data.sccIndications.push_back(data.sccStates.size());
+            }
+
+            data.functions = storm::utility::parametric::CompiledRationalFunctions(functions);
+            STORM_LOG_INFO("Prepared batch checking with " << data.maybeStates.getNumberOfSetBits() << " maybe states, " << sccDecomposition.size() << " SCCs and " << functions.size() << " distinct functions.");
+            batchData = std::move(data);
+            return true;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        void SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::solveBatch(Environment const& env, std::vector<double> const& functionValues, uint64_t numberOfValuations, std::vector<double>& x) const {
+            BatchData const& data = *batchData;
+            uint64_t const numberOfMaybeStates = data.rowIndications.size() - 1;
+            double const precision = storm::utility::convertNumber<double>(env.solver().native().getPrecision());
+            bool const relative = env.solver().native().getRelativeTerminationCriterion();
+            uint64_t const maxIterations = env.solver().native().getMaximalNumberOfIterations();
+
+            // The values of the i-th state (or function) for all valuations are stored consecutively
+            std::vector<double> offsets(numberOfMaybeStates * numberOfValuations, 0.0);
+            for (uint64_t state = 0; state < numberOfMaybeStates; ++state) {
+                double* stateOffsets = offsets.data() + state * numberOfValuations;
+                for (uint64_t offset = data.offsetIndications[state]; offset < data.offsetIndications[state + 1]; ++offset) {
+                    double const* values = functionValues.data() + data.offsetFunctions[offset] * numberOfValuations;
+                    for (uint64_t valuation = 0; valuation < numberOfValuations; ++valuation) {
+                        stateOffsets[valuation] += values[valuation];
+                    }
+                }
+            }
+            x.assign(numberOfMaybeStates * numberOfValuations, 0.0);
+
+            // Updates the values of the given state for all valuations and returns true if no value changed (w.r.t. the precision).
+            // Self-loops are eliminated, i.e., we compute x_s = (b_s + sum_{t != s} A_st * x_t) / (1 - A_ss).
+            std::vector<double> newValues(numberOfValuations), selfLoops(numberOfValuations);
+            auto updateState = [&](uint64_t state) {
+                std::copy(offsets.begin() + state * numberOfValuations, offsets.begin() + (state + 1) * numberOfValuations, newValues.begin());
+                std::fill(selfLoops.begin(), selfLoops.end(), 0.0);
+                for (uint64_t entry = data.rowIndications[state]; entry < data.rowIndications[state + 1]; ++entry) {
+                    double const* values = functionValues.data() + data.entryFunctions[entry] * numberOfValuations;
+                    uint64_t const target = data.entryTargets[entry];
+                    if (target == state) {
+                        for (uint64_t valuation = 0; valuation < numberOfValuations; ++valuation) {
+                            selfLoops[valuation] += values[valuation];
+                        }
+                    } else {
+                        double const* targetValues = x.data() + target * numberOfValuations;
+                        for (uint64_t valuation = 0; valuation < numberOfValuations; ++valuation) {
+                            newValues[valuation] += values[valuation] * targetValues[valuation];
+                        }
+                    }
+                }
+                double* stateValues = x.data() + state * numberOfValuations;
+                bool converged = true;
+                for (uint64_t valuation = 0; valuation < numberOfValuations; ++valuation) {
+                    double newValue = newValues[valuation] / (1.0 - selfLoops[valuation]);
+                    converged = converged && storm::utility::vector::equalModuloPrecision(stateValues[valuation], newValue, precision, relative);
+                    stateValues[valuation] = newValue;
+                }
+                return converged;
+            };
+
+            // Solve the SCCs one after another. As successor SCCs come first, the values of their states are already final.
+            for (uint64_t scc = 0; scc + 1 < data.sccIndications.size(); ++scc) {
+                auto const sccBegin = data.sccStates.begin() + data.sccIndications[scc];
+                auto const sccEnd = data.sccStates.begin() + data.sccIndications[scc + 1];
+                if (sccEnd - sccBegin == 1) {
+                    // Trivial SCCs are solved directly
+                    updateState(*sccBegin);
+                    continue;
+                }
+                bool converged = false;
+                uint64_t iterations = 0;
+                while (!converged && iterations < maxIterations) {
+                    converged = true;
+                    for (auto stateIt = sccBegin; stateIt != sccEnd; ++stateIt) {
+                        converged = updateState(*stateIt) && converged;
+                    }
+                    ++iterations;
+                }
+                STORM_LOG_WARN_COND(converged, "Iterations for an SCC with " << (sccEnd - sccBegin) << " states did not converge within " << maxIterations << " iterations.");
+            }
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<ConstantType> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkIndividually(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) {
+            auto const& instantiatedModel = modelInstantiator.instantiate(valuation);
+            STORM_LOG_THROW(instantiatedModel.getTransitionMatrix().isProbabilistic(), storm::exceptions::InvalidArgumentException, "Instantiation point is invalid as the transition matrix becomes non-stochastic.");
+            storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>> modelChecker(instantiatedModel);
+
+            auto const& formula = this->currentCheckTask->getFormula();
+            std::unique_ptr<CheckResult> result;
+            if (formula.isProbabilityOperatorFormula()) {
+                auto newCheckTask = this->currentCheckTask->substituteFormula(formula.asOperatorFormula().getSubformula()).setOnlyInitialStatesRelevant(false);
+                result = modelChecker.computeProbabilities(env, newCheckTask);
+            } else if (formula.isRewardOperatorFormula()) {
+                auto newCheckTask = this->currentCheckTask->substituteFormula(formula.asOperatorFormula().getSubformula()).setOnlyInitialStatesRelevant(false);
+                result = modelChecker.computeRewards(env, formula.asRewardOperatorFormula().getMeasureType(), newCheckTask);
+            } else {
+                auto newCheckTask = *this->currentCheckTask;
+                newCheckTask.setOnlyInitialStatesRelevant(false);
+                result = modelChecker.check(env, newCheckTask);
+            }
+            STORM_LOG_THROW(result->isExplicitQuantitativeCheckResult(), storm::exceptions::NotSupportedException, "Checking a batch of valuations requires a formula with a quantitative result.");
+            return std::move(result->template asExplicitQuantitativeCheckResult<ConstantType>().getValueVector());
+        }
+
         template class SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double>;
         template class SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::RationalNumber>;
 
@@ -1,10 +1,13 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 #include <boost/optional.hpp>
 
 #include "storm-pars/modelchecker/instantiation/SparseInstantiationModelChecker.h"
+#include "storm-pars/utility/CompiledRationalFunctions.h"
 #include "storm-pars/utility/ModelInstantiator.h"
+#include "storm/storage/BitVector.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
@@ -20,8 +23,21 @@ namespace storm {
         public:
             SparseDtmcInstantiationModelChecker(SparseModelType const& parametricModel);
             
+            virtual void specifyFormula(CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask) override;
+
             virtual std::unique_ptr<CheckResult> check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) override;
 
+            /*!
+             * Checks the specified formula for all given valuations and returns, for each valuation, the values of all states.
+             * For formulas with a bound, the values of the subformula are returned.
+             *
+             * For (unbounded) reachability probabilities and expected reachability rewards, the graph analysis and the SCC decomposition are performed only once.
+             * The transition functions are then compiled and evaluated for a batch of valuations at once, and the equation systems of the batch
+             * are solved together (SCC by SCC with Gauss-Seidel iterations), where each pass over the shared matrix structure updates the values of all valuations.
+             * Valuations that do not preserve the graph structure (i.e., a transition function is not positive) and other formulas are checked one after another.
+             */
+            std::vector<std::vector<ConstantType>> checkBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations);
+
         protected:
             
             // Optimizations for the different formula types
@@ -30,6 +46,53 @@ namespace storm {
             std::unique_ptr<CheckResult> checkBoundedUntilFormula(Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
             
             storm::utility::ModelInstantiator<SparseModelType, storm::models::sparse::Dtmc<ConstantType>> modelInstantiator;
+
+        private:
+            /*!
+             * The data for checking batches of valuations that only depends on the model and the formula.
+             */
+            struct BatchData {
+                // The states whose values are obtained by solving the equation systems and their index within the equation systems
+                storm::storage::BitVector maybeStates;
+                std::vector<uint64_t> maybeStateIndices;
+                // The values of all states that are not maybe states
+                std::vector<ConstantType> resultsForNonMaybeStates;
+
+                // The distinct functions that occur in the considered part of the model: First the transition functions (which need to be positive), then the rewards
+                storm::utility::parametric::CompiledRationalFunctions functions;
+                uint64_t numberOfTransitionFunctions;
+
+                // The transitions between maybe states, given row by row by the target (index) and the index of the function
+                std::vector<uint64_t> rowIndications;
+                std::vector<uint64_t> entryTargets;
+                std::vector<uint64_t> entryFunctions;
+                // The functions that contribute to the constant part of the equation system of each maybe state (transitions to states with probability one or the reward)
+                std::vector<uint64_t> offsetIndications;
+                std::vector<uint64_t> offsetFunctions;
+
+                // The SCCs of the maybe states (given by their indices) such that successor SCCs come first
+                std::vector<uint64_t> sccIndications;
+                std::vector<uint64_t> sccStates;
+            };
+
+            /*!
+             * Initializes the batch data for the current formula. Returns false if the formula is not supported.
+             */
+            bool initializeBatchData(Environment const& env);
+
+            /*!
+             * Solves the equation systems for the given values of the functions (stored function by function) of the given number of valuations.
+             * @param x the solutions (stored state by state) are written to this vector
+             */
+            void solveBatch(Environment const& env, std::vector<double> const& functionValues, uint64_t numberOfValuations, std::vector<double>& x) const;
+
+            /*!
+             * Computes the values of all states (of the subformula, if the formula has a bound) for a single valuation.
+             */
+            std::vector<ConstantType> checkIndividually(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation);
+
+            boost::optional<BatchData> batchData;
+            bool batchDataInitialized;
         };
     }
 }
@@ -0,0 +1,168 @@
+#include <atomic>
+#include <deque>
+
+#include "storm-pars/modelchecker/region/ParallelRegionRefinement.h"
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/utility/parallel.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace modelchecker {
+
+        namespace {
+            // The number of regions per worker that are analyzed in one round of the refinement.
+            uint64_t const regionsPerWorkerAndRound = 8;
+        }
+
+        template <typename ParametricType>
+        ParallelRegionRefinement<ParametricType>::ParallelRegionRefinement(CheckerFactory const& checkerFactory, uint64_t numberOfWorkers) {
+            STORM_LOG_THROW(numberOfWorkers > 0, storm::exceptions::InvalidArgumentException, "At least one worker is needed.");
+            // The checkers are created one after another as specifying a checker is not necessarily thread safe.
+            for (uint64_t worker = 0; worker < numberOfWorkers; ++worker) {
+                checkers.push_back(checkerFactory());
+                STORM_LOG_THROW(checkers.back() != nullptr, storm::exceptions::InvalidArgumentException, "Unable to create a region model checker.");
+                STORM_LOG_THROW(!checkers.back()->isUseMonotonicitySet(), storm::exceptions::InvalidArgumentException, "Parallel region refinement does not support monotonicity.");
+            }
+        }
+
+        template <typename ParametricType>
+        std::unique_ptr<storm::modelchecker::RegionCheckResult<ParametricType>> ParallelRegionRefinement<ParametricType>::analyzeRegions(Environment const& env, std::vector<storm::storage::ParameterRegion<ParametricType>> const& regions, std::vector<RegionResultHypothesis> const& hypotheses, bool sampleVerticesOfRegion) {
+            STORM_LOG_THROW(regions.size() == hypotheses.size(), storm::exceptions::InvalidArgumentException, "The number of regions and the number of hypotheses do not match");
+            std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, storm::modelchecker::RegionResult>> result;
+            for (auto const& region : regions) {
+                result.emplace_back(region, RegionResult::Unknown);
+            }
+            std::vector<RegionResult> regionResults = analyzeInParallel(env, result, hypotheses, sampleVerticesOfRegion);
+            for (uint64_t i = 0; i < result.size(); ++i) {
+                result[i].second = regionResults[i];
+            }
+            return std::make_unique<storm::modelchecker::RegionCheckResult<ParametricType>>(std::move(result));
+        }
+
+        template <typename ParametricType>
+        std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> ParallelRegionRefinement<ParametricType>::performRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold, RegionResultHypothesis const& hypothesis) {
+            STORM_LOG_INFO("Applying parallel refinement with " << checkers.size() << " workers on region: " << region.toString(true) << " .");
+
+            auto thresholdAsCoefficient = coverageThreshold ? storm::utility::convertNumber<CoefficientType>(coverageThreshold.get()) : storm::utility::zero<CoefficientType>();
+            auto areaOfParameterSpace = region.area();
+            auto fractionOfUndiscoveredArea = storm::utility::one<CoefficientType>();
+
+            // The resulting (sub-)regions
+            std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> result;
+
+            // The queue of regions that we still need to process (together with their refinement depths).
+            // It is processed in the same (breadth-first) order as the sequential refinement.
+            std::deque<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> unprocessedRegions;
+            std::deque<uint64_t> refinementDepths;
+            unprocessedRegions.emplace_back(region, RegionResult::Unknown);
+            refinementDepths.push_back(0);
+
+            uint_fast64_t numOfAnalyzedRegions = 0;
+            uint_fast64_t numOfRounds = 0;
+            std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> roundRegions;
+            std::vector<uint64_t> roundDepths;
+            while (fractionOfUndiscoveredArea > thresholdAsCoefficient && !unprocessedRegions.empty()) {
+                // Take the next regions from the queue and analyze them in parallel.
+                uint64_t roundSize = std::min<uint64_t>(unprocessedRegions.size(), checkers.size() * regionsPerWorkerAndRound);
+                roundRegions.assign(std::make_move_iterator(unprocessedRegions.begin()), std::make_move_iterator(unprocessedRegions.begin() + roundSize));
+                roundDepths.assign(refinementDepths.begin(), refinementDepths.begin() + roundSize);
+                unprocessedRegions.erase(unprocessedRegions.begin(), unprocessedRegions.begin() + roundSize);
+                refinementDepths.erase(refinementDepths.begin(), refinementDepths.begin() + roundSize);
+                STORM_LOG_INFO("Analyzing " << roundSize << " regions in round #" << numOfRounds << " (" << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
+                std::vector<RegionResult> roundResults = analyzeInParallel(env, roundRegions, std::vector<RegionResultHypothesis>(roundSize, hypothesis), false);
+                ++numOfRounds;
+
+                // Merge the results in the order of the queue.
+                uint64_t index = 0;
+                for (; index < roundSize && fractionOfUndiscoveredArea > thresholdAsCoefficient; ++index) {
+                    auto& currentRegion = roundRegions[index].first;
+                    auto& res = roundRegions[index].second;
+                    uint64_t currentDepth = roundDepths[index];
+                    res = roundResults[index];
+                    switch (res) {
+                        case RegionResult::AllSat:
+                        case RegionResult::AllViolated:
+                            fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
+                            result.push_back(std::move(roundRegions[index]));
+                            break;
+                        default:
+                            // Split the region as long as the desired refinement depth is not reached.
+                            if (!depthThreshold || currentDepth < depthThreshold.get()) {
+                                std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
+                                RegionResult initResForNewRegions = (res == RegionResult::CenterSat) ? RegionResult::ExistsSat :
+                                                                    ((res == RegionResult::CenterViolated) ? RegionResult::ExistsViolated :
+                                                                     RegionResult::Unknown);
+                                currentRegion.split(currentRegion.getCenterPoint(), newRegions);
+                                for (auto& newRegion : newRegions) {
+                                    unprocessedRegions.emplace_back(std::move(newRegion), initResForNewRegions);
+                                    refinementDepths.push_back(currentDepth + 1);
+                                }
+                            } else {
+                                // If the region is not further refined, it is still added to the result
+                                result.push_back(std::move(roundRegions[index]));
+                            }
+                            break;
+                    }
+                    ++numOfAnalyzedRegions;
+                }
+
+                // If the coverage was reached within this round, the results of the remaining regions are discarded such that they are treated as in the sequential refinement.
+                for (uint64_t remaining = roundSize; remaining > index; --remaining) {
+                    unprocessedRegions.push_front(std::move(roundRegions[remaining - 1]));
+                    refinementDepths.push_front(roundDepths[remaining - 1]);
+                }
+            }
+
+            // Add the still unprocessed regions to the result
+            for (auto& unprocessedRegion : unprocessedRegions) {
+                result.push_back(std::move(unprocessedRegion));
+            }
+
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                STORM_PRINT_AND_LOG("Region Refinement Statistics:\n");
+                STORM_PRINT_AND_LOG("    Analyzed a total of " << numOfAnalyzedRegions << " regions in " << numOfRounds << " rounds with " << checkers.size() << " workers.\n");
+            }
+
+            auto regionCopyForResult = region;
+            return std::make_unique<storm::modelchecker::RegionRefinementCheckResult<ParametricType>>(std::move(result), std::move(regionCopyForResult));
+        }
+
+        template <typename ParametricType>
+        std::vector<RegionResult> ParallelRegionRefinement<ParametricType>::analyzeInParallel(Environment const& env, std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> const& regions, std::vector<RegionResultHypothesis> const& hypotheses, bool sampleVerticesOfRegion) {
+            std::vector<RegionResult> results(regions.size(), RegionResult::Unknown);
+            if (regions.empty()) {
+                return results;
+            }
+            std::atomic<uint64_t> nextRegion(0);
+            auto runWorker = [&](uint64_t worker) {
+                for (uint64_t index = nextRegion++; index < regions.size(); index = nextRegion++) {
+                    results[index] = checkers[worker]->analyzeRegion(env, regions[index].first, hypotheses[index], regions[index].second, sampleVerticesOfRegion);
+                }
+            };
+#ifdef STORM_HAVE_INTELTBB
+            uint64_t numberOfWorkers = std::min<uint64_t>(checkers.size(), regions.size());
+            storm::utility::parallel::executeWithThreadLimit(numberOfWorkers, [&]() {
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfWorkers, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                    for (uint64_t worker = range.begin(); worker < range.end(); ++worker) {
+                        runWorker(worker);
+                    }
+                });
+            });
+#else
+            runWorker(0);
+#endif
+            return results;
+        }
+
+#ifdef STORM_HAVE_CARL
+        template class ParallelRegionRefinement<storm::RationalFunction>;
+#endif
+    } //namespace modelchecker
+} //namespace storm
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm-pars/modelchecker/region/RegionModelChecker.h"
+#include "storm-pars/modelchecker/region/RegionResult.h"
+#include "storm-pars/modelchecker/region/RegionResultHypothesis.h"
+#include "storm-pars/modelchecker/results/RegionCheckResult.h"
+#include "storm-pars/modelchecker/results/RegionRefinementCheckResult.h"
+#include "storm-pars/storage/ParameterRegion.h"
+
+namespace storm {
+
+    class Environment;
+
+    namespace modelchecker {
+
+        /*!
+         * Analyzes and refines regions with several region model checkers in parallel.
+         * Each worker owns a region model checker (and thus its own parameter lifter and solver) that is obtained from the given factory.
+         * The regions are taken from a shared queue in rounds and the results of a round are merged in the order of the queue.
+         * Hence, the result coincides with the one of RegionModelChecker::performRegionRefinement (without monotonicity) and does not depend on the number of threads.
+         */
+        template<typename ParametricType>
+        class ParallelRegionRefinement {
+        public:
+            typedef typename storm::storage::ParameterRegion<ParametricType>::CoefficientType CoefficientType;
+            typedef std::function<std::shared_ptr<RegionModelChecker<ParametricType>>()> CheckerFactory;
+
+            /*!
+             * @param checkerFactory creates a region model checker that is specified for the considered model and property
+             * @param numberOfWorkers the number of region model checkers that are used in parallel
+             */
+            ParallelRegionRefinement(CheckerFactory const& checkerFactory, uint64_t numberOfWorkers);
+
+            /*!
+             * Analyzes the given regions in parallel. The results are in the order of the given regions.
+             */
+            std::unique_ptr<storm::modelchecker::RegionCheckResult<ParametricType>> analyzeRegions(Environment const& env, std::vector<storm::storage::ParameterRegion<ParametricType>> const& regions, std::vector<RegionResultHypothesis> const& hypotheses, bool sampleVerticesOfRegion = false);
+
+            /*!
+             * Iteratively refines the region until the region analysis yields a conclusive result (AllSat or AllViolated).
+             * @param region the considered region
+             * @param coverageThreshold if given, the refinement stops as soon as the fraction of the area of the subregions with inconclusive result is less then this threshold
+             * @param depthThreshold if given, the refinement stops at the given depth. depth=0 means no refinement.
+             * @param hypothesis if not 'unknown', it is only checked whether the hypothesis holds within the given region.
+             */
+            std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> performRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold = boost::none, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown);
+
+        private:
+            /*!
+             * Analyzes the given regions, where the i-th region is analyzed with the given hypothesis and the given initial result.
+             * The workers pick the next region to analyze from a shared counter.
+             */
+            std::vector<RegionResult> analyzeInParallel(Environment const& env, std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> const& regions, std::vector<RegionResultHypothesis> const& hypotheses, bool sampleVerticesOfRegion);
+
+            std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> checkers;
+        };
+
+    } //namespace modelchecker
+} //namespace storm
@@ -1,5 +1,9 @@
 #include "storm-pars/transformer/ParameterLifter.h"
 
+#include <algorithm>
+#include <map>
+#include <type_traits>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/utility/vector.h"
 #include "storm/exceptions/UnexpectedException.h"
@@ -326,11 +330,16 @@ namespace storm {
             // insert the function and the valuation
             //Note that references to elements of an unordered map remain valid after calling unordered_map::insert.
             auto insertionRes = collectedFunctions.insert(std::pair<FunctionValuation, ConstantType>(FunctionValuation(std::move(simplifiedFunction), std::move(simplifiedValuation)), storm::utility::one<ConstantType>()));
+            functionsCompiled = false;
             return insertionRes.first->second;
         }
     
         template<typename ParametricType, typename ConstantType>
         void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
+            if (std::is_same<ConstantType, double>::value) {
+                evaluateCompiledFunctions(region, dirForUnspecifiedParameters);
+                return;
+            }
             for (auto &collectedFunctionValuationPlaceholder : collectedFunctions) {
                 ParametricType const &function = collectedFunctionValuationPlaceholder.first.first;
                 AbstractValuation const &abstrValuation = collectedFunctionValuationPlaceholder.first.second;
@@ -349,6 +358,104 @@ namespace storm {
             }
         }
         
+        template<typename ParametricType, typename ConstantType>
+        void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::compileCollectedFunctions() {
+            // Group the functions by their occurring variables
+            std::map<std::set<VariableType>, uint64_t> variablesToGroup;
+            std::vector<std::vector<ParametricType>> groupFunctions;
+            std::vector<std::unordered_map<ParametricType, uint64_t>> groupFunctionIndices;
+            std::vector<std::vector<std::pair<FunctionValuation const*, ConstantType*>>> groupPlaceholders;
+            for (auto& collectedFunctionValuationPlaceholder : collectedFunctions) {
+                ParametricType const& function = collectedFunctionValuationPlaceholder.first.first;
+                std::set<VariableType> variablesInFunction;
+                storm::utility::parametric::gatherOccurringVariables(function, variablesInFunction);
+                auto groupIt = variablesToGroup.emplace(std::move(variablesInFunction), groupFunctions.size()).first;
+                if (groupIt->second == groupFunctions.size()) {
+                    groupFunctions.emplace_back();
+                    groupFunctionIndices.emplace_back();
+                    groupPlaceholders.emplace_back();
+                }
+                if (groupFunctionIndices[groupIt->second].emplace(function, groupFunctions[groupIt->second].size()).second) {
+                    groupFunctions[groupIt->second].push_back(function);
+                }
+                groupPlaceholders[groupIt->second].emplace_back(&collectedFunctionValuationPlaceholder.first, &collectedFunctionValuationPlaceholder.second);
+            }
+
+            compiledGroups.clear();
+            compiledGroups.reserve(groupFunctions.size());
+            for (uint64_t group = 0; group < groupFunctions.size(); ++group) {
+                compiledGroups.push_back(CompiledGroup{storm::utility::parametric::CompiledRationalFunctions(groupFunctions[group]), {}, {}, {}});
+                CompiledGroup& compiledGroup = compiledGroups.back();
+                auto const& variables = compiledGroup.functions.getVariables();
+                STORM_LOG_THROW(variables.size() < 64, storm::exceptions::NotSupportedException, "Functions with " << variables.size() << " parameters are not supported.");
+                auto getVariableMask = [&variables](std::set<VariableType> const& variableSet) {
+                    uint64_t mask = 0;
+                    for (auto const& variable : variableSet) {
+                        mask |= 1ull << (std::lower_bound(variables.begin(), variables.end(), variable) - variables.begin());
+                    }
+                    return mask;
+                };
+                // The vertices of a valuation are obtained by setting some of the unspecified variables to their upper bound
+                auto forEachVertex = [&getVariableMask](AbstractValuation const& valuation, auto const& function) {
+                    uint64_t const upperVariables = getVariableMask(valuation.getUpperParameters());
+                    uint64_t const unspecifiedVariables = getVariableMask(valuation.getUnspecifiedParameters());
+                    function(upperVariables);
+                    for (uint64_t upperUnspecified = unspecifiedVariables; upperUnspecified != 0; upperUnspecified = (upperUnspecified - 1) & unspecifiedVariables) {
+                        function(upperVariables | upperUnspecified);
+                    }
+                };
+
+                // Only the vertices that are required by some valuation are evaluated
+                for (auto const& functionValuationPlaceholder : groupPlaceholders[group]) {
+                    forEachVertex(functionValuationPlaceholder.first->second, [&compiledGroup](uint64_t vertex) { compiledGroup.vertices.push_back(vertex); });
+                }
+                std::sort(compiledGroup.vertices.begin(), compiledGroup.vertices.end());
+                compiledGroup.vertices.erase(std::unique(compiledGroup.vertices.begin(), compiledGroup.vertices.end()), compiledGroup.vertices.end());
+
+                for (auto const& functionValuationPlaceholder : groupPlaceholders[group]) {
+                    FunctionValuation const& functionValuation = *functionValuationPlaceholder.first;
+                    uint64_t verticesBegin = compiledGroup.placeholderVertices.size();
+                    forEachVertex(functionValuation.second, [&compiledGroup](uint64_t vertex) {
+                        compiledGroup.placeholderVertices.push_back(std::lower_bound(compiledGroup.vertices.begin(), compiledGroup.vertices.end(), vertex) - compiledGroup.vertices.begin());
+                    });
+                    compiledGroup.placeholders.push_back({groupFunctionIndices[group].at(functionValuation.first), verticesBegin, compiledGroup.placeholderVertices.size(), functionValuationPlaceholder.second});
+                }
+            }
+            functionsCompiled = true;
+        }
+
+        template<typename ParametricType, typename ConstantType>
+        void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCompiledFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
+            if (!functionsCompiled) {
+                compileCollectedFunctions();
+            }
+            bool const minimize = storm::solver::minimize(dirForUnspecifiedParameters);
+            for (auto const& group : compiledGroups) {
+                // The i-th bit of a vertex is set iff the i-th variable is at its upper bound
+                auto const& variables = group.functions.getVariables();
+                uint64_t const numberOfVertices = group.vertices.size();
+                vertexCoordinates.resize(variables.size() * numberOfVertices);
+                for (uint64_t variableIndex = 0; variableIndex < variables.size(); ++variableIndex) {
+                    double lowerBound = storm::utility::convertNumber<double>(region.getLowerBoundary(variables[variableIndex]));
+                    double upperBound = storm::utility::convertNumber<double>(region.getUpperBoundary(variables[variableIndex]));
+                    for (uint64_t vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex) {
+                        vertexCoordinates[variableIndex * numberOfVertices + vertexIndex] = ((group.vertices[vertexIndex] >> variableIndex) & 1) ? upperBound : lowerBound;
+                    }
+                }
+                group.functions.evaluateBatch(vertexCoordinates, numberOfVertices, vertexResults);
+
+                for (auto const& compiledPlaceholder : group.placeholders) {
+                    double const* functionValues = vertexResults.data() + compiledPlaceholder.function * numberOfVertices;
+                    double value = functionValues[group.placeholderVertices[compiledPlaceholder.verticesBegin]];
+                    for (uint64_t position = compiledPlaceholder.verticesBegin + 1; position < compiledPlaceholder.verticesEnd; ++position) {
+                        double currentResult = functionValues[group.placeholderVertices[position]];
+                        value = minimize ? std::min(value, currentResult) : std::max(value, currentResult);
+                    }
+                    *compiledPlaceholder.placeholder = storm::utility::convertNumber<ConstantType>(value);
+                }
+            }
+        }
+
         template class ParameterLifter<storm::RationalFunction, double>;
         template class ParameterLifter<storm::RationalFunction, storm::RationalNumber>;
     }
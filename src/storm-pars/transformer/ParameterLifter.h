@@ -7,6 +7,7 @@
 
 
 #include "storm-pars/storage/ParameterRegion.h"
+#include "storm-pars/utility/CompiledRationalFunctions.h"
 #include "storm-pars/utility/parametric.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
@@ -150,6 +151,37 @@ namespace storm {
 
                 // Stores the collected functions with the valuations together with a placeholder for the result.
                 std::unordered_map<FunctionValuation, ConstantType, FuncValHash> collectedFunctions;
+
+                /*!
+                 * For evaluations with doubles, the collected functions are grouped by their occurring variables and each group is compiled.
+                 * A group is then evaluated in a single batch at the vertices of the region (restricted to the variables of the group) that are required by
+                 * at least one of its valuations.
+                 */
+                void compileCollectedFunctions();
+                void evaluateCompiledFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters);
+
+                struct CompiledPlaceholder {
+                    // The index of the function within its group
+                    uint64_t function;
+                    // The range of the group's placeholder vertices that hold the (positions of the) vertices of this valuation
+                    uint64_t verticesBegin;
+                    uint64_t verticesEnd;
+                    ConstantType* placeholder;
+                };
+
+                struct CompiledGroup {
+                    storm::utility::parametric::CompiledRationalFunctions functions;
+                    // The (sorted) vertices at which the functions are evaluated. The i-th bit of a vertex is set iff the i-th variable of the group is at its upper bound
+                    std::vector<uint64_t> vertices;
+                    // For each placeholder, the positions (within vertices) of the vertices of its valuation
+                    std::vector<uint64_t> placeholderVertices;
+                    std::vector<CompiledPlaceholder> placeholders;
+                };
+
+                bool functionsCompiled = false;
+                std::vector<CompiledGroup> compiledGroups;
+                std::vector<double> vertexCoordinates;
+                std::vector<double> vertexResults;
             };
             
             FunctionValuationCollector functionValuationCollector;
@@ -0,0 +1,273 @@
+#include "storm-pars/utility/CompiledRationalFunctions.h"
+
+#include <algorithm>
+#include <limits>
+#include <set>
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/UnexpectedException.h"
+
+namespace storm {
+    namespace utility {
+        namespace parametric {
+
+            namespace {
+                // The number of points that are evaluated at once in a batch evaluation.
+                uint64_t const lanesPerBatch = 64;
+            }
+
+            CompiledRationalFunctions::CompiledRationalFunctions() : numberOfRegisters(0) {
+                // Intentionally left empty
+            }
+
+            CompiledRationalFunctions::CompiledRationalFunctions(std::vector<FunctionType> const& functions) : numberOfRegisters(0) {
+                std::set<Variable> occurringVariables;
+                for (auto const& function : functions) {
+                    gatherOccurringVariables(function, occurringVariables);
+                }
+                variables.assign(occurringVariables.begin(), occurringVariables.end());
+                for (auto const& variable : variables) {
+                    variableToIndex.emplace(variable, newRegister());
+                }
+
+                std::unordered_map<FunctionType, uint32_t> functionRegisters;
+                resultRegisters.reserve(functions.size());
+                for (auto const& function : functions) {
+                    auto findRes = functionRegisters.find(function);
+                    if (findRes == functionRegisters.end()) {
+                        findRes = functionRegisters.emplace(function, compileFunction(function)).first;
+                    }
+                    resultRegisters.push_back(findRes->second);
+                }
+
+                // The caches are not needed for the evaluation.
+                variableToIndex.clear();
+                powerRegisters.clear();
+                monomialRegisters.clear();
+                polynomialRegisters.clear();
+                instructions.shrink_to_fit();
+            }
+
+            std::vector<CompiledRationalFunctions::Variable> const& CompiledRationalFunctions::getVariables() const {
+                return variables;
+            }
+
+            uint64_t CompiledRationalFunctions::getNumberOfFunctions() const {
+                return resultRegisters.size();
+            }
+
+            uint64_t CompiledRationalFunctions::getNumberOfRegisters() const {
+                return numberOfRegisters;
+            }
+
+            std::vector<CompiledRationalFunctions::Instruction> const& CompiledRationalFunctions::getInstructions() const {
+                return instructions;
+            }
+
+            void CompiledRationalFunctions::evaluate(std::vector<double> const& point, std::vector<double>& result) const {
+                STORM_LOG_THROW(point.size() == variables.size(), storm::exceptions::InvalidArgumentException, "The point has " << point.size() << " coordinates but " << variables.size() << " variables occur in the functions.");
+                registers.resize(numberOfRegisters);
+                std::copy(point.begin(), point.end(), registers.begin());
+                execute<1>(registers.data());
+                result.resize(resultRegisters.size());
+                for (uint64_t function = 0; function < resultRegisters.size(); ++function) {
+                    result[function] = registers[resultRegisters[function]];
+                }
+            }
+
+            void CompiledRationalFunctions::evaluate(Valuation<FunctionType> const& valuation, std::vector<double>& result) const {
+                std::vector<double> point;
+                point.reserve(variables.size());
+                for (auto const& variable : variables) {
+                    auto valuationIt = valuation.find(variable);
+                    STORM_LOG_THROW(valuationIt != valuation.end(), storm::exceptions::InvalidArgumentException, "The valuation does not assign a value to variable " << variable << ".");
+                    point.push_back(storm::utility::convertNumber<double>(valuationIt->second));
+                }
+                evaluate(point, result);
+            }
+
+            void CompiledRationalFunctions::evaluateBatch(std::vector<double> const& points, uint64_t numberOfPoints, std::vector<double>& result) const {
+                STORM_LOG_THROW(points.size() == variables.size() * numberOfPoints, storm::exceptions::InvalidArgumentException, "Unexpected number of coordinates for " << numberOfPoints << " points with " << variables.size() << " variables.");
+                result.resize(resultRegisters.size() * numberOfPoints);
+                registers.resize(numberOfRegisters * lanesPerBatch);
+                for (uint64_t firstPoint = 0; firstPoint < numberOfPoints; firstPoint += lanesPerBatch) {
+                    uint64_t pointsInBatch = std::min(lanesPerBatch, numberOfPoints - firstPoint);
+                    // Unused lanes are filled with the last point of the batch so that they do not produce (e.g.) divisions by zero.
+                    for (uint64_t variable = 0; variable < variables.size(); ++variable) {
+                        double const* coordinates = points.data() + variable * numberOfPoints + firstPoint;
+                        double* variableRegister = registers.data() + variable * lanesPerBatch;
+                        for (uint64_t lane = 0; lane < lanesPerBatch; ++lane) {
+                            variableRegister[lane] = coordinates[std::min(lane, pointsInBatch - 1)];
+                        }
+                    }
+                    execute<lanesPerBatch>(registers.data());
+                    for (uint64_t function = 0; function < resultRegisters.size(); ++function) {
+                        double const* functionRegister = registers.data() + resultRegisters[function] * lanesPerBatch;
+                        std::copy(functionRegister, functionRegister + pointsInBatch, result.begin() + function * numberOfPoints + firstPoint);
+                    }
+                }
+            }
+
+            template<uint64_t Lanes>
+            void CompiledRationalFunctions::execute(double* registerValues) const {
+                for (auto const& instruction : instructions) {
+                    double* target = registerValues + instruction.target * Lanes;
+                    double const* first = registerValues + instruction.first * Lanes;
+                    double const* second = registerValues + instruction.second * Lanes;
+                    double const constant = instruction.constant;
+                    switch (instruction.opCode) {
+                        case OpCode::LoadConstant:
+                            for (uint64_t lane = 0; lane < Lanes; ++lane) {
+                                target[lane] = constant;
+                            }
+                            break;
+                        case OpCode::Multiply:
+                            for (uint64_t lane = 0; lane < Lanes; ++lane) {
+                                target[lane] = first[lane] * second[lane];
+                            }
+                            break;
+                        case OpCode::MultiplyAdd:
+                            for (uint64_t lane = 0; lane < Lanes; ++lane) {
+                                target[lane] += constant * first[lane];
+                            }
+                            break;
+                        case OpCode::HornerStep:
+                            for (uint64_t lane = 0; lane < Lanes; ++lane) {
+                                target[lane] = target[lane] * first[lane] + constant;
+                            }
+                            break;
+                        case OpCode::Divide:
+                            for (uint64_t lane = 0; lane < Lanes; ++lane) {
+                                target[lane] = first[lane] / second[lane];
+                            }
+                            break;
+                    }
+                }
+            }
+
+            uint32_t CompiledRationalFunctions::compileFunction(FunctionType const& function) {
+                if (function.isConstant()) {
+                    return addInstruction(OpCode::LoadConstant, newRegister(), 0, 0, storm::utility::convertNumber<double>(function.constantPart()));
+                }
+                auto const& denominator = function.denominator();
+                if (denominator.isConstant()) {
+                    // The constant denominator is folded into the coefficients of the numerator.
+                    return compilePolynomial(function.nominator().polynomialWithCoefficient(), denominator.constantPart());
+                }
+                uint32_t numeratorRegister = compilePolynomial(function.nominator().polynomialWithCoefficient(), storm::utility::one<storm::RationalFunctionCoefficient>());
+                uint32_t denominatorRegister = compilePolynomial(denominator.polynomialWithCoefficient(), storm::utility::one<storm::RationalFunctionCoefficient>());
+                return addInstruction(OpCode::Divide, newRegister(), numeratorRegister, denominatorRegister, 0.0);
+            }
+
+            uint32_t CompiledRationalFunctions::compilePolynomial(storm::RawPolynomial const& polynomial, storm::RationalFunctionCoefficient const& divisor) {
+                bool const divisorIsOne = storm::utility::isOne(divisor);
+                if (divisorIsOne) {
+                    auto findRes = polynomialRegisters.find(polynomial);
+                    if (findRes != polynomialRegisters.end()) {
+                        return findRes->second;
+                    }
+                }
+
+                // Gather the terms with their coefficients (divided by the divisor)
+                double constantPart = 0.0;
+                std::vector<std::pair<Exponents, double>> terms;
+                std::set<uint32_t> termVariables;
+                for (auto const& term : polynomial) {
+                    double coefficient = storm::utility::convertNumber<double>(divisorIsOne ? term.coeff() : static_cast<storm::RationalFunctionCoefficient>(term.coeff() / divisor));
+                    if (term.isConstant()) {
+                        constantPart += coefficient;
+                        continue;
+                    }
+                    Exponents exponents;
+                    for (auto const& variableExponent : term.monomial()->exponents()) {
+                        uint32_t variableIndex = variableToIndex.at(variableExponent.first);
+                        exponents.emplace_back(variableIndex, static_cast<uint32_t>(variableExponent.second));
+                        termVariables.insert(variableIndex);
+                    }
+                    std::sort(exponents.begin(), exponents.end());
+                    terms.emplace_back(std::move(exponents), coefficient);
+                }
+
+                uint32_t result;
+                if (terms.size() == 1 && constantPart == 0.0 && terms.front().second == 1.0) {
+                    // The polynomial is a single monomial.
+                    result = getMonomialRegister(terms.front().first);
+                } else if (termVariables.size() == 1) {
+                    // Univariate polynomials are evaluated in Horner form, where gaps between exponents are bridged with (shared) powers.
+                    uint32_t variableIndex = *termVariables.begin();
+                    std::sort(terms.begin(), terms.end(), [](std::pair<Exponents, double> const& lhs, std::pair<Exponents, double> const& rhs) { return lhs.first.front().second > rhs.first.front().second; });
+                    result = addInstruction(OpCode::LoadConstant, newRegister(), 0, 0, terms.front().second);
+                    uint32_t previousExponent = terms.front().first.front().second;
+                    for (auto termIt = terms.begin() + 1; termIt != terms.end(); ++termIt) {
+                        uint32_t exponent = termIt->first.front().second;
+                        addInstruction(OpCode::HornerStep, result, getPowerRegister(variableIndex, previousExponent - exponent), 0, termIt->second);
+                        previousExponent = exponent;
+                    }
+                    if (constantPart != 0.0) {
+                        addInstruction(OpCode::HornerStep, result, getPowerRegister(variableIndex, previousExponent), 0, constantPart);
+                    } else {
+                        addInstruction(OpCode::Multiply, result, result, getPowerRegister(variableIndex, previousExponent), 0.0);
+                    }
+                } else {
+                    result = addInstruction(OpCode::LoadConstant, newRegister(), 0, 0, constantPart);
+                    for (auto const& term : terms) {
+                        addInstruction(OpCode::MultiplyAdd, result, getMonomialRegister(term.first), 0, term.second);
+                    }
+                }
+
+                if (divisorIsOne) {
+                    polynomialRegisters.emplace(polynomial, result);
+                }
+                return result;
+            }
+
+            uint32_t CompiledRationalFunctions::getPowerRegister(uint32_t variableIndex, uint32_t exponent) {
+                STORM_LOG_ASSERT(exponent > 0, "Unexpected exponent.");
+                if (exponent == 1) {
+                    return variableIndex;
+                }
+                auto key = std::make_pair(variableIndex, exponent);
+                auto findRes = powerRegisters.find(key);
+                if (findRes != powerRegisters.end()) {
+                    return findRes->second;
+                }
+                // Square-and-multiply such that the intermediate powers can be shared as well.
+                uint32_t halfPower = getPowerRegister(variableIndex, exponent / 2);
+                uint32_t result = addInstruction(OpCode::Multiply, newRegister(), halfPower, halfPower, 0.0);
+                if (exponent % 2 == 1) {
+                    addInstruction(OpCode::Multiply, result, result, variableIndex, 0.0);
+                }
+                powerRegisters.emplace(key, result);
+                return result;
+            }
+
+            uint32_t CompiledRationalFunctions::getMonomialRegister(Exponents const& exponents) {
+                STORM_LOG_ASSERT(!exponents.empty(), "Unexpected constant monomial.");
+                if (exponents.size() == 1) {
+                    return getPowerRegister(exponents.front().first, exponents.front().second);
+                }
+                auto findRes = monomialRegisters.find(exponents);
+                if (findRes != monomialRegisters.end()) {
+                    return findRes->second;
+                }
+                // The monomial is the product of a (shared) prefix and the power of the last variable.
+                Exponents prefix(exponents.begin(), exponents.end() - 1);
+                uint32_t result = addInstruction(OpCode::Multiply, newRegister(), getMonomialRegister(prefix), getPowerRegister(exponents.back().first, exponents.back().second), 0.0);
+                monomialRegisters.emplace(exponents, result);
+                return result;
+            }
+
+            uint32_t CompiledRationalFunctions::addInstruction(OpCode opCode, uint32_t target, uint32_t first, uint32_t second, double constant) {
+                instructions.push_back({opCode, target, first, second, constant});
+                return target;
+            }
+
+            uint32_t CompiledRationalFunctions::newRegister() {
+                STORM_LOG_THROW(numberOfRegisters < std::numeric_limits<uint32_t>::max(), storm::exceptions::UnexpectedException, "Too many registers needed to compile the functions.");
+                return static_cast<uint32_t>(numberOfRegisters++);
+            }
+        }
+    }
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm-pars/utility/parametric.h"
+
+namespace storm {
+    namespace utility {
+        namespace parametric {
+
+            /*!
+             * A table of rational functions that is compiled once into straight-line code over doubles.
+             * The instructions operate on registers, where the first registers hold the values of the variables.
+             * Powers of variables and monomials are computed only once and shared by all functions of the table.
+             * Polynomials in a single variable are evaluated in Horner form, other polynomials as a sum of (shared) monomials.
+             *
+             * The instructions can be executed for a batch of parameter points at once, where each register holds the values for several points.
+             * The loops over the points are independent of each other such that they are vectorized by the compiler.
+             *
+             * @note Evaluating the table is not thread safe as the registers are stored in this object. Use one copy per thread.
+             */
+            class CompiledRationalFunctions {
+            public:
+                typedef storm::RationalFunction FunctionType;
+                typedef VariableType<FunctionType>::type Variable;
+
+                enum class OpCode : uint8_t {
+                    // target = constant
+                    LoadConstant,
+                    // target = first * second
+                    Multiply,
+                    // target = target + constant * first
+                    MultiplyAdd,
+                    // target = target * first + constant
+                    HornerStep,
+                    // target = first / second
+                    Divide
+                };
+
+                struct Instruction {
+                    OpCode opCode;
+                    uint32_t target;
+                    uint32_t first;
+                    uint32_t second;
+                    double constant;
+                };
+
+                /*!
+                 * Creates an empty table.
+                 */
+                CompiledRationalFunctions();
+
+                /*!
+                 * Compiles the given functions. The i-th result of an evaluation corresponds to the i-th function.
+                 * Functions that occur more than once are only compiled once.
+                 */
+                CompiledRationalFunctions(std::vector<FunctionType> const& functions);
+
+                /*!
+                 * Retrieves the variables that occur in the functions (in ascending order).
+                 * The coordinates of the parameter points that are passed to evaluate refer to this order.
+                 */
+                std::vector<Variable> const& getVariables() const;
+
+                uint64_t getNumberOfFunctions() const;
+                uint64_t getNumberOfRegisters() const;
+                std::vector<Instruction> const& getInstructions() const;
+
+                /*!
+                 * Evaluates all functions at the given point, i.e., point[i] is the value of the i-th variable.
+                 * @param result the i-th entry is set to the value of the i-th function.
+                 */
+                void evaluate(std::vector<double> const& point, std::vector<double>& result) const;
+
+                /*!
+                 * Evaluates all functions at the point given by the valuation, which has to assign a value to every occurring variable.
+                 * @param result the i-th entry is set to the value of the i-th function.
+                 */
+                void evaluate(Valuation<FunctionType> const& valuation, std::vector<double>& result) const;
+
+                /*!
+                 * Evaluates all functions at several points.
+                 * @param points the coordinates of the points, stored variable by variable, i.e., points[i * numberOfPoints + p] is the value of the i-th variable in the p-th point.
+                 * @param numberOfPoints the number of points
+                 * @param result stored function by function, i.e., result[f * numberOfPoints + p] is set to the value of the f-th function at the p-th point.
+                 */
+                void evaluateBatch(std::vector<double> const& points, uint64_t numberOfPoints, std::vector<double>& result) const;
+
+            private:
+                typedef std::vector<std::pair<uint32_t, uint32_t>> Exponents;
+
+                /*!
+                 * Executes the instructions on registers that each hold the values for the given number of points.
+                 */
+                template<uint64_t Lanes>
+                void execute(double* registerValues) const;
+
+                uint32_t compileFunction(FunctionType const& function);
+                uint32_t compilePolynomial(storm::RawPolynomial const& polynomial, storm::RationalFunctionCoefficient const& divisor);
+                uint32_t getPowerRegister(uint32_t variableIndex, uint32_t exponent);
+                uint32_t getMonomialRegister(Exponents const& exponents);
+                uint32_t addInstruction(OpCode opCode, uint32_t target, uint32_t first, uint32_t second, double constant);
+                uint32_t newRegister();
+
+                std::vector<Variable> variables;
+                std::vector<Instruction> instructions;
+                uint64_t numberOfRegisters;
+                // The register that holds the value of each function after executing the instructions
+                std::vector<uint32_t> resultRegisters;
+
+                // Caches that are only used during compilation
+                std::map<Variable, uint32_t> variableToIndex;
+                std::map<std::pair<uint32_t, uint32_t>, uint32_t> powerRegisters;
+                std::map<Exponents, uint32_t> monomialRegisters;
+                std::unordered_map<storm::RawPolynomial, uint32_t> polynomialRegisters;
+
+                mutable std::vector<double> registers;
+            };
+        }
+    }
+}
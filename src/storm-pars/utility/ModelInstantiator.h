@@ -5,6 +5,9 @@
 #include <memory>
 #include <type_traits>
 
+#include <boost/optional.hpp>
+
+#include "storm-pars/utility/CompiledRationalFunctions.h"
 #include "storm-pars/utility/parametric.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
@@ -129,9 +132,10 @@ namespace storm {
                     }
                 }
 
-                template<typename PMT = ParametricSparseModelType>
+                template<typename PMT = ParametricSparseModelType, typename CT = ConstantType>
                 typename std::enable_if<
-                        !std::is_same<PMT,ConstantSparseModelType>::value
+                        !std::is_same<PMT,ConstantSparseModelType>::value &&
+                        !std::is_same<CT,double>::value
                 >::type
                 instantiate_helper(storm::utility::parametric::Valuation<ParametricType> const& valuation) {
                     for(auto& functionResult : this->functions){
@@ -140,6 +144,31 @@ namespace storm {
                     }
                 }
 
+                /*!
+                 * For instantiations with doubles, the occurring functions are compiled (upon the first instantiation) and evaluated all at once.
+                 */
+                template<typename PMT = ParametricSparseModelType, typename CT = ConstantType>
+                typename std::enable_if<
+                        !std::is_same<PMT,ConstantSparseModelType>::value &&
+                        std::is_same<CT,double>::value
+                >::type
+                instantiate_helper(storm::utility::parametric::Valuation<ParametricType> const& valuation) {
+                    if (!this->compiledFunctions) {
+                        std::vector<ParametricType> occurringFunctions;
+                        occurringFunctions.reserve(this->functions.size());
+                        this->compiledPlaceholders.reserve(this->functions.size());
+                        for(auto& functionResult : this->functions){
+                            occurringFunctions.push_back(functionResult.first);
+                            this->compiledPlaceholders.push_back(&functionResult.second);
+                        }
+                        this->compiledFunctions = storm::utility::parametric::CompiledRationalFunctions(occurringFunctions);
+                    }
+                    this->compiledFunctions->evaluate(valuation, this->compiledResults);
+                    for (uint_fast64_t i = 0; i < this->compiledPlaceholders.size(); ++i) {
+                        *(this->compiledPlaceholders[i]) = this->compiledResults[i];
+                    }
+                }
+
                 /*!
                  * Creates a matrix that has entries at the same position as the given matrix.
                  * The returned matrix is a stochastic matrix, i.e., the rows sum up to one.
@@ -189,6 +218,10 @@ namespace storm {
                 std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>> matrixMapping; 
                 /// Connection of Vector entries with placeholders
                 std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>> vectorMapping; 
+                /// The compiled functions (only used for instantiations with doubles) and the placeholders for their results
+                boost::optional<storm::utility::parametric::CompiledRationalFunctions> compiledFunctions;
+                std::vector<ConstantType*> compiledPlaceholders;
+                std::vector<double> compiledResults;
                 
                 
             };
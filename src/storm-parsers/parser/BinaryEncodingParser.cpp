@@ -0,0 +1,300 @@
+#include "storm-parsers/parser/BinaryEncodingParser.h"
+
+#include <cstring>
+
+#include "storm-parsers/parser/MappedFile.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/BinaryEncodingFormat.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace parser {
+
+using storm::exporter::BinaryEncoding;
+
+/*!
+ * Copies the given number of bytes at the given position to the given target and advances the position.
+ */
+inline void readBytes(char const*& position, char const* end, void* target, uint64_t size) {
+    STORM_LOG_THROW(static_cast<uint64_t>(end - position) >= size, storm::exceptions::WrongFormatException, "Unexpected end of binary model file.");
+    if (size > 0) {
+        std::memcpy(target, position, size);
+    }
+    position += size;
+}
+
+/*!
+ * Reads a value of the given type at the given position and advances the position.
+ */
+template<typename T>
+inline T readValue(char const*& position, char const* end) {
+    T result;
+    readBytes(position, end, &result, sizeof(T));
+    return result;
+}
+
+/*!
+ * Reads a string (prefixed by its length) at the given position and advances the position.
+ */
+inline std::string readString(char const*& position, char const* end) {
+    std::string result(readValue<uint32_t>(position, end), '\0');
+    readBytes(position, end, &result[0], result.size());
+    return result;
+}
+
+/*!
+ * Copies the given payload in bulk to a vector with the given number of elements.
+ */
+template<typename T>
+inline std::vector<T> readVector(char const* payload, uint64_t payloadSize, uint64_t numberOfElements, std::string const& description) {
+    STORM_LOG_THROW(payloadSize == numberOfElements * sizeof(T), storm::exceptions::WrongFormatException,
+                    "Unexpected size of " << description << " in binary model file: expected " << numberOfElements << " elements.");
+    std::vector<T> result(numberOfElements);
+    if (payloadSize > 0) {
+        std::memcpy(static_cast<void*>(result.data()), payload, payloadSize);
+    }
+    return result;
+}
+
+/*!
+ * Creates a bit vector of the given size from the buckets in the given payload.
+ */
+inline storm::storage::BitVector readBitVector(char const* payload, uint64_t payloadSize, uint64_t size, std::string const& description) {
+    std::vector<uint64_t> buckets = readVector<uint64_t>(payload, payloadSize, (size + 63) / 64, description);
+    storm::storage::BitVector result(size);
+    for (uint64_t bucket = 0; bucket < buckets.size(); ++bucket) {
+        uint64_t numberOfBits = std::min<uint64_t>(64, size - bucket * 64);
+        STORM_LOG_THROW(numberOfBits == 64 || (buckets[bucket] >> numberOfBits) == 0, storm::exceptions::WrongFormatException,
+                        "Invalid padding of " << description << " in binary model file.");
+        result.setFromInt(bucket * 64, numberOfBits, buckets[bucket]);
+    }
+    return result;
+}
+
+/*!
+ * Checks that the given indices are non-decreasing, start at zero and end at the given value.
+ */
+inline void checkIndications(std::vector<uint_fast64_t> const& indications, uint64_t last, std::string const& description) {
+    STORM_LOG_THROW(indications.front() == 0 && indications.back() == last, storm::exceptions::WrongFormatException,
+                    "Invalid " << description << " in binary model file.");
+    for (uint64_t index = 1; index < indications.size(); ++index) {
+        STORM_LOG_THROW(indications[index - 1] <= indications[index], storm::exceptions::WrongFormatException,
+                        "Invalid " << description << " in binary model file.");
+    }
+}
+
+/*!
+ * Decodes the given state valuations (see BinaryEncodingExporter.cpp). The variables are declared in a new manager that is
+ * owned by the state valuations.
+ */
+inline storm::storage::sparse::StateValuations readStateValuations(char const* payload, uint64_t payloadSize, uint64_t numberOfStates) {
+    char const* position = payload;
+    char const* end = payload + payloadSize;
+
+    auto managerPointer = std::make_shared<storm::expressions::ExpressionManager>();
+    storm::expressions::ExpressionManager& manager = *managerPointer;
+    storm::storage::sparse::StateValuationsBuilder builder;
+    builder.setExpressionManager(managerPointer);
+    std::vector<BinaryEncoding::ValuationType> types(readValue<uint64_t>(position, end));
+    for (auto& type : types) {
+        type = readValue<BinaryEncoding::ValuationType>(position, end);
+        std::string name = readString(position, end);
+        switch (type) {
+            case BinaryEncoding::ValuationType::Boolean:
+                builder.addVariable(manager.declareBooleanVariable(name));
+                break;
+            case BinaryEncoding::ValuationType::Integer:
+                builder.addVariable(manager.declareIntegerVariable(name));
+                break;
+            case BinaryEncoding::ValuationType::Rational:
+                builder.addVariable(manager.declareRationalVariable(name));
+                break;
+            case BinaryEncoding::ValuationType::ObservationLabel:
+                builder.addObservationLabel(name);
+                break;
+            default:
+                STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Unknown type of state valuation '" << name << "' in binary model file.");
+        }
+    }
+
+    for (uint64_t state = 0; state < numberOfStates && !types.empty(); ++state) {
+        std::vector<bool> booleanValues;
+        std::vector<int64_t> integerValues;
+        std::vector<storm::RationalNumber> rationalValues;
+        std::vector<int64_t> observationLabelValues;
+        for (auto const& type : types) {
+            if (type == BinaryEncoding::ValuationType::Rational) {
+                rationalValues.push_back(storm::utility::convertNumber<storm::RationalNumber>(readString(position, end)));
+            } else {
+                int64_t value = readValue<int64_t>(position, end);
+                if (type == BinaryEncoding::ValuationType::Boolean) {
+                    booleanValues.push_back(value != 0);
+                } else if (type == BinaryEncoding::ValuationType::Integer) {
+                    integerValues.push_back(value);
+                } else {
+                    observationLabelValues.push_back(value);
+                }
+            }
+        }
+        builder.addState(state, std::move(booleanValues), std::move(integerValues), std::move(rationalValues), std::move(observationLabelValues));
+    }
+    STORM_LOG_THROW(position == end, storm::exceptions::WrongFormatException, "Unexpected size of state valuations in binary model file.");
+    return builder.build(numberOfStates);
+}
+
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> BinaryEncodingParser<ValueType, RewardModelType>::parseModel(
+    std::string const& filename) {
+    static_assert(std::is_same<ValueType, double>::value, "The binary encoding only supports models with double values.");
+    static_assert(sizeof(storm::storage::MatrixEntry<uint_fast64_t, ValueType>) == sizeof(uint64_t) + sizeof(ValueType),
+                  "Unexpected layout of matrix entries.");
+    static_assert(sizeof(uint_fast64_t) == sizeof(uint64_t), "Unexpected size of matrix indices.");
+
+    MappedFile file(filename.c_str());
+    char const* position = file.getData();
+    char const* end = file.getDataEnd();
+
+    auto header = readValue<BinaryEncoding::Header>(position, end);
+    STORM_LOG_THROW(std::equal(header.magic, header.magic + sizeof(header.magic), BinaryEncoding::magic), storm::exceptions::WrongFormatException,
+                    "File " << filename << " is not a binary model file.");
+    STORM_LOG_THROW(header.version == BinaryEncoding::version, storm::exceptions::WrongFormatException,
+                    "Version " << header.version << " of binary model file " << filename << " is not supported.");
+    STORM_LOG_THROW(header.byteOrderMark == BinaryEncoding::byteOrderMark, storm::exceptions::WrongFormatException,
+                    "Binary model file " << filename << " was written on a machine with a different byte order.");
+    STORM_LOG_THROW(header.valueType == BinaryEncoding::ValueType::Double, storm::exceptions::WrongFormatException,
+                    "Unknown value type of binary model file " << filename << ".");
+
+    storm::models::ModelType type;
+    switch (header.modelType) {
+        case BinaryEncoding::ModelType::Dtmc:
+            type = storm::models::ModelType::Dtmc;
+            break;
+        case BinaryEncoding::ModelType::Ctmc:
+            type = storm::models::ModelType::Ctmc;
+            break;
+        case BinaryEncoding::ModelType::Mdp:
+            type = storm::models::ModelType::Mdp;
+            break;
+        case BinaryEncoding::ModelType::MarkovAutomaton:
+            type = storm::models::ModelType::MarkovAutomaton;
+            break;
+        case BinaryEncoding::ModelType::Pomdp:
+            type = storm::models::ModelType::Pomdp;
+            break;
+        default:
+            STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Unknown model type in binary model file " << filename << ".");
+    }
+    bool nondeterministic = type != storm::models::ModelType::Dtmc && type != storm::models::ModelType::Ctmc;
+    STORM_LOG_THROW(nondeterministic || header.numberOfChoices == header.numberOfStates, storm::exceptions::WrongFormatException,
+                    "Number of choices of deterministic model in binary model file " << filename << " does not match the number of states.");
+
+    std::vector<uint_fast64_t> rowIndications;
+    std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>> entries;
+    boost::optional<std::vector<uint_fast64_t>> rowGroupIndices;
+    storm::models::sparse::StateLabeling stateLabeling(header.numberOfStates);
+    boost::optional<storm::models::sparse::ChoiceLabeling> choiceLabeling;
+    std::map<std::string, std::pair<boost::optional<std::vector<ValueType>>, boost::optional<std::vector<ValueType>>>> rewardVectors;
+    boost::optional<std::vector<ValueType>> exitRates;
+    boost::optional<storm::storage::BitVector> markovianStates;
+    boost::optional<std::vector<uint32_t>> observations;
+    boost::optional<storm::storage::sparse::StateValuations> stateValuations;
+
+    for (uint64_t sectionIndex = 0; sectionIndex < header.numberOfSections; ++sectionIndex) {
+        auto sectionHeader = readValue<BinaryEncoding::SectionHeader>(position, end);
+        std::string name(sectionHeader.nameLength, '\0');
+        readBytes(position, end, &name[0], name.size());
+        position += std::min<uint64_t>(BinaryEncoding::getPadding(name.size()), end - position);
+        STORM_LOG_THROW(static_cast<uint64_t>(end - position) >= sectionHeader.payloadSize, storm::exceptions::WrongFormatException,
+                        "Unexpected end of binary model file " << filename << ".");
+        char const* payload = position;
+        position += sectionHeader.payloadSize;
+        position += std::min<uint64_t>(BinaryEncoding::getPadding(sectionHeader.payloadSize), end - position);
+
+        switch (sectionHeader.type) {
+            case BinaryEncoding::SectionType::RowIndications:
+                rowIndications = readVector<uint_fast64_t>(payload, sectionHeader.payloadSize, header.numberOfChoices + 1, "row indications");
+                checkIndications(rowIndications, header.numberOfEntries, "row indications");
+                break;
+            case BinaryEncoding::SectionType::Entries:
+                entries = readVector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>(payload, sectionHeader.payloadSize, header.numberOfEntries,
+                                                                                            "matrix entries");
+                for (auto const& entry : entries) {
+                    STORM_LOG_THROW(entry.getColumn() < header.numberOfStates, storm::exceptions::WrongFormatException,
+                                    "Invalid column " << entry.getColumn() << " in binary model file " << filename << ".");
+                }
+                break;
+            case BinaryEncoding::SectionType::RowGroupIndices:
+                rowGroupIndices = readVector<uint_fast64_t>(payload, sectionHeader.payloadSize, header.numberOfStates + 1, "row group indices");
+                checkIndications(rowGroupIndices.get(), header.numberOfChoices, "row group indices");
+                break;
+            case BinaryEncoding::SectionType::StateLabel:
+                stateLabeling.addLabel(name, readBitVector(payload, sectionHeader.payloadSize, header.numberOfStates, "state label " + name));
+                break;
+            case BinaryEncoding::SectionType::ChoiceLabel:
+                if (!choiceLabeling) {
+                    choiceLabeling = storm::models::sparse::ChoiceLabeling(header.numberOfChoices);
+                }
+                choiceLabeling->addLabel(name, readBitVector(payload, sectionHeader.payloadSize, header.numberOfChoices, "choice label " + name));
+                break;
+            case BinaryEncoding::SectionType::StateRewards:
+                rewardVectors[name].first = readVector<ValueType>(payload, sectionHeader.payloadSize, header.numberOfStates, "state rewards " + name);
+                break;
+            case BinaryEncoding::SectionType::StateActionRewards:
+                rewardVectors[name].second =
+                    readVector<ValueType>(payload, sectionHeader.payloadSize, header.numberOfChoices, "state-action rewards " + name);
+                break;
+            case BinaryEncoding::SectionType::ExitRates:
+                exitRates = readVector<ValueType>(payload, sectionHeader.payloadSize, header.numberOfStates, "exit rates");
+                break;
+            case BinaryEncoding::SectionType::MarkovianStates:
+                markovianStates = readBitVector(payload, sectionHeader.payloadSize, header.numberOfStates, "Markovian states");
+                break;
+            case BinaryEncoding::SectionType::Observations:
+                observations = readVector<uint32_t>(payload, sectionHeader.payloadSize, header.numberOfStates, "observations");
+                break;
+            case BinaryEncoding::SectionType::StateValuations:
+                stateValuations = readStateValuations(payload, sectionHeader.payloadSize, header.numberOfStates);
+                break;
+            default:
+                STORM_LOG_WARN("Skipping unknown section " << static_cast<uint32_t>(sectionHeader.type) << " in binary model file " << filename << ".");
+        }
+    }
+    STORM_LOG_THROW(!rowIndications.empty(), storm::exceptions::WrongFormatException, "Binary model file " << filename << " has no transition matrix.");
+    STORM_LOG_THROW(!nondeterministic || rowGroupIndices, storm::exceptions::WrongFormatException,
+                    "Binary model file " << filename << " of a nondeterministic model has no row groups.");
+    STORM_LOG_THROW(type != storm::models::ModelType::MarkovAutomaton || (exitRates && markovianStates), storm::exceptions::WrongFormatException,
+                    "Binary model file " << filename << " of a Markov automaton has no exit rates.");
+    STORM_LOG_THROW(type != storm::models::ModelType::Pomdp || observations, storm::exceptions::WrongFormatException,
+                    "Binary model file " << filename << " of a POMDP has no observations.");
+    if (!nondeterministic) {
+        rowGroupIndices = boost::none;
+    }
+
+    storm::storage::SparseMatrix<ValueType> transitionMatrix(header.numberOfStates, std::move(rowIndications), std::move(entries), std::move(rowGroupIndices));
+    std::unordered_map<std::string, RewardModelType> rewardModels;
+    for (auto& rewardVector : rewardVectors) {
+        rewardModels.emplace(rewardVector.first, RewardModelType(std::move(rewardVector.second.first), std::move(rewardVector.second.second)));
+    }
+
+    storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components(std::move(transitionMatrix), std::move(stateLabeling),
+                                                                                   std::move(rewardModels), type == storm::models::ModelType::Ctmc,
+                                                                                   std::move(markovianStates));
+    components.choiceLabeling = std::move(choiceLabeling);
+    components.stateValuations = std::move(stateValuations);
+    components.exitRates = std::move(exitRates);
+    components.observabilityClasses = std::move(observations);
+    return storm::utility::builder::buildModelFromComponents(type, std::move(components));
+}
+
+// Template instantiations.
+template class BinaryEncodingParser<double>;
+
+}  // namespace parser
+}  // namespace storm
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace storm {
+namespace parser {
+
+/*!
+ * Parser for models in the binary DRB format (see storm/io/BinaryEncodingFormat.h).
+ *
+ * The file is mapped into memory and all arrays are validated and copied in bulk into the data structures of the model.
+ */
+template<typename ValueType, typename RewardModelType = models::sparse::StandardRewardModel<ValueType>>
+class BinaryEncodingParser {
+   public:
+    /*!
+     * Load a model in DRB format from a file and create the model.
+     *
+     * @param filename The DRB file to be parsed.
+     *
+     * @return A sparse model
+     */
+    static std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> parseModel(std::string const& filename);
+};
+
+}  // namespace parser
+}  // namespace storm
@@ -2,12 +2,15 @@
 
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/predicate.hpp>
+#include <cstring>
 #include <iostream>
 #include <regex>
 #include <string>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include "storm-parsers/parser/MappedFile.h"
+
 #include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/FileIoException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -26,6 +29,7 @@
 #include "storm/utility/builder.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace parser {
@@ -119,7 +123,16 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
                             "No. of actions (@nr_choices) has to be declared before model.");
             STORM_LOG_WARN_COND(nrChoices != 0, "No. of actions has to be declared. We may continue now, but future versions might not support this.");
             // Construct model components
-            modelComponents = parseStates(file, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
+            if (options.numberOfThreads > 1 && std::is_same<ValueType, double>::value) {
+                // Parse the states from the mapped file in parallel. Exact values are parsed sequentially.
+                std::streamoff offset = file.tellg();
+                MappedFile mappedFile(filename.c_str());
+                char const* begin = offset < 0 ? mappedFile.getDataEnd() : mappedFile.getData() + offset;
+                modelComponents = parseStatesInParallel(begin, mappedFile.getDataEnd(), type, nrStates, nrChoices, placeholders, valueParser,
+                                                        rewardModelNames, options);
+            } else {
+                modelComponents = parseStates(file, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
+            }
             break;
         } else {
             STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Could not parse line '" << line << "'.");
@@ -132,42 +145,140 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
     return storm::utility::builder::buildModelFromComponents(type, std::move(*modelComponents));
 }
 
+template<typename ValueType, typename RewardModelType>
+struct DirectEncodingParser<ValueType, RewardModelType>::StatesChunk {
+    // The index of the first state of the chunk.
+    uint64_t firstState = 0;
+    // The number of states and rows of the chunk.
+    uint64_t numberOfStates = 0;
+    uint64_t numberOfRows = 0;
+    // The transitions of the chunk. Target states are global indices.
+    storm::storage::SparseMatrix<ValueType> transitions;
+    // The exit rates (for CTMCs and MAs) and observations (for POMDPs) of the states of the chunk.
+    std::vector<ValueType> exitRates;
+    std::vector<uint32_t> observations;
+    // The (chunk) indices of Markovian states.
+    std::vector<uint64_t> markovianStates;
+    // The state and action rewards of the chunk for each reward model. Vectors without non-zero values are empty.
+    std::vector<std::vector<ValueType>> stateRewards;
+    std::vector<std::vector<ValueType>> actionRewards;
+    // The (chunk) indices of the states and rows for each state and choice label.
+    std::map<std::string, std::vector<uint64_t>> stateLabels;
+    std::map<std::string, std::vector<uint64_t>> choiceLabels;
+};
+
+/*!
+ * Calls the given function for all indices from zero to the given number, in parallel if Storm was built with TBB and
+ * more than one thread is given.
+ */
+template<typename Function>
+inline void forEachIndex(uint64_t numberOfThreads, uint64_t numberOfIndices, Function const& function) {
+#ifdef STORM_HAVE_INTELTBB
+    if (numberOfThreads > 1) {
+        storm::utility::parallel::executeWithThreadLimit(numberOfThreads, [&]() {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfIndices, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                    function(index);
+                }
+            });
+        });
+        return;
+    }
+#else
+    (void)numberOfThreads;
+#endif
+    for (uint64_t index = 0; index < numberOfIndices; ++index) {
+        function(index);
+    }
+}
+
+/*!
+ * Retrieves the beginning of the line following the given position (or the end).
+ */
+inline char const* getNextLineBegin(char const* position, char const* end) {
+    char const* lineEnd = static_cast<char const*>(std::memchr(position, '\n', end - position));
+    return lineEnd == nullptr ? end : lineEnd + 1;
+}
+
 template<typename ValueType, typename RewardModelType>
 std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseStates(
     std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
     ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options) {
+    std::vector<StatesChunk> chunks(1);
+    parseStatesChunk([&file](std::string& line) { return static_cast<bool>(storm::utility::getline(file, line)); }, type, stateSize, placeholders,
+                     valueParser, options, chunks.front());
+    return assembleModelComponents(chunks, type, stateSize, nrChoices, rewardModelNames, options);
+}
+
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseStatesInParallel(
+    char const* begin, char const* end, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+    std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+    std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options) {
+    // Split the range into chunks (of roughly the same size) that begin with a state. We use more chunks than threads
+    // to balance the load.
+    uint64_t const minimalChunkSize = 4096;
+    uint64_t numberOfChunks = std::max<uint64_t>(1, std::min<uint64_t>(options.numberOfThreads * 4, (end - begin) / minimalChunkSize));
+    std::vector<char const*> chunkBegins = {begin};
+    for (uint64_t chunk = 1; chunk < numberOfChunks; ++chunk) {
+        char const* position = std::max(chunkBegins.back(), begin + chunk * ((end - begin) / numberOfChunks));
+        if (position != begin && position[-1] != '\n') {
+            position = getNextLineBegin(position, end);
+        }
+        while (position != end && !(end - position >= 6 && std::strncmp(position, "state ", 6) == 0)) {
+            position = getNextLineBegin(position, end);
+        }
+        if (position != chunkBegins.back()) {
+            chunkBegins.push_back(position);
+        }
+    }
+    if (chunkBegins.back() == end && chunkBegins.size() > 1) {
+        chunkBegins.pop_back();
+    }
+    chunkBegins.push_back(end);
+    STORM_LOG_INFO("Parsing states in " << chunkBegins.size() - 1 << " chunks.");
+
+    std::vector<StatesChunk> chunks(chunkBegins.size() - 1);
+    forEachIndex(options.numberOfThreads, chunks.size(), [&](uint64_t chunk) {
+        char const* position = chunkBegins[chunk];
+        char const* chunkEnd = chunkBegins[chunk + 1];
+        auto getNextLine = [&position, chunkEnd](std::string& line) {
+            if (position == chunkEnd) {
+                return false;
+            }
+            char const* nextLineBegin = getNextLineBegin(position, chunkEnd);
+            char const* lineEnd = nextLineBegin;
+            while (lineEnd != position && (lineEnd[-1] == '\n' || lineEnd[-1] == '\r')) {
+                --lineEnd;
+            }
+            line.assign(position, lineEnd);
+            position = nextLineBegin;
+            return true;
+        };
+        parseStatesChunk(getNextLine, type, stateSize, placeholders, valueParser, options, chunks[chunk]);
+    });
+    return assembleModelComponents(chunks, type, stateSize, nrChoices, rewardModelNames, options);
+}
+
+template<typename ValueType, typename RewardModelType>
+void DirectEncodingParser<ValueType, RewardModelType>::parseStatesChunk(std::function<bool(std::string&)> const& getNextLine,
+                                                                          storm::models::ModelType type, size_t stateSize,
+                                                                          std::unordered_map<std::string, ValueType> const& placeholders,
+                                                                          ValueParser<ValueType> const& valueParser,
+                                                                          DirectEncodingParserOptions const& options, StatesChunk& chunk) {
     // Initialize
-    auto modelComponents = std::make_shared<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>();
     bool nonDeterministic =
         (type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp);
     bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
     storm::storage::SparseMatrixBuilder<ValueType> builder = storm::storage::SparseMatrixBuilder<ValueType>(0, 0, 0, false, nonDeterministic, 0);
-    modelComponents->stateLabeling = storm::models::sparse::StateLabeling(stateSize);
-    modelComponents->observabilityClasses = std::vector<uint32_t>();
-    modelComponents->observabilityClasses->resize(stateSize);
-    if (options.buildChoiceLabeling) {
-        modelComponents->choiceLabeling = storm::models::sparse::ChoiceLabeling(nrChoices);
-    }
-    std::vector<std::vector<ValueType>> stateRewards;
-    std::vector<std::vector<ValueType>> actionRewards;
-    if (continuousTime) {
-        modelComponents->exitRates = std::vector<ValueType>(stateSize);
-        if (type == storm::models::ModelType::MarkovAutomaton) {
-            modelComponents->markovianStates = storm::storage::BitVector(stateSize);
-        }
-    }
-    // We parse rates for continuous time models.
-    if (type == storm::models::ModelType::Ctmc) {
-        modelComponents->rateTransitions = true;
-    }
 
-    // Iterate over all lines
+    // Iterate over all lines. States and rows are numbered relative to the chunk.
     std::string line;
     size_t row = 0;
     size_t state = 0;
     bool firstState = true;
     bool firstActionForState = true;
-    while (storm::utility::getline(file, line)) {
+    while (getNextLine(line)) {
         if (boost::starts_with(line, "//")) {
             continue;
         }
@@ -194,7 +305,10 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
                 line = "";
             }
             size_t parsedId = parseNumber<size_t>(curString);
-            STORM_LOG_ASSERT(state == parsedId, "State ids do not correspond.");
+            if (state == 0) {
+                chunk.firstState = parsedId;
+            }
+            STORM_LOG_ASSERT(chunk.firstState + state == parsedId, "State ids do not correspond.");
             if (nonDeterministic) {
                 STORM_LOG_TRACE("new Row Group starts at " << row << ".");
                 builder.newRowGroup(row);
@@ -214,10 +328,11 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
                 }
                 ValueType exitRate = parseValue(curString, placeholders, valueParser);
                 if (type == storm::models::ModelType::MarkovAutomaton && !storm::utility::isZero<ValueType>(exitRate)) {
-                    modelComponents->markovianStates.get().set(state);
+                    chunk.markovianStates.push_back(state);
                 }
                 STORM_LOG_TRACE("Exit rate " << exitRate);
-                modelComponents->exitRates.get()[state] = exitRate;
+                chunk.exitRates.resize(state + 1, storm::utility::zero<ValueType>());
+                chunk.exitRates[state] = exitRate;
             }
 
             if (boost::starts_with(line, "[")) {
@@ -228,15 +343,15 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
                 STORM_LOG_TRACE("State rewards: " << rewardsStr);
                 std::vector<std::string> rewards;
                 boost::split(rewards, rewardsStr, boost::is_any_of(","));
-                if (stateRewards.size() < rewards.size()) {
-                    stateRewards.resize(rewards.size());
+                if (chunk.stateRewards.size() < rewards.size()) {
+                    chunk.stateRewards.resize(rewards.size());
                 }
-                auto stateRewardsIt = stateRewards.begin();
+                auto stateRewardsIt = chunk.stateRewards.begin();
                 for (auto const& rew : rewards) {
                     auto rewardValue = parseValue(rew, placeholders, valueParser);
                     if (!storm::utility::isZero(rewardValue)) {
-                        if (stateRewardsIt->empty()) {
-                            stateRewardsIt->resize(stateSize, storm::utility::zero<ValueType>());
+                        if (stateRewardsIt->size() <= state) {
+                            stateRewardsIt->resize(state + 1, storm::utility::zero<ValueType>());
                         }
                         (*stateRewardsIt)[state] = std::move(rewardValue);
                     }
@@ -250,10 +365,11 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
                     size_t posEndObservation = line.find("}");
                     std::string observation = line.substr(1, posEndObservation - 1);
                     STORM_LOG_TRACE("State observation " << observation);
-                    modelComponents->observabilityClasses.get()[state] = std::stoi(observation);
+                    chunk.observations.resize(state + 1, 0);
+                    chunk.observations[state] = std::stoi(observation);
                     line = line.substr(posEndObservation + 1);
                 } else {
-                    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Expected an observation for state " << state << ".");
+                    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Expected an observation for state " << chunk.firstState + state << ".");
                 }
             }
 
@@ -285,10 +401,7 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
                 }
 
                 for (std::string const& label : labels) {
-                    if (!modelComponents->stateLabeling.containsLabel(label)) {
-                        modelComponents->stateLabeling.addLabel(label);
-                    }
-                    modelComponents->stateLabeling.addLabelToState(label, state);
+                    chunk.stateLabels[label].push_back(state);
                     STORM_LOG_TRACE("New label: '" << label << "'");
                 }
             }
@@ -314,10 +427,7 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
             // curString contains action name.
             if (options.buildChoiceLabeling) {
                 if (curString != "__NOLABEL__") {
-                    if (!modelComponents->choiceLabeling.get().containsLabel(curString)) {
-                        modelComponents->choiceLabeling.get().addLabel(curString);
-                    }
-                    modelComponents->choiceLabeling.get().addLabelToChoice(curString, row);
+                    chunk.choiceLabels[curString].push_back(row);
                 }
             }
             // Check for rewards
@@ -329,15 +439,15 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
                 STORM_LOG_TRACE("Action rewards: " << rewardsStr);
                 std::vector<std::string> rewards;
                 boost::split(rewards, rewardsStr, boost::is_any_of(","));
-                if (actionRewards.size() < rewards.size()) {
-                    actionRewards.resize(rewards.size());
+                if (chunk.actionRewards.size() < rewards.size()) {
+                    chunk.actionRewards.resize(rewards.size());
                 }
-                auto actionRewardsIt = actionRewards.begin();
+                auto actionRewardsIt = chunk.actionRewards.begin();
                 for (auto const& rew : rewards) {
                     auto rewardValue = parseValue(rew, placeholders, valueParser);
                     if (!storm::utility::isZero(rewardValue)) {
                         if (actionRewardsIt->size() <= row) {
-                            actionRewardsIt->resize(std::max(row + 1, stateSize), storm::utility::zero<ValueType>());
+                            actionRewardsIt->resize(row + 1, storm::utility::zero<ValueType>());
                         }
                         (*actionRewardsIt)[row] = std::move(rewardValue);
                     }
@@ -360,7 +470,7 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
         }
 
         if (storm::utility::resources::isTerminate()) {
-            std::cout << "Parsed " << state << "/" << stateSize << " states before abort.\n";
+            std::cout << "Parsed " << chunk.firstState + state << "/" << stateSize << " states before abort.\n";
             STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
             break;
         }
@@ -368,13 +478,135 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
     }  // end state iteration
     STORM_LOG_TRACE("Finished parsing");
 
+    // Build transitions of the chunk
+    chunk.numberOfStates = firstState ? 0 : state + 1;
+    chunk.numberOfRows = row + 1;
+    chunk.transitions = builder.build(chunk.numberOfRows, stateSize, nonDeterministic ? chunk.numberOfStates : 0);
+    if (continuousTime) {
+        chunk.exitRates.resize(chunk.numberOfStates, storm::utility::zero<ValueType>());
+    }
+    if (type == storm::models::ModelType::Pomdp) {
+        chunk.observations.resize(chunk.numberOfStates, 0);
+    }
+    for (auto& stateRewardVector : chunk.stateRewards) {
+        if (!stateRewardVector.empty()) {
+            stateRewardVector.resize(chunk.numberOfStates, storm::utility::zero<ValueType>());
+        }
+    }
+    for (auto& actionRewardVector : chunk.actionRewards) {
+        if (!actionRewardVector.empty()) {
+            actionRewardVector.resize(chunk.numberOfRows, storm::utility::zero<ValueType>());
+        }
+    }
+}
+
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>
+DirectEncodingParser<ValueType, RewardModelType>::assembleModelComponents(std::vector<StatesChunk>& chunks, storm::models::ModelType type, size_t stateSize,
+                                                                          size_t nrChoices, std::vector<std::string> const& rewardModelNames,
+                                                                          DirectEncodingParserOptions const& options) {
+    // Initialize
+    auto modelComponents = std::make_shared<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>();
+    bool nonDeterministic =
+        (type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp);
+    bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
+
+    // Determine the offsets of the chunks. Chunks without states (e.g. consisting only of comments) are dropped.
+    chunks.erase(std::remove_if(chunks.begin(), chunks.end(), [](StatesChunk const& chunk) { return chunk.numberOfStates == 0; }), chunks.end());
+    std::vector<uint64_t> rowOffsets(chunks.size() + 1, 0);
+    std::vector<uint64_t> entryOffsets(chunks.size() + 1, 0);
+    uint64_t numberOfRewardModels = 0;
+    for (uint64_t chunk = 0; chunk < chunks.size(); ++chunk) {
+        uint64_t const expectedFirstState = chunk == 0 ? 0 : chunks[chunk - 1].firstState + chunks[chunk - 1].numberOfStates;
+        STORM_LOG_THROW(chunks[chunk].firstState == expectedFirstState, storm::exceptions::WrongFormatException,
+                        "Expected state " << expectedFirstState << " but got state " << chunks[chunk].firstState << ".");
+        rowOffsets[chunk + 1] = rowOffsets[chunk] + chunks[chunk].numberOfRows;
+        entryOffsets[chunk + 1] = entryOffsets[chunk] + chunks[chunk].transitions.getEntryCount();
+        numberOfRewardModels = std::max({numberOfRewardModels, chunks[chunk].stateRewards.size(), chunks[chunk].actionRewards.size()});
+    }
+    uint64_t const numberOfStates = chunks.empty() ? 0 : chunks.back().firstState + chunks.back().numberOfStates;
+    uint64_t const numberOfRows = std::max<uint64_t>(1, rowOffsets.back());
+    STORM_LOG_THROW(numberOfStates <= stateSize, storm::exceptions::WrongFormatException,
+                    "Found " << numberOfStates << " states, but only " << stateSize << " states were declared.");
+
     // Build transition matrix
-    modelComponents->transitionMatrix = builder.build(row + 1, stateSize, nonDeterministic ? stateSize : 0);
+    if (chunks.size() == 1 && numberOfStates == stateSize) {
+        modelComponents->transitionMatrix = std::move(chunks.front().transitions);
+    } else {
+        std::vector<uint_fast64_t> rowIndications(numberOfRows + 1, entryOffsets.back());
+        std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>> columnsAndValues(entryOffsets.back());
+        boost::optional<std::vector<uint_fast64_t>> rowGroupIndices;
+        if (nonDeterministic) {
+            // Row groups of missing states are empty.
+            rowGroupIndices = std::vector<uint_fast64_t>(stateSize + 1, rowOffsets.back());
+        }
+        forEachIndex(options.numberOfThreads, chunks.size(), [&](uint64_t chunk) {
+            auto const& transitions = chunks[chunk].transitions;
+            for (uint64_t row = 0; row < chunks[chunk].numberOfRows; ++row) {
+                rowIndications[rowOffsets[chunk] + row] = entryOffsets[chunk] + (transitions.begin(row) - transitions.begin());
+            }
+            std::copy(transitions.begin(), transitions.begin() + transitions.getEntryCount(), columnsAndValues.begin() + entryOffsets[chunk]);
+            if (nonDeterministic) {
+                for (uint64_t state = 0; state < chunks[chunk].numberOfStates; ++state) {
+                    rowGroupIndices.get()[chunks[chunk].firstState + state] = rowOffsets[chunk] + transitions.getRowGroupIndices()[state];
+                }
+            }
+            // Release the memory of the chunk as early as possible.
+            chunks[chunk].transitions = storm::storage::SparseMatrix<ValueType>();
+        });
+        modelComponents->transitionMatrix =
+            storm::storage::SparseMatrix<ValueType>(stateSize, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+    }
     STORM_LOG_TRACE("Built matrix");
 
+    // Build state labeling, choice labeling, exit rates and observations
+    modelComponents->stateLabeling = storm::models::sparse::StateLabeling(stateSize);
+    if (options.buildChoiceLabeling) {
+        modelComponents->choiceLabeling = storm::models::sparse::ChoiceLabeling(nrChoices);
+    }
+    modelComponents->observabilityClasses = std::vector<uint32_t>(stateSize, 0);
+    if (continuousTime) {
+        modelComponents->exitRates = std::vector<ValueType>(stateSize, storm::utility::zero<ValueType>());
+        if (type == storm::models::ModelType::MarkovAutomaton) {
+            modelComponents->markovianStates = storm::storage::BitVector(stateSize);
+        }
+    }
+    // We parse rates for continuous time models.
+    if (type == storm::models::ModelType::Ctmc) {
+        modelComponents->rateTransitions = true;
+    }
+    for (uint64_t chunk = 0; chunk < chunks.size(); ++chunk) {
+        uint64_t const firstState = chunks[chunk].firstState;
+        for (auto const& labelStates : chunks[chunk].stateLabels) {
+            if (!modelComponents->stateLabeling.containsLabel(labelStates.first)) {
+                modelComponents->stateLabeling.addLabel(labelStates.first);
+            }
+            for (auto const& state : labelStates.second) {
+                modelComponents->stateLabeling.addLabelToState(labelStates.first, firstState + state);
+            }
+        }
+        for (auto const& labelChoices : chunks[chunk].choiceLabels) {
+            if (!modelComponents->choiceLabeling.get().containsLabel(labelChoices.first)) {
+                modelComponents->choiceLabeling.get().addLabel(labelChoices.first);
+            }
+            for (auto const& row : labelChoices.second) {
+                modelComponents->choiceLabeling.get().addLabelToChoice(labelChoices.first, rowOffsets[chunk] + row);
+            }
+        }
+        for (auto const& state : chunks[chunk].markovianStates) {
+            modelComponents->markovianStates.get().set(firstState + state);
+        }
+        if (continuousTime) {
+            std::copy(chunks[chunk].exitRates.begin(), chunks[chunk].exitRates.end(), modelComponents->exitRates.get().begin() + firstState);
+        }
+        if (type == storm::models::ModelType::Pomdp) {
+            std::copy(chunks[chunk].observations.begin(), chunks[chunk].observations.end(),
+                      modelComponents->observabilityClasses.get().begin() + firstState);
+        }
+    }
+
     // Build reward models
-    uint64_t numRewardModels = std::max(stateRewards.size(), actionRewards.size());
-    for (uint64_t i = 0; i < numRewardModels; ++i) {
+    for (uint64_t i = 0; i < numberOfRewardModels; ++i) {
         std::string rewardModelName;
         if (rewardModelNames.size() <= i) {
             rewardModelName = "rew" + std::to_string(i);
@@ -382,12 +614,21 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
             rewardModelName = rewardModelNames[i];
         }
         boost::optional<std::vector<ValueType>> stateRewardVector, actionRewardVector;
-        if (i < stateRewards.size() && !stateRewards[i].empty()) {
-            stateRewardVector = std::move(stateRewards[i]);
-        }
-        if (i < actionRewards.size() && !actionRewards[i].empty()) {
-            actionRewards[i].resize(row + 1, storm::utility::zero<ValueType>());
-            actionRewardVector = std::move(actionRewards[i]);
+        for (uint64_t chunk = 0; chunk < chunks.size(); ++chunk) {
+            if (i < chunks[chunk].stateRewards.size() && !chunks[chunk].stateRewards[i].empty()) {
+                if (!stateRewardVector) {
+                    stateRewardVector = std::vector<ValueType>(stateSize, storm::utility::zero<ValueType>());
+                }
+                std::copy(chunks[chunk].stateRewards[i].begin(), chunks[chunk].stateRewards[i].end(),
+                          stateRewardVector.get().begin() + chunks[chunk].firstState);
+            }
+            if (i < chunks[chunk].actionRewards.size() && !chunks[chunk].actionRewards[i].empty()) {
+                if (!actionRewardVector) {
+                    actionRewardVector = std::vector<ValueType>(numberOfRows, storm::utility::zero<ValueType>());
+                }
+                std::copy(chunks[chunk].actionRewards[i].begin(), chunks[chunk].actionRewards[i].end(),
+                          actionRewardVector.get().begin() + rowOffsets[chunk]);
+            }
         }
         modelComponents->rewardModels.emplace(
             rewardModelName, storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewardVector), std::move(actionRewardVector)));
@@ -1,7 +1,10 @@
 #ifndef STORM_PARSER_DIRECTENCODINGPARSER_H_
 #define STORM_PARSER_DIRECTENCODINGPARSER_H_
 
+#include <functional>
+
 #include "storm-parsers/parser/ValueParser.h"
+#include "storm/environment/ParallelEnvironment.h"
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/storage/sparse/ModelComponents.h"
@@ -11,6 +14,8 @@ namespace parser {
 
 struct DirectEncodingParserOptions {
     bool buildChoiceLabeling = false;
+    // If more than one thread is given, the states are split into chunks that are parsed in parallel.
+    uint64_t numberOfThreads = storm::ParallelEnvironment().getNumberOfThreads();
 };
 /*!
  *	Parser for models in the DRN format with explicit encoding.
@@ -29,6 +34,9 @@ class DirectEncodingParser {
         std::string const& fil, DirectEncodingParserOptions const& options = DirectEncodingParserOptions());
 
    private:
+    // The states of a contiguous part of the model. Rows and row groups are numbered relative to the part.
+    struct StatesChunk;
+
     /*!
      * Parse states and return transition matrix.
      *
@@ -45,6 +53,44 @@ class DirectEncodingParser {
         std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
         ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
 
+    /*!
+     * Parse the states given in the (memory-mapped) range in parallel. The range is split at the beginning of states
+     * into chunks that are parsed independently and then stitched together.
+     *
+     * @param begin Beginning of the states.
+     * @param end End of the states.
+     * @param type Model type.
+     * @param stateSize No. of states
+     * @param placeholders Placeholders for values.
+     * @param valueParser Value parser.
+     * @param rewardModelNames Names of reward models.
+     *
+     * @return Model components.
+     */
+    static std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> parseStatesInParallel(
+        char const* begin, char const* end, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+        std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+        std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
+
+    /*!
+     * Parse the states given by the lines that are successively obtained from the given function.
+     *
+     * @param getNextLine Function that retrieves the next line and returns false if there is none.
+     * @param chunk The chunk in which to store the parsed states.
+     */
+    static void parseStatesChunk(std::function<bool(std::string&)> const& getNextLine, storm::models::ModelType type, size_t stateSize,
+                                 std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+                                 DirectEncodingParserOptions const& options, StatesChunk& chunk);
+
+    /*!
+     * Stitch the given chunks of consecutive states together.
+     *
+     * @return Model components.
+     */
+    static std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> assembleModelComponents(
+        std::vector<StatesChunk>& chunks, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::vector<std::string> const& rewardModelNames,
+        DirectEncodingParserOptions const& options);
+
     /*!
      * Parse value from string while using placeholders.
      * @param valueStr String.
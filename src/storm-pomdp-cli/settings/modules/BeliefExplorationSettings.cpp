@@ -6,6 +6,7 @@
 #include "storm/settings/OptionBuilder.h"
 #include "storm/settings/ArgumentBuilder.h"
 
+#include "storm/environment/ParallelEnvironment.h"
 #include "storm/utility/NumberTraits.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm-pomdp/modelchecker/BeliefExplorationPomdpModelCheckerOptions.h"
@@ -168,6 +169,9 @@ namespace storm {
                     }
                 }
                 options.dynamicTriangulation = isDynamicTriangulationModeSet();
+                // The number of threads is taken from the core settings
+                storm::ParallelEnvironment parallelEnvironment;
+                options.numberOfThreads = parallelEnvironment.isParallel() ? parallelEnvironment.getNumberOfThreads() : 1;
             }
             
             template void BeliefExplorationSettings::setValuesInOptionsStruct<double>(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<double>& options) const;
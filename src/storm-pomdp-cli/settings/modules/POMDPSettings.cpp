@@ -17,6 +17,7 @@ namespace storm {
             const std::string exportAsParametricModelOption = "parametric-drn";
             const std::string beliefExplorationOption = "belief-exploration";
             std::vector<std::string> beliefExplorationModes = {"both", "discretize", "unfold"};
+            const std::string pointBasedOption = "point-based";
             const std::string qualitativeReductionOption = "qualitativereduction";
             const std::string analyzeUniqueObservationsOption = "uniqueobservations";
             const std::string selfloopReductionOption = "selfloopreduction";
@@ -35,6 +36,7 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, memoryBoundOption, false, "Sets the maximal number of allowed memory states (1 means memoryless schedulers).").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("bound", "The maximal number of memory states.").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, memoryPatternOption, false, "Sets the pattern of the considered memory structure").addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "Pattern name.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(memoryPatterns)).setDefaultValueString("full").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, beliefExplorationOption, false,"Analyze the POMDP by exploring the belief state-space.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("mode", "Sets whether lower, upper, or interval result bounds are computed.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(beliefExplorationModes)).setDefaultValueString("both").makeOptional().build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, pointBasedOption, false, "Analyze the POMDP with point-based value iteration on alpha-vectors.").addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("prec", "The goal precision, i.e., the maximal difference between the lower and the upper bound.").setDefaultValueDouble(1e-4).makeOptional().addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleGreaterEqualValidator(0.0)).build()).addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("trials", "The maximal number of trials (0 means no limit).").setDefaultValueUnsignedInteger(0).makeOptional().build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, checkFullyObservableOption, false, "Performs standard model checking on the underlying MDP").build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, isQualitativeOption, false, "Sets the option qualitative analysis").build());
             }
@@ -77,6 +79,18 @@ namespace storm {
                 return isBeliefExplorationSet() && (arg == "unfold" || arg == "both");
             }
 
+            bool POMDPSettings::isPointBasedSet() const {
+                return this->getOption(pointBasedOption).getHasOptionBeenSet();
+            }
+
+            double POMDPSettings::getPointBasedPrecision() const {
+                return this->getOption(pointBasedOption).getArgumentByName("prec").getValueAsDouble();
+            }
+
+            uint64_t POMDPSettings::getPointBasedTrialLimit() const {
+                return this->getOption(pointBasedOption).getArgumentByName("trials").getValueAsUnsignedInteger();
+            }
+
             bool POMDPSettings::isCheckFullyObservableSet() const {
                 return this->getOption(checkFullyObservableOption).getHasOptionBeenSet();
             }
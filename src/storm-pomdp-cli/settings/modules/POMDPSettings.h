@@ -30,6 +30,9 @@ namespace storm {
                 bool isBeliefExplorationSet() const;
                 bool isBeliefExplorationDiscretizeSet() const;
                 bool isBeliefExplorationUnfoldSet() const;
+                bool isPointBasedSet() const;
+                double getPointBasedPrecision() const;
+                uint64_t getPointBasedTrialLimit() const;
                 bool isAnalyzeUniqueObservationsSet() const;
                 bool isSelfloopReductionSet() const;
                 bool isCheckFullyObservableSet() const;
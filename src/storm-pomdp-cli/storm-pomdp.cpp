@@ -23,6 +23,7 @@
 #include "storm-pomdp/analysis/UniqueObservationStates.h"
 #include "storm-pomdp/analysis/QualitativeAnalysisOnGraphs.h"
 #include "storm-pomdp/modelchecker/BeliefExplorationPomdpModelChecker.h"
+#include "storm-pomdp/modelchecker/PointBasedPomdpModelChecker.h"
 #include "storm-pomdp/analysis/FormulaInformation.h"
 #include "storm-pomdp/analysis/IterativePolicySearch.h"
 #include "storm-pomdp/analysis/OneShotPolicySearch.h"
@@ -38,6 +39,7 @@
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/exceptions/NotSupportedException.h"
 
+#include <type_traits>
 #include <typeinfo>
 
 namespace storm {
@@ -278,6 +280,28 @@ namespace storm {
                     STORM_PRINT_AND_LOG('\n');
                     analysisPerformed = true;
                 }
+                if (pomdpSettings.isPointBasedSet()) {
+                    STORM_LOG_THROW((std::is_same<ValueType, double>::value), storm::exceptions::NotSupportedException, "Point-based value iteration is only supported for floating point numbers.");
+                    STORM_PRINT_AND_LOG("Applying point-based value iteration... ");
+                    if constexpr (std::is_same<ValueType, double>::value) {
+                        storm::pomdp::modelchecker::PointBasedPomdpModelCheckerOptions<ValueType> options;
+                        options.precision = storm::utility::convertNumber<ValueType>(pomdpSettings.getPointBasedPrecision());
+                        if (pomdpSettings.getPointBasedTrialLimit() > 0) {
+                            options.trialLimit = pomdpSettings.getPointBasedTrialLimit();
+                        }
+                        storm::pomdp::modelchecker::PointBasedPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(pomdp, options);
+                        auto result = checker.check(formula);
+                        checker.printStatisticsToStream(std::cout);
+                        if (storm::utility::resources::isTerminate()) {
+                            STORM_PRINT_AND_LOG("\nResult till abort: ")
+                        } else {
+                            STORM_PRINT_AND_LOG("\nResult: ")
+                        }
+                        printResult(result.lowerBound, result.upperBound);
+                        STORM_PRINT_AND_LOG('\n');
+                    }
+                    analysisPerformed = true;
+                }
                 if (pomdpSettings.isQualitativeAnalysisSet()) {
                     performQualitativeAnalysis(pomdp, formulaInfo, formula);
                     analysisPerformed = true;
@@ -1,5 +1,7 @@
 #include "storm-pomdp/builder/BeliefMdpExplorer.h"
 
+#include <unordered_map>
+
 #include "storm-parsers/api/properties.h"
 #include "storm/api/properties.h"
 
@@ -151,6 +153,18 @@ namespace storm {
             return mdpStateToBeliefIdMap[currentMdpState];
         }
 
+        template<typename PomdpType, typename BeliefValueType>
+        std::vector<typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId> BeliefMdpExplorer<PomdpType, BeliefValueType>::getBeliefsToExplore() const {
+            STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
+            std::vector<BeliefId> result;
+            for (auto const &mdpState : mdpStatesToExplore) {
+                if ((!exploredMdp || mdpState >= exploredMdp->getNumberOfStates()) && mdpStateToBeliefIdMap[mdpState] != beliefManager->noId()) {
+                    result.push_back(mdpStateToBeliefIdMap[mdpState]);
+                }
+            }
+            return result;
+        }
+
         template<typename PomdpType, typename BeliefValueType>
         void BeliefMdpExplorer<PomdpType, BeliefValueType>::addTransitionsToExtraStates(uint64_t const &localActionIndex, ValueType const &targetStateValue,
                                                                                         ValueType const &bottomStateValue) {
@@ -58,6 +58,12 @@ namespace storm {
 
             BeliefId exploreNextState();
 
+            /*!
+             * Retrieves the beliefs that are still waiting for their exploration (in the order in which they will be explored).
+             * States that already have behavior from a previous exploration are not included.
+             */
+            std::vector<BeliefId> getBeliefsToExplore() const;
+
             void addTransitionsToExtraStates(uint64_t const &localActionIndex, ValueType const &targetStateValue = storm::utility::zero<ValueType>(),
                                              ValueType const &bottomStateValue = storm::utility::zero<ValueType>());
 
@@ -558,6 +558,8 @@ namespace storm {
                 bool timeLimitExceeded = false;
                 std::map<uint32_t, typename ExplorerType::SuccessorObservationInformation> gatheredSuccessorObservations; // Declare here to avoid reallocations
                 uint64_t numRewiredOrExploredStates = 0;
+                // The successors of the current state (reused for all states and actions)
+                std::vector<std::pair<typename BeliefManagerType::BeliefId, ValueType>> successorGridPoints;
                 while (overApproximation->hasUnexploredState()) {
                     if (!timeLimitExceeded && options.explorationTimeLimit && static_cast<uint64_t>(explorationTime.getTimeInSeconds()) > options.explorationTimeLimit.get()) {
                         STORM_LOG_INFO("Exploration time limit exceeded.");
@@ -568,11 +570,27 @@ namespace storm {
 
                     uint64_t currId = overApproximation->exploreNextState();
                     bool hasOldBehavior = refine && overApproximation->currentStateHasOldBehavior();
+                    uint32_t currObservation = beliefManager->getBeliefObservation(currId);
+                    if (options.numberOfThreads > 1 && !hasOldBehavior && !timeLimitExceeded && targetObservations.count(currObservation) == 0 &&
+                        numRewiredOrExploredStates < heuristicParameters.sizeThreshold && !beliefManager->isExpansionPrepared(currId)) {
+                        // Expand the current belief together with the beliefs that are waiting for their exploration in parallel.
+                        // We skip beliefs that are targets or that will be truncated and do not prepare more beliefs than can still be explored.
+                        std::vector<typename BeliefManagerType::BeliefId> beliefsToExpand = {currId};
+                        for (auto const& beliefId : overApproximation->getBeliefsToExplore()) {
+                            if (numRewiredOrExploredStates + beliefsToExpand.size() >= heuristicParameters.sizeThreshold) {
+                                break;
+                            }
+                            if (targetObservations.count(beliefManager->getBeliefObservation(beliefId)) == 0 &&
+                                getGap(overApproximation->computeLowerValueBoundAtBelief(beliefId), overApproximation->computeUpperValueBoundAtBelief(beliefId)) > heuristicParameters.gapThreshold) {
+                                beliefsToExpand.push_back(beliefId);
+                            }
+                        }
+                        beliefManager->prepareExpansionsAndTriangulations(beliefsToExpand, observationResolutionVector, options.numberOfThreads);
+                    }
                     if (!hasOldBehavior) {
                         STORM_LOG_INFO_COND(!fixPoint, "Not reaching a refinement fixpoint because a new state is explored");
                         fixPoint = false; // Exploring a new state!
                     }
-                    uint32_t currObservation = beliefManager->getBeliefObservation(currId);
                     if (targetObservations.count(currObservation) != 0) {
                         overApproximation->setCurrentStateIsTarget();
                         overApproximation->addSelfloopTransition();
@@ -674,7 +692,7 @@ namespace storm {
                                 expandedAtLeastOneAction = true;
                                 if (!truncateAllActions) {
                                     // Cases 1.1, 2.1, or 3.1
-                                    auto successorGridPoints = beliefManager->expandAndTriangulate(currId, action, observationResolutionVector);
+                                    beliefManager->expandAndTriangulate(currId, action, observationResolutionVector, successorGridPoints);
                                     for (auto const& successor : successorGridPoints) {
                                         overApproximation->addTransitionToBelief(action, successor.first, successor.second, false);
                                     }
@@ -685,7 +703,7 @@ namespace storm {
                                     // Cases 1.2 or 2.2
                                     ValueType truncationProbability = storm::utility::zero<ValueType>();
                                     ValueType truncationValueBound = storm::utility::zero<ValueType>();
-                                    auto successorGridPoints = beliefManager->expandAndTriangulate(currId, action, observationResolutionVector);
+                                    beliefManager->expandAndTriangulate(currId, action, observationResolutionVector, successorGridPoints);
                                     for (auto const& successor : successorGridPoints) {
                                         bool added = overApproximation->addTransitionToBelief(action, successor.first, successor.second, true);
                                         if (!added) {
@@ -723,10 +741,12 @@ namespace storm {
                         statistics.overApproximationBuildAborted = true;
                         statistics.overApproximationStates = overApproximation->getCurrentNumberOfMdpStates();
                     }
+                    beliefManager->clearPreparedExpansions();
                     statistics.overApproximationBuildTime.stop();
                     return false;
                 }
                 
+                beliefManager->clearPreparedExpansions();
                 overApproximation->finishExploration();
                 statistics.overApproximationBuildTime.stop();
                 
@@ -766,6 +786,8 @@ namespace storm {
                     explorationTime.start();
                 }
                 bool timeLimitExceeded = false;
+                // The successors of the current state (reused for all states and actions)
+                std::vector<std::pair<typename BeliefManagerType::BeliefId, ValueType>> successors;
                 while (underApproximation->hasUnexploredState()) {
                     if (!timeLimitExceeded && options.explorationTimeLimit && static_cast<uint64_t>(explorationTime.getTimeInSeconds()) > options.explorationTimeLimit.get()) {
                         STORM_LOG_INFO("Exploration time limit exceeded.");
@@ -775,6 +797,22 @@ namespace storm {
                     
                     uint32_t currObservation = beliefManager->getBeliefObservation(currId);
                     bool stateAlreadyExplored = refine && underApproximation->currentStateHasOldBehavior() && !underApproximation->getCurrentStateWasTruncated();
+                    if (options.numberOfThreads > 1 && !stateAlreadyExplored && !timeLimitExceeded && targetObservations.count(currObservation) == 0 &&
+                        underApproximation->getCurrentNumberOfMdpStates() < heuristicParameters.sizeThreshold && !beliefManager->isExpansionPrepared(currId)) {
+                        // Expand the current belief together with the beliefs that are waiting for their exploration in parallel.
+                        // We skip beliefs that are targets or that will be truncated and do not prepare more beliefs than there are states left until the size threshold.
+                        std::vector<typename BeliefManagerType::BeliefId> beliefsToExpand = {currId};
+                        for (auto const& beliefId : underApproximation->getBeliefsToExplore()) {
+                            if (underApproximation->getCurrentNumberOfMdpStates() + beliefsToExpand.size() > heuristicParameters.sizeThreshold) {
+                                break;
+                            }
+                            if (targetObservations.count(beliefManager->getBeliefObservation(beliefId)) == 0 &&
+                                getGap(underApproximation->computeLowerValueBoundAtBelief(beliefId), underApproximation->computeUpperValueBoundAtBelief(beliefId)) >= heuristicParameters.gapThreshold) {
+                                beliefsToExpand.push_back(beliefId);
+                            }
+                        }
+                        beliefManager->prepareExpansions(beliefsToExpand, options.numberOfThreads);
+                    }
                     if (!stateAlreadyExplored || timeLimitExceeded) {
                         fixPoint = false;
                     }
@@ -804,7 +842,7 @@ namespace storm {
                             } else {
                                 ValueType truncationProbability = storm::utility::zero<ValueType>();
                                 ValueType truncationValueBound = storm::utility::zero<ValueType>();
-                                auto successors = beliefManager->expand(currId, action);
+                                beliefManager->expand(currId, action, successors);
                                 for (auto const& successor : successors) {
                                     bool added = underApproximation->addTransitionToBelief(action, successor.first, successor.second, stopExploration);
                                     if (!added) {
@@ -842,10 +880,12 @@ namespace storm {
                         statistics.underApproximationBuildAborted = true;
                         statistics.underApproximationStates = underApproximation->getCurrentNumberOfMdpStates();
                     }
+                    beliefManager->clearPreparedExpansions();
                     statistics.underApproximationBuildTime.stop();
                     return false;
                 }
                 
+                beliefManager->clearPreparedExpansions();
                 underApproximation->finishExploration();
                 statistics.underApproximationBuildTime.stop();
 
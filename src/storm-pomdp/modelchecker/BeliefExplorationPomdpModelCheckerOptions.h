@@ -39,6 +39,7 @@ namespace storm {
                 
                 ValueType numericPrecision = storm::NumberTraits<ValueType>::IsExact ? storm::utility::zero<ValueType>() : storm::utility::convertNumber<ValueType>(1e-9); /// Used to decide whether two beliefs are equal
                 bool dynamicTriangulation = true; // Sets whether the triangulation is done in a dynamic way (yielding more precise triangulations)
+                uint64_t numberOfThreads = 1; // The number of threads that are used to expand beliefs
             };
         }
     }
@@ -0,0 +1,550 @@
+#include "storm-pomdp/modelchecker/PointBasedPomdpModelChecker.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "storm-pomdp/analysis/FormulaInformation.h"
+#include "storm-pomdp/modelchecker/TrivialPomdpValueBoundsModelChecker.h"
+#include "storm-pomdp/transformer/MakeStateSetObservationClosed.h"
+
+#include "storm/logic/Formulas.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace pomdp {
+        namespace modelchecker {
+
+            template<typename PomdpModelType>
+            PointBasedPomdpModelChecker<PomdpModelType>::Statistics::Statistics() : trials(0), backups(0), sampledBeliefs(0), alphaVectors(0), points(0), prunedAlphaVectors(0), aborted(false) {
+                // Intentionally left empty
+            }
+
+            template<typename PomdpModelType>
+            PointBasedPomdpModelChecker<PomdpModelType>::PointBasedPomdpModelChecker(std::shared_ptr<PomdpModelType> pomdp, Options options) : inputPomdp(pomdp), options(options) {
+                STORM_LOG_ASSERT(inputPomdp, "The given POMDP is not initialized.");
+                STORM_LOG_THROW(inputPomdp->isCanonic(), storm::exceptions::InvalidArgumentException, "Point-based model checking requires a canonic POMDP.");
+                STORM_LOG_THROW(options.maxTrialDepth > 0, storm::exceptions::InvalidArgumentException, "The maximal depth of a trial must be positive.");
+            }
+
+            template<typename PomdpModelType>
+            typename PointBasedPomdpModelChecker<PomdpModelType>::Result PointBasedPomdpModelChecker<PomdpModelType>::check(storm::logic::Formula const& formula) {
+                // Potentially reset preprocessed model from previous call
+                preprocessedPomdp.reset();
+
+                // Reset all collected statistics
+                statistics = Statistics();
+                statistics.totalTime.start();
+                // Extract the relevant information from the formula
+                auto formulaInfo = storm::pomdp::analysis::getFormulaInformation(pomdp(), formula);
+
+                boost::optional<std::string> rewardModelName;
+                std::set<uint32_t> targetObservationSet;
+                if (formulaInfo.isNonNestedReachabilityProbability() || formulaInfo.isNonNestedExpectedRewardFormula()) {
+                    if (formulaInfo.isNonNestedReachabilityProbability()) {
+                        if (!formulaInfo.getSinkStates().empty()) {
+                            auto reachableFromSinkStates = storm::utility::graph::getReachableStates(pomdp().getTransitionMatrix(), formulaInfo.getSinkStates().states, formulaInfo.getSinkStates().states, ~formulaInfo.getSinkStates().states);
+                            reachableFromSinkStates &= ~formulaInfo.getSinkStates().states;
+                            STORM_LOG_THROW(reachableFromSinkStates.empty(), storm::exceptions::NotSupportedException, "There are sink states that can reach non-sink states. This is currently not supported");
+                        }
+                    } else {
+                        rewardModelName = formulaInfo.getRewardModelName();
+                    }
+                } else {
+                    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Unsupported formula '" << formula << "'.");
+                }
+
+                // Compute some initial bounds on the values for each state of the pomdp
+                auto initialPomdpValueBounds = TrivialPomdpValueBoundsModelChecker<storm::models::sparse::Pomdp<ValueType>>(pomdp()).getValueBounds(formula, formulaInfo);
+                uint64_t initialPomdpState = pomdp().getInitialStates().getNextSetIndex(0);
+                Result result(initialPomdpValueBounds.getHighestLowerBound(initialPomdpState), initialPomdpValueBounds.getSmallestUpperBound(initialPomdpState));
+                STORM_LOG_INFO("Initial value bounds are [" << result.lowerBound << ", " <<  result.upperBound << "]");
+
+                if (formulaInfo.getTargetStates().observationClosed) {
+                    targetObservationSet = formulaInfo.getTargetStates().observations;
+                } else {
+                    storm::transformer::MakeStateSetObservationClosed<ValueType> obsCloser(inputPomdp);
+                    std::tie(preprocessedPomdp, targetObservationSet) = obsCloser.transform(formulaInfo.getTargetStates().states);
+                }
+
+                initialize(targetObservationSet, formulaInfo.minimize(), rewardModelName, initialPomdpValueBounds);
+                updateResult(result);
+
+                storm::utility::Stopwatch explorationTime(true);
+                while (result.diff() > options.precision) {
+                    if (storm::utility::resources::isTerminate()) {
+                        statistics.aborted = true;
+                        break;
+                    }
+                    if (options.trialLimit && statistics.trials >= options.trialLimit.get()) {
+                        STORM_LOG_INFO("Trial limit exceeded.");
+                        break;
+                    }
+                    if (options.timeLimit && static_cast<uint64_t>(explorationTime.getTimeInSeconds()) >= options.timeLimit.get()) {
+                        STORM_LOG_INFO("Time limit exceeded.");
+                        break;
+                    }
+
+                    bool improved = performTrial();
+                    ++statistics.trials;
+                    if (options.pruningInterval > 0 && statistics.trials % options.pruningInterval == 0) {
+                        pruneAlphaVectors();
+                    }
+                    updateResult(result);
+                    STORM_LOG_INFO("Bounds after " << statistics.trials << " trials are [" << result.lowerBound << ", " << result.upperBound << "]");
+                    if (!improved) {
+                        // Further trials would sample the same beliefs again
+                        STORM_LOG_INFO("Sampled beliefs do not improve the bounds any further.");
+                        break;
+                    }
+                }
+
+                for (auto const& data : observations) {
+                    statistics.alphaVectors += data.states.empty() ? 0 : data.alphaVectors.size() / data.states.size();
+                    statistics.points += data.points.size();
+                }
+                statistics.sampledBeliefs = sampledBeliefs.getNumberOfSetBits();
+                // Release the memory that is only needed during the computation
+                observations.clear();
+                beliefManager.reset();
+                statistics.totalTime.stop();
+                return result;
+            }
+
+            template<typename PomdpModelType>
+            void PointBasedPomdpModelChecker<PomdpModelType>::printStatisticsToStream(std::ostream& stream) const {
+                stream << "##### Point-based Value Iteration Statistics ######\n";
+                stream << "# Input model: \n";
+                pomdp().printModelInformationToStream(stream);
+                stream << "# Max. Number of states with same observation: " << pomdp().getMaxNrStatesWithSameObservation() << '\n';
+                if (statistics.aborted) {
+                    stream << "# Computation aborted early\n";
+                }
+                stream << "# Total check time: " << statistics.totalTime << '\n';
+                stream << "# Number of trials: " << statistics.trials << '\n';
+                stream << "# Number of backups: " << statistics.backups << '\n';
+                stream << "# Number of sampled beliefs: " << statistics.sampledBeliefs << '\n';
+                stream << "# Number of alpha-vectors: " << statistics.alphaVectors << " (" << statistics.prunedAlphaVectors << " pruned)\n";
+                stream << "# Number of beliefs with improved optimistic values: " << statistics.points << '\n';
+                stream << "##########################################\n";
+            }
+
+            template<typename PomdpModelType>
+            PomdpModelType const& PointBasedPomdpModelChecker<PomdpModelType>::pomdp() const {
+                if (preprocessedPomdp) {
+                    return *preprocessedPomdp;
+                } else {
+                    return *inputPomdp;
+                }
+            }
+
+            template<typename PomdpModelType>
+            void PointBasedPomdpModelChecker<PomdpModelType>::initialize(std::set<uint32_t> const& targetObservationSet, bool min, boost::optional<std::string> const& rewardModelName, TrivialPomdpValueBounds<ValueType>& pomdpValueBounds) {
+                auto const& model = pomdp();
+                auto const& transitionMatrix = model.getTransitionMatrix();
+                auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+                minimize = min;
+                computeRewards = rewardModelName.is_initialized();
+                targetValue = rewardModelName ? storm::utility::zero<ValueType>() : storm::utility::one<ValueType>();
+                targetObservations = storm::storage::BitVector(model.getNrObservations(), false);
+                for (auto const& observation : targetObservationSet) {
+                    targetObservations.set(observation, true);
+                }
+
+                beliefManager = std::make_shared<BeliefManagerType>(model, options.numericPrecision, BeliefManagerType::TriangulationMode::Static);
+                std::vector<ValueType> actionRewards;
+                if (rewardModelName) {
+                    beliefManager->setRewardModel(rewardModelName);
+                    actionRewards = model.getRewardModel(rewardModelName.get()).getTotalRewardVector(transitionMatrix);
+                }
+                sampledBeliefs = storm::storage::BitVector(beliefManager->getNumberOfBeliefIds(), false);
+
+                // The gather instructions of the SIMD kernels take signed 32-bit indices
+                instructionSet = storm::solver::simd::getBestSupportedInstructionSet();
+                if (model.getNumberOfStates() >= storm::solver::simd::getMaximalColumnCount(instructionSet)) {
+                    instructionSet = storm::solver::simd::InstructionSet::Portable;
+                }
+                STORM_LOG_THROW(model.getNumberOfStates() < storm::solver::simd::getMaximalColumnCount(instructionSet), storm::exceptions::NotSupportedException, "The POMDP has too many states.");
+
+                observations.assign(model.getNrObservations(), ObservationData());
+                localStateIndices.resize(model.getNumberOfStates());
+                for (uint64_t state = 0; state < model.getNumberOfStates(); ++state) {
+                    auto& states = observations[model.getObservation(state)].states;
+                    localStateIndices[state] = states.size();
+                    states.push_back(state);
+                }
+
+                // The optimistic values are given by the fully observable MDP, the pessimistic values by schedulers that only depend on the observations.
+                auto const& pessimisticBounds = min ? pomdpValueBounds.upper : pomdpValueBounds.lower;
+                std::vector<ValueType> alphaVector;
+                for (uint64_t observation = 0; observation < observations.size(); ++observation) {
+                    auto& data = observations[observation];
+                    if (data.states.empty() || targetObservations.get(observation)) {
+                        continue;
+                    }
+                    uint64_t numberOfActions = transitionMatrix.getRowGroupSize(data.states.front());
+                    for (uint64_t action = 0; action < numberOfActions; ++action) {
+                        ActionMatrix matrix;
+                        matrix.rowIndications.push_back(0);
+                        for (auto const& state : data.states) {
+                            uint64_t row = rowGroupIndices[state] + action;
+                            for (auto const& entry : transitionMatrix.getRow(row)) {
+                                if (!storm::utility::isZero(entry.getValue())) {
+                                    matrix.columns.push_back(entry.getColumn());
+                                    matrix.values.push_back(entry.getValue());
+                                }
+                            }
+                            matrix.rowIndications.push_back(matrix.columns.size());
+                            matrix.rewards.push_back(actionRewards.empty() ? storm::utility::zero<ValueType>() : actionRewards[row]);
+                        }
+                        for (auto const& column : matrix.columns) {
+                            matrix.successorObservations.push_back(model.getObservation(column));
+                        }
+                        std::sort(matrix.successorObservations.begin(), matrix.successorObservations.end());
+                        matrix.successorObservations.erase(std::unique(matrix.successorObservations.begin(), matrix.successorObservations.end()), matrix.successorObservations.end());
+                        data.actions.push_back(std::move(matrix));
+                    }
+
+                    for (auto const& state : data.states) {
+                        data.cornerValues.push_back(min ? pomdpValueBounds.getHighestLowerBound(state) : pomdpValueBounds.getSmallestUpperBound(state));
+                        STORM_LOG_THROW(!storm::utility::isInfinity(data.cornerValues.back()), storm::exceptions::NotSupportedException, "Point-based model checking requires finite values on the fully observable MDP.");
+                    }
+                    for (auto const& bound : pessimisticBounds) {
+                        alphaVector.clear();
+                        for (auto const& state : data.states) {
+                            alphaVector.push_back(bound[state]);
+                        }
+                        addAlphaVector(data, alphaVector);
+                    }
+                }
+                denseBelief.assign(model.getNumberOfStates(), storm::utility::zero<ValueType>());
+                successorValues.assign(model.getNumberOfStates(), storm::utility::zero<ValueType>());
+            }
+
+            template<typename PomdpModelType>
+            bool PointBasedPomdpModelChecker<PomdpModelType>::performTrial() {
+                trial.clear();
+                BeliefId currentBelief = beliefManager->getInitialBelief();
+                while (true) {
+                    trial.push_back(currentBelief);
+                    if (isTargetBelief(currentBelief) || trial.size() >= options.maxTrialDepth) {
+                        break;
+                    }
+                    if (std::abs(computeOptimisticValue(currentBelief) - computePessimisticValue(currentBelief)) <= options.precision) {
+                        break;
+                    }
+
+                    // Take the action that is optimal w.r.t. the optimistic bound
+                    uint64_t numberOfActions = beliefManager->getBeliefNumberOfChoices(currentBelief);
+                    uint64_t bestAction = 0;
+                    ValueType bestActionValue = computeOptimisticActionValue(currentBelief, 0, successors);
+                    for (uint64_t action = 1; action < numberOfActions; ++action) {
+                        ValueType actionValue = computeOptimisticActionValue(currentBelief, action, successors);
+                        if (isBetter(actionValue, bestActionValue)) {
+                            bestAction = action;
+                            bestActionValue = actionValue;
+                        }
+                    }
+
+                    // Continue with the successor with the largest weighted gap between the bounds
+                    beliefManager->expand(currentBelief, bestAction, successors);
+                    BeliefId nextBelief = beliefManager->noId();
+                    ValueType largestWeightedGap = storm::utility::zero<ValueType>();
+                    for (auto const& successor : successors) {
+                        if (isTargetBelief(successor.first)) {
+                            continue;
+                        }
+                        ValueType weightedGap = successor.second * std::abs(computeOptimisticValue(successor.first) - computePessimisticValue(successor.first));
+                        if (weightedGap > largestWeightedGap) {
+                            nextBelief = successor.first;
+                            largestWeightedGap = weightedGap;
+                        }
+                    }
+                    if (nextBelief == beliefManager->noId()) {
+                        break;
+                    }
+                    currentBelief = nextBelief;
+                }
+
+                bool improved = false;
+                for (auto beliefIt = trial.rbegin(); beliefIt != trial.rend(); ++beliefIt) {
+                    if (!isTargetBelief(*beliefIt) && backup(*beliefIt)) {
+                        improved = true;
+                    }
+                }
+                return improved;
+            }
+
+            template<typename PomdpModelType>
+            bool PointBasedPomdpModelChecker<PomdpModelType>::backup(BeliefId const& beliefId) {
+                ++statistics.backups;
+                uint32_t observation = beliefManager->getBeliefObservation(beliefId);
+                uint64_t numberOfStates = observations[observation].states.size();
+                uint64_t numberOfActions = observations[observation].actions.size();
+                candidateAlphaVector.resize(numberOfStates);
+                bestAlphaVector.resize(numberOfStates);
+
+                ValueType bestPessimisticValue = storm::utility::zero<ValueType>();
+                ValueType bestOptimisticValue = storm::utility::zero<ValueType>();
+                for (uint64_t action = 0; action < numberOfActions; ++action) {
+                    // This might add new beliefs
+                    ValueType optimisticValue = computeOptimisticActionValue(beliefId, action, successors);
+                    auto const& matrix = observations[observation].actions[action];
+
+                    // The new alpha-vector is given by the alpha-vectors of the successor observations, i.e., by a plan that depends on the next observation.
+                    // Every choice of these vectors yields a valid bound. At the successor beliefs, we take the optimal vectors. For the observations that
+                    // are only reached from states outside of the belief, we take the most recently added vectors.
+                    for (auto const& successorObservation : matrix.successorObservations) {
+                        auto const& successorData = observations[successorObservation];
+                        if (targetObservations.get(successorObservation)) {
+                            for (auto const& state : successorData.states) {
+                                successorValues[state] = targetValue;
+                            }
+                        } else {
+                            setSuccessorValues(successorData, successorData.alphaVectors.size() / successorData.states.size() - 1);
+                        }
+                    }
+                    for (auto const& successor : successors) {
+                        uint32_t successorObservation = beliefManager->getBeliefObservation(successor.first);
+                        if (!targetObservations.get(successorObservation)) {
+                            auto const& successorData = observations[successorObservation];
+                            loadBelief(successor.first);
+                            setSuccessorValues(successorData, getOptimalAlphaVector(successorData));
+                        }
+                    }
+                    storm::solver::simd::multiplyRows(instructionSet, matrix.rowIndications.data(), matrix.columns.data(), matrix.values.data(), successorValues.data(), matrix.rewards.data(), 0, numberOfStates, candidateAlphaVector.data());
+
+                    loadBelief(beliefId);
+                    ValueType pessimisticValue = multiplyWithLoadedBelief(candidateAlphaVector.data());
+                    if (action == 0 || isBetter(pessimisticValue, bestPessimisticValue)) {
+                        bestPessimisticValue = pessimisticValue;
+                        std::swap(bestAlphaVector, candidateAlphaVector);
+                    }
+                    if (action == 0 || isBetter(optimisticValue, bestOptimisticValue)) {
+                        bestOptimisticValue = optimisticValue;
+                    }
+                }
+
+                if (sampledBeliefs.size() <= beliefId) {
+                    sampledBeliefs.resize(beliefManager->getNumberOfBeliefIds(), false);
+                }
+                if (!sampledBeliefs.get(beliefId)) {
+                    sampledBeliefs.set(beliefId, true);
+                    observations[observation].sampledBeliefs.push_back(beliefId);
+                }
+
+                bool improved = false;
+                if (isBetter(bestPessimisticValue, computePessimisticValue(beliefId))) {
+                    improved = addAlphaVector(observations[observation], bestAlphaVector);
+                }
+                if (isBetter(computeOptimisticValue(beliefId), bestOptimisticValue)) {
+                    auto& data = observations[observation];
+                    loadBelief(beliefId);
+                    data.points.push_back(beliefId);
+                    data.pointValues.push_back(bestOptimisticValue);
+                    data.pointCornerValues.push_back(multiplyWithLoadedBelief(data.cornerValues.data()));
+                    improved = true;
+                }
+                return improved;
+            }
+
+            template<typename PomdpModelType>
+            typename PointBasedPomdpModelChecker<PomdpModelType>::ValueType PointBasedPomdpModelChecker<PomdpModelType>::computePessimisticValue(BeliefId const& beliefId) {
+                if (isTargetBelief(beliefId)) {
+                    return targetValue;
+                }
+                auto const& data = observations[beliefManager->getBeliefObservation(beliefId)];
+                loadBelief(beliefId);
+                return multiplyWithLoadedBelief(data.alphaVectors.data() + getOptimalAlphaVector(data) * data.states.size());
+            }
+
+            template<typename PomdpModelType>
+            typename PointBasedPomdpModelChecker<PomdpModelType>::ValueType PointBasedPomdpModelChecker<PomdpModelType>::computeOptimisticValue(BeliefId const& beliefId) {
+                if (isTargetBelief(beliefId)) {
+                    return targetValue;
+                }
+                auto const& data = observations[beliefManager->getBeliefObservation(beliefId)];
+                loadBelief(beliefId);
+                ValueType result = multiplyWithLoadedBelief(data.cornerValues.data());
+                if (data.points.empty()) {
+                    return result;
+                }
+
+                // Sawtooth interpolation: The improvement at a point is transferred to the given belief, scaled by the largest factor such that the given belief dominates the scaled point
+                auto const belief = beliefManager->getBelief(beliefId);
+                for (auto const& entry : belief) {
+                    denseBelief[entry.first] = entry.second;
+                }
+                ValueType bestImprovement = storm::utility::zero<ValueType>();
+                for (uint64_t point = 0; point < data.points.size(); ++point) {
+                    ValueType ratio = std::numeric_limits<ValueType>::infinity();
+                    for (auto const& entry : beliefManager->getBelief(data.points[point])) {
+                        ratio = std::min(ratio, denseBelief[entry.first] / entry.second);
+                        if (storm::utility::isZero(ratio)) {
+                            break;
+                        }
+                    }
+                    ValueType improvement = (data.pointValues[point] - data.pointCornerValues[point]) * ratio;
+                    if (std::abs(improvement) > std::abs(bestImprovement)) {
+                        bestImprovement = improvement;
+                    }
+                }
+                for (auto const& entry : belief) {
+                    denseBelief[entry.first] = storm::utility::zero<ValueType>();
+                }
+                return result + bestImprovement;
+            }
+
+            template<typename PomdpModelType>
+            typename PointBasedPomdpModelChecker<PomdpModelType>::ValueType PointBasedPomdpModelChecker<PomdpModelType>::computeOptimisticActionValue(BeliefId const& beliefId, uint64_t localActionIndex, std::vector<std::pair<BeliefId, ValueType>>& successors) {
+                ValueType result = computeRewards ? beliefManager->getBeliefActionReward(beliefId, localActionIndex) : storm::utility::zero<ValueType>();
+                beliefManager->expand(beliefId, localActionIndex, successors);
+                for (auto const& successor : successors) {
+                    result += successor.second * computeOptimisticValue(successor.first);
+                }
+                return result;
+            }
+
+            template<typename PomdpModelType>
+            uint64_t PointBasedPomdpModelChecker<PomdpModelType>::getOptimalAlphaVector(ObservationData const& data) {
+                uint64_t numberOfStates = data.states.size();
+                uint64_t numberOfAlphaVectors = data.alphaVectors.size() / numberOfStates;
+                STORM_LOG_ASSERT(numberOfAlphaVectors > 0, "No alpha-vector for the observation.");
+                alphaVectorValues.resize(numberOfAlphaVectors);
+                for (uint64_t alphaVector = 0; alphaVector < numberOfAlphaVectors; ++alphaVector) {
+                    alphaVectorValues[alphaVector] = multiplyWithLoadedBelief(data.alphaVectors.data() + alphaVector * numberOfStates);
+                }
+                if (minimize) {
+                    return std::min_element(alphaVectorValues.begin(), alphaVectorValues.end()) - alphaVectorValues.begin();
+                } else {
+                    return std::max_element(alphaVectorValues.begin(), alphaVectorValues.end()) - alphaVectorValues.begin();
+                }
+            }
+
+            template<typename PomdpModelType>
+            void PointBasedPomdpModelChecker<PomdpModelType>::setSuccessorValues(ObservationData const& data, uint64_t alphaVectorIndex) {
+                ValueType const* alphaVector = data.alphaVectors.data() + alphaVectorIndex * data.states.size();
+                for (uint64_t localState = 0; localState < data.states.size(); ++localState) {
+                    successorValues[data.states[localState]] = alphaVector[localState];
+                }
+            }
+
+            template<typename PomdpModelType>
+            void PointBasedPomdpModelChecker<PomdpModelType>::loadBelief(BeliefId const& beliefId) {
+                beliefColumns.clear();
+                beliefValues.clear();
+                for (auto const& entry : beliefManager->getBelief(beliefId)) {
+                    beliefColumns.push_back(localStateIndices[entry.first]);
+                    beliefValues.push_back(entry.second);
+                }
+            }
+
+            template<typename PomdpModelType>
+            typename PointBasedPomdpModelChecker<PomdpModelType>::ValueType PointBasedPomdpModelChecker<PomdpModelType>::multiplyWithLoadedBelief(ValueType const* vector) const {
+                // The loaded belief is a matrix with a single row
+                uint64_t const rowIndications[2] = {0, beliefColumns.size()};
+                ValueType result;
+                storm::solver::simd::multiplyRows(instructionSet, rowIndications, beliefColumns.data(), beliefValues.data(), vector, nullptr, 0, 1, &result);
+                return result;
+            }
+
+            template<typename PomdpModelType>
+            bool PointBasedPomdpModelChecker<PomdpModelType>::addAlphaVector(ObservationData& data, std::vector<ValueType> const& alphaVector) {
+                uint64_t numberOfStates = data.states.size();
+                STORM_LOG_ASSERT(alphaVector.size() == numberOfStates, "The alpha-vector has an unexpected size.");
+                uint64_t numberOfAlphaVectors = data.alphaVectors.size() / numberOfStates;
+                for (uint64_t index = 0; index < numberOfAlphaVectors; ++index) {
+                    if (dominates(data.alphaVectors.data() + index * numberOfStates, alphaVector.data(), numberOfStates)) {
+                        return false;
+                    }
+                }
+                // Remove the vectors that are dominated by the new vector
+                uint64_t keptAlphaVectors = 0;
+                for (uint64_t index = 0; index < numberOfAlphaVectors; ++index) {
+                    if (!dominates(alphaVector.data(), data.alphaVectors.data() + index * numberOfStates, numberOfStates)) {
+                        if (keptAlphaVectors != index) {
+                            std::copy_n(data.alphaVectors.begin() + index * numberOfStates, numberOfStates, data.alphaVectors.begin() + keptAlphaVectors * numberOfStates);
+                        }
+                        ++keptAlphaVectors;
+                    } else {
+                        ++statistics.prunedAlphaVectors;
+                    }
+                }
+                data.alphaVectors.resize(keptAlphaVectors * numberOfStates);
+                data.alphaVectors.insert(data.alphaVectors.end(), alphaVector.begin(), alphaVector.end());
+                return true;
+            }
+
+            template<typename PomdpModelType>
+            void PointBasedPomdpModelChecker<PomdpModelType>::pruneAlphaVectors() {
+                for (auto& data : observations) {
+                    if (data.sampledBeliefs.empty()) {
+                        continue;
+                    }
+                    uint64_t numberOfStates = data.states.size();
+                    uint64_t numberOfAlphaVectors = data.alphaVectors.size() / numberOfStates;
+                    storm::storage::BitVector optimalAlphaVectors(numberOfAlphaVectors, false);
+                    for (auto const& beliefId : data.sampledBeliefs) {
+                        loadBelief(beliefId);
+                        optimalAlphaVectors.set(getOptimalAlphaVector(data), true);
+                    }
+                    uint64_t keptAlphaVectors = 0;
+                    for (auto const& index : optimalAlphaVectors) {
+                        if (keptAlphaVectors != index) {
+                            std::copy_n(data.alphaVectors.begin() + index * numberOfStates, numberOfStates, data.alphaVectors.begin() + keptAlphaVectors * numberOfStates);
+                        }
+                        ++keptAlphaVectors;
+                    }
+                    statistics.prunedAlphaVectors += numberOfAlphaVectors - keptAlphaVectors;
+                    data.alphaVectors.resize(keptAlphaVectors * numberOfStates);
+                }
+            }
+
+            template<typename PomdpModelType>
+            bool PointBasedPomdpModelChecker<PomdpModelType>::isTargetBelief(BeliefId const& beliefId) {
+                return targetObservations.get(beliefManager->getBeliefObservation(beliefId));
+            }
+
+            template<typename PomdpModelType>
+            bool PointBasedPomdpModelChecker<PomdpModelType>::isBetter(ValueType const& first, ValueType const& second) const {
+                if (minimize) {
+                    return first < second - options.numericPrecision;
+                } else {
+                    return first > second + options.numericPrecision;
+                }
+            }
+
+            template<typename PomdpModelType>
+            bool PointBasedPomdpModelChecker<PomdpModelType>::dominates(ValueType const* first, ValueType const* second, uint64_t size) const {
+                for (uint64_t index = 0; index < size; ++index) {
+                    if (minimize ? first[index] > second[index] : first[index] < second[index]) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            template<typename PomdpModelType>
+            void PointBasedPomdpModelChecker<PomdpModelType>::updateResult(Result& result) {
+                BeliefId initialBelief = beliefManager->getInitialBelief();
+                ValueType pessimisticValue = computePessimisticValue(initialBelief);
+                ValueType optimisticValue = computeOptimisticValue(initialBelief);
+                if (minimize) {
+                    result.updateLowerBound(optimisticValue);
+                    result.updateUpperBound(pessimisticValue);
+                } else {
+                    result.updateLowerBound(pessimisticValue);
+                    result.updateUpperBound(optimisticValue);
+                }
+            }
+
+            template class PointBasedPomdpModelChecker<storm::models::sparse::Pomdp<double>>;
+
+        }
+    }
+}
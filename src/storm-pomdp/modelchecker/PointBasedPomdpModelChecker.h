@@ -0,0 +1,202 @@
+#pragma once
+
+#include <memory>
+#include <set>
+#include <type_traits>
+#include <vector>
+
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/solver/multiplier/SimdKernels.h"
+#include "storm/storage/BitVector.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm-pomdp/storage/BeliefManager.h"
+#include "storm-pomdp/modelchecker/BeliefExplorationPomdpModelChecker.h"
+#include "storm-pomdp/modelchecker/PointBasedPomdpModelCheckerOptions.h"
+
+namespace storm {
+    namespace logic {
+        class Formula;
+    }
+
+    namespace pomdp {
+        namespace modelchecker {
+
+            template<typename ValueType>
+            struct TrivialPomdpValueBounds;
+
+            /*!
+             * Computes bounds on reachability probabilities and expected rewards of POMDPs with a point-based (HSVI/SARSOP-style) algorithm.
+             *
+             * The bound that is achieved by a policy (the lower bound when maximizing) is represented by a set of alpha-vectors for each observation.
+             * The other bound is represented by the values at the states and at a set of beliefs, which are combined by sawtooth interpolation.
+             * Both bounds are initialized with the trivial bounds of the POMDP and improved by backups at beliefs that are sampled in trials from the initial belief.
+             * Along a trial, the action that is optimal w.r.t. the optimistic bound and the observation with the largest weighted gap between the bounds is taken.
+             *
+             * The alpha-vector backups multiply the rows of the POMDP matrix with the vectors of the successor observations using the SIMD kernels of the native multiplier.
+             * Alpha-vectors that are (pointwise) dominated by another vector are removed immediately, vectors that are not optimal at any sampled belief are removed periodically.
+             *
+             * The bounds are valid at any time. The check can thus be aborted (e.g., by a time limit) to obtain the current bounds.
+             */
+            template<typename PomdpModelType>
+            class PointBasedPomdpModelChecker {
+            public:
+                typedef typename PomdpModelType::ValueType ValueType;
+                typedef storm::storage::BeliefManager<PomdpModelType> BeliefManagerType;
+                typedef typename BeliefManagerType::BeliefId BeliefId;
+                typedef PointBasedPomdpModelCheckerOptions<ValueType> Options;
+                typedef typename BeliefExplorationPomdpModelChecker<PomdpModelType>::Result Result;
+
+                static_assert(std::is_same<ValueType, double>::value, "Point-based model checking is only supported for double precision values.");
+
+                PointBasedPomdpModelChecker(std::shared_ptr<PomdpModelType> pomdp, Options options = Options());
+
+                Result check(storm::logic::Formula const& formula);
+
+                void printStatisticsToStream(std::ostream& stream) const;
+
+            private:
+                /*!
+                 * The transitions of the states with the same observation under one (local) action in compressed row storage.
+                 * The i-th row corresponds to the i-th state with that observation.
+                 */
+                struct ActionMatrix {
+                    std::vector<uint64_t> rowIndications;
+                    std::vector<uint32_t> columns;
+                    std::vector<ValueType> values;
+                    std::vector<ValueType> rewards;
+                    // The observations of the successor states (without duplicates)
+                    std::vector<uint32_t> successorObservations;
+                };
+
+                struct ObservationData {
+                    // The states with this observation. The alpha-vectors and the corner values refer to this order.
+                    std::vector<uint64_t> states;
+                    std::vector<ActionMatrix> actions;
+                    // The optimistic value of each state
+                    std::vector<ValueType> cornerValues;
+                    // The alpha-vectors, stored one after another
+                    std::vector<ValueType> alphaVectors;
+                    // The beliefs with an optimistic value that improves the interpolation of the corner values
+                    std::vector<BeliefId> points;
+                    std::vector<ValueType> pointValues;
+                    std::vector<ValueType> pointCornerValues;
+                    // The beliefs at which a backup was performed
+                    std::vector<BeliefId> sampledBeliefs;
+                };
+
+                /**
+                 * Returns the pomdp that is to be analyzed
+                 */
+                PomdpModelType const& pomdp() const;
+
+                void initialize(std::set<uint32_t> const& targetObservations, bool min, boost::optional<std::string> const& rewardModelName, TrivialPomdpValueBounds<ValueType>& pomdpValueBounds);
+
+                /*!
+                 * Samples beliefs starting from the initial belief and performs backups at the sampled beliefs in reverse order.
+                 * @return true if one of the bounds was improved at one of the sampled beliefs.
+                 */
+                bool performTrial();
+
+                /*!
+                 * Improves both bounds at the given belief by a Bellman backup.
+                 * @return true if one of the bounds was improved.
+                 */
+                bool backup(BeliefId const& beliefId);
+
+                ValueType computePessimisticValue(BeliefId const& beliefId);
+                ValueType computeOptimisticValue(BeliefId const& beliefId);
+
+                /*!
+                 * Computes the optimistic value of the given belief under the given action and stores the successor beliefs in the given vector.
+                 */
+                ValueType computeOptimisticActionValue(BeliefId const& beliefId, uint64_t localActionIndex, std::vector<std::pair<BeliefId, ValueType>>& successors);
+
+                /*!
+                 * Retrieves the index of the alpha-vector of the given observation that is optimal at the belief that is currently loaded.
+                 */
+                uint64_t getOptimalAlphaVector(ObservationData const& data);
+
+                /*!
+                 * Sets the values of the states with the given observation in successorValues to the given alpha-vector.
+                 */
+                void setSuccessorValues(ObservationData const& data, uint64_t alphaVectorIndex);
+
+                /*!
+                 * Writes the states and probabilities of the given belief to beliefColumns and beliefValues.
+                 * The columns are the indices of the states among the states with the same observation.
+                 */
+                void loadBelief(BeliefId const& beliefId);
+
+                /*!
+                 * Computes the scalar product of the given vector (over the states of an observation) and the belief that is currently loaded.
+                 */
+                ValueType multiplyWithLoadedBelief(ValueType const* vector) const;
+
+                /*!
+                 * Adds the given alpha-vector unless it is dominated by another vector. Vectors that are dominated by the new vector are removed.
+                 * @return true if the vector has been added.
+                 */
+                bool addAlphaVector(ObservationData& data, std::vector<ValueType> const& alphaVector);
+
+                /*!
+                 * Removes the alpha-vectors that are not optimal at any of the sampled beliefs.
+                 */
+                void pruneAlphaVectors();
+
+                bool isTargetBelief(BeliefId const& beliefId);
+
+                /*!
+                 * Retrieves whether the first value is better than the second value (by more than the numeric precision) w.r.t. the optimization direction.
+                 */
+                bool isBetter(ValueType const& first, ValueType const& second) const;
+
+                /*!
+                 * Retrieves whether the first vector is at least as good as the second vector at every state.
+                 */
+                bool dominates(ValueType const* first, ValueType const* second, uint64_t size) const;
+
+                void updateResult(Result& result);
+
+                struct Statistics {
+                    Statistics();
+                    uint64_t trials;
+                    uint64_t backups;
+                    uint64_t sampledBeliefs;
+                    uint64_t alphaVectors;
+                    uint64_t points;
+                    uint64_t prunedAlphaVectors;
+                    bool aborted;
+                    storm::utility::Stopwatch totalTime;
+                };
+                Statistics statistics;
+
+                std::shared_ptr<PomdpModelType> inputPomdp;
+                std::shared_ptr<PomdpModelType> preprocessedPomdp;
+                Options options;
+
+                // Data that is only valid during a call of check
+                bool minimize;
+                bool computeRewards;
+                ValueType targetValue;
+                storm::storage::BitVector targetObservations;
+                std::shared_ptr<BeliefManagerType> beliefManager;
+                std::vector<ObservationData> observations;
+                std::vector<uint64_t> localStateIndices;
+                storm::storage::BitVector sampledBeliefs;
+                storm::solver::simd::InstructionSet instructionSet;
+
+                // Buffers that are reused
+                std::vector<uint32_t> beliefColumns;
+                std::vector<ValueType> beliefValues;
+                std::vector<ValueType> denseBelief;
+                std::vector<ValueType> successorValues;
+                std::vector<ValueType> alphaVectorValues;
+                std::vector<ValueType> candidateAlphaVector;
+                std::vector<ValueType> bestAlphaVector;
+                std::vector<std::pair<BeliefId, ValueType>> successors;
+                std::vector<BeliefId> trial;
+            };
+
+        }
+    }
+}
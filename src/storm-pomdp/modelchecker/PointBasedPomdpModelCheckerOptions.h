@@ -0,0 +1,24 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include "storm/utility/constants.h"
+
+namespace storm {
+    namespace pomdp {
+        namespace modelchecker {
+            template<typename ValueType>
+            struct PointBasedPomdpModelCheckerOptions {
+                // The analysis stops as soon as the difference between the lower and the upper bound at the initial belief is at most this value
+                ValueType precision = storm::utility::convertNumber<ValueType>(1e-4);
+                // The maximal number of beliefs that are sampled along a single trial
+                uint64_t maxTrialDepth = 200;
+                // Optional limits on the number of trials and on the time (in seconds) after which the current bounds are returned
+                boost::optional<uint64_t> trialLimit;
+                boost::optional<uint64_t> timeLimit;
+                // The number of trials after which alpha-vectors that are not optimal at any of the sampled beliefs are removed. Zero disables this pruning.
+                uint64_t pruningInterval = 16;
+                ValueType numericPrecision = storm::utility::convertNumber<ValueType>(1e-9); /// Used to decide whether two beliefs are equal and whether a bound was improved
+            };
+        }
+    }
+}
@@ -1,9 +1,16 @@
 #include "storm-pomdp/storage/BeliefManager.h"
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <boost/functional/hash.hpp>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
 #include "storm/models/sparse/Pomdp.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
     namespace storage {
@@ -29,21 +36,53 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefHash::operator()(const BeliefType &belief) const {
+        std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::computeHash(BeliefSpan const &belief) const {
             std::size_t seed = 0;
             // Assumes that beliefs are ordered
             for (auto const &entry : belief) {
                 boost::hash_combine(seed, entry.first);
-                boost::hash_combine(seed, entry.second);
+                if (storm::utility::isZero(hashBucketWidth)) {
+                    boost::hash_combine(seed, entry.second);
+                } else {
+                    boost::hash_combine(seed, getGridPoint(entry.second));
+                }
             }
             return seed;
         }
 
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::getGridPoint(BeliefValueType const &probability) const {
+            STORM_LOG_ASSERT(!storm::utility::isZero(hashBucketWidth), "Probabilities are not rounded.");
+            return storm::utility::convertNumber<uint64_t>(storm::utility::round<BeliefValueType>(probability / hashBucketWidth));
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::isIndexEqual(BeliefSpan const &first, BeliefSpan const &second) const {
+            if (first.size() != second.size()) {
+                return false;
+            }
+            bool const exact = storm::utility::isZero(hashBucketWidth);
+            auto secondIt = second.begin();
+            for (auto const &firstEntry : first) {
+                if (firstEntry.first != secondIt->first) {
+                    return false;
+                }
+                if (exact ? firstEntry.second != secondIt->second : getGridPoint(firstEntry.second) != getGridPoint(secondIt->second)) {
+                    return false;
+                }
+                ++secondIt;
+            }
+            return true;
+        }
+
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefManager(PomdpType const &pomdp, BeliefValueType const &precision, TriangulationMode const &triangulationMode)
                 : pomdp(pomdp), triangulationMode(triangulationMode) {
             cc = storm::utility::ConstantsComparator<ValueType>(precision, false);
-            beliefToIdMap.resize(pomdp.getNrObservations());
+            // Buckets that are smaller than the resolution of doubles would not help (and might overflow when computing the bucket)
+            hashBucketWidth = storm::utility::convertNumber<double>(precision) < 1e-15 ? storm::utility::zero<BeliefValueType>() : precision;
+            beliefIndications.push_back(0);
+            beliefIndex.assign(1024, noId());
             initialBeliefId = computeInitialBelief();
         }
 
@@ -133,7 +172,17 @@ namespace storm {
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation
         BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefId beliefId, BeliefValueType resolution) {
-            return triangulateBelief(getBelief(beliefId), resolution);
+            Triangulation result;
+            triangulateBelief(beliefId, resolution, result);
+            return result;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefId beliefId, BeliefValueType resolution, Triangulation &result) {
+            // The triangulation might add new beliefs, which invalidates views on stored beliefs. Hence, we work on a copy.
+            BeliefSpan belief = getBelief(beliefId);
+            triangulationInput.assign(belief.begin(), belief.end());
+            triangulateBelief(BeliefSpan(triangulationInput.data(), triangulationInput.data() + triangulationInput.size()), resolution, result);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -155,40 +204,46 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getNumberOfBeliefIds() const {
-            return beliefs.size();
+            return beliefHashes.size();
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
         BeliefManager<PomdpType, BeliefValueType, StateType>::expandAndTriangulate(BeliefId const &beliefId, uint64_t actionIndex,
                                                                                    std::vector<BeliefValueType> const &observationResolutions) {
-            return expandInternal(beliefId, actionIndex, observationResolutions);
+            std::vector<std::pair<BeliefId, ValueType>> destinations;
+            expandInternal(beliefId, actionIndex, &observationResolutions, destinations);
+            return destinations;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
         BeliefManager<PomdpType, BeliefValueType, StateType>::expand(BeliefId const &beliefId, uint64_t actionIndex) {
-            return expandInternal(beliefId, actionIndex);
+            std::vector<std::pair<BeliefId, ValueType>> destinations;
+            expandInternal(beliefId, actionIndex, nullptr, destinations);
+            return destinations;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType const &BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(BeliefId const &id) const {
-            STORM_LOG_ASSERT(id != noId(), "Tried to get a non-existend belief.");
-            STORM_LOG_ASSERT(id < getNumberOfBeliefIds(), "Belief index " << id << " is out of range.");
-            return beliefs[id];
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::expandAndTriangulate(BeliefId const &beliefId, uint64_t actionIndex, std::vector<BeliefValueType> const &observationResolutions,
+                                                                                        std::vector<std::pair<BeliefId, ValueType>> &destinations) {
+            expandInternal(beliefId, actionIndex, &observationResolutions, destinations);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getId(BeliefType const &belief) const {
-            uint32_t obs = getBeliefObservation(belief);
-            STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-            auto idIt = beliefToIdMap[obs].find(belief);
-            STORM_LOG_ASSERT(idIt != beliefToIdMap[obs].end(), "Unknown Belief.");
-            return idIt->second;
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::expand(BeliefId const &beliefId, uint64_t actionIndex, std::vector<std::pair<BeliefId, ValueType>> &destinations) {
+            expandInternal(beliefId, actionIndex, nullptr, destinations);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(BeliefType const &belief) const {
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefSpan BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(BeliefId const &id) const {
+            STORM_LOG_ASSERT(id != noId(), "Tried to get a non-existend belief.");
+            STORM_LOG_ASSERT(id < getNumberOfBeliefIds(), "Belief index " << id << " is out of range.");
+            return BeliefSpan(beliefEntries.data() + beliefIndications[id], beliefEntries.data() + beliefIndications[id + 1]);
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(BeliefSpan const &belief) const {
             std::stringstream str;
             str << "{ ";
             bool first = true;
@@ -205,7 +260,7 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(BeliefType const &first, BeliefType const &second) const {
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(BeliefSpan const &first, BeliefSpan const &second) const {
             if (first.size() != second.size()) {
                 return false;
             }
@@ -223,7 +278,7 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertBelief(BeliefType const &belief) const {
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertBelief(BeliefSpan const &belief) const {
             BeliefValueType sum = storm::utility::zero<ValueType>();
             boost::optional<uint32_t> observation;
             for (auto const &entry : belief) {
@@ -264,7 +319,7 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const {
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefSpan const &belief, Triangulation const &triangulation) const {
             if (triangulation.weights.size() != triangulation.gridPoints.size()) {
                 STORM_LOG_ERROR("Number of weights and points in triangulation does not match.");
                 return false;
@@ -288,8 +343,7 @@ namespace storm {
                     STORM_LOG_ERROR("Weight greater than one in triangulation.");
                 }
                 weightSum += triangulation.weights[i];
-                BeliefType const &gridPoint = getBelief(triangulation.gridPoints[i]);
-                for (auto const &pointEntry : gridPoint) {
+                for (auto const &pointEntry : getBelief(triangulation.gridPoints[i])) {
                     BeliefValueType &triangulatedValue = triangulatedBelief.emplace(pointEntry.first, storm::utility::zero<ValueType>()).first->second;
                     triangulatedValue += triangulation.weights[i] * pointEntry.second;
                 }
@@ -298,25 +352,27 @@ namespace storm {
                 STORM_LOG_ERROR("Triangulation weights do not sum up to one.");
                 return false;
             }
-            if (!assertBelief(triangulatedBelief)) {
+            std::vector<BeliefEntry> triangulatedEntries(triangulatedBelief.begin(), triangulatedBelief.end());
+            BeliefSpan triangulatedSpan(triangulatedEntries.data(), triangulatedEntries.data() + triangulatedEntries.size());
+            if (!assertBelief(triangulatedSpan)) {
                 STORM_LOG_ERROR("Triangulated belief is not a belief.");
             }
-            if (!isEqual(belief, triangulatedBelief)) {
-                STORM_LOG_ERROR("Belief:\n\t" << toString(belief) << "\ndoes not match triangulated belief:\n\t" << toString(triangulatedBelief) << ".");
+            if (!isEqual(belief, triangulatedSpan)) {
+                STORM_LOG_ERROR("Belief:\n\t" << toString(belief) << "\ndoes not match triangulated belief:\n\t" << toString(triangulatedSpan) << ".");
                 return false;
             }
             return true;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefType belief) const {
+        uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefSpan const &belief) const {
             STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
             return pomdp.getObservation(belief.begin()->first);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         void
-        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result) {
+        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefSpan const &belief, BeliefValueType const &resolution, ExpansionBuffers &buffers) const {
             STORM_LOG_ASSERT(resolution != 0, "Invalid resolution: 0");
             STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
             StateType numEntries = belief.size();
@@ -324,55 +380,50 @@ namespace storm {
             // Probabilities will be triangulated to values in 0/N, 1/N, 2/N, ..., N/N
             // Variable names are mostly based on the paper
             // However, we speed this up a little by exploiting that belief states usually have sparse support (i.e. numEntries is much smaller than pomdp.getNumberOfStates()).
+            // The dimensions refer to the entries of the belief (and not to the pomdp states).
             // Initialize diffs and the first row of the 'qs' matrix (aka v)
-            std::set<FreudenthalDiff, std::greater<FreudenthalDiff>> sorted_diffs; // d (and p?) in the paper
-            std::vector<BeliefValueType> qsRow; // Row of the 'qs' matrix from the paper (initially corresponds to v
-            qsRow.reserve(numEntries);
-            std::vector<StateType> toOriginalIndicesMap; // Maps 'local' indices to the original pomdp state indices
-            toOriginalIndicesMap.reserve(numEntries);
+            auto &sortedDiffs = buffers.freudenthalDiffs; // d (and p?) in the paper
+            auto &qsRow = buffers.freudenthalQsRow; // Row of the 'qs' matrix from the paper (initially corresponds to v
+            sortedDiffs.clear();
+            qsRow.clear();
             BeliefValueType x = resolution;
             for (auto const &entry : belief) {
                 qsRow.push_back(storm::utility::floor(x)); // v
-                sorted_diffs.emplace(toOriginalIndicesMap.size(), x - qsRow.back()); // x-v
-                toOriginalIndicesMap.push_back(entry.first);
+                sortedDiffs.emplace_back(sortedDiffs.size(), x - qsRow.back()); // x-v
                 x -= entry.second * resolution;
             }
             // Insert a dummy 0 column in the qs matrix so the loops below are a bit simpler
             qsRow.push_back(storm::utility::zero<BeliefValueType>());
+            std::sort(sortedDiffs.begin(), sortedDiffs.end(), std::greater<FreudenthalDiff>());
 
-            result.weights.reserve(numEntries);
-            result.gridPoints.reserve(numEntries);
-            auto currentSortedDiff = sorted_diffs.begin();
-            auto previousSortedDiff = sorted_diffs.end();
-            --previousSortedDiff;
+            StateType previousSortedDiff = numEntries - 1;
             for (StateType i = 0; i < numEntries; ++i) {
                 // Compute the weight for the grid points
-                BeliefValueType weight = previousSortedDiff->diff - currentSortedDiff->diff;
+                BeliefValueType weight = sortedDiffs[previousSortedDiff].diff - sortedDiffs[i].diff;
                 if (i == 0) {
                     // The first weight is a bit different
                     weight += storm::utility::one<ValueType>();
                 } else {
                     // 'compute' the next row of the qs matrix
-                    qsRow[previousSortedDiff->dimension] += storm::utility::one<BeliefValueType>();
+                    qsRow[sortedDiffs[previousSortedDiff].dimension] += storm::utility::one<BeliefValueType>();
                 }
                 if (!cc.isZero(weight)) {
-                    result.weights.push_back(weight);
+                    buffers.gridPointWeights.push_back(weight);
                     // Compute the grid point
-                    BeliefType gridPoint;
                     for (StateType j = 0; j < numEntries; ++j) {
                         BeliefValueType gridPointEntry = qsRow[j] - qsRow[j + 1];
                         if (!cc.isZero(gridPointEntry)) {
-                            gridPoint[toOriginalIndicesMap[j]] = gridPointEntry / resolution;
+                            buffers.gridPointEntries.emplace_back(belief.begin()[j].first, gridPointEntry / resolution);
                         }
                     }
-                    result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+                    buffers.gridPointIndications.push_back(buffers.gridPointEntries.size());
                 }
-                previousSortedDiff = currentSortedDiff++;
+                previousSortedDiff = i;
             }
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result) {
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefSpan const &belief, BeliefValueType const &resolution, ExpansionBuffers &buffers) const {
             // Find the best resolution for this belief, i.e., N such that the largest distance between one of the belief values to a value in {i/N | 0 ≤ i ≤ N} is minimal
             STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
             BeliefValueType finalResolution = resolution;
@@ -405,83 +456,225 @@ namespace storm {
             STORM_LOG_TRACE("Picking resolution " << finalResolution << " for belief " << toString(belief));
 
             // do standard freudenthal with the found resolution
-            triangulateBeliefFreudenthal(belief, finalResolution, result);
+            triangulateBeliefFreudenthal(belief, finalResolution, buffers);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation
-        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution) {
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::computeTriangulation(BeliefSpan const &belief, BeliefValueType const &resolution, ExpansionBuffers &buffers) const {
             STORM_LOG_ASSERT(assertBelief(belief), "Input belief for triangulation is not valid.");
-            Triangulation result;
+            buffers.gridPointEntries.clear();
+            buffers.gridPointIndications.assign(1, 0);
+            buffers.gridPointWeights.clear();
             // Quickly triangulate Dirac beliefs
             if (belief.size() == 1u) {
-                result.weights.push_back(storm::utility::one<BeliefValueType>());
-                result.gridPoints.push_back(getOrAddBeliefId(belief));
+                buffers.gridPointWeights.push_back(storm::utility::one<BeliefValueType>());
+                buffers.gridPointEntries.push_back(*belief.begin());
+                buffers.gridPointIndications.push_back(1);
             } else {
                 auto ceiledResolution = storm::utility::ceil<BeliefValueType>(resolution);
                 switch (triangulationMode) {
                     case TriangulationMode::Static:
-                        triangulateBeliefFreudenthal(belief, ceiledResolution, result);
+                        triangulateBeliefFreudenthal(belief, ceiledResolution, buffers);
                         break;
                     case TriangulationMode::Dynamic:
-                        triangulateBeliefDynamic(belief, ceiledResolution, result);
+                        triangulateBeliefDynamic(belief, ceiledResolution, buffers);
                         break;
                     default:
                         STORM_LOG_ASSERT(false, "Invalid triangulation mode.");
                 }
             }
-            STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation: " << toString(result));
-            return result;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
-        BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
-                                                                             boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) {
-            std::vector<std::pair<BeliefId, ValueType>> destinations;
-
-            BeliefType belief = getBelief(beliefId);
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefSpan const &belief, BeliefValueType const &resolution, Triangulation &result) {
+            computeTriangulation(belief, resolution, buffers);
+            result.weights.assign(buffers.gridPointWeights.begin(), buffers.gridPointWeights.end());
+            result.gridPoints.clear();
+            // The grid points are stored in the buffers, so adding them does not invalidate them
+            for (uint64_t gridPoint = 0; gridPoint < buffers.gridPointWeights.size(); ++gridPoint) {
+                result.gridPoints.push_back(getOrAddBeliefId(BeliefSpan(buffers.gridPointEntries.data() + buffers.gridPointIndications[gridPoint], buffers.gridPointEntries.data() + buffers.gridPointIndications[gridPoint + 1])));
+            }
+            STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation: " << toString(result));
+        }
 
-            // Find the probability we go to each observation
-            BeliefType successorObs; // This is actually not a belief but has the same type
-            for (auto const &pointEntry : belief) {
-                uint64_t state = pointEntry.first;
-                for (auto const &pomdpTransition : pomdp.getTransitionMatrix().getRow(state, actionIndex)) {
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::computeSuccessorBeliefs(BeliefId const &beliefId, uint64_t actionIndex, ExpansionBuffers &buffers) const {
+            // Collect the successor states together with their observation and probability
+            auto &successorEntries = buffers.successorEntries;
+            successorEntries.clear();
+            for (auto const &pointEntry : getBelief(beliefId)) {
+                for (auto const &pomdpTransition : pomdp.getTransitionMatrix().getRow(pointEntry.first, actionIndex)) {
                     if (!storm::utility::isZero(pomdpTransition.getValue())) {
-                        auto obs = pomdp.getObservation(pomdpTransition.getColumn());
-                        addToDistribution(successorObs, obs, pointEntry.second * pomdpTransition.getValue());
+                        successorEntries.push_back({pomdp.getObservation(pomdpTransition.getColumn()), pomdpTransition.getColumn(), pointEntry.second * pomdpTransition.getValue()});
+                    }
+                }
+            }
+            // Ordering the entries by observation and state makes each successor belief a consecutive run of entries
+            std::sort(successorEntries.begin(), successorEntries.end(), [](SuccessorEntry const &lhs, SuccessorEntry const &rhs) {
+                return lhs.observation < rhs.observation || (lhs.observation == rhs.observation && lhs.state < rhs.state);
+            });
+
+            auto &successorBeliefEntries = buffers.successorBeliefEntries;
+            successorBeliefEntries.clear();
+            buffers.successorObservations.clear();
+            auto entryIt = successorEntries.begin();
+            while (entryIt != successorEntries.end()) {
+                SuccessorObservation successor{entryIt->observation, storm::utility::zero<ValueType>(), successorBeliefEntries.size(), 0};
+                for (; entryIt != successorEntries.end() && entryIt->observation == successor.observation; ++entryIt) {
+                    successor.probability += entryIt->value;
+                    if (successorBeliefEntries.size() > successor.entriesBegin && successorBeliefEntries.back().first == entryIt->state) {
+                        successorBeliefEntries.back().second += entryIt->value;
+                    } else {
+                        successorBeliefEntries.emplace_back(entryIt->state, entryIt->value);
                     }
                 }
+                successor.entriesEnd = successorBeliefEntries.size();
+                for (uint64_t entry = successor.entriesBegin; entry < successor.entriesEnd; ++entry) {
+                    successorBeliefEntries[entry].second /= successor.probability;
+                }
+                STORM_LOG_ASSERT(assertBelief(BeliefSpan(successorBeliefEntries.data() + successor.entriesBegin, successorBeliefEntries.data() + successor.entriesEnd)), "Invalid successor belief.");
+                buffers.successorObservations.push_back(std::move(successor));
             }
+        }
 
-            // Now for each successor observation we find and potentially triangulate the successor belief
-            for (auto const &successor : successorObs) {
-                BeliefType successorBelief;
-                for (auto const &pointEntry : belief) {
-                    uint64_t state = pointEntry.first;
-                    for (auto const &pomdpTransition : pomdp.getTransitionMatrix().getRow(state, actionIndex)) {
-                        if (pomdp.getObservation(pomdpTransition.getColumn()) == successor.first) {
-                            ValueType prob = pointEntry.second * pomdpTransition.getValue() / successor.second;
-                            addToDistribution(successorBelief, pomdpTransition.getColumn(), prob);
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex, std::vector<BeliefValueType> const *observationTriangulationResolutions,
+                                                                                  std::vector<std::pair<BeliefId, ValueType>> &destinations) {
+            // Check whether the expansion has been prepared (with the same resolutions)
+            if (!preparedExpansions.empty()) {
+                auto preparedIt = preparedExpansions.find(std::make_pair(beliefId, actionIndex));
+                if (preparedIt != preparedExpansions.end()) {
+                    PreparedExpansion const &prepared = preparedIt->second;
+                    bool matches = prepared.triangulated == (observationTriangulationResolutions != nullptr);
+                    for (uint64_t i = 0; matches && observationTriangulationResolutions && i < prepared.observations.size(); ++i) {
+                        matches = (*observationTriangulationResolutions)[prepared.observations[i]] == prepared.resolutions[i];
+                    }
+                    if (matches) {
+                        destinations.assign(prepared.destinations.begin(), prepared.destinations.end());
+                        // Add the pending beliefs now, i.e., in the order in which the sequential expansion adds them
+                        for (auto const &position : prepared.pendingDestinations) {
+                            uint64_t pendingBelief = destinations[position].first;
+                            destinations[position].first = getOrAddBeliefId(BeliefSpan(prepared.pendingEntries.data() + prepared.pendingIndications[pendingBelief], prepared.pendingEntries.data() + prepared.pendingIndications[pendingBelief + 1]));
                         }
                     }
+                    preparedExpansions.erase(preparedIt);
+                    if (matches) {
+                        return;
+                    }
                 }
-                STORM_LOG_ASSERT(assertBelief(successorBelief), "Invalid successor belief.");
+            }
+
+            destinations.clear();
+            computeSuccessorBeliefs(beliefId, actionIndex, buffers);
 
+            // Now for each successor observation we find and potentially triangulate the successor belief
+            for (auto const &successor : buffers.successorObservations) {
+                BeliefSpan successorBelief(buffers.successorBeliefEntries.data() + successor.entriesBegin, buffers.successorBeliefEntries.data() + successor.entriesEnd);
                 // Insert the destination. We know that destinations have to be disjoined since they have different observations
                 if (observationTriangulationResolutions) {
-                    Triangulation triangulation = triangulateBelief(successorBelief, observationTriangulationResolutions.get()[successor.first]);
-                    for (size_t j = 0; j < triangulation.size(); ++j) {
+                    triangulateBelief(successorBelief, (*observationTriangulationResolutions)[successor.observation], successorTriangulation);
+                    for (size_t j = 0; j < successorTriangulation.size(); ++j) {
                         // Here we additionally assume that triangulation.gridPoints does not contain the same point multiple times
-                        destinations.emplace_back(triangulation.gridPoints[j], triangulation.weights[j] * successor.second);
+                        destinations.emplace_back(successorTriangulation.gridPoints[j], successorTriangulation.weights[j] * successor.probability);
                     }
                 } else {
-                    destinations.emplace_back(getOrAddBeliefId(successorBelief), successor.second);
+                    destinations.emplace_back(getOrAddBeliefId(successorBelief), successor.probability);
                 }
             }
+        }
 
-            return destinations;
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::prepareExpansions(std::vector<BeliefId> const &beliefIds, uint64_t numberOfThreads) {
+            prepareExpansionsInternal(beliefIds, nullptr, numberOfThreads);
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::prepareExpansionsAndTriangulations(std::vector<BeliefId> const &beliefIds, std::vector<BeliefValueType> const &observationResolutions, uint64_t numberOfThreads) {
+            prepareExpansionsInternal(beliefIds, &observationResolutions, numberOfThreads);
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::isExpansionPrepared(BeliefId const &beliefId) const {
+            return preparedExpansions.count(std::make_pair(beliefId, 0)) > 0;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::clearPreparedExpansions() {
+            preparedExpansions.clear();
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::prepareExpansion(BeliefId const &beliefId, uint64_t actionIndex, std::vector<BeliefValueType> const *observationTriangulationResolutions,
+                                                                                    ExpansionBuffers &expansionBuffers, PreparedExpansion &result) const {
+            result.triangulated = observationTriangulationResolutions != nullptr;
+            result.pendingIndications.push_back(0);
+            auto addDestination = [this, &result](BeliefSpan const &belief, ValueType const &value) {
+                BeliefId id = findBelief(belief, computeHash(belief)).first;
+                if (id == noId()) {
+                    // The belief gets its id when the results are merged. Until then, we refer to the pending belief.
+                    result.pendingDestinations.push_back(result.destinations.size());
+                    id = result.pendingIndications.size() - 1;
+                    result.pendingEntries.insert(result.pendingEntries.end(), belief.begin(), belief.end());
+                    result.pendingIndications.push_back(result.pendingEntries.size());
+                }
+                result.destinations.emplace_back(id, value);
+            };
+
+            computeSuccessorBeliefs(beliefId, actionIndex, expansionBuffers);
+            for (auto const &successor : expansionBuffers.successorObservations) {
+                BeliefSpan successorBelief(expansionBuffers.successorBeliefEntries.data() + successor.entriesBegin, expansionBuffers.successorBeliefEntries.data() + successor.entriesEnd);
+                result.observations.push_back(successor.observation);
+                if (observationTriangulationResolutions) {
+                    result.resolutions.push_back((*observationTriangulationResolutions)[successor.observation]);
+                    computeTriangulation(successorBelief, result.resolutions.back(), expansionBuffers);
+                    for (uint64_t gridPoint = 0; gridPoint < expansionBuffers.gridPointWeights.size(); ++gridPoint) {
+                        BeliefSpan gridPointBelief(expansionBuffers.gridPointEntries.data() + expansionBuffers.gridPointIndications[gridPoint], expansionBuffers.gridPointEntries.data() + expansionBuffers.gridPointIndications[gridPoint + 1]);
+                        addDestination(gridPointBelief, expansionBuffers.gridPointWeights[gridPoint] * successor.probability);
+                    }
+                } else {
+                    addDestination(successorBelief, successor.probability);
+                }
+            }
+        }
 
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::prepareExpansionsInternal(std::vector<BeliefId> const &beliefIds, std::vector<BeliefValueType> const *observationTriangulationResolutions, uint64_t numberOfThreads) {
+            std::vector<std::pair<BeliefId, uint64_t>> tasks;
+            for (auto const &beliefId : beliefIds) {
+                for (uint64_t action = 0, numActions = getBeliefNumberOfChoices(beliefId); action < numActions; ++action) {
+                    tasks.emplace_back(beliefId, action);
+                }
+            }
+            if (tasks.empty()) {
+                return;
+            }
+
+            // The workers take the next task from a shared counter. Since no beliefs are added while they are running, they can all read the arena and the index.
+            std::vector<PreparedExpansion> results(tasks.size());
+            uint64_t numberOfWorkers = std::max<uint64_t>(1, std::min<uint64_t>(numberOfThreads, tasks.size()));
+            std::vector<ExpansionBuffers> workerBuffers(numberOfWorkers);
+            std::atomic<uint64_t> nextTask(0);
+            auto runWorker = [&](uint64_t worker) {
+                for (uint64_t task = nextTask++; task < tasks.size(); task = nextTask++) {
+                    prepareExpansion(tasks[task].first, tasks[task].second, observationTriangulationResolutions, workerBuffers[worker], results[task]);
+                }
+            };
+#ifdef STORM_HAVE_INTELTBB
+            storm::utility::parallel::executeWithThreadLimit(numberOfWorkers, [&]() {
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfWorkers, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                    for (uint64_t worker = range.begin(); worker < range.end(); ++worker) {
+                        runWorker(worker);
+                    }
+                });
+            });
+#else
+            runWorker(0);
+#endif
+
+            // New beliefs are only added when an expansion is retrieved, such that prepared expansions that are never retrieved do not add beliefs
+            for (uint64_t task = 0; task < tasks.size(); ++task) {
+                preparedExpansions[tasks[task]] = std::move(results[task]);
+            }
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -490,24 +683,59 @@ namespace storm {
                              "POMDP contains more than one initial state");
             STORM_LOG_ASSERT(pomdp.getInitialStates().getNumberOfSetBits() == 1,
                              "POMDP does not contain an initial state");
-            BeliefType belief;
-            belief[*pomdp.getInitialStates().begin()] = storm::utility::one<ValueType>();
-
+            BeliefEntry initialEntry(*pomdp.getInitialStates().begin(), storm::utility::one<BeliefValueType>());
+            BeliefSpan belief(&initialEntry, &initialEntry + 1);
             STORM_LOG_ASSERT(assertBelief(belief), "Invalid initial belief.");
             return getOrAddBeliefId(belief);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(BeliefType const &belief) {
-            uint32_t obs = getBeliefObservation(belief);
-            STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-            auto insertioRes = beliefToIdMap[obs].emplace(belief, beliefs.size());
-            if (insertioRes.second) {
-                // There actually was an insertion, so add the new belief
-                beliefs.push_back(belief);
+        std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId, uint64_t> BeliefManager<PomdpType, BeliefValueType, StateType>::findBelief(BeliefSpan const &belief, std::size_t hash) const {
+            uint64_t const mask = beliefIndex.size() - 1;
+            uint64_t position = hash & mask;
+            for (; beliefIndex[position] != noId(); position = (position + 1) & mask) {
+                BeliefId candidate = beliefIndex[position];
+                if (beliefHashes[candidate] == hash && isIndexEqual(getBelief(candidate), belief)) {
+                    return std::make_pair(candidate, position);
+                }
+            }
+            return std::make_pair(noId(), position);
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(BeliefSpan const &belief) {
+            STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
+            std::size_t hash = computeHash(belief);
+            auto findRes = findBelief(belief, hash);
+            if (findRes.first != noId()) {
+                return findRes.first;
+            }
+            // Stored beliefs are always found. Hence, the given belief does not refer to the arena which we are about to extend.
+            STORM_LOG_ASSERT(belief.begin() < beliefEntries.data() || belief.begin() >= beliefEntries.data() + beliefEntries.size(), "Unable to find a stored belief.");
+            BeliefId newId = getNumberOfBeliefIds();
+            beliefEntries.insert(beliefEntries.end(), belief.begin(), belief.end());
+            beliefIndications.push_back(beliefEntries.size());
+            beliefHashes.push_back(hash);
+            beliefIndex[findRes.second] = newId;
+            // Keep the load factor of the index below 1/2
+            if (2 * getNumberOfBeliefIds() > beliefIndex.size()) {
+                growIndex();
+            }
+            return newId;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::growIndex() {
+            std::vector<BeliefId> newIndex(2 * beliefIndex.size(), noId());
+            uint64_t const mask = newIndex.size() - 1;
+            for (BeliefId id = 0; id < getNumberOfBeliefIds(); ++id) {
+                uint64_t position = beliefHashes[id] & mask;
+                while (newIndex[position] != noId()) {
+                    position = (position + 1) & mask;
+                }
+                newIndex[position] = id;
             }
-            // Return the id
-            return insertioRes.first->second;
+            beliefIndex = std::move(newIndex);
         }
 
         template class BeliefManager<storm::models::sparse::Pomdp<double>>;
@@ -1,7 +1,7 @@
 #pragma once
 
+#include <map>
 #include <vector>
-#include <unordered_map>
 #include <boost/optional.hpp>
 #include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
@@ -17,8 +17,22 @@ namespace storm {
             typedef typename PomdpType::ValueType ValueType;
             typedef boost::container::flat_map<StateType, BeliefValueType> BeliefType; // iterating over this shall be ordered (for correct hash computation)
             typedef boost::container::flat_set<StateType> BeliefSupportType;
+            typedef std::pair<StateType, BeliefValueType> BeliefEntry;
             typedef uint64_t BeliefId;
 
+            /*!
+             * A view on the entries of a belief, i.e., (state, probability) pairs that are ordered by state.
+             * A view on a stored belief becomes invalid as soon as another belief is added to the manager.
+             */
+            struct BeliefSpan {
+                BeliefSpan(BeliefEntry const* first, BeliefEntry const* last) : first(first), last(last) {}
+                BeliefEntry const* begin() const { return first; }
+                BeliefEntry const* end() const { return last; }
+                uint64_t size() const { return last - first; }
+                BeliefEntry const* first;
+                BeliefEntry const* last;
+            };
+
             enum class TriangulationMode {
                 Static,
                 Dynamic
@@ -38,6 +52,11 @@ namespace storm {
 
             BeliefId noId() const;
 
+            /*!
+             * Retrieves the entries of the belief with the given id.
+             */
+            BeliefSpan getBelief(BeliefId const &id) const;
+
             bool isEqual(BeliefId const &first, BeliefId const &second) const;
 
             std::string toString(BeliefId const &beliefId) const;
@@ -57,6 +76,11 @@ namespace storm {
 
             Triangulation triangulateBelief(BeliefId beliefId, BeliefValueType resolution);
 
+            /*!
+             * Triangulates the given belief and writes the triangulation to the given (reused) result.
+             */
+            void triangulateBelief(BeliefId beliefId, BeliefValueType resolution, Triangulation &result);
+
             template<typename DistributionType>
             void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value);
 
@@ -69,11 +93,34 @@ namespace storm {
 
             std::vector<std::pair<BeliefId, ValueType>> expand(BeliefId const &beliefId, uint64_t actionIndex);
 
-        private:
+            /*!
+             * Variants of expandAndTriangulate and expand that write the successors to the given vector.
+             * Apart from adding new beliefs, these do not allocate memory once the internal buffers and the given vector are large enough.
+             */
+            void expandAndTriangulate(BeliefId const &beliefId, uint64_t actionIndex, std::vector<BeliefValueType> const &observationResolutions, std::vector<std::pair<BeliefId, ValueType>> &destinations);
+            void expand(BeliefId const &beliefId, uint64_t actionIndex, std::vector<std::pair<BeliefId, ValueType>> &destinations);
+
+            /*!
+             * Expands (and triangulates) the given beliefs under all their actions using the given number of threads.
+             * The results are kept until they are retrieved by a call of expand (or expandAndTriangulate with the same resolutions for the successor observations).
+             *
+             * The workers only read the stored beliefs. Successor beliefs (or grid points) that are not stored yet are only added once the expansion is retrieved.
+             * Hence, the assigned belief ids are the same as without preparing any expansions.
+             */
+            void prepareExpansions(std::vector<BeliefId> const &beliefIds, uint64_t numberOfThreads);
+            void prepareExpansionsAndTriangulations(std::vector<BeliefId> const &beliefIds, std::vector<BeliefValueType> const &observationResolutions, uint64_t numberOfThreads);
+
+            /*!
+             * Retrieves whether the expansion of the given belief under the first action has been prepared and not yet retrieved.
+             */
+            bool isExpansionPrepared(BeliefId const &beliefId) const;
+
+            /*!
+             * Discards all prepared expansions that have not been retrieved.
+             */
+            void clearPreparedExpansions();
 
-            struct BeliefHash {
-                std::size_t operator()(const BeliefType &belief) const;
-            };
+        private:
 
             struct FreudenthalDiff {
                 FreudenthalDiff(StateType const &dimension, BeliefValueType diff);
@@ -83,39 +130,140 @@ namespace storm {
                 bool operator>(FreudenthalDiff const &other) const;
             };
 
-            BeliefType const &getBelief(BeliefId const &id) const;
+            /*!
+             * The successor beliefs of a belief for one observation. The entries of the successor belief are stored in successorBeliefEntries.
+             */
+            struct SuccessorObservation {
+                uint32_t observation;
+                ValueType probability;
+                uint64_t entriesBegin;
+                uint64_t entriesEnd;
+            };
 
-            BeliefId getId(BeliefType const &belief) const;
+            struct SuccessorEntry {
+                uint32_t observation;
+                StateType state;
+                BeliefValueType value;
+            };
 
-            std::string toString(BeliefType const &belief) const;
+            /*!
+             * Buffers that are reused for the expansion and triangulation of beliefs. Each thread needs its own buffers.
+             */
+            struct ExpansionBuffers {
+                std::vector<SuccessorEntry> successorEntries;
+                std::vector<BeliefEntry> successorBeliefEntries;
+                std::vector<SuccessorObservation> successorObservations;
+                std::vector<FreudenthalDiff> freudenthalDiffs;
+                std::vector<BeliefValueType> freudenthalQsRow;
+                // The grid points of the most recent triangulation (stored consecutively) and their weights
+                std::vector<BeliefEntry> gridPointEntries;
+                std::vector<uint64_t> gridPointIndications;
+                std::vector<BeliefValueType> gridPointWeights;
+            };
 
-            bool isEqual(BeliefType const &first, BeliefType const &second) const;
+            /*!
+             * The result of expanding a belief under one action ahead of time.
+             */
+            struct PreparedExpansion {
+                bool triangulated;
+                // The successor observations and the resolutions with which their beliefs were triangulated (if triangulated)
+                std::vector<uint32_t> observations;
+                std::vector<BeliefValueType> resolutions;
+                std::vector<std::pair<BeliefId, ValueType>> destinations;
+                // Until the expansion is retrieved, the destinations at these positions refer to the i-th pending belief instead of a stored belief
+                std::vector<uint64_t> pendingDestinations;
+                std::vector<BeliefEntry> pendingEntries;
+                std::vector<uint64_t> pendingIndications;
+            };
 
-            bool assertBelief(BeliefType const &belief) const;
+            std::string toString(BeliefSpan const &belief) const;
 
-            bool assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const;
+            bool isEqual(BeliefSpan const &first, BeliefSpan const &second) const;
 
-            uint32_t getBeliefObservation(BeliefType belief) const;
+            bool assertBelief(BeliefSpan const &belief) const;
 
-            void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+            bool assertTriangulation(BeliefSpan const &belief, Triangulation const &triangulation) const;
 
-            void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+            uint32_t getBeliefObservation(BeliefSpan const &belief) const;
 
-            Triangulation triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution);
+            /*!
+             * These methods compute the grid points of a triangulation and their weights and store them in the given buffers.
+             */
+            void triangulateBeliefFreudenthal(BeliefSpan const &belief, BeliefValueType const &resolution, ExpansionBuffers &buffers) const;
 
-            std::vector<std::pair<BeliefId, ValueType>>
-            expandInternal(BeliefId const &beliefId, uint64_t actionIndex, boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions = boost::none);
+            void triangulateBeliefDynamic(BeliefSpan const &belief, BeliefValueType const &resolution, ExpansionBuffers &buffers) const;
+
+            void computeTriangulation(BeliefSpan const &belief, BeliefValueType const &resolution, ExpansionBuffers &buffers) const;
+
+            /*!
+             * Triangulates the given belief and adds the grid points that are not stored yet.
+             */
+            void triangulateBelief(BeliefSpan const &belief, BeliefValueType const &resolution, Triangulation &result);
+
+            /*!
+             * Computes the successor beliefs of the given belief under the given action and stores them in the given buffers.
+             */
+            void computeSuccessorBeliefs(BeliefId const &beliefId, uint64_t actionIndex, ExpansionBuffers &buffers) const;
+
+            void expandInternal(BeliefId const &beliefId, uint64_t actionIndex, std::vector<BeliefValueType> const *observationTriangulationResolutions, std::vector<std::pair<BeliefId, ValueType>> &destinations);
+
+            /*!
+             * Expands the given belief without modifying this manager such that it can be called concurrently (as long as no beliefs are added).
+             */
+            void prepareExpansion(BeliefId const &beliefId, uint64_t actionIndex, std::vector<BeliefValueType> const *observationTriangulationResolutions, ExpansionBuffers &buffers, PreparedExpansion &result) const;
+
+            void prepareExpansionsInternal(std::vector<BeliefId> const &beliefIds, std::vector<BeliefValueType> const *observationTriangulationResolutions, uint64_t numberOfThreads);
 
             BeliefId computeInitialBelief();
 
-            BeliefId getOrAddBeliefId(BeliefType const &belief);
+            /*!
+             * Retrieves the id of the given belief (or of a belief whose probabilities are rounded to the same grid points). If there is no such belief, the belief is copied into the arena.
+             * The given belief must not be a view on a belief that is not yet stored in the arena.
+             */
+            BeliefId getOrAddBeliefId(BeliefSpan const &belief);
+
+            /*!
+             * Looks up the given belief in the index.
+             * @return the id of the stored belief (or noId()) and the position of the index where the lookup stopped
+             */
+            std::pair<BeliefId, uint64_t> findBelief(BeliefSpan const &belief, std::size_t hash) const;
+
+            std::size_t computeHash(BeliefSpan const &belief) const;
+
+            /*!
+             * Returns the index of the multiple of hashBucketWidth that is closest to the given probability.
+             */
+            uint64_t getGridPoint(BeliefValueType const &probability) const;
+
+            /*!
+             * Checks whether the given beliefs have the same support and all their probabilities are rounded to the same grid point.
+             * In contrast to isEqual, this relation is transitive and consistent with computeHash. It thus decides which beliefs are merged in the index.
+             */
+            bool isIndexEqual(BeliefSpan const &first, BeliefSpan const &second) const;
+
+            /*!
+             * Doubles the size of the belief index.
+             */
+            void growIndex();
 
             PomdpType const& pomdp;
             std::vector<ValueType> pomdpActionRewardVector;
             
-            std::vector<BeliefType> beliefs;
-            std::vector<std::unordered_map<BeliefType, BeliefId, BeliefHash>> beliefToIdMap;
+            // The arena that stores the entries of all beliefs consecutively. The entries of the i-th belief are at positions beliefIndications[i], ..., beliefIndications[i+1]-1
+            std::vector<BeliefEntry> beliefEntries;
+            std::vector<uint64_t> beliefIndications;
+            std::vector<std::size_t> beliefHashes;
+            // Open addressing hash table (with linear probing) that maps beliefs to their ids. Free slots hold noId().
+            std::vector<BeliefId> beliefIndex;
+            // Probabilities are rounded to the closest multiple of this width before they are hashed and compared in the index. Zero means that probabilities are hashed and compared exactly.
+            BeliefValueType hashBucketWidth;
             BeliefId initialBeliefId;
+
+            ExpansionBuffers buffers;
+            std::vector<BeliefEntry> triangulationInput;
+            Triangulation successorTriangulation;
+            // Expansions that were computed ahead of time, indexed by the belief and the (local) action
+            std::map<std::pair<BeliefId, uint64_t>, PreparedExpansion> preparedExpansions;
             
             storm::utility::ConstantsComparator<ValueType> cc;
             
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "storm-parsers/parser/AutoParser.h"
+#include "storm-parsers/parser/BinaryEncodingParser.h"
 #include "storm-parsers/parser/DirectEncodingParser.h"
 #include "storm-parsers/parser/ImcaMarkovAutomatonParser.h"
 
@@ -96,10 +97,14 @@ storm::builder::ExplicitModelBuilder<ValueType> makeExplicitModelBuilder(storm::
                                                                          std::shared_ptr<storm::generator::ActionMask<ValueType>> actionMask = nullptr) {
     std::shared_ptr<storm::generator::NextStateGenerator<ValueType, uint32_t>> generator;
     if (model.isPrismProgram()) {
+        if (actionMask == nullptr) {
+            // In this case, the builder can create additional generators which allows to explore the model in parallel.
+            return storm::builder::ExplicitModelBuilder<ValueType>(model.asPrismProgram(), options);
+        }
         generator = std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, uint32_t>>(model.asPrismProgram(), options, actionMask);
     } else if (model.isJaniModel()) {
         STORM_LOG_THROW(actionMask == nullptr, storm::exceptions::NotSupportedException, "Action masks for JANI are not yet supported");
-        generator = std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, uint32_t>>(model.asJaniModel(), options);
+        return storm::builder::ExplicitModelBuilder<ValueType>(model.asJaniModel(), options);
     } else {
         STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Cannot build sparse model from this symbolic model description.");
     }
@@ -181,6 +186,16 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitDRNModel(
     return storm::parser::DirectEncodingParser<ValueType>::parseModel(drnFile, options);
 }
 
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitBinaryModel(std::string const&) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Only models with double values can be loaded from the binary format.");
+}
+
+template<>
+inline std::shared_ptr<storm::models::sparse::Model<double>> buildExplicitBinaryModel(std::string const& drbFile) {
+    return storm::parser::BinaryEncodingParser<double>::parseModel(drbFile);
+}
+
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitIMCAModel(std::string const&) {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exact models with direct encoding are not supported.");
@@ -20,6 +20,7 @@
 #include "storm/modelchecker/prctl/SymbolicMdpPrctlModelChecker.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 #include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
+#include "storm/modelchecker/statistical/StatisticalModelChecker.h"
 
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/MarkovAutomaton.h"
@@ -184,6 +185,40 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyWithExplorationEngine(st
     return verifyWithExplorationEngine(env, model, task);
 }
 
+//
+// Verifying with Statistical engine
+//
+template<typename ValueType>
+typename std::enable_if<std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithStatisticalEngine(
+    storm::Environment const& env, storm::storage::SymbolicModelDescription const& model,
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    STORM_LOG_THROW(model.isPrismProgram(), storm::exceptions::NotSupportedException,
+                    "Statistical model checking engine is currently only applicable to PRISM models.");
+    storm::prism::Program const& program = model.asPrismProgram();
+    STORM_LOG_THROW(program.getModelType() == storm::prism::Program::ModelType::DTMC, storm::exceptions::NotSupportedException,
+                    "The model type " << program.getModelType() << " is not supported by the statistical model checking engine.");
+
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+    storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(program);
+    if (checker.canHandle(task)) {
+        result = checker.check(env, task);
+    }
+    return result;
+}
+
+template<typename ValueType>
+typename std::enable_if<!std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithStatisticalEngine(
+    storm::Environment const&, storm::storage::SymbolicModelDescription const&, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Statistical model checking engine does not support data type.");
+}
+
+template<typename ValueType>
+std::unique_ptr<storm::modelchecker::CheckResult> verifyWithStatisticalEngine(storm::storage::SymbolicModelDescription const& model,
+                                                                              storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    Environment env;
+    return verifyWithStatisticalEngine(env, model, task);
+}
+
 //
 // Verifying with Sparse engine
 //
@@ -50,6 +50,8 @@ BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels)
       inferObservationsFromActions(false),
       addOverlappingGuardsLabel(false),
       addOutOfBoundsState(false),
+      symmetryReduction(false),
+      partialOrderReduction(false),
       reservedBitsForUnboundedVariables(32),
       showProgress(false),
       showProgressDelay(0) {
@@ -189,6 +191,14 @@ bool BuilderOptions::isAddOverlappingGuardLabelSet() const {
     return addOverlappingGuardsLabel;
 }
 
+bool BuilderOptions::isSymmetryReductionSet() const {
+    return symmetryReduction;
+}
+
+bool BuilderOptions::isPartialOrderReductionSet() const {
+    return partialOrderReduction;
+}
+
 BuilderOptions& BuilderOptions::setBuildAllRewardModels(bool newValue) {
     buildAllRewardModels = newValue;
     return *this;
@@ -290,6 +300,16 @@ BuilderOptions& BuilderOptions::setAddOverlappingGuardsLabel(bool newValue) {
     return *this;
 }
 
+BuilderOptions& BuilderOptions::setSymmetryReduction(bool newValue) {
+    symmetryReduction = newValue;
+    return *this;
+}
+
+BuilderOptions& BuilderOptions::setPartialOrderReduction(bool newValue) {
+    partialOrderReduction = newValue;
+    return *this;
+}
+
 BuilderOptions& BuilderOptions::substituteExpressions(
     std::function<storm::expressions::Expression(storm::expressions::Expression const&)> const& substitutionFunction) {
     for (auto& e : expressionLabels) {
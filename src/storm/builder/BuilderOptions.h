@@ -120,6 +120,8 @@ class BuilderOptions {
     bool isAddOutOfBoundsStateSet() const;
     uint64_t getReservedBitsForUnboundedVariables() const;
     bool isAddOverlappingGuardLabelSet() const;
+    bool isSymmetryReductionSet() const;
+    bool isPartialOrderReductionSet() const;
     uint64_t getShowProgressDelay() const;
 
     /**
@@ -206,6 +208,18 @@ class BuilderOptions {
      */
     BuilderOptions& setAddOverlappingGuardsLabel(bool newValue = true);
 
+    /**
+     * Should states that only differ by a permutation of symmetric modules be identified
+     * @param newValue the new value (default true)
+     */
+    BuilderOptions& setSymmetryReduction(bool newValue = true);
+
+    /**
+     * Should independent and invisible commands only be explored in one interleaving (where possible)
+     * @param newValue the new value (default true)
+     */
+    BuilderOptions& setPartialOrderReduction(bool newValue = true);
+
     /**
      * Sets the number of bits that will be reserved for unbounded integer variables.
      */
@@ -268,6 +282,12 @@ class BuilderOptions {
     /// A flag indicating that the an additional state for out of bounds should be created.
     bool addOutOfBoundsState;
 
+    /// A flag indicating that only one state of each orbit under permutations of symmetric modules is to be built.
+    bool symmetryReduction;
+
+    /// A flag indicating that a partial-order reduction is to be applied during the exploration.
+    bool partialOrderReduction;
+
     /// Indicates the number of bits that are reserved for the storage of unbounded integer variables.
     uint64_t reservedBitsForUnboundedVariables;
 
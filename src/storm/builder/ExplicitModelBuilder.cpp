@@ -1,10 +1,17 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
+#include <algorithm>
+#include <iterator>
 #include <map>
+#include <type_traits>
 
 #include "storm/builder/RewardModelBuilder.h"
 #include "storm/builder/StateAndChoiceInformationBuilder.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/ParallelEnvironment.h"
+
 #include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/exceptions/WrongFormatException.h"
@@ -31,6 +38,7 @@
 #include "storm/utility/builder.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/prism.h"
 
 namespace storm {
@@ -53,14 +61,16 @@ uint64_t ExplicitStateLookup<StateType>::size() const {
 
 template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options()
-    : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()) {
+    : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()),
+      numberOfThreads(storm::ParallelEnvironment().getNumberOfThreads()),
+      compressStates(storm::settings::getModule<storm::settings::modules::BuildSettings>().isCompressStatesSet()) {
     // Intentionally left empty.
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(
     std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, Options const& options)
-    : generator(generator), options(options), stateStorage(generator->getStateSize()) {
+    : generator(generator), options(options), stateStorage(generator->getStateSize(), options.compressStates) {
     // Intentionally left empty.
 }
 
@@ -69,7 +79,9 @@ ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilde
                                                                                   storm::generator::NextStateGeneratorOptions const& generatorOptions,
                                                                                   Options const& builderOptions)
     : ExplicitModelBuilder(std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions), builderOptions) {
-    // Intentionally left empty.
+    generatorFactory = [program, generatorOptions]() {
+        return std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions);
+    };
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
@@ -77,7 +89,9 @@ ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilde
                                                                                   storm::generator::NextStateGeneratorOptions const& generatorOptions,
                                                                                   Options const& builderOptions)
     : ExplicitModelBuilder(std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions), builderOptions) {
-    // Intentionally left empty.
+    generatorFactory = [model, generatorOptions]() {
+        return std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions);
+    };
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
@@ -169,29 +183,9 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     uint64_t numberOfExploredStates = 0;
     uint64_t numberOfExploredStatesSinceLastMessage = 0;
 
-    // Perform a search through the model.
-    while (!statesToExplore.empty()) {
-        // Get the first state in the queue.
-        CompressedState currentState = statesToExplore.front().first;
-        StateType currentIndex = statesToExplore.front().second;
-        statesToExplore.pop_front();
-
-        // If the exploration order differs from breadth-first, we remember that this row group was actually
-        // filled with the transitions of a different state.
-        if (options.explorationOrder != ExplorationOrder::Bfs) {
-            stateRemapping.get()[currentIndex] = currentRowGroup;
-        }
-
-        if (currentIndex % 100000 == 0) {
-            STORM_LOG_TRACE("Exploring state with id " << currentIndex << ".");
-        }
-
-        generator->load(currentState);
-        if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
-            generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
-        }
-        storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
-
+    // Adds the given behavior of the state with the given index to the components of the model.
+    auto addStateBehavior = [&](CompressedState const& currentState, StateType const& currentIndex,
+                                storm::generator::StateBehavior<ValueType, StateType> const& behavior) {
         // If there is no behavior, we might have to introduce a self-loop.
         if (behavior.empty()) {
             if (!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
@@ -310,7 +304,114 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
             auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - timeOfStart).count();
             std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds before abort.\n";
             STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
-            break;
+        }
+    };
+
+    // States are explored in parallel only if the exploration is breadth-first and if additional generators can be
+    // created. Moreover, the generators must not depend on the exploration order (as for the labels of states with
+    // overlapping guards or the partial-order reduction) and the value type must allow for concurrent computations.
+#ifdef STORM_HAVE_INTELTBB
+    bool const exploreInParallel = options.numberOfThreads > 1 && generatorFactory && options.explorationOrder == ExplorationOrder::Bfs &&
+                                   !generator->getOptions().isAddOverlappingGuardLabelSet() && !generator->getOptions().isPartialOrderReductionSet() &&
+                                   !std::is_same<ValueType, storm::RationalFunction>::value;
+#else
+    bool const exploreInParallel = false;
+#endif
+    if (exploreInParallel) {
+#ifdef STORM_HAVE_INTELTBB
+        // Create one generator for each thread. This is done upfront as the creation of generators is not thread-safe.
+        std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> workerGenerators;
+        for (uint64_t thread = 0; thread < options.numberOfThreads; ++thread) {
+            workerGenerators.push_back(generatorFactory());
+        }
+
+        // Explore the model level by level. While the states of a level are expanded, the mapping of states to ids is only read.
+        std::vector<std::pair<CompressedState, StateType>> currentLevel;
+        while (!statesToExplore.empty()) {
+            currentLevel.assign(std::make_move_iterator(statesToExplore.begin()), std::make_move_iterator(statesToExplore.end()));
+            statesToExplore.clear();
+
+            // Expand all states of the current level. For each state, we record the successors that are not yet known (in the order in
+            // which the generator requests them). Such a successor gets a placeholder index that is not used by any known state, namely
+            // the number of known states plus its position in the recorded successors. The placeholders are replaced once the level is merged.
+            StateType const placeholderOffset = static_cast<StateType>(stateStorage.getNumberOfStates());
+            std::vector<std::vector<CompressedState>> newSuccessors(currentLevel.size());
+            std::vector<storm::generator::StateBehavior<ValueType, StateType>> behaviors(currentLevel.size());
+            storm::utility::parallel::executeWithThreadLimit(options.numberOfThreads, [&]() {
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, currentLevel.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+                    auto& workerGenerator = *workerGenerators[tbb::this_task_arena::current_thread_index()];
+                    for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                        std::vector<CompressedState>& successors = newSuccessors[index];
+                        workerGenerator.load(currentLevel[index].first);
+                        behaviors[index] = workerGenerator.expand([&](CompressedState const& state) {
+                            std::pair<bool, StateType> knownIndex = stateStorage.stateToId.find(state);
+                            if (knownIndex.first) {
+                                return knownIndex.second;
+                            }
+                            auto successorIt = std::find(successors.begin(), successors.end(), state);
+                            StateType const placeholder = placeholderOffset + static_cast<StateType>(std::distance(successors.begin(), successorIt));
+                            if (successorIt == successors.end()) {
+                                successors.push_back(state);
+                            }
+                            return placeholder;
+                        });
+                    }
+                });
+            });
+
+            // Number the new states in the same order as the sequential breadth-first exploration and add the behaviors to the model.
+            std::vector<StateType> successorIndices;
+            for (uint64_t index = 0; index < currentLevel.size(); ++index) {
+                CompressedState const& currentState = currentLevel[index].first;
+                StateType const currentIndex = currentLevel[index].second;
+                if (currentIndex % 100000 == 0) {
+                    STORM_LOG_TRACE("Exploring state with id " << currentIndex << ".");
+                }
+
+                if (!newSuccessors[index].empty()) {
+                    successorIndices.clear();
+                    for (auto const& successor : newSuccessors[index]) {
+                        successorIndices.push_back(getOrAddStateIndex(successor));
+                    }
+                    for (auto& choice : behaviors[index].getChoices()) {
+                        choice.replacePlaceholderStates(placeholderOffset, successorIndices);
+                    }
+                    newSuccessors[index].clear();
+                }
+
+                if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+                    generator->load(currentState);
+                    generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
+                }
+                addStateBehavior(currentState, currentIndex, behaviors[index]);
+                behaviors[index] = storm::generator::StateBehavior<ValueType, StateType>();
+            }
+        }
+#endif
+    } else {
+        // Perform a search through the model.
+        while (!statesToExplore.empty()) {
+            // Get the first state in the queue.
+            CompressedState currentState = statesToExplore.front().first;
+            StateType currentIndex = statesToExplore.front().second;
+            statesToExplore.pop_front();
+
+            // If the exploration order differs from breadth-first, we remember that this row group was actually
+            // filled with the transitions of a different state.
+            if (options.explorationOrder != ExplorationOrder::Bfs) {
+                stateRemapping.get()[currentIndex] = currentRowGroup;
+            }
+
+            if (currentIndex % 100000 == 0) {
+                STORM_LOG_TRACE("Exploring state with id " << currentIndex << ".");
+            }
+
+            generator->load(currentState);
+            if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+                generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
+            }
+            storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
+            addStateBehavior(currentState, currentIndex, behavior);
         }
     }
 
@@ -6,6 +6,7 @@
 #include <boost/variant.hpp>
 #include <cstdint>
 #include <deque>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -78,6 +79,13 @@ class ExplicitModelBuilder {
 
         // The order in which to explore the model.
         ExplorationOrder explorationOrder;
+
+        // The number of threads used to explore the model. Multiple threads are only used for breadth-first
+        // explorations with a builder that can create additional generators (e.g. for PRISM programs and JANI models).
+        uint64_t numberOfThreads;
+
+        // Whether the states are stored in a compressed form during the exploration.
+        bool compressStates;
     };
 
     /*!
@@ -161,6 +169,10 @@ class ExplicitModelBuilder {
     /// The generator to use for the building process.
     std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
 
+    /// If set, this function creates generators that are equivalent to the one used for the building process.
+    /// These are used by the threads of a parallel exploration.
+    std::function<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>()> generatorFactory;
+
     /// The options to be used for the building process.
     Options options;
 
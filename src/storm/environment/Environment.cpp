@@ -1,4 +1,5 @@
 #include "storm/environment/Environment.h"
+#include "storm/environment/ParallelEnvironment.h"
 #include "storm/environment/SubEnvironment.h"
 #include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/SolverEnvironment.h"
@@ -37,4 +38,12 @@ ModelCheckerEnvironment& Environment::modelchecker() {
 ModelCheckerEnvironment const& Environment::modelchecker() const {
     return internalEnv.get().modelcheckerEnvironment.get();
 }
+
+ParallelEnvironment& Environment::parallel() {
+    return internalEnv.get().parallelEnvironment.get();
+}
+
+ParallelEnvironment const& Environment::parallel() const {
+    return internalEnv.get().parallelEnvironment.get();
+}
 }  // namespace storm
\ No newline at end of file
@@ -7,11 +7,13 @@ namespace storm {
 // Forward declare sub-environments
 class SolverEnvironment;
 class ModelCheckerEnvironment;
+class ParallelEnvironment;
 
 // Avoid implementing ugly copy constructors for environment by using an internal environment.
 struct InternalEnvironment {
     SubEnvironment<SolverEnvironment> solverEnvironment;
     SubEnvironment<ModelCheckerEnvironment> modelcheckerEnvironment;
+    SubEnvironment<ParallelEnvironment> parallelEnvironment;
 };
 
 class Environment {
@@ -25,6 +27,8 @@ class Environment {
     SolverEnvironment const& solver() const;
     ModelCheckerEnvironment& modelchecker();
     ModelCheckerEnvironment const& modelchecker() const;
+    ParallelEnvironment& parallel();
+    ParallelEnvironment const& parallel() const;
 
    private:
     SubEnvironment<InternalEnvironment> internalEnv;
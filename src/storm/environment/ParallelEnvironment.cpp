@@ -0,0 +1,41 @@
+#include "storm/environment/ParallelEnvironment.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "storm-config.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+namespace storm {
+
+ParallelEnvironment::ParallelEnvironment() {
+    setNumberOfThreads(storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads());
+}
+
+ParallelEnvironment::~ParallelEnvironment() {
+    // Intentionally left empty
+}
+
+uint64_t const& ParallelEnvironment::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+void ParallelEnvironment::setNumberOfThreads(uint64_t value) {
+    if (value == 0) {
+        // hardware_concurrency might return 0 if the number of hardware threads can not be determined.
+        numberOfThreads = std::max<uint64_t>(1, std::thread::hardware_concurrency());
+    } else {
+        numberOfThreads = value;
+    }
+}
+
+bool ParallelEnvironment::isParallel() const {
+#ifdef STORM_HAVE_INTELTBB
+    return numberOfThreads > 1;
+#else
+    return false;
+#endif
+}
+
+}  // namespace storm
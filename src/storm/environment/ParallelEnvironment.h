@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+
+namespace storm {
+
+class ParallelEnvironment {
+   public:
+    ParallelEnvironment();
+    ~ParallelEnvironment();
+
+    /*!
+     * Retrieves the number of threads that parallel algorithms may use. This is always at least one.
+     */
+    uint64_t const& getNumberOfThreads() const;
+
+    /*!
+     * Sets the number of threads that parallel algorithms may use. A value of 0 means that the number of hardware threads is used.
+     */
+    void setNumberOfThreads(uint64_t value);
+
+    /*!
+     * Retrieves whether parallel algorithms are to be used, i.e., whether Storm was built with support for TBB and
+     * more than one thread is available.
+     */
+    bool isParallel() const;
+
+   private:
+    uint64_t numberOfThreads;
+};
+}  // namespace storm
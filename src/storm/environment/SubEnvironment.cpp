@@ -1,6 +1,7 @@
 #include <memory>
 
 #include "storm/environment/Environment.h"
+#include "storm/environment/ParallelEnvironment.h"
 
 #include "storm/environment/modelchecker/AllModelCheckerEnvironments.h"
 #include "storm/environment/solver/AllSolverEnvironments.h"
@@ -48,6 +49,8 @@ void SubEnvironment<EnvironmentType>::assertInitialized() const {
 
 template class SubEnvironment<InternalEnvironment>;
 
+template class SubEnvironment<ParallelEnvironment>;
+
 template class SubEnvironment<MultiObjectiveModelCheckerEnvironment>;
 template class SubEnvironment<ModelCheckerEnvironment>;
 
@@ -11,6 +11,7 @@ MultiplierEnvironment::MultiplierEnvironment() {
     auto const& multiplierSettings = storm::settings::getModule<storm::settings::modules::MultiplierSettings>();
     type = multiplierSettings.getMultiplierType();
     typeSetFromDefault = multiplierSettings.isMultiplierTypeSetFromDefaultValue();
+    compactMatrix = multiplierSettings.isCompactMatrixSet();
 }
 
 MultiplierEnvironment::~MultiplierEnvironment() {
@@ -30,4 +31,12 @@ void MultiplierEnvironment::setType(storm::solver::MultiplierType value, bool is
     typeSetFromDefault = isSetFromDefault;
 }
 
+bool const& MultiplierEnvironment::isCompactMatrixSet() const {
+    return compactMatrix;
+}
+
+void MultiplierEnvironment::setCompactMatrix(bool value) {
+    compactMatrix = value;
+}
+
 }  // namespace storm
@@ -14,8 +14,12 @@ class MultiplierEnvironment {
     bool const& isTypeSetFromDefault() const;
     void setType(storm::solver::MultiplierType value, bool isSetFromDefault = false);
 
+    bool const& isCompactMatrixSet() const;
+    void setCompactMatrix(bool value);
+
    private:
     storm::solver::MultiplierType type;
     bool typeSetFromDefault;
+    bool compactMatrix;
 };
 }  // namespace storm
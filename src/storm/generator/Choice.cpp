@@ -190,6 +190,20 @@ void Choice<ValueType, StateType>::reserve(std::size_t const& size) {
     distribution.reserve(size);
 }
 
+template<typename ValueType, typename StateType>
+void Choice<ValueType, StateType>::replacePlaceholderStates(StateType const& offset, std::vector<StateType> const& replacements) {
+    storm::storage::Distribution<ValueType, StateType> newDistribution;
+    newDistribution.reserve(distribution.size());
+    for (auto const& stateProbabilityPair : distribution) {
+        if (stateProbabilityPair.first >= offset) {
+            newDistribution.addProbability(replacements[stateProbabilityPair.first - offset], stateProbabilityPair.second);
+        } else {
+            newDistribution.addProbability(stateProbabilityPair.first, stateProbabilityPair.second);
+        }
+    }
+    distribution = std::move(newDistribution);
+}
+
 template<typename ValueType, typename StateType>
 std::ostream& operator<<(std::ostream& out, Choice<ValueType, StateType> const& choice) {
     out << "<";
@@ -186,6 +186,12 @@ struct Choice {
      */
     void reserve(std::size_t const& size);
 
+    /*!
+     * Replaces placeholder states in the underlying distribution. Every state that is at least the given offset is a
+     * placeholder and is replaced by replacements[state - offset]. All other states are kept.
+     */
+    void replacePlaceholderStates(StateType const& offset, std::vector<StateType> const& replacements);
+
    private:
     // A flag indicating whether this choice is Markovian or not.
     bool markovian;
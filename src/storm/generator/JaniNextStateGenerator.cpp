@@ -50,6 +50,7 @@ JaniNextStateGenerator<ValueType, StateType>::JaniNextStateGenerator(storm::jani
       evaluateRewardExpressionsAtDestinations(false) {
     STORM_LOG_THROW(!this->options.isBuildChoiceLabelsSet(), storm::exceptions::InvalidSettingsException,
                     "JANI next-state generator cannot generate choice labels.");
+    STORM_LOG_WARN_COND(!this->options.isPartialOrderReductionSet(), "Partial-order reduction is not supported for JANI models. Building the full model.");
 
     auto features = this->model.getModelFeatures();
     features.remove(storm::jani::ModelFeature::DerivedOperators);
@@ -99,6 +100,7 @@ JaniNextStateGenerator<ValueType, StateType>::JaniNextStateGenerator(storm::jani
     // Create a proper evaluator.
     this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(this->model.getManager());
     this->transientVariableInformation.setDefaultValuesInEvaluator(*this->evaluator);
+    compileExpressions();
 
     // Build the information structs for the reward models.
     buildRewardModelInformation();
@@ -129,6 +131,42 @@ JaniNextStateGenerator<ValueType, StateType>::JaniNextStateGenerator(storm::jani
     }
 }
 
+template<typename ValueType, typename StateType>
+void JaniNextStateGenerator<ValueType, StateType>::compileExpressions() {
+    compiledGuards.resize(parallelAutomata.size());
+    compiledProbabilities.resize(parallelAutomata.size());
+    for (uint64_t automatonIndex = 0; automatonIndex < parallelAutomata.size(); ++automatonIndex) {
+        compiledGuards[automatonIndex].resize(parallelAutomata[automatonIndex].get().getNumberOfEdges());
+        compiledProbabilities[automatonIndex].resize(parallelAutomata[automatonIndex].get().getNumberOfEdges());
+    }
+    if (!std::is_same<ValueType, double>::value) {
+        return;
+    }
+
+    // As the transient variables are not stored in the states, guards and probabilities that refer to them are not compiled.
+    StateExpressionCompiler compiler(this->variableInformation);
+    for (uint64_t automatonIndex = 0; automatonIndex < parallelAutomata.size(); ++automatonIndex) {
+        uint64_t edgeIndex = 0;
+        for (auto const& edge : parallelAutomata[automatonIndex].get().getEdges()) {
+            compiledGuards[automatonIndex][edgeIndex] = compiler.compile(edge.getGuard());
+            for (auto const& destination : edge.getDestinations()) {
+                compiledProbabilities[automatonIndex][edgeIndex].push_back(compiler.compile(destination.getProbability()));
+            }
+            ++edgeIndex;
+        }
+    }
+    registers.resize(compiler.getNumberOfRegisters());
+}
+
+template<typename ValueType, typename StateType>
+bool JaniNextStateGenerator<ValueType, StateType>::isEnabled(uint64_t automatonIndex, uint64_t edgeIndex, storm::jani::Edge const& edge) const {
+    StateExpressionCompiler::CompiledExpressionPointer const& compiledGuard = compiledGuards[automatonIndex][edgeIndex];
+    if (compiledGuard) {
+        return compiledGuard->evaluate(*this->state, registers.data()) == 1.0;
+    }
+    return this->evaluator->asBool(edge.getGuard());
+}
+
 template<typename ValueType, typename StateType>
 storm::jani::ModelFeatures JaniNextStateGenerator<ValueType, StateType>::getSupportedJaniFeatures() {
     storm::jani::ModelFeatures features;
@@ -728,8 +766,8 @@ StateBehavior<ValueType, StateType> JaniNextStateGenerator<ValueType, StateType>
 
 template<typename ValueType, typename StateType>
 Choice<ValueType> JaniNextStateGenerator<ValueType, StateType>::expandNonSynchronizingEdge(storm::jani::Edge const& edge, uint64_t outputActionIndex,
-                                                                                           uint64_t automatonIndex, CompressedState const& state,
-                                                                                           StateToIdCallback stateToIdCallback) {
+                                                                                           uint64_t automatonIndex, uint64_t edgeIndex,
+                                                                                           CompressedState const& state, StateToIdCallback stateToIdCallback) {
     // Determine the exit rate if it's a Markovian edge.
     boost::optional<ValueType> exitRate = boost::none;
     if (edge.hasRate()) {
@@ -756,8 +794,11 @@ Choice<ValueType> JaniNextStateGenerator<ValueType, StateType>::expandNonSynchro
 
     // Iterate over all updates of the current command.
     ValueType probabilitySum = storm::utility::zero<ValueType>();
-    for (auto const& destination : edge.getDestinations()) {
-        ValueType probability = this->evaluator->asRational(destination.getProbability());
+    for (uint64_t destinationIndex = 0; destinationIndex < edge.getNumberOfDestinations(); ++destinationIndex) {
+        storm::jani::EdgeDestination const& destination = edge.getDestination(destinationIndex);
+        StateExpressionCompiler::CompiledExpressionPointer const& compiledProbability = compiledProbabilities[automatonIndex][edgeIndex][destinationIndex];
+        ValueType probability = compiledProbability ? storm::utility::convertNumber<ValueType>(compiledProbability->evaluate(state, registers.data()))
+                                                    : this->evaluator->asRational(destination.getProbability());
 
         if (probability != storm::utility::zero<ValueType>()) {
             bool evaluatorChanged = false;
@@ -1053,13 +1094,13 @@ std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::get
                             continue;
                         }
                     }
-                    if (!this->evaluator->asBool(indexAndEdge.second->getGuard())) {
+                    if (!isEnabled(automatonIndex, indexAndEdge.first, *indexAndEdge.second)) {
                         continue;
                     }
 
                     result.push_back(expandNonSynchronizingEdge(*indexAndEdge.second,
                                                                 outputAndEdges.first ? outputAndEdges.first.get() : indexAndEdge.second->getActionIndex(),
-                                                                automatonIndex, state, stateToIdCallback));
+                                                                automatonIndex, indexAndEdge.first, state, stateToIdCallback));
 
                     if (this->getOptions().isBuildChoiceOriginsSet()) {
                         EdgeIndexSet edgeIndex{model.encodeAutomatonAndEdgeIndices(automatonIndex, indexAndEdge.first)};
@@ -1092,7 +1133,9 @@ std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::get
             if (productiveCombination) {
                 // second, check whether each automaton has at least one enabled action
                 edgeIteratorMemory.clear();  // Store the first enabled edge in each automaton.
+                auto automatonAndEdgesIt = outputAndEdges.second.begin();
                 for (auto const& edgesIt : edgeSetsMemory) {
+                    uint64_t automatonIndex = (automatonAndEdgesIt++)->first;
                     bool atLeastOneEdge = false;
                     EdgeSetWithIndices const& edgeSetWithIndices = *edgesIt;
                     for (auto indexAndEdgeIt = edgeSetWithIndices.begin(), indexAndEdgeIte = edgeSetWithIndices.end(); indexAndEdgeIt != indexAndEdgeIte;
@@ -1105,7 +1148,7 @@ std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::get
                             }
                         }
 
-                        if (!this->evaluator->asBool(indexAndEdgeIt->second->getGuard())) {
+                        if (!isEnabled(automatonIndex, indexAndEdgeIt->first, *indexAndEdgeIt->second)) {
                             continue;
                         }
 
@@ -1148,7 +1191,7 @@ std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::get
                             }
                         }
 
-                        if (!this->evaluator->asBool(indexAndEdgeIt->second->getGuard())) {
+                        if (!isEnabled(automatonIndex, indexAndEdgeIt->first, *indexAndEdgeIt->second)) {
                             continue;
                         }
                         // If we reach this point, the edge is considered enabled.
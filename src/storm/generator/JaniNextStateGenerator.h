@@ -1,6 +1,7 @@
 #pragma once
 
 #include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/StateExpressionCompiler.h"
 #include "storm/generator/TransientVariableInformation.h"
 
 #include "storm/storage/BoostTypes.h"
@@ -159,9 +160,22 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
     /*!
      * Retrieves the choice generated by the given edge.
      */
-    Choice<ValueType> expandNonSynchronizingEdge(storm::jani::Edge const& edge, uint64_t outputActionIndex, uint64_t automatonIndex,
+    Choice<ValueType> expandNonSynchronizingEdge(storm::jani::Edge const& edge, uint64_t outputActionIndex, uint64_t automatonIndex, uint64_t edgeIndex,
                                                  CompressedState const& state, StateToIdCallback stateToIdCallback);
 
+    /*!
+     * Compiles the guards of all edges and the probabilities of their destinations such that they are evaluated
+     * directly on the compressed states (see StateExpressionCompiler). As the compiled expressions compute with
+     * doubles, this is only done if the value type is double.
+     */
+    void compileExpressions();
+
+    /*!
+     * Retrieves whether the guard of the given edge (with the given index in the automaton with the given index) is
+     * satisfied in the currently loaded state.
+     */
+    bool isEnabled(uint64_t automatonIndex, uint64_t edgeIndex, storm::jani::Edge const& edge) const;
+
     typedef std::vector<std::pair<uint64_t, storm::jani::Edge const*>> EdgeSetWithIndices;
     typedef std::unordered_map<uint64_t, EdgeSetWithIndices> LocationsAndEdges;
     typedef std::vector<std::pair<uint64_t, LocationsAndEdges>> AutomataAndEdges;
@@ -236,6 +250,15 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
 
     /// Information about the transient variables of the model.
     TransientVariableInformation<ValueType> transientVariableInformation;
+
+    /// The compiled guards of the edges, indexed by the automaton index and the edge index, and the compiled
+    /// probabilities of their destinations. Expressions that are not compiled (e.g. because they refer to transient
+    /// variables) are represented by null pointers and evaluated using the evaluator.
+    std::vector<std::vector<StateExpressionCompiler::CompiledExpressionPointer>> compiledGuards;
+    std::vector<std::vector<std::vector<StateExpressionCompiler::CompiledExpressionPointer>>> compiledProbabilities;
+
+    /// The registers used to evaluate the compiled expressions.
+    mutable std::vector<double> registers;
 };
 
 }  // namespace generator
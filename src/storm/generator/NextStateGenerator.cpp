@@ -40,6 +40,8 @@ NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions:
       variableInformation(variableInformation),
       evaluator(nullptr),
       state(nullptr),
+      unpackStatesLazily(false),
+      evaluatorHoldsCurrentState(false),
       actionMask(mask) {
     if (variableInformation.hasOutOfBoundsBit()) {
         outOfBoundsState = createOutOfBoundsState(variableInformation);
@@ -53,7 +55,14 @@ template<typename ValueType, typename StateType>
 NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager,
                                                              NextStateGeneratorOptions const& options,
                                                              std::shared_ptr<ActionMask<ValueType, StateType>> const& mask)
-    : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(), evaluator(nullptr), state(nullptr), actionMask(mask) {
+    : options(options),
+      expressionManager(expressionManager.getSharedPointer()),
+      variableInformation(),
+      evaluator(nullptr),
+      state(nullptr),
+      unpackStatesLazily(false),
+      evaluatorHoldsCurrentState(false),
+      actionMask(mask) {
     if (variableInformation.hasOutOfBoundsBit()) {
         outOfBoundsState = createOutOfBoundsState(variableInformation);
     }
@@ -108,11 +117,23 @@ storm::storage::sparse::StateValuationsBuilder NextStateGenerator<ValueType, Sta
 
 template<typename ValueType, typename StateType>
 void NextStateGenerator<ValueType, StateType>::load(CompressedState const& state) {
-    // Since almost all subsequent operations are based on the evaluator, we load the state into it now.
-    unpackStateIntoEvaluator(state, variableInformation, *evaluator);
-
-    // Also, we need to store a pointer to the state itself, because we need to be able to access it when expanding it.
+    // We need to store a pointer to the state itself, because we need to be able to access it when expanding it.
     this->state = &state;
+
+    // Unless the generator evaluates expressions directly on the state, almost all subsequent operations are based on
+    // the evaluator, so we load the state into it now.
+    evaluatorHoldsCurrentState = false;
+    if (!unpackStatesLazily) {
+        unpackCurrentStateIntoEvaluator();
+    }
+}
+
+template<typename ValueType, typename StateType>
+void NextStateGenerator<ValueType, StateType>::unpackCurrentStateIntoEvaluator() const {
+    if (!evaluatorHoldsCurrentState) {
+        unpackStateIntoEvaluator(*state, variableInformation, *evaluator);
+        evaluatorHoldsCurrentState = true;
+    }
 }
 
 template<typename ValueType, typename StateType>
@@ -120,6 +141,7 @@ bool NextStateGenerator<ValueType, StateType>::satisfies(storm::expressions::Exp
     if (expression.isTrue()) {
         return true;
     }
+    unpackCurrentStateIntoEvaluator();
     return evaluator->asBool(expression);
 }
 
@@ -195,6 +217,7 @@ storm::models::sparse::StateLabeling NextStateGenerator<ValueType, StateType>::l
     }
 
     auto const& states = stateStorage.stateToId;
+    evaluatorHoldsCurrentState = false;
     for (auto const& stateIndexPair : states) {
         unpackStateIntoEvaluator(stateIndexPair.first, variableInformation, *this->evaluator);
         unpackTransientVariableValuesIntoEvaluator(stateIndexPair.first, *this->evaluator);
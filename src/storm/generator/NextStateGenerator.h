@@ -150,6 +150,12 @@ class NextStateGenerator {
      */
     virtual void unpackTransientVariableValuesIntoEvaluator(CompressedState const& state, storm::expressions::ExpressionEvaluator<ValueType>& evaluator) const;
 
+    /*!
+     * Unpacks the currently loaded state into the evaluator unless the evaluator already holds its values. Generators
+     * that unpack states lazily (see unpackStatesLazily) need to call this before using the evaluator.
+     */
+    void unpackCurrentStateIntoEvaluator() const;
+
     virtual storm::storage::BitVector evaluateObservationLabels(CompressedState const& state) const = 0;
 
     virtual void extendStateInformation(storm::json<ValueType>& stateInfo) const;
@@ -176,6 +182,13 @@ class NextStateGenerator {
     /// The currently loaded state.
     CompressedState const* state;
 
+    /// If set, loading a state does not unpack it into the evaluator. This pays off for generators that evaluate most
+    /// expressions directly on the compressed states.
+    bool unpackStatesLazily;
+
+    /// A flag that indicates whether the evaluator holds the values of the currently loaded state.
+    mutable bool evaluatorHoldsCurrentState;
+
     /// A comparator used to compare constants.
     storm::utility::ConstantsComparator<ValueType> comparator;
 
@@ -32,7 +32,11 @@ PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::pr
 template<typename ValueType, typename StateType>
 PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options,
                                                                        std::shared_ptr<ActionMask<ValueType, StateType>> const& mask, bool)
-    : NextStateGenerator<ValueType, StateType>(program.getManager(), options, mask), program(program), rewardModels(), hasStateActionRewards(false) {
+    : NextStateGenerator<ValueType, StateType>(program.getManager(), options, mask),
+      program(program),
+      rewardModels(),
+      hasStateActionRewards(false),
+      numberOfKnownStates(0) {
     STORM_LOG_TRACE("Creating next-state generator for PRISM program: " << program);
     STORM_LOG_THROW(!this->program.specifiesSystemComposition(), storm::exceptions::WrongFormatException,
                     "The explicit next-state generator currently does not support custom system compositions.");
@@ -41,6 +45,14 @@ PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::pr
     this->checkValid();
     this->variableInformation = VariableInformation(program, options.getReservedBitsForUnboundedVariables(), options.isAddOutOfBoundsStateSet());
 
+    if (options.isSymmetryReductionSet()) {
+        symmetryReduction = PrismSymmetryReduction(this->program, this->variableInformation);
+        STORM_LOG_WARN_COND(symmetryReduction->hasSymmetricModules(), "No symmetric modules found. Building the full model.");
+        if (!symmetryReduction->hasSymmetricModules()) {
+            symmetryReduction = boost::none;
+        }
+    }
+
     // Create a proper evalator.
     this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(program.getManager());
 
@@ -96,6 +108,155 @@ PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::pr
         moduleIndexToPlayerIndexMap = program.buildModuleIndexToPlayerIndexMap();
         actionIndexToPlayerIndexMap = program.buildActionIndexToPlayerIndexMap();
     }
+
+    if (this->options.isPartialOrderReductionSet()) {
+        if (program.getModelType() != storm::prism::Program::ModelType::MDP) {
+            STORM_LOG_WARN("Partial-order reduction is only supported for MDPs. Building the full model.");
+        } else if (symmetryReduction) {
+            STORM_LOG_WARN("Partial-order reduction can not be combined with symmetry reduction. Only applying symmetry reduction.");
+        } else {
+            // Commands must not affect the labels, rewards and terminal states that are built.
+            std::set<storm::expressions::Variable> visibleVariables;
+            std::set<uint_fast64_t> visibleActionIndices;
+            for (auto const& label : this->program.getLabels()) {
+                if (this->options.isBuildAllLabelsSet() || this->options.getLabelNames().count(label.getName()) > 0) {
+                    label.getStatePredicateExpression().gatherVariables(visibleVariables);
+                }
+            }
+            for (auto const& expressionLabel : this->options.getExpressionLabels()) {
+                expressionLabel.second.gatherVariables(visibleVariables);
+            }
+            for (auto const& expressionBool : this->terminalStates) {
+                expressionBool.first.gatherVariables(visibleVariables);
+            }
+            for (auto const& rewardModel : rewardModels) {
+                for (auto const& stateReward : rewardModel.get().getStateRewards()) {
+                    stateReward.getStatePredicateExpression().gatherVariables(visibleVariables);
+                    stateReward.getRewardValueExpression().gatherVariables(visibleVariables);
+                }
+                for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+                    visibleActionIndices.insert(stateActionReward.getActionIndex());
+                }
+            }
+
+            partialOrderReduction = PrismPartialOrderReduction(this->program, visibleVariables, visibleActionIndices);
+            STORM_LOG_WARN_COND(partialOrderReduction->hasAmpleCandidates(), "No independent and invisible commands found. Building the full model.");
+            if (!partialOrderReduction->hasAmpleCandidates()) {
+                partialOrderReduction = boost::none;
+            }
+        }
+    }
+
+    compileExpressions();
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::compileExpressions() {
+    uint64_t numberOfCommands = 0;
+    uint64_t numberOfUpdates = 0;
+    for (auto const& module : program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            numberOfCommands = std::max<uint64_t>(numberOfCommands, command.getGlobalIndex() + 1);
+            for (auto const& update : command.getUpdates()) {
+                numberOfUpdates = std::max<uint64_t>(numberOfUpdates, update.getGlobalIndex() + 1);
+            }
+        }
+    }
+    compiledGuards.resize(numberOfCommands);
+    compiledUpdates.resize(numberOfUpdates);
+    compiledStateRewards.resize(rewardModels.size());
+    compiledStateActionRewards.resize(rewardModels.size());
+    compiledTerminalStates.resize(this->terminalStates.size());
+    if (!std::is_same<ValueType, double>::value) {
+        return;
+    }
+
+    StateExpressionCompiler compiler(this->variableInformation);
+    for (auto const& module : program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            compiledGuards[command.getGlobalIndex()] = compiler.compile(command.getGuardExpression());
+            for (auto const& update : command.getUpdates()) {
+                CompiledUpdate& compiledUpdate = compiledUpdates[update.getGlobalIndex()];
+                compiledUpdate.likelihood = compiler.compile(update.getLikelihoodExpression());
+
+                // The assignments are sorted in the same way as the variables, so we find the assigned variables in one pass.
+                compiledUpdate.hasCompiledAssignments = true;
+                auto booleanIt = this->variableInformation.booleanVariables.begin();
+                auto integerIt = this->variableInformation.integerVariables.begin();
+                for (auto const& assignment : update.getAssignments()) {
+                    CompiledAssignment compiledAssignment;
+                    compiledAssignment.expression = compiler.compile(assignment.getExpression());
+                    compiledAssignment.variable = assignment.getVariable();
+                    compiledAssignment.isBoolean = assignment.getExpression().hasBooleanType();
+                    if (compiledAssignment.isBoolean) {
+                        while (assignment.getVariable() != booleanIt->variable) {
+                            ++booleanIt;
+                        }
+                        compiledAssignment.bitOffset = booleanIt->bitOffset;
+                        compiledAssignment.bitWidth = 1;
+                        compiledAssignment.lowerBound = 0;
+                        compiledAssignment.upperBound = 1;
+                        compiledAssignment.forceOutOfBoundsCheck = false;
+                    } else {
+                        while (assignment.getVariable() != integerIt->variable) {
+                            ++integerIt;
+                        }
+                        compiledAssignment.bitOffset = integerIt->bitOffset;
+                        compiledAssignment.bitWidth = integerIt->bitWidth;
+                        compiledAssignment.lowerBound = integerIt->lowerBound;
+                        compiledAssignment.upperBound = integerIt->upperBound;
+                        compiledAssignment.forceOutOfBoundsCheck = integerIt->forceOutOfBoundsCheck;
+                    }
+                    compiledUpdate.hasCompiledAssignments &= compiledAssignment.expression != nullptr;
+                    compiledUpdate.assignments.push_back(std::move(compiledAssignment));
+                }
+            }
+        }
+    }
+    for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModels.size(); ++rewardModelIndex) {
+        for (auto const& stateReward : rewardModels[rewardModelIndex].get().getStateRewards()) {
+            compiledStateRewards[rewardModelIndex].push_back(
+                {compiler.compile(stateReward.getStatePredicateExpression()), compiler.compile(stateReward.getRewardValueExpression())});
+        }
+        for (auto const& stateActionReward : rewardModels[rewardModelIndex].get().getStateActionRewards()) {
+            compiledStateActionRewards[rewardModelIndex].push_back(
+                {compiler.compile(stateActionReward.getStatePredicateExpression()), compiler.compile(stateActionReward.getRewardValueExpression())});
+        }
+    }
+    for (uint64_t index = 0; index < this->terminalStates.size(); ++index) {
+        compiledTerminalStates[index] = compiler.compile(this->terminalStates[index].first);
+    }
+    registers.resize(compiler.getNumberOfRegisters());
+
+    // Expressions that could not be compiled unpack the state into the evaluator on demand.
+    this->unpackStatesLazily = true;
+}
+
+template<typename ValueType, typename StateType>
+bool PrismNextStateGenerator<ValueType, StateType>::evaluateBooleanExpression(storm::expressions::Expression const& expression,
+                                                                              CompiledExpressionPointer const& compiledExpression) const {
+    if (compiledExpression) {
+        return compiledExpression->evaluate(*this->state, registers.data()) == 1.0;
+    }
+    this->unpackCurrentStateIntoEvaluator();
+    return this->evaluator->asBool(expression);
+}
+
+template<typename ValueType, typename StateType>
+ValueType PrismNextStateGenerator<ValueType, StateType>::evaluateRationalExpression(storm::expressions::Expression const& expression,
+                                                                                   CompiledExpressionPointer const& compiledExpression) const {
+    if constexpr (std::is_same<ValueType, double>::value) {
+        if (compiledExpression) {
+            return compiledExpression->evaluate(*this->state, registers.data());
+        }
+    }
+    this->unpackCurrentStateIntoEvaluator();
+    return this->evaluator->asRational(expression);
+}
+
+template<typename ValueType, typename StateType>
+bool PrismNextStateGenerator<ValueType, StateType>::isEnabled(storm::prism::Command const& command) const {
+    return evaluateBooleanExpression(command.getGuardExpression(), compiledGuards[command.getGlobalIndex()]);
 }
 
 template<typename ValueType, typename StateType>
@@ -173,7 +334,9 @@ bool PrismNextStateGenerator<ValueType, StateType>::isPartiallyObservable() cons
 }
 
 template<typename ValueType, typename StateType>
-std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitialStates(StateToIdCallback const& stateToIdCallback) {
+std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitialStates(StateToIdCallback const& originalStateToIdCallback) {
+    // If symmetry reduction is applied, only the canonical representatives of the states are registered.
+    StateToIdCallback stateToIdCallback = symmetryReduction ? getCanonicalStateToIdCallback(originalStateToIdCallback) : originalStateToIdCallback;
     std::vector<StateType> initialStateIndices;
 
     // If all states are initial, we can simplify the enumeration substantially.
@@ -270,22 +433,38 @@ std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitial
         STORM_LOG_DEBUG("Enumerated " << initialStateIndices.size() << " initial states using SMT solving.");
     }
 
+    if (symmetryReduction) {
+        // Several initial states may have the same representative.
+        std::sort(initialStateIndices.begin(), initialStateIndices.end());
+        initialStateIndices.erase(std::unique(initialStateIndices.begin(), initialStateIndices.end()), initialStateIndices.end());
+    }
+
+    for (auto const& index : initialStateIndices) {
+        numberOfKnownStates = std::max<uint64_t>(numberOfKnownStates, index + 1);
+    }
+
     return initialStateIndices;
 }
 
 template<typename ValueType, typename StateType>
-StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& stateToIdCallback) {
+StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& originalStateToIdCallback) {
+    // If symmetry reduction is applied, only the canonical representatives of the states are registered.
+    StateToIdCallback stateToIdCallback = symmetryReduction ? getCanonicalStateToIdCallback(originalStateToIdCallback) : originalStateToIdCallback;
+
     // Prepare the result, in case we return early.
     StateBehavior<ValueType, StateType> result;
 
     // First, construct the state rewards, as we may return early if there are no choices later and we already
     // need the state rewards then.
-    for (auto const& rewardModel : rewardModels) {
+    for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModels.size(); ++rewardModelIndex) {
+        storm::prism::RewardModel const& rewardModel = rewardModels[rewardModelIndex].get();
         ValueType stateRewardValue = storm::utility::zero<ValueType>();
-        if (rewardModel.get().hasStateRewards()) {
-            for (auto const& stateReward : rewardModel.get().getStateRewards()) {
-                if (this->evaluator->asBool(stateReward.getStatePredicateExpression())) {
-                    stateRewardValue += ValueType(this->evaluator->asRational(stateReward.getRewardValueExpression()));
+        if (rewardModel.hasStateRewards()) {
+            for (uint64_t index = 0; index < rewardModel.getStateRewards().size(); ++index) {
+                storm::prism::StateReward const& stateReward = rewardModel.getStateRewards()[index];
+                CompiledReward const& compiledReward = compiledStateRewards[rewardModelIndex][index];
+                if (evaluateBooleanExpression(stateReward.getStatePredicateExpression(), compiledReward.statePredicate)) {
+                    stateRewardValue += ValueType(evaluateRationalExpression(stateReward.getRewardValueExpression(), compiledReward.rewardValue));
                 }
             }
         }
@@ -294,8 +473,9 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
 
     // If a terminal expression was set and we must not expand this state, return now.
     if (!this->terminalStates.empty()) {
-        for (auto const& expressionBool : this->terminalStates) {
-            if (this->evaluator->asBool(expressionBool.first) == expressionBool.second) {
+        for (uint64_t index = 0; index < this->terminalStates.size(); ++index) {
+            auto const& expressionBool = this->terminalStates[index];
+            if (evaluateBooleanExpression(expressionBool.first, compiledTerminalStates[index]) == expressionBool.second) {
                 return result;
             }
         }
@@ -305,6 +485,15 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
     result.setExpanded();
 
     std::vector<Choice<ValueType>> allChoices;
+    if (partialOrderReduction && this->actionMask == nullptr) {
+        // If possible, only explore a single independent and invisible command.
+        boost::optional<Choice<ValueType>> ampleChoice = getAmpleChoice(*this->state, stateToIdCallback);
+        if (ampleChoice) {
+            result.addChoice(std::move(ampleChoice.get()));
+            this->postprocess(result);
+            return result;
+        }
+    }
     if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
         // First explore only edges without a rate
         allChoices = getAsynchronousChoices(*this->state, stateToIdCallback, CommandFilter::Probabilistic);
@@ -321,6 +510,12 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
 
     std::size_t totalNumberOfChoices = allChoices.size();
 
+    if (partialOrderReduction) {
+        for (auto const& choice : allChoices) {
+            updateNumberOfKnownStates(choice);
+        }
+    }
+
     // If there is not a single choice, we return immediately, because the state has no behavior (other than
     // the state reward).
     if (totalNumberOfChoices == 0) {
@@ -363,15 +558,19 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
         }
 
         // Now construct the state-action reward for all selected reward models.
-        for (auto const& rewardModel : rewardModels) {
+        for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModels.size(); ++rewardModelIndex) {
+            storm::prism::RewardModel const& rewardModel = rewardModels[rewardModelIndex].get();
             ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
-            if (rewardModel.get().hasStateActionRewards()) {
-                for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+            if (rewardModel.hasStateActionRewards()) {
+                for (uint64_t index = 0; index < rewardModel.getStateActionRewards().size(); ++index) {
+                    storm::prism::StateActionReward const& stateActionReward = rewardModel.getStateActionRewards()[index];
+                    CompiledReward const& compiledReward = compiledStateActionRewards[rewardModelIndex][index];
                     for (auto const& choice : allChoices) {
                         if (stateActionReward.getActionIndex() == choice.getActionIndex() &&
-                            this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
+                            evaluateBooleanExpression(stateActionReward.getStatePredicateExpression(), compiledReward.statePredicate)) {
                             stateActionRewardValue +=
-                                ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression())) * choice.getTotalMass();
+                                ValueType(evaluateRationalExpression(stateActionReward.getRewardValueExpression(), compiledReward.rewardValue)) *
+                                choice.getTotalMass();
                         }
                     }
                 }
@@ -421,13 +620,53 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
 
 template<typename ValueType, typename StateType>
 bool PrismNextStateGenerator<ValueType, StateType>::evaluateBooleanExpressionInCurrentState(expressions::Expression const& expr) const {
+    this->unpackCurrentStateIntoEvaluator();
     return this->evaluator->asBool(expr);
 }
 
+template<typename ValueType, typename StateType>
+int64_t PrismNextStateGenerator<ValueType, StateType>::evaluateIntegerExpressionInCurrentState(expressions::Expression const& expr) const {
+    this->unpackCurrentStateIntoEvaluator();
+    return this->evaluator->asInt(expr);
+}
+
 template<typename ValueType, typename StateType>
 CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState const& state, storm::prism::Update const& update) {
     CompressedState newState(state);
 
+    // If possible, the compiled assignments are carried out in one pass over the precomputed locations of the variables.
+    CompiledUpdate const& compiledUpdate = compiledUpdates[update.getGlobalIndex()];
+    if (compiledUpdate.hasCompiledAssignments) {
+        for (auto const& assignment : compiledUpdate.assignments) {
+            double value = assignment.expression->evaluate(*this->state, registers.data());
+            if (assignment.isBoolean) {
+                newState.set(assignment.bitOffset, value == 1.0);
+                continue;
+            }
+            int_fast64_t assignedValue = static_cast<int_fast64_t>(value);
+            if (this->options.isAddOutOfBoundsStateSet()) {
+                if (assignedValue < assignment.lowerBound || assignedValue > assignment.upperBound) {
+                    return this->outOfBoundsState;
+                }
+            } else if (assignment.forceOutOfBoundsCheck || this->options.isExplorationChecksSet()) {
+                STORM_LOG_THROW(assignedValue >= assignment.lowerBound, storm::exceptions::WrongFormatException,
+                                "The update " << update << " leads to an out-of-bounds value (" << assignedValue << ") for the variable '"
+                                              << assignment.variable.getName() << "'.");
+                STORM_LOG_THROW(assignedValue <= assignment.upperBound, storm::exceptions::WrongFormatException,
+                                "The update " << update << " leads to an out-of-bounds value (" << assignedValue << ") for the variable '"
+                                              << assignment.variable.getName() << "'.");
+            }
+            newState.setFromInt(assignment.bitOffset, assignment.bitWidth, assignedValue - assignment.lowerBound);
+            STORM_LOG_ASSERT(static_cast<int_fast64_t>(newState.getAsInt(assignment.bitOffset, assignment.bitWidth)) + assignment.lowerBound == assignedValue,
+                             "Writing to the bit vector bucket failed (read " << newState.getAsInt(assignment.bitOffset, assignment.bitWidth) << " but wrote "
+                                                                              << assignedValue << ").");
+        }
+        return newState;
+    }
+
+    // Otherwise, the state is unpacked into the evaluator.
+    this->unpackCurrentStateIntoEvaluator();
+
     // NOTE: the following process assumes that the assignments of the update are ordered in such a way that the
     // assignments to boolean variables precede the assignments to all integer variables and that within the
     // types, the assignments to variables are ordered (in ascending order) by the expression variables.
@@ -526,7 +765,7 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
                     continue;
                 }
             }
-            if (this->evaluator->asBool(command.getGuardExpression())) {
+            if (isEnabled(command)) {
                 // Found the first enabled command for this module.
                 hasOneEnabledCommand = true;
                 activeCommands.emplace_back(&module, &commandIndices, commandIndexIt);
@@ -560,7 +799,7 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
                     continue;
                 }
             }
-            if (this->evaluator->asBool(command.getGuardExpression())) {
+            if (isEnabled(command)) {
                 commands.push_back(command);
             }
         }
@@ -603,72 +842,131 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
             }
 
             // Skip the command, if it is not enabled.
-            if (!this->evaluator->asBool(command.getGuardExpression())) {
+            if (!isEnabled(command)) {
                 continue;
             }
 
-            result.push_back(Choice<ValueType>(command.getActionIndex(), command.isMarkovian()));
-            Choice<ValueType>& choice = result.back();
+            addAsynchronousChoice(result, i, command, state, stateToIdCallback);
+        }
+    }
 
-            // Remember the choice origin only if we were asked to.
-            if (this->options.isBuildChoiceOriginsSet()) {
-                CommandSet commandIndex{command.getGlobalIndex()};
-                choice.addOriginData(boost::any(std::move(commandIndex)));
-            }
+    return result;
+}
 
-            // Iterate over all updates of the current command.
-            ValueType probabilitySum = storm::utility::zero<ValueType>();
-            for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
-                storm::prism::Update const& update = command.getUpdate(k);
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::addAsynchronousChoice(std::vector<Choice<ValueType>>& choices, uint_fast64_t moduleIndex,
+                                                                          storm::prism::Command const& command, CompressedState const& state,
+                                                                          StateToIdCallback stateToIdCallback) {
+    choices.push_back(Choice<ValueType>(command.getActionIndex(), command.isMarkovian()));
+    Choice<ValueType>& choice = choices.back();
+
+    // Remember the choice origin only if we were asked to.
+    if (this->options.isBuildChoiceOriginsSet()) {
+        CommandSet commandIndex{command.getGlobalIndex()};
+        choice.addOriginData(boost::any(std::move(commandIndex)));
+    }
 
-                ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
-                if (probability != storm::utility::zero<ValueType>()) {
-                    // Obtain target state index and add it to the list of known states. If it has not yet been
-                    // seen, we also add it to the set of states that have yet to be explored.
-                    StateType stateIndex = stateToIdCallback(applyUpdate(state, update));
+    // Iterate over all updates of the current command.
+    ValueType probabilitySum = storm::utility::zero<ValueType>();
+    for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
+        storm::prism::Update const& update = command.getUpdate(k);
 
-                    // Update the choice by adding the probability/target state to it.
-                    choice.addProbability(stateIndex, probability);
-                    if (this->options.isExplorationChecksSet()) {
-                        probabilitySum += probability;
-                    }
-                }
+        ValueType probability = evaluateRationalExpression(update.getLikelihoodExpression(), compiledUpdates[update.getGlobalIndex()].likelihood);
+        if (probability != storm::utility::zero<ValueType>()) {
+            // Obtain target state index and add it to the list of known states. If it has not yet been
+            // seen, we also add it to the set of states that have yet to be explored.
+            StateType stateIndex = stateToIdCallback(applyUpdate(state, update));
+
+            // Update the choice by adding the probability/target state to it.
+            choice.addProbability(stateIndex, probability);
+            if (this->options.isExplorationChecksSet()) {
+                probabilitySum += probability;
             }
+        }
+    }
 
-            // Create the state-action reward for the newly created choice.
-            for (auto const& rewardModel : rewardModels) {
-                ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
-                if (rewardModel.get().hasStateActionRewards()) {
-                    for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
-                        if (stateActionReward.getActionIndex() == choice.getActionIndex() &&
-                            this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
-                            stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
-                        }
-                    }
+    // Create the state-action reward for the newly created choice.
+    for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModels.size(); ++rewardModelIndex) {
+        storm::prism::RewardModel const& rewardModel = rewardModels[rewardModelIndex].get();
+        ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
+        if (rewardModel.hasStateActionRewards()) {
+            for (uint64_t index = 0; index < rewardModel.getStateActionRewards().size(); ++index) {
+                storm::prism::StateActionReward const& stateActionReward = rewardModel.getStateActionRewards()[index];
+                CompiledReward const& compiledReward = compiledStateActionRewards[rewardModelIndex][index];
+                if (stateActionReward.getActionIndex() == choice.getActionIndex() &&
+                    evaluateBooleanExpression(stateActionReward.getStatePredicateExpression(), compiledReward.statePredicate)) {
+                    stateActionRewardValue += ValueType(evaluateRationalExpression(stateActionReward.getRewardValueExpression(), compiledReward.rewardValue));
                 }
-                choice.addReward(stateActionRewardValue);
             }
+        }
+        choice.addReward(stateActionRewardValue);
+    }
 
-            if (this->options.isBuildChoiceLabelsSet() && command.isLabeled()) {
-                choice.addLabel(program.getActionName(command.getActionIndex()));
-            }
+    if (this->options.isBuildChoiceLabelsSet() && command.isLabeled()) {
+        choice.addLabel(program.getActionName(command.getActionIndex()));
+    }
 
-            if (program.getModelType() == storm::prism::Program::ModelType::SMG) {
-                storm::storage::PlayerIndex const& playerOfModule = moduleIndexToPlayerIndexMap.at(i);
-                STORM_LOG_THROW(playerOfModule != storm::storage::INVALID_PLAYER_INDEX, storm::exceptions::WrongFormatException,
-                                "Module " << module.getName() << " is not owned by any player but has at least one enabled, unlabeled command.");
-                choice.setPlayerIndex(playerOfModule);
-            }
+    if (program.getModelType() == storm::prism::Program::ModelType::SMG) {
+        storm::storage::PlayerIndex const& playerOfModule = moduleIndexToPlayerIndexMap.at(moduleIndex);
+        STORM_LOG_THROW(playerOfModule != storm::storage::INVALID_PLAYER_INDEX, storm::exceptions::WrongFormatException,
+                    "Module " << program.getModule(moduleIndex).getName() << " is not owned by any player but has at least one enabled, unlabeled command.");
+        choice.setPlayerIndex(playerOfModule);
+    }
 
-            if (this->options.isExplorationChecksSet()) {
-                // Check that the resulting distribution is in fact a distribution.
-                STORM_LOG_THROW(!program.isDiscreteTimeModel() || this->comparator.isOne(probabilitySum), storm::exceptions::WrongFormatException,
-                                "Probabilities do not sum to one for command '" << command << "' (actually sum to " << probabilitySum << ").");
+    if (this->options.isExplorationChecksSet()) {
+        // Check that the resulting distribution is in fact a distribution.
+        STORM_LOG_THROW(!program.isDiscreteTimeModel() || this->comparator.isOne(probabilitySum), storm::exceptions::WrongFormatException,
+                        "Probabilities do not sum to one for command '" << command << "' (actually sum to " << probabilitySum << ").");
+    }
+}
+
+template<typename ValueType, typename StateType>
+boost::optional<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::getAmpleChoice(CompressedState const& state,
+                                                                                                 StateToIdCallback stateToIdCallback) {
+    for (auto const& moduleIndex : partialOrderReduction->getCandidateModuleIndices()) {
+        storm::prism::Module const& module = program.getModule(moduleIndex);
+
+        // The ample candidate needs to be the only enabled command of its module.
+        storm::prism::Command const* enabledCommand = nullptr;
+        bool isUnique = true;
+        for (auto const& command : module.getCommands()) {
+            if (isEnabled(command)) {
+                isUnique = enabledCommand == nullptr;
+                enabledCommand = &command;
+                if (!isUnique) {
+                    break;
+                }
             }
         }
+        if (enabledCommand == nullptr || !isUnique || !partialOrderReduction->isAmpleCandidate(enabledCommand->getGlobalIndex())) {
+            continue;
+        }
+
+        std::vector<Choice<ValueType>> choices;
+        uint64_t firstNewState = numberOfKnownStates;
+        addAsynchronousChoice(choices, moduleIndex, *enabledCommand, state, stateToIdCallback);
+        updateNumberOfKnownStates(choices.front());
+
+        // To make sure that every cycle of the reduced model contains a fully explored state, we require all successors to be new.
+        // This way, the last state of a cycle that is explored is fully explored.
+        Choice<ValueType> const& choice = choices.front();
+        if (std::all_of(choice.begin(), choice.end(),
+                        [&firstNewState](auto const& stateProbabilityPair) { return stateProbabilityPair.first >= firstNewState; })) {
+            return std::move(choices.front());
+        }
+
+        // The successors of the rejected candidate have already been registered. As they are also successors under the full
+        // expansion, we fall back to it rather than trying further candidates (whose choice would not lead to these successors).
+        break;
     }
+    return boost::none;
+}
 
-    return result;
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::updateNumberOfKnownStates(Choice<ValueType> const& choice) {
+    for (auto const& stateProbabilityPair : choice) {
+        numberOfKnownStates = std::max<uint64_t>(numberOfKnownStates, stateProbabilityPair.first + 1);
+    }
 }
 
 template<typename ValueType, typename StateType>
@@ -687,8 +985,10 @@ void PrismNextStateGenerator<ValueType, StateType>::generateSynchronizedDistribu
         storm::prism::Command const& command = *iteratorList[position];
         for (uint_fast64_t j = 0; j < command.getNumberOfUpdates(); ++j) {
             storm::prism::Update const& update = command.getUpdate(j);
-            generateSynchronizedDistribution(applyUpdate(state, update), probability * this->evaluator->asRational(update.getLikelihoodExpression()),
-                                             position + 1, iteratorList, distribution, stateToIdCallback);
+            generateSynchronizedDistribution(
+                applyUpdate(state, update),
+                probability * evaluateRationalExpression(update.getLikelihoodExpression(), compiledUpdates[update.getGlobalIndex()].likelihood), position + 1,
+                iteratorList, distribution, stateToIdCallback);
         }
     }
 }
@@ -770,13 +1070,17 @@ void PrismNextStateGenerator<ValueType, StateType>::addSynchronousChoices(std::v
                 }
 
                 // Create the state-action reward for the newly created choice.
-                for (auto const& rewardModel : rewardModels) {
+                for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModels.size(); ++rewardModelIndex) {
+                    storm::prism::RewardModel const& rewardModel = rewardModels[rewardModelIndex].get();
                     ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
-                    if (rewardModel.get().hasStateActionRewards()) {
-                        for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+                    if (rewardModel.hasStateActionRewards()) {
+                        for (uint64_t index = 0; index < rewardModel.getStateActionRewards().size(); ++index) {
+                            storm::prism::StateActionReward const& stateActionReward = rewardModel.getStateActionRewards()[index];
+                            CompiledReward const& compiledReward = compiledStateActionRewards[rewardModelIndex][index];
                             if (stateActionReward.getActionIndex() == choice.getActionIndex() &&
-                                this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
-                                stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
+                                evaluateBooleanExpression(stateActionReward.getStatePredicateExpression(), compiledReward.statePredicate)) {
+                                stateActionRewardValue +=
+                                    ValueType(evaluateRationalExpression(stateActionReward.getRewardValueExpression(), compiledReward.rewardValue));
                             }
                         }
                     }
@@ -839,6 +1143,7 @@ storm::storage::BitVector PrismNextStateGenerator<ValueType, StateType>::evaluat
         return result;
     }
     unpackStateIntoEvaluator(state, this->variableInformation, *this->evaluator);
+    this->evaluatorHoldsCurrentState = false;
     for (uint64_t i = 0; i < program.getNumberOfObservationLabels(); ++i) {
         result.setFromInt(64 * i, 64, this->evaluator->asInt(program.getObservationLabels()[i].getStatePredicateExpression()));
     }
@@ -847,6 +1152,7 @@ storm::storage::BitVector PrismNextStateGenerator<ValueType, StateType>::evaluat
 
 template<typename ValueType, typename StateType>
 void PrismNextStateGenerator<ValueType, StateType>::extendStateInformation(storm::json<ValueType>& result) const {
+    this->unpackCurrentStateIntoEvaluator();
     for (uint64_t i = 0; i < program.getNumberOfObservationLabels(); ++i) {
         result[program.getObservationLabels()[i].getName()] = this->evaluator->asInt(program.getObservationLabels()[i].getStatePredicateExpression());
     }
@@ -905,6 +1211,16 @@ bool PrismNextStateGenerator<ValueType, StateType>::isCommandPotentiallySynchron
     return program.getPossiblySynchronizingCommands().get(command.getGlobalIndex());
 }
 
+template<typename ValueType, typename StateType>
+typename PrismNextStateGenerator<ValueType, StateType>::StateToIdCallback PrismNextStateGenerator<ValueType, StateType>::getCanonicalStateToIdCallback(
+    StateToIdCallback const& stateToIdCallback) {
+    return [this, &stateToIdCallback](CompressedState const& state) {
+        CompressedState canonicalState(state);
+        symmetryReduction->canonicalize(canonicalState);
+        return stateToIdCallback(canonicalState);
+    };
+}
+
 template class PrismNextStateGenerator<double>;
 
 #ifdef STORM_HAVE_CARL
@@ -2,6 +2,9 @@
 #define STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 
 #include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/PrismPartialOrderReduction.h"
+#include "storm/generator/PrismSymmetryReduction.h"
+#include "storm/generator/StateExpressionCompiler.h"
 
 #include "storm/storage/BoostTypes.h"
 #include "storm/storage/prism/Program.h"
@@ -41,6 +44,7 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
 
     virtual StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback) override;
     bool evaluateBooleanExpressionInCurrentState(storm::expressions::Expression const&) const;
+    int64_t evaluateIntegerExpressionInCurrentState(storm::expressions::Expression const&) const;
 
     virtual std::size_t getNumberOfRewardModels() const override;
     virtual storm::builder::RewardModelInformation getRewardModelInformation(uint64_t const& index) const override;
@@ -63,9 +67,30 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options,
                             std::shared_ptr<ActionMask<ValueType, StateType>> const&, bool flag);
 
+    typedef StateExpressionCompiler::CompiledExpressionPointer CompiledExpressionPointer;
+
+    /*!
+     * Compiles the guards and updates of all commands as well as the reward and terminal state expressions such that
+     * they are evaluated directly on the compressed states (see StateExpressionCompiler). As the compiled expressions
+     * compute with doubles, this is only done if the value type is double.
+     */
+    void compileExpressions();
+
+    /*!
+     * Evaluates the given expression in the currently loaded state. If the expression is compiled, the compiled
+     * expression is evaluated. Otherwise, the evaluator is used.
+     */
+    bool evaluateBooleanExpression(storm::expressions::Expression const& expression, CompiledExpressionPointer const& compiledExpression) const;
+    ValueType evaluateRationalExpression(storm::expressions::Expression const& expression, CompiledExpressionPointer const& compiledExpression) const;
+
+    /*!
+     * Retrieves whether the guard of the given command is satisfied in the currently loaded state.
+     */
+    bool isEnabled(storm::prism::Command const& command) const;
+
     /*!
-     * Applies an update to the state currently loaded into the evaluator and applies the resulting values to
-     * the given compressed state.
+     * Applies an update to the currently loaded state and applies the resulting values to the given compressed
+     * state. If the assignments of the update are compiled, they read the values directly from the loaded state.
      * @params state The state to which to apply the new values.
      * @params update The update to apply.
      * @return The resulting state.
@@ -100,6 +125,24 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     std::vector<Choice<ValueType>> getAsynchronousChoices(CompressedState const& state, StateToIdCallback stateToIdCallback,
                                                           CommandFilter const& commandFilter = CommandFilter::All);
 
+    /*!
+     * Adds the choice of the given (enabled and asynchronous) command of the module with the given index to the given choices.
+     */
+    void addAsynchronousChoice(std::vector<Choice<ValueType>>& choices, uint_fast64_t moduleIndex, storm::prism::Command const& command,
+                               CompressedState const& state, StateToIdCallback stateToIdCallback);
+
+    /*!
+     * Retrieves the choice of an ample candidate of the partial-order reduction that is the only enabled command of its
+     * module in the given state and whose successors are all new, if there is such a command. Checking a candidate registers its
+     * successors, so only the first candidate that is the only enabled command of its module is checked.
+     */
+    boost::optional<Choice<ValueType>> getAmpleChoice(CompressedState const& state, StateToIdCallback stateToIdCallback);
+
+    /*!
+     * Accounts for the successors of the given choice in the number of known states.
+     */
+    void updateNumberOfKnownStates(Choice<ValueType> const& choice);
+
     /*!
      * Retrieves all (potentially) synchronous choices possible from the given state.
      * Note that these may include choices that run asynchronously for this state.
@@ -130,6 +173,12 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
 
     bool isCommandPotentiallySynchronizing(prism::Command const& command) const;
 
+    /*!
+     * Creates a callback that registers the canonical representative of a state (w.r.t. the symmetry reduction) via
+     * the given callback.
+     */
+    StateToIdCallback getCanonicalStateToIdCallback(StateToIdCallback const& stateToIdCallback);
+
     // The program used for the generation of next states.
     storm::prism::Program program;
 
@@ -139,6 +188,57 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     // A flag that stores whether at least one of the selected reward models has state-action rewards.
     bool hasStateActionRewards;
 
+    // If set, only the canonical representatives of states under permutations of symmetric modules are explored.
+    boost::optional<PrismSymmetryReduction> symmetryReduction;
+
+    // If set, only a single independent and invisible command is explored in states where this is possible.
+    boost::optional<PrismPartialOrderReduction> partialOrderReduction;
+
+    // An upper bound on the indices of the states that were registered so far. As state indices are assigned in the
+    // order in which states are registered, this identifies the successors that have not been seen before.
+    uint64_t numberOfKnownStates;
+
+    // An assignment whose expression is compiled together with the location of the assigned variable.
+    struct CompiledAssignment {
+        CompiledExpressionPointer expression;
+        storm::expressions::Variable variable;
+        bool isBoolean;
+        uint64_t bitOffset;
+        uint64_t bitWidth;
+        int64_t lowerBound;
+        int64_t upperBound;
+        bool forceOutOfBoundsCheck;
+    };
+
+    // The compiled likelihood and assignments of an update. If not all assignments could be compiled, the update is
+    // applied using the evaluator.
+    struct CompiledUpdate {
+        CompiledExpressionPointer likelihood;
+        std::vector<CompiledAssignment> assignments;
+        bool hasCompiledAssignments = false;
+    };
+
+    // The compiled state predicate and reward value of a state or state-action reward.
+    struct CompiledReward {
+        CompiledExpressionPointer statePredicate;
+        CompiledExpressionPointer rewardValue;
+    };
+
+    // The compiled guards of the commands and the compiled updates, indexed by their global indices. An expression
+    // that is not compiled (e.g. because the value type is not double) is represented by a null pointer.
+    std::vector<CompiledExpressionPointer> compiledGuards;
+    std::vector<CompiledUpdate> compiledUpdates;
+
+    // The compiled state rewards and state-action rewards of the selected reward models.
+    std::vector<std::vector<CompiledReward>> compiledStateRewards;
+    std::vector<std::vector<CompiledReward>> compiledStateActionRewards;
+
+    // The compiled expressions of the terminal states.
+    std::vector<CompiledExpressionPointer> compiledTerminalStates;
+
+    // The registers used to evaluate the compiled expressions.
+    mutable std::vector<double> registers;
+
     // Mappings from module/action indices to the programs players
     std::vector<storm::storage::PlayerIndex> moduleIndexToPlayerIndexMap;
     std::map<uint_fast64_t, storm::storage::PlayerIndex> actionIndexToPlayerIndexMap;
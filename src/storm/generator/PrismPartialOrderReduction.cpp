@@ -0,0 +1,119 @@
+#include "storm/generator/PrismPartialOrderReduction.h"
+
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+/*!
+ * Inserts all variables that are read by the given command into the given set.
+ */
+inline void gatherReadVariables(storm::prism::Command const& command, std::set<storm::expressions::Variable>& variables) {
+    command.getGuardExpression().gatherVariables(variables);
+    for (auto const& update : command.getUpdates()) {
+        update.getLikelihoodExpression().gatherVariables(variables);
+        for (auto const& assignment : update.getAssignments()) {
+            assignment.getExpression().gatherVariables(variables);
+        }
+    }
+}
+
+/*!
+ * Inserts all variables that are written by the given command into the given set.
+ */
+inline void gatherWrittenVariables(storm::prism::Command const& command, std::set<storm::expressions::Variable>& variables) {
+    for (auto const& update : command.getUpdates()) {
+        for (auto const& assignment : update.getAssignments()) {
+            variables.insert(assignment.getVariable());
+        }
+    }
+}
+
+/*!
+ * Checks whether the two given sets of variables are disjoint.
+ */
+inline bool areDisjoint(std::set<storm::expressions::Variable> const& first, std::set<storm::expressions::Variable> const& second) {
+    for (auto const& variable : first) {
+        if (second.count(variable) > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+PrismPartialOrderReduction::PrismPartialOrderReduction(storm::prism::Program const& program,
+                                                       std::set<storm::expressions::Variable> const& visibleVariables,
+                                                       std::set<uint_fast64_t> const& visibleActionIndices)
+    : ampleCandidates(program.getNumberOfCommands()) {
+    // Determine the variables read and written by each module.
+    uint_fast64_t const numberOfModules = program.getNumberOfModules();
+    std::vector<std::set<storm::expressions::Variable>> readVariables(numberOfModules);
+    std::vector<std::set<storm::expressions::Variable>> writtenVariables(numberOfModules);
+    for (uint_fast64_t moduleIndex = 0; moduleIndex < numberOfModules; ++moduleIndex) {
+        for (auto const& command : program.getModule(moduleIndex).getCommands()) {
+            gatherReadVariables(command, readVariables[moduleIndex]);
+            gatherWrittenVariables(command, writtenVariables[moduleIndex]);
+        }
+    }
+
+    storm::storage::BitVector const& synchronizingCommands = program.getPossiblySynchronizingCommands();
+    for (uint_fast64_t moduleIndex = 0; moduleIndex < numberOfModules; ++moduleIndex) {
+        storm::prism::Module const& module = program.getModule(moduleIndex);
+
+        std::set<storm::expressions::Variable> readByOthers;
+        std::set<storm::expressions::Variable> writtenByOthers;
+        for (uint_fast64_t otherModuleIndex = 0; otherModuleIndex < numberOfModules; ++otherModuleIndex) {
+            if (otherModuleIndex != moduleIndex) {
+                readByOthers.insert(readVariables[otherModuleIndex].begin(), readVariables[otherModuleIndex].end());
+                writtenByOthers.insert(writtenVariables[otherModuleIndex].begin(), writtenVariables[otherModuleIndex].end());
+            }
+        }
+
+        // The set of enabled commands of the module must not be affected by other modules.
+        std::set<storm::expressions::Variable> guardVariables;
+        for (auto const& command : module.getCommands()) {
+            command.getGuardExpression().gatherVariables(guardVariables);
+        }
+        if (!areDisjoint(guardVariables, writtenByOthers)) {
+            continue;
+        }
+
+        bool hasAmpleCandidate = false;
+        for (auto const& command : module.getCommands()) {
+            if (synchronizingCommands.get(command.getGlobalIndex()) || visibleActionIndices.count(command.getActionIndex()) > 0) {
+                continue;
+            }
+            std::set<storm::expressions::Variable> commandReadVariables;
+            std::set<storm::expressions::Variable> commandWrittenVariables;
+            gatherReadVariables(command, commandReadVariables);
+            gatherWrittenVariables(command, commandWrittenVariables);
+            if (areDisjoint(commandReadVariables, writtenByOthers) && areDisjoint(commandWrittenVariables, writtenByOthers) &&
+                areDisjoint(commandWrittenVariables, readByOthers) && areDisjoint(commandWrittenVariables, visibleVariables)) {
+                ampleCandidates.set(command.getGlobalIndex());
+                hasAmpleCandidate = true;
+            }
+        }
+        if (hasAmpleCandidate) {
+            candidateModuleIndices.push_back(moduleIndex);
+        }
+    }
+
+    STORM_LOG_INFO("Partial-order reduction found " << ampleCandidates.getNumberOfSetBits() << " of " << program.getNumberOfCommands()
+                                                    << " commands that are independent of other modules and invisible.");
+}
+
+bool PrismPartialOrderReduction::hasAmpleCandidates() const {
+    return !candidateModuleIndices.empty();
+}
+
+std::vector<uint_fast64_t> const& PrismPartialOrderReduction::getCandidateModuleIndices() const {
+    return candidateModuleIndices;
+}
+
+bool PrismPartialOrderReduction::isAmpleCandidate(uint_fast64_t globalCommandIndex) const {
+    return ampleCandidates.get(globalCommandIndex);
+}
+
+}  // namespace generator
+}  // namespace storm
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace prism {
+class Program;
+}
+
+namespace generator {
+
+/*!
+ * Statically determines the commands of a PRISM program that may serve as (singleton) ample sets for an ample-set
+ * partial-order reduction of MDPs. A command is an ample candidate if it is
+ *   - not synchronizing with other modules,
+ *   - independent of all commands of the other modules, i.e. it neither reads nor writes variables written by other
+ *     modules and it does not write variables read by other modules, and
+ *   - invisible, i.e. it does not write a variable that is relevant for the labels (or rewards) and its action has no
+ *     state-action rewards.
+ * Moreover, the guards of the module of the command must not refer to variables written by other modules. Hence, if
+ * an ample candidate is the only enabled command of its module in some state, it remains the only enabled command of
+ * its module until it is executed and it is independent of all other commands that may be executed before.
+ *
+ * Exploring only the ample candidate in such a state preserves minimal and maximal probabilities of LTL properties
+ * without next operators, provided that along every cycle of the reduced model, at least one state is fully explored.
+ */
+class PrismPartialOrderReduction {
+   public:
+    /*!
+     * Analyzes the given program.
+     *
+     * @param program The program to analyze. Constants and formulas need to be substituted already.
+     * @param visibleVariables The variables that are relevant for the labels, rewards or terminal states.
+     * @param visibleActionIndices The indices of actions that are relevant, e.g., because they carry rewards.
+     */
+    PrismPartialOrderReduction(storm::prism::Program const& program, std::set<storm::expressions::Variable> const& visibleVariables,
+                               std::set<uint_fast64_t> const& visibleActionIndices);
+
+    /*!
+     * Retrieves whether the program has at least one ample candidate.
+     */
+    bool hasAmpleCandidates() const;
+
+    /*!
+     * Retrieves the indices of the modules that have at least one ample candidate.
+     */
+    std::vector<uint_fast64_t> const& getCandidateModuleIndices() const;
+
+    /*!
+     * Retrieves whether the command with the given global index is an ample candidate.
+     */
+    bool isAmpleCandidate(uint_fast64_t globalCommandIndex) const;
+
+   private:
+    // The indices of the modules that have at least one ample candidate.
+    std::vector<uint_fast64_t> candidateModuleIndices;
+
+    // The (global) indices of the ample candidates.
+    storm::storage::BitVector ampleCandidates;
+};
+
+}  // namespace generator
+}  // namespace storm
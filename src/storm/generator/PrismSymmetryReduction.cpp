@@ -0,0 +1,269 @@
+#include "storm/generator/PrismSymmetryReduction.h"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <set>
+#include <sstream>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+/*!
+ * Retrieves the local variables of the given module in the order of their declaration (boolean variables first).
+ */
+inline std::vector<storm::expressions::Variable> getLocalVariables(storm::prism::Module const& module) {
+    std::vector<storm::expressions::Variable> result;
+    for (auto const& variable : module.getBooleanVariables()) {
+        result.push_back(variable.getExpressionVariable());
+    }
+    for (auto const& variable : module.getIntegerVariables()) {
+        result.push_back(variable.getExpressionVariable());
+    }
+    return result;
+}
+
+/*!
+ * Inserts all variables that are read or written by the given command into the given set.
+ */
+inline void gatherVariables(storm::prism::Command const& command, std::set<storm::expressions::Variable>& variables) {
+    command.getGuardExpression().gatherVariables(variables);
+    for (auto const& update : command.getUpdates()) {
+        update.getLikelihoodExpression().gatherVariables(variables);
+        for (auto const& assignment : update.getAssignments()) {
+            variables.insert(assignment.getVariable());
+            assignment.getExpression().gatherVariables(variables);
+        }
+    }
+}
+
+/*!
+ * Creates a textual representation of the behavior of the given command (ignoring its action) after applying the given
+ * renaming of variables. Two commands behave the same iff their representations coincide.
+ */
+inline std::string getCommandSignature(storm::prism::Command const& command,
+                                       std::map<storm::expressions::Variable, storm::expressions::Expression> const& renaming) {
+    std::stringstream stream;
+    stream << (command.isMarkovian() ? "<> " : "[] ") << command.getGuardExpression().substitute(renaming).simplify() << " ->";
+    for (auto const& update : command.getUpdates()) {
+        // The order of the assignments is irrelevant (and may differ due to the renaming).
+        std::vector<std::string> assignments;
+        for (auto const& assignment : update.getAssignments()) {
+            std::stringstream assignmentStream;
+            auto renamingIt = renaming.find(assignment.getVariable());
+            if (renamingIt != renaming.end()) {
+                assignmentStream << renamingIt->second;
+            } else {
+                assignmentStream << assignment.getVariable().getName();
+            }
+            assignmentStream << "'=" << assignment.getExpression().substitute(renaming).simplify();
+            assignments.push_back(assignmentStream.str());
+        }
+        std::sort(assignments.begin(), assignments.end());
+        stream << " " << update.getLikelihoodExpression().substitute(renaming) << ":";
+        for (auto const& assignment : assignments) {
+            stream << " (" << assignment << ")";
+        }
+    }
+    return stream.str();
+}
+
+PrismSymmetryReduction::PrismSymmetryReduction(storm::prism::Program const& program, VariableInformation const& variableInformation) {
+    if (program.getModelType() == storm::prism::Program::ModelType::SMG || program.isPartiallyObservable()) {
+        STORM_LOG_WARN("Symmetry reduction is not supported for games and partially observable models. Building the full model.");
+        return;
+    }
+
+    std::map<storm::expressions::Variable, VariablePosition> variableToPosition;
+    for (auto const& booleanVariable : variableInformation.booleanVariables) {
+        variableToPosition[booleanVariable.variable] = {booleanVariable.bitOffset, 1, true};
+    }
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        variableToPosition[integerVariable.variable] = {integerVariable.bitOffset, integerVariable.bitWidth, false};
+    }
+    auto getIntegerVariableInformation = [&variableInformation](storm::expressions::Variable const& variable) -> IntegerVariableInformation const& {
+        return *std::find_if(variableInformation.integerVariables.begin(), variableInformation.integerVariables.end(),
+                             [&variable](IntegerVariableInformation const& information) { return information.variable == variable; });
+    };
+
+    // Determine the variables that are referenced by each module.
+    std::vector<std::set<storm::expressions::Variable>> referencedVariables(program.getNumberOfModules());
+    for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+        for (auto const& command : program.getModule(moduleIndex).getCommands()) {
+            gatherVariables(command, referencedVariables[moduleIndex]);
+        }
+    }
+
+    std::vector<bool> isGrouped(program.getNumberOfModules(), false);
+    for (uint64_t referenceIndex = 0; referenceIndex < program.getNumberOfModules(); ++referenceIndex) {
+        storm::prism::Module const& reference = program.getModule(referenceIndex);
+        std::vector<storm::expressions::Variable> referenceVariables = getLocalVariables(reference);
+        if (isGrouped[referenceIndex] || referenceVariables.empty()) {
+            continue;
+        }
+
+        // Collect the modules that behave like the reference module up to a renaming of the local variables (that
+        // maps the i-th variable to the i-th variable) and of the actions.
+        std::vector<uint64_t> members = {referenceIndex};
+        std::vector<std::map<uint64_t, uint64_t>> actionRenamings = {{}};
+        for (uint64_t moduleIndex = referenceIndex + 1; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+            storm::prism::Module const& module = program.getModule(moduleIndex);
+            if (isGrouped[moduleIndex] || module.getNumberOfBooleanVariables() != reference.getNumberOfBooleanVariables() ||
+                module.getNumberOfIntegerVariables() != reference.getNumberOfIntegerVariables() ||
+                module.getNumberOfCommands() != reference.getNumberOfCommands()) {
+                continue;
+            }
+
+            std::vector<storm::expressions::Variable> moduleVariables = getLocalVariables(module);
+            std::map<storm::expressions::Variable, storm::expressions::Expression> renaming;
+            bool isSymmetric = true;
+            for (uint64_t variableIndex = 0; variableIndex < referenceVariables.size(); ++variableIndex) {
+                storm::expressions::Variable const& referenceVariable = referenceVariables[variableIndex];
+                storm::expressions::Variable const& moduleVariable = moduleVariables[variableIndex];
+                if (variableIndex >= reference.getNumberOfBooleanVariables()) {
+                    auto const& referenceInformation = getIntegerVariableInformation(referenceVariable);
+                    auto const& moduleInformation = getIntegerVariableInformation(moduleVariable);
+                    isSymmetric &= referenceInformation.lowerBound == moduleInformation.lowerBound &&
+                                   referenceInformation.upperBound == moduleInformation.upperBound &&
+                                   referenceInformation.bitWidth == moduleInformation.bitWidth;
+                }
+                renaming.emplace(referenceVariable, moduleVariable.getExpression());
+            }
+
+            std::map<uint64_t, uint64_t> actionRenaming;
+            for (uint64_t commandIndex = 0; isSymmetric && commandIndex < reference.getNumberOfCommands(); ++commandIndex) {
+                storm::prism::Command const& referenceCommand = reference.getCommand(commandIndex);
+                storm::prism::Command const& command = module.getCommand(commandIndex);
+                if (referenceCommand.isLabeled() != command.isLabeled() ||
+                    getCommandSignature(referenceCommand, renaming) != getCommandSignature(command, {})) {
+                    isSymmetric = false;
+                } else if (referenceCommand.isLabeled()) {
+                    auto insertionResult = actionRenaming.emplace(referenceCommand.getActionIndex(), command.getActionIndex());
+                    isSymmetric = insertionResult.first->second == command.getActionIndex();
+                }
+            }
+
+            if (isSymmetric) {
+                members.push_back(moduleIndex);
+                actionRenamings.push_back(std::move(actionRenaming));
+            }
+        }
+        if (members.size() < 2) {
+            continue;
+        }
+
+        // Actions need to be either shared by all modules of the group or private to each of the modules.
+        bool isValidGroup = true;
+        for (auto const& actionIndex : reference.getSynchronizingActionIndices()) {
+            bool isShared = std::all_of(actionRenamings.begin() + 1, actionRenamings.end(),
+                                        [&actionIndex](std::map<uint64_t, uint64_t> const& actionRenaming) {
+                                            return actionRenaming.at(actionIndex) == actionIndex;
+                                        });
+            if (isShared) {
+                continue;
+            }
+            for (uint64_t memberIndex = 0; memberIndex < members.size(); ++memberIndex) {
+                uint64_t memberActionIndex = memberIndex == 0 ? actionIndex : actionRenamings[memberIndex].at(actionIndex);
+                isValidGroup &= program.getModuleIndicesByActionIndex(memberActionIndex) == std::set<uint_fast64_t>({members[memberIndex]});
+            }
+        }
+
+        // The local variables of a module of the group must not be referenced by any other module.
+        std::set<storm::expressions::Variable> groupVariables;
+        for (auto const& member : members) {
+            auto localVariables = getLocalVariables(program.getModule(member));
+            groupVariables.insert(localVariables.begin(), localVariables.end());
+        }
+        for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+            std::set<storm::expressions::Variable> foreignVariables = groupVariables;
+            if (std::find(members.begin(), members.end(), moduleIndex) != members.end()) {
+                for (auto const& variable : getLocalVariables(program.getModule(moduleIndex))) {
+                    foreignVariables.erase(variable);
+                }
+            }
+            for (auto const& variable : referencedVariables[moduleIndex]) {
+                isValidGroup &= foreignVariables.count(variable) == 0;
+            }
+        }
+
+        if (!isValidGroup) {
+            STORM_LOG_INFO("Modules of the same structure as module '" << reference.getName()
+                                                                         << "' are not symmetric due to their interaction with other modules.");
+            continue;
+        }
+
+        SymmetricGroup group;
+        std::stringstream moduleNames;
+        for (auto const& member : members) {
+            isGrouped[member] = true;
+            std::vector<VariablePosition> positions;
+            for (auto const& variable : getLocalVariables(program.getModule(member))) {
+                positions.push_back(variableToPosition.at(variable));
+            }
+            group.moduleVariables.push_back(std::move(positions));
+            moduleNames << (member == members.front() ? "" : ", ") << program.getModule(member).getName();
+        }
+        groups.push_back(std::move(group));
+        STORM_LOG_INFO("Detected symmetric modules " << moduleNames.str() << ".");
+    }
+
+    STORM_LOG_WARN_COND(groups.empty(),
+                        "Applying symmetry reduction. Labels, reward models and properties need to be invariant under permuting symmetric modules.");
+}
+
+bool PrismSymmetryReduction::hasSymmetricModules() const {
+    return !groups.empty();
+}
+
+uint64_t PrismSymmetryReduction::getNumberOfSymmetricGroups() const {
+    return groups.size();
+}
+
+void PrismSymmetryReduction::canonicalize(CompressedState& state) {
+    for (auto const& group : groups) {
+        uint64_t const numberOfModules = group.moduleVariables.size();
+        uint64_t const numberOfVariables = group.moduleVariables.front().size();
+
+        // Read the values of the local variables of each module.
+        values.resize(numberOfModules * numberOfVariables);
+        auto valueIt = values.begin();
+        for (auto const& positions : group.moduleVariables) {
+            for (auto const& position : positions) {
+                *valueIt = position.isBoolean ? static_cast<uint64_t>(state.get(position.bitOffset)) : state.getAsInt(position.bitOffset, position.bitWidth);
+                ++valueIt;
+            }
+        }
+
+        // Sort the modules by their (lexicographically ordered) values.
+        order.resize(numberOfModules);
+        std::iota(order.begin(), order.end(), 0);
+        auto isSmaller = [this, numberOfVariables](uint64_t first, uint64_t second) {
+            return std::lexicographical_compare(values.begin() + first * numberOfVariables, values.begin() + (first + 1) * numberOfVariables,
+                                                values.begin() + second * numberOfVariables, values.begin() + (second + 1) * numberOfVariables);
+        };
+        if (std::is_sorted(order.begin(), order.end(), isSmaller)) {
+            continue;
+        }
+        std::sort(order.begin(), order.end(), isSmaller);
+
+        // Write back the values in the new order.
+        for (uint64_t module = 0; module < numberOfModules; ++module) {
+            auto const& positions = group.moduleVariables[module];
+            for (uint64_t variable = 0; variable < numberOfVariables; ++variable) {
+                uint64_t value = values[order[module] * numberOfVariables + variable];
+                if (positions[variable].isBoolean) {
+                    state.set(positions[variable].bitOffset, value != 0);
+                } else {
+                    state.setFromInt(positions[variable].bitOffset, positions[variable].bitWidth, value);
+                }
+            }
+        }
+    }
+}
+
+}  // namespace generator
+}  // namespace storm
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+namespace prism {
+class Program;
+}
+
+namespace generator {
+
+struct VariableInformation;
+
+/*!
+ * Detects groups of fully symmetric modules in a PRISM program (typically modules that were obtained by renaming the
+ * same module) and maps states to a canonical representative of their orbit under permutations of these modules. The
+ * representative is obtained by sorting the blocks of module-local variables of each group. Building the model from
+ * the representatives only yields the quotient under the symmetry. This preserves all properties whose labels and
+ * rewards are invariant under permuting the modules of a group.
+ */
+class PrismSymmetryReduction {
+   public:
+    /*!
+     * Detects the groups of symmetric modules of the given program.
+     *
+     * @param program The program whose modules to consider. Constants and formulas need to be substituted already.
+     * @param variableInformation The information about the variables of the program in the compressed states.
+     */
+    PrismSymmetryReduction(storm::prism::Program const& program, VariableInformation const& variableInformation);
+
+    /*!
+     * Retrieves whether at least one group of symmetric modules was detected.
+     */
+    bool hasSymmetricModules() const;
+
+    /*!
+     * Retrieves the number of detected groups of symmetric modules.
+     */
+    uint64_t getNumberOfSymmetricGroups() const;
+
+    /*!
+     * Replaces the given state by the canonical representative of its orbit.
+     */
+    void canonicalize(CompressedState& state);
+
+   private:
+    // The position of a module-local variable within the compressed states.
+    struct VariablePosition {
+        uint64_t bitOffset;
+        uint64_t bitWidth;
+        bool isBoolean;
+    };
+
+    // A group of symmetric modules, where the i-th variable of each module corresponds to the i-th variable of all
+    // other modules.
+    struct SymmetricGroup {
+        std::vector<std::vector<VariablePosition>> moduleVariables;
+    };
+
+    // The detected groups of symmetric modules.
+    std::vector<SymmetricGroup> groups;
+
+    // Buffers used to canonicalize a state.
+    std::vector<uint64_t> values;
+    std::vector<uint64_t> order;
+};
+
+}  // namespace generator
+}  // namespace storm
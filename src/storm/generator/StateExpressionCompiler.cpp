@@ -0,0 +1,45 @@
+#include "storm/generator/StateExpressionCompiler.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "storm/generator/VariableInformation.h"
+
+namespace storm {
+namespace generator {
+
+/*!
+ * Retrieves the locations of all boolean and integer variables in the compressed states.
+ */
+inline std::unordered_map<storm::expressions::Variable, storm::expressions::ToBytecodeVisitor::BitVectorLocation> getVariableLocations(
+    VariableInformation const& variableInformation) {
+    std::unordered_map<storm::expressions::Variable, storm::expressions::ToBytecodeVisitor::BitVectorLocation> result;
+    for (auto const& booleanVariable : variableInformation.booleanVariables) {
+        result[booleanVariable.variable] = {booleanVariable.bitOffset, 1, 0};
+    }
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        result[integerVariable.variable] = {integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound};
+    }
+    return result;
+}
+
+StateExpressionCompiler::StateExpressionCompiler(VariableInformation const& variableInformation)
+    : visitor(getVariableLocations(variableInformation)), numberOfRegisters(1) {
+    // Intentionally left empty.
+}
+
+StateExpressionCompiler::CompiledExpressionPointer StateExpressionCompiler::compile(storm::expressions::Expression const& expression) {
+    if (!visitor.canCompile(expression)) {
+        return nullptr;
+    }
+    CompiledExpressionPointer result = visitor.compile(expression);
+    numberOfRegisters = std::max(numberOfRegisters, result->getNumberOfRegisters());
+    return result;
+}
+
+uint64_t StateExpressionCompiler::getNumberOfRegisters() const {
+    return numberOfRegisters;
+}
+
+}  // namespace generator
+}  // namespace storm
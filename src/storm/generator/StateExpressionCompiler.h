@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "storm/storage/expressions/BytecodeCompiledExpression.h"
+#include "storm/storage/expressions/ToBytecodeVisitor.h"
+
+namespace storm {
+namespace generator {
+
+struct VariableInformation;
+
+/*!
+ * Compiles expressions over the boolean and integer variables of a model to bytecode (see BytecodeCompiledExpression)
+ * that reads the values of the variables directly from the bits of a compressed state. Evaluating such an expression
+ * neither requires unpacking the state into an evaluator nor traversing the expression tree.
+ */
+class StateExpressionCompiler {
+   public:
+    typedef std::shared_ptr<storm::expressions::BytecodeCompiledExpression const> CompiledExpressionPointer;
+
+    /*!
+     * Creates a compiler for states whose layout is given by the provided variable information.
+     */
+    StateExpressionCompiler(VariableInformation const& variableInformation);
+
+    /*!
+     * Compiles the given expression.
+     *
+     * @return The compiled expression or nullptr if the expression refers to variables that are not stored in the
+     * states (such as transient variables).
+     */
+    CompiledExpressionPointer compile(storm::expressions::Expression const& expression);
+
+    /*!
+     * Retrieves the number of registers that suffices to evaluate all expressions compiled so far.
+     */
+    uint64_t getNumberOfRegisters() const;
+
+   private:
+    // The visitor used to compile the expressions.
+    storm::expressions::ToBytecodeVisitor visitor;
+
+    // The maximal number of registers needed by the expressions compiled so far.
+    uint64_t numberOfRegisters;
+};
+
+}  // namespace generator
+}  // namespace storm
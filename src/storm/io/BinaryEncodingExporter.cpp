@@ -0,0 +1,239 @@
+#include "storm/io/BinaryEncodingExporter.h"
+
+#include <algorithm>
+#include <list>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/BinaryEncodingFormat.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace exporter {
+
+/*!
+ * A section of a binary encoded model. The payload is not owned by the section.
+ */
+struct BinaryEncodingSection {
+    BinaryEncoding::SectionType type;
+    std::string name;
+    char const* data;
+    uint64_t size;
+};
+
+/*!
+ * Appends the raw bytes of the given value to the given buffer.
+ */
+template<typename T>
+inline void appendRaw(std::string& buffer, T const& value) {
+    buffer.append(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+/*!
+ * Appends the given string (prefixed by its length) to the given buffer.
+ */
+inline void appendString(std::string& buffer, std::string const& value) {
+    appendRaw(buffer, static_cast<uint32_t>(value.size()));
+    buffer.append(value);
+}
+
+/*!
+ * Adds a section whose payload is the content of the given vector.
+ */
+template<typename T>
+inline void addVectorSection(std::vector<BinaryEncodingSection>& sections, BinaryEncoding::SectionType type, std::string const& name,
+                             std::vector<T> const& vector) {
+    sections.push_back({type, name, reinterpret_cast<char const*>(vector.data()), vector.size() * sizeof(T)});
+}
+
+/*!
+ * Adds a section whose payload are the buckets of the given bit vector. The buckets are stored in the given buffers.
+ */
+inline void addBitVectorSection(std::vector<BinaryEncodingSection>& sections, std::list<std::string>& buffers, BinaryEncoding::SectionType type,
+                                std::string const& name, storm::storage::BitVector const& bitVector) {
+    buffers.emplace_back();
+    std::string& buffer = buffers.back();
+    for (uint64_t bitIndex = 0; bitIndex < bitVector.size(); bitIndex += 64) {
+        appendRaw(buffer, static_cast<uint64_t>(bitVector.getAsInt(bitIndex, std::min<uint64_t>(64, bitVector.size() - bitIndex))));
+    }
+    sections.push_back({type, name, buffer.data(), buffer.size()});
+}
+
+/*!
+ * Encodes the given state valuations. The payload starts with the number of variables followed by the type and name of
+ * each variable. Afterwards, the values of all variables are given for each state, where boolean, integer and
+ * observation label values are stored as int64 and rational values are stored as strings.
+ */
+inline std::string encodeStateValuations(storm::storage::sparse::StateValuations const& stateValuations, uint64_t numberOfStates) {
+    std::string buffer;
+    if (numberOfStates == 0) {
+        appendRaw(buffer, static_cast<uint64_t>(0));
+        return buffer;
+    }
+
+    std::vector<BinaryEncoding::ValuationType> types;
+    std::vector<std::string> names;
+    for (auto valueIt = stateValuations.at(0).begin(); valueIt != stateValuations.at(0).end(); ++valueIt) {
+        if (valueIt.isLabelAssignment()) {
+            types.push_back(BinaryEncoding::ValuationType::ObservationLabel);
+        } else if (valueIt.isBoolean()) {
+            types.push_back(BinaryEncoding::ValuationType::Boolean);
+        } else if (valueIt.isInteger()) {
+            types.push_back(BinaryEncoding::ValuationType::Integer);
+        } else {
+            STORM_LOG_ASSERT(valueIt.isRational(), "Unexpected type of variable " << valueIt.getName() << ".");
+            types.push_back(BinaryEncoding::ValuationType::Rational);
+        }
+        names.push_back(valueIt.getName());
+    }
+
+    appendRaw(buffer, static_cast<uint64_t>(types.size()));
+    for (uint64_t index = 0; index < types.size(); ++index) {
+        appendRaw(buffer, types[index]);
+        appendString(buffer, names[index]);
+    }
+
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        STORM_LOG_THROW(!stateValuations.isEmpty(state) || types.empty(), storm::exceptions::NotSupportedException,
+                        "Binary export requires a valuation for every state, but state " << state << " has none.");
+        for (auto valueIt = stateValuations.at(state).begin(); valueIt != stateValuations.at(state).end(); ++valueIt) {
+            if (valueIt.isLabelAssignment()) {
+                appendRaw(buffer, static_cast<int64_t>(valueIt.getLabelValue()));
+            } else if (valueIt.isBoolean()) {
+                appendRaw(buffer, static_cast<int64_t>(valueIt.getBooleanValue()));
+            } else if (valueIt.isInteger()) {
+                appendRaw(buffer, static_cast<int64_t>(valueIt.getIntegerValue()));
+            } else {
+                appendString(buffer, storm::utility::to_string(valueIt.getRationalValue()));
+            }
+        }
+    }
+    return buffer;
+}
+
+/*!
+ * Writes zeros such that the given size is padded to a multiple of eight.
+ */
+inline void writePadding(std::ostream& os, uint64_t size) {
+    static char const zeros[8] = {};
+    os.write(zeros, BinaryEncoding::getPadding(size));
+}
+
+template<typename ValueType>
+void binaryExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& sparseModel) {
+    static_assert(std::is_same<ValueType, double>::value, "The binary encoding only supports models with double values.");
+    static_assert(sizeof(storm::storage::MatrixEntry<uint_fast64_t, ValueType>) == sizeof(uint64_t) + sizeof(ValueType),
+                  "Unexpected layout of matrix entries.");
+    static_assert(sizeof(uint_fast64_t) == sizeof(uint64_t), "Unexpected size of matrix indices.");
+
+    BinaryEncoding::Header header;
+    std::copy(BinaryEncoding::magic, BinaryEncoding::magic + sizeof(header.magic), header.magic);
+    header.version = BinaryEncoding::version;
+    header.byteOrderMark = BinaryEncoding::byteOrderMark;
+    switch (sparseModel->getType()) {
+        case storm::models::ModelType::Dtmc:
+            header.modelType = BinaryEncoding::ModelType::Dtmc;
+            break;
+        case storm::models::ModelType::Ctmc:
+            header.modelType = BinaryEncoding::ModelType::Ctmc;
+            break;
+        case storm::models::ModelType::Mdp:
+            header.modelType = BinaryEncoding::ModelType::Mdp;
+            break;
+        case storm::models::ModelType::MarkovAutomaton:
+            header.modelType = BinaryEncoding::ModelType::MarkovAutomaton;
+            break;
+        case storm::models::ModelType::Pomdp:
+            header.modelType = BinaryEncoding::ModelType::Pomdp;
+            break;
+        default:
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                            "Models of type " << sparseModel->getType() << " can not be exported in binary format.");
+    }
+    header.valueType = BinaryEncoding::ValueType::Double;
+
+    storm::storage::SparseMatrix<ValueType> const& matrix = sparseModel->getTransitionMatrix();
+    header.numberOfStates = sparseModel->getNumberOfStates();
+    header.numberOfChoices = matrix.getRowCount();
+    header.numberOfEntries = matrix.getEntryCount();
+
+    // Collect the sections. Payloads that are not stored in the model in the right layout are kept in the buffers.
+    std::vector<BinaryEncodingSection> sections;
+    std::list<std::string> buffers;
+
+    buffers.emplace_back();
+    std::string& rowIndications = buffers.back();
+    rowIndications.reserve((header.numberOfChoices + 1) * sizeof(uint64_t));
+    appendRaw(rowIndications, static_cast<uint64_t>(0));
+    for (uint64_t row = 0; row < header.numberOfChoices; ++row) {
+        appendRaw(rowIndications, static_cast<uint64_t>(matrix.end(row) - matrix.begin()));
+    }
+    sections.push_back({BinaryEncoding::SectionType::RowIndications, "", rowIndications.data(), rowIndications.size()});
+    sections.push_back({BinaryEncoding::SectionType::Entries, "", header.numberOfEntries == 0 ? nullptr : reinterpret_cast<char const*>(&*matrix.begin()),
+                        header.numberOfEntries * sizeof(storm::storage::MatrixEntry<uint_fast64_t, ValueType>)});
+    if (sparseModel->isNondeterministicModel()) {
+        addVectorSection(sections, BinaryEncoding::SectionType::RowGroupIndices, "", matrix.getRowGroupIndices());
+    }
+
+    for (auto const& label : sparseModel->getStateLabeling().getLabels()) {
+        addBitVectorSection(sections, buffers, BinaryEncoding::SectionType::StateLabel, label, sparseModel->getStateLabeling().getStates(label));
+    }
+    if (sparseModel->hasChoiceLabeling()) {
+        for (auto const& label : sparseModel->getChoiceLabeling().getLabels()) {
+            addBitVectorSection(sections, buffers, BinaryEncoding::SectionType::ChoiceLabel, label, sparseModel->getChoiceLabeling().getChoices(label));
+        }
+    }
+
+    for (auto const& rewardModel : sparseModel->getRewardModels()) {
+        STORM_LOG_THROW(!rewardModel.second.hasTransitionRewards(), storm::exceptions::NotSupportedException,
+                        "Transition rewards of reward model '" << rewardModel.first << "' can not be exported in binary format.");
+        if (rewardModel.second.hasStateRewards()) {
+            addVectorSection(sections, BinaryEncoding::SectionType::StateRewards, rewardModel.first, rewardModel.second.getStateRewardVector());
+        }
+        if (rewardModel.second.hasStateActionRewards()) {
+            addVectorSection(sections, BinaryEncoding::SectionType::StateActionRewards, rewardModel.first, rewardModel.second.getStateActionRewardVector());
+        }
+    }
+
+    if (sparseModel->getType() == storm::models::ModelType::MarkovAutomaton) {
+        auto ma = sparseModel->template as<storm::models::sparse::MarkovAutomaton<ValueType>>();
+        addVectorSection(sections, BinaryEncoding::SectionType::ExitRates, "", ma->getExitRates());
+        addBitVectorSection(sections, buffers, BinaryEncoding::SectionType::MarkovianStates, "", ma->getMarkovianStates());
+    } else if (sparseModel->getType() == storm::models::ModelType::Pomdp) {
+        addVectorSection(sections, BinaryEncoding::SectionType::Observations, "",
+                         sparseModel->template as<storm::models::sparse::Pomdp<ValueType>>()->getObservations());
+    }
+
+    if (sparseModel->hasStateValuations()) {
+        buffers.push_back(encodeStateValuations(sparseModel->getStateValuations(), header.numberOfStates));
+        sections.push_back({BinaryEncoding::SectionType::StateValuations, "", buffers.back().data(), buffers.back().size()});
+    }
+
+    // Write the header and the sections.
+    header.numberOfSections = sections.size();
+    os.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    for (auto const& section : sections) {
+        BinaryEncoding::SectionHeader sectionHeader;
+        sectionHeader.type = section.type;
+        sectionHeader.nameLength = section.name.size();
+        sectionHeader.payloadSize = section.size;
+        os.write(reinterpret_cast<char const*>(&sectionHeader), sizeof(sectionHeader));
+        os.write(section.name.data(), section.name.size());
+        writePadding(os, section.name.size());
+        if (section.size > 0) {
+            os.write(section.data, section.size);
+        }
+        writePadding(os, section.size);
+    }
+    STORM_LOG_THROW(os, storm::exceptions::FileIoException, "Writing the binary encoding of the model failed.");
+}
+
+template void binaryExportSparseModel<double>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> const& sparseModel);
+
+}  // namespace exporter
+}  // namespace storm
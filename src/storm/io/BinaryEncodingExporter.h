@@ -0,0 +1,23 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+namespace exporter {
+
+/*!
+ * Exports a sparse model into the binary DRB format (see BinaryEncodingFormat.h). The transition matrix, the row
+ * grouping and all vectors are written in the in-memory layout of the respective data structures, such that the model
+ * can be loaded by mapping the file into memory and copying the arrays in bulk.
+ *
+ * @param os           Stream to export to. Should be opened in binary mode.
+ * @param sparseModel  Model to export
+ */
+template<typename ValueType>
+void binaryExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& sparseModel);
+
+}  // namespace exporter
+}  // namespace storm
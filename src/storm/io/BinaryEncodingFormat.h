@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+
+namespace storm {
+namespace exporter {
+
+/*
+ * The binary (drb) encoding of sparse models. All numbers are stored in the byte order of the exporting machine, which
+ * is recorded in the header. A file consists of a header followed by a sequence of sections. Every section starts with
+ * a section header, followed by the (padded) name of the section and the (padded) payload. Padding is applied such
+ * that every name and payload starts at an offset that is a multiple of eight. Hence, arrays within a memory-mapped
+ * file can be accessed in place.
+ *
+ * The sections are:
+ *   - RowIndications (uint64[numberOfChoices + 1]) and Entries ({uint64 column, double value}[numberOfEntries]) holding
+ *     the transition matrix in compressed sparse row format,
+ *   - RowGroupIndices (uint64[numberOfStates + 1]) for nondeterministic models,
+ *   - StateLabel and ChoiceLabel (named, uint64 buckets of a bitset over the states and choices, respectively),
+ *   - StateRewards (double[numberOfStates]) and StateActionRewards (double[numberOfChoices]) named by reward model,
+ *   - ExitRates (double[numberOfStates]) and MarkovianStates (bitset) for Markov automata,
+ *   - Observations (uint32[numberOfStates]) for POMDPs and
+ *   - StateValuations (see the exporter for the layout).
+ */
+struct BinaryEncoding {
+    static constexpr char magic[8] = {'S', 'T', 'O', 'R', 'M', 'D', 'R', 'B'};
+    static constexpr uint32_t version = 1;
+    static constexpr uint32_t byteOrderMark = 0x01020304;
+
+    enum class ModelType : uint32_t { Dtmc = 0, Ctmc = 1, Mdp = 2, MarkovAutomaton = 3, Pomdp = 4 };
+
+    enum class ValueType : uint32_t { Double = 0 };
+
+    enum class SectionType : uint32_t {
+        RowIndications = 0,
+        Entries = 1,
+        RowGroupIndices = 2,
+        StateLabel = 3,
+        ChoiceLabel = 4,
+        StateRewards = 5,
+        StateActionRewards = 6,
+        ExitRates = 7,
+        MarkovianStates = 8,
+        Observations = 9,
+        StateValuations = 10
+    };
+
+    enum class ValuationType : uint32_t { Boolean = 0, Integer = 1, Rational = 2, ObservationLabel = 3 };
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t byteOrderMark;
+        ModelType modelType;
+        ValueType valueType;
+        uint64_t numberOfStates;
+        uint64_t numberOfChoices;
+        uint64_t numberOfEntries;
+        uint64_t numberOfSections;
+    };
+
+    struct SectionHeader {
+        SectionType type;
+        uint32_t nameLength;
+        uint64_t payloadSize;
+    };
+
+    /*!
+     * Retrieves the number of bytes that are needed to pad the given size to a multiple of eight.
+     */
+    static uint64_t getPadding(uint64_t size) {
+        return (8 - size % 8) % 8;
+    }
+};
+
+static_assert(sizeof(BinaryEncoding::Header) == 56, "Unexpected layout of the binary encoding header.");
+static_assert(sizeof(BinaryEncoding::SectionHeader) == 16, "Unexpected layout of the binary encoding section header.");
+
+}  // namespace exporter
+}  // namespace storm
@@ -0,0 +1,73 @@
+#include "storm/io/BufferedWriter.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace utility {
+
+// The maximal number of characters of a formatted integer or double.
+static const uint64_t maxNumberLength = 32;
+
+BufferedWriter::BufferedWriter(std::ostream& os, uint64_t bufferSize) : os(os), buffer(std::max(bufferSize, maxNumberLength)) {
+    position = buffer.data();
+    bufferEnd = buffer.data() + buffer.size();
+    formatStream.precision(os.precision());
+    formatStream.flags(os.flags());
+}
+
+BufferedWriter::~BufferedWriter() {
+    // Do not throw from the destructor, the state of the stream can be checked by the caller.
+    os.write(buffer.data(), position - buffer.data());
+}
+
+void BufferedWriter::write(std::string_view characters) {
+    if (characters.size() > static_cast<uint64_t>(bufferEnd - position)) {
+        flushBuffer();
+        if (characters.size() > buffer.size()) {
+            os.write(characters.data(), characters.size());
+            return;
+        }
+    }
+    std::memcpy(position, characters.data(), characters.size());
+    position += characters.size();
+}
+
+void BufferedWriter::writeUnsigned(uint64_t value) {
+    reserve(maxNumberLength);
+    position = std::to_chars(position, bufferEnd, value).ptr;
+}
+
+void BufferedWriter::writeSigned(int64_t value) {
+    reserve(maxNumberLength);
+    position = std::to_chars(position, bufferEnd, value).ptr;
+}
+
+void BufferedWriter::writeDouble(double value) {
+    reserve(maxNumberLength);
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    position = std::to_chars(position, bufferEnd, value).ptr;
+#else
+    // Without floating point support for to_chars, 17 significant digits are sufficient to parse back the same value.
+    position += std::snprintf(position, bufferEnd - position, "%.17g", value);
+#endif
+}
+
+void BufferedWriter::flush() {
+    flushBuffer();
+    os.flush();
+}
+
+void BufferedWriter::flushBuffer() {
+    os.write(buffer.data(), position - buffer.data());
+    position = buffer.data();
+    STORM_LOG_THROW(os, storm::exceptions::FileIoException, "Writing to the output stream failed.");
+}
+
+}  // namespace utility
+}  // namespace storm
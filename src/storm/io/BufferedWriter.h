@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace storm {
+namespace utility {
+
+/*!
+ * Writes to an output stream through a (large) buffer. Integers and doubles are formatted directly into the buffer,
+ * where doubles are written in the shortest form that parses back to the same value. Values of all other types are
+ * formatted with the operator<< of the stream.
+ *
+ * The buffer is written to the stream when it is full, when flush() is called and upon destruction.
+ */
+class BufferedWriter {
+   public:
+    static const uint64_t defaultBufferSize = 1ull << 20;
+
+    /*!
+     * Creates a writer for the given stream.
+     *
+     * @param os The stream to write to.
+     * @param bufferSize The size of the buffer (in bytes).
+     */
+    explicit BufferedWriter(std::ostream& os, uint64_t bufferSize = defaultBufferSize);
+
+    /*!
+     * Writes the remaining content of the buffer to the stream.
+     */
+    ~BufferedWriter();
+
+    BufferedWriter(BufferedWriter const&) = delete;
+    BufferedWriter& operator=(BufferedWriter const&) = delete;
+
+    /*!
+     * Writes the given character.
+     */
+    void write(char character) {
+        if (position == bufferEnd) {
+            flushBuffer();
+        }
+        *position++ = character;
+    }
+
+    /*!
+     * Writes the given characters.
+     */
+    void write(std::string_view characters);
+
+    /*!
+     * Writes the given integer in decimal notation.
+     */
+    void writeUnsigned(uint64_t value);
+    void writeSigned(int64_t value);
+
+    /*!
+     * Writes the shortest decimal representation of the given double that parses back to the same value.
+     */
+    void writeDouble(double value);
+
+    /*!
+     * Writes the given value using the operator<< of the underlying stream (with its precision and flags).
+     */
+    template<typename T>
+    void writeFormatted(T const& value) {
+        formatStream.str(std::string());
+        formatStream << value;
+        write(std::string_view(formatStream.str()));
+    }
+
+    template<typename T>
+    BufferedWriter& operator<<(T const& value) {
+        if constexpr (std::is_same<T, char>::value) {
+            write(value);
+        } else if constexpr (std::is_same<T, bool>::value) {
+            write(value ? '1' : '0');
+        } else if constexpr (std::is_integral<T>::value && std::is_signed<T>::value) {
+            writeSigned(value);
+        } else if constexpr (std::is_integral<T>::value) {
+            writeUnsigned(value);
+        } else if constexpr (std::is_same<T, double>::value) {
+            writeDouble(value);
+        } else if constexpr (std::is_convertible<T const&, std::string_view>::value) {
+            write(std::string_view(value));
+        } else {
+            writeFormatted(value);
+        }
+        return *this;
+    }
+
+    /*!
+     * Writes the content of the buffer to the stream and flushes the stream.
+     */
+    void flush();
+
+   private:
+    /*!
+     * Writes the content of the buffer to the stream.
+     */
+    void flushBuffer();
+
+    /*!
+     * Ensures that at least the given number of characters fit into the buffer.
+     */
+    void reserve(uint64_t size) {
+        if (static_cast<uint64_t>(bufferEnd - position) < size) {
+            flushBuffer();
+        }
+    }
+
+    // The stream to write to.
+    std::ostream& os;
+    // The buffer together with the current and the last position.
+    std::vector<char> buffer;
+    char* position;
+    char* bufferEnd;
+    // A stream (with the precision and flags of the underlying stream) that is used for values without a dedicated format.
+    std::ostringstream formatStream;
+};
+
+}  // namespace utility
+}  // namespace storm
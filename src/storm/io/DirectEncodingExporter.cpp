@@ -16,110 +16,143 @@
 namespace storm {
 namespace exporter {
 
+/*!
+ * A label together with the items (states or choices) that carry it.
+ */
+struct ExportedLabel {
+    ExportedLabel(std::string const& name, storm::storage::BitVector const& items)
+        : name(name), items(items), hasQuotationMark(name.find('\"') != std::string::npos) {
+        // Only labels with a whitespace are put in (double) quotation marks.
+        if (std::any_of(name.begin(), name.end(), isspace)) {
+            output = " \"" + name + "\"";
+        } else {
+            output = " " + name;
+        }
+    }
+
+    std::string name;
+    storm::storage::BitVector const& items;
+    bool hasQuotationMark;
+    // The label as it is written after a state.
+    std::string output;
+};
+
 template<typename ValueType>
 void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel,
                                std::vector<std::string> const& parameters, DirectEncodingOptions const& options) {
     // Notice that for CTMCs we write the rate matrix instead of probabilities
 
     // Initialize
-    std::vector<ValueType> exitRates;  // Only for CTMCs and MAs.
+    // All output goes through a buffer that formats numbers directly instead of using the (slow) operator<< of the stream.
+    storm::utility::BufferedWriter writer(os);
+    std::vector<ValueType> const noExitRates;
+    std::vector<ValueType> const* exitRates = &noExitRates;  // Only for CTMCs and MAs.
     if (sparseModel->getType() == storm::models::ModelType::Ctmc) {
-        exitRates = sparseModel->template as<storm::models::sparse::Ctmc<ValueType>>()->getExitRateVector();
+        exitRates = &sparseModel->template as<storm::models::sparse::Ctmc<ValueType>>()->getExitRateVector();
     } else if (sparseModel->getType() == storm::models::ModelType::MarkovAutomaton) {
-        exitRates = sparseModel->template as<storm::models::sparse::MarkovAutomaton<ValueType>>()->getExitRates();
+        exitRates = &sparseModel->template as<storm::models::sparse::MarkovAutomaton<ValueType>>()->getExitRates();
     }
 
     // Write header
-    os << "// Exported by storm\n";
-    os << "// Original model type: " << sparseModel->getType() << '\n';
-    os << "@type: " << sparseModel->getType() << '\n';
-    os << "@parameters\n";
+    writer << "// Exported by storm\n";
+    writer << "// Original model type: " << sparseModel->getType() << '\n';
+    writer << "@type: " << sparseModel->getType() << '\n';
+    writer << "@parameters\n";
     if (parameters.empty()) {
         for (std::string const& parameter : getParameters(sparseModel)) {
-            os << parameter << " ";
+            writer << parameter << " ";
         }
     } else {
         for (std::string const& parameter : parameters) {
-            os << parameter << " ";
+            writer << parameter << " ";
         }
     }
-    os << '\n';
+    writer << '\n';
 
     // Optionally write placeholders which only need to be parsed once
     // This is used to reduce the parsing effort for rational functions
     // Placeholders begin with the dollar symbol $
     std::unordered_map<ValueType, std::string> placeholders;
     if (options.allowPlaceholders) {
-        placeholders = generatePlaceholders(sparseModel, exitRates);
+        placeholders = generatePlaceholders(sparseModel, *exitRates);
     }
     if (!placeholders.empty()) {
-        os << "@placeholders\n";
+        writer << "@placeholders\n";
         for (auto const& entry : placeholders) {
-            os << "$" << entry.second << " : " << entry.first << '\n';
+            writer << "$" << entry.second << " : " << entry.first << '\n';
         }
     }
 
-    os << "@reward_models\n";
+    writer << "@reward_models\n";
     for (auto const& rewardModel : sparseModel->getRewardModels()) {
-        os << rewardModel.first << " ";
+        writer << rewardModel.first << " ";
     }
-    os << '\n';
-    os << "@nr_states\n" << sparseModel->getNumberOfStates() << '\n';
-    os << "@nr_choices\n" << sparseModel->getNumberOfChoices() << '\n';
-    os << "@model\n";
+    writer << '\n';
+    writer << "@nr_states\n" << sparseModel->getNumberOfStates() << '\n';
+    writer << "@nr_choices\n" << sparseModel->getNumberOfChoices() << '\n';
+    writer << "@model\n";
 
     storm::storage::SparseMatrix<ValueType> const& matrix = sparseModel->getTransitionMatrix();
 
+    // Collect the labels once instead of looking up the labels of each state and choice by name.
+    std::vector<ExportedLabel> stateLabels, choiceLabels;
+    for (auto const& label : sparseModel->getStateLabeling().getLabels()) {
+        stateLabels.emplace_back(label, sparseModel->getStateLabeling().getStates(label));
+    }
+    if (sparseModel->hasChoiceLabeling()) {
+        for (auto const& label : sparseModel->getChoiceLabeling().getLabels()) {
+            choiceLabels.emplace_back(label, sparseModel->getChoiceLabeling().getChoices(label));
+        }
+    }
+
     // Iterate over states and export state information and outgoing transitions
     for (typename storm::storage::SparseMatrix<ValueType>::index_type group = 0; group < matrix.getRowGroupCount(); ++group) {
-        os << "state " << group;
+        writer << "state " << group;
 
         // Write exit rates for CTMCs and MAs
-        if (!exitRates.empty()) {
-            os << " !";
-            writeValue(os, exitRates.at(group), placeholders);
+        if (!exitRates->empty()) {
+            writer << " !";
+            writeValue(writer, exitRates->at(group), placeholders);
         }
 
         if (sparseModel->getType() == storm::models::ModelType::Pomdp) {
-            os << " {" << sparseModel->template as<storm::models::sparse::Pomdp<ValueType>>()->getObservation(group) << "}";
+            writer << " {" << sparseModel->template as<storm::models::sparse::Pomdp<ValueType>>()->getObservation(group) << "}";
         }
 
         // Write state rewards
         bool first = true;
         for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
             if (first) {
-                os << " [";
+                writer << " [";
                 first = false;
             } else {
-                os << ", ";
+                writer << ", ";
             }
 
             if (rewardModelEntry.second.hasStateRewards()) {
-                writeValue(os, rewardModelEntry.second.getStateRewardVector().at(group), placeholders);
+                writeValue(writer, rewardModelEntry.second.getStateRewardVector().at(group), placeholders);
             } else {
-                os << "0";
+                writer << "0";
             }
         }
 
         if (!first) {
-            os << "]";
+            writer << "]";
         }
 
-        // Write labels. Only labels with a whitespace are put in (double) quotation marks.
-        for (auto const& label : sparseModel->getStateLabeling().getLabelsOfState(group)) {
-            STORM_LOG_THROW(std::count(label.begin(), label.end(), '\"') == 0, storm::exceptions::NotSupportedException,
-                            "Labels with quotation marks are not supported in the DRN format and therefore may not be exported.");
-            // TODO consider escaping the quotation marks. Not sure whether that is a good idea.
-            if (std::count_if(label.begin(), label.end(), isspace) > 0) {
-                os << " \"" << label << "\"";
-            } else {
-                os << " " << label;
+        // Write labels
+        for (auto const& label : stateLabels) {
+            if (label.items.get(group)) {
+                STORM_LOG_THROW(!label.hasQuotationMark, storm::exceptions::NotSupportedException,
+                                "Labels with quotation marks are not supported in the DRN format and therefore may not be exported.");
+                // TODO consider escaping the quotation marks. Not sure whether that is a good idea.
+                writer << label.output;
             }
         }
-        os << '\n';
+        writer << '\n';
         // Write state valuations as comments
         if (sparseModel->hasStateValuations()) {
-            os << "//" << sparseModel->getStateValuations().getStateInfo(group) << '\n';
+            writer << "//" << sparseModel->getStateValuations().getStateInfo(group) << '\n';
         }
 
         // Write probabilities
@@ -130,52 +163,55 @@ void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::
         for (typename storm::storage::SparseMatrix<ValueType>::index_type row = start; row < end; ++row) {
             // Write choice
             if (sparseModel->hasChoiceLabeling()) {
-                os << "\taction ";
+                writer << "\taction ";
                 bool lfirst = true;
-                if (sparseModel->getChoiceLabeling().getLabelsOfChoice(row).empty()) {
-                    os << "__NOLABEL__";
-                }
-                for (auto const& label : sparseModel->getChoiceLabeling().getLabelsOfChoice(row)) {
-                    if (!lfirst) {
-                        os << "_";
+                for (auto const& label : choiceLabels) {
+                    if (label.items.get(row)) {
+                        if (!lfirst) {
+                            writer << "_";
+                        }
                         lfirst = false;
+                        writer << label.name;
                     }
-                    os << label;
+                }
+                if (lfirst) {
+                    writer << "__NOLABEL__";
                 }
             } else {
-                os << "\taction " << row - start;
+                writer << "\taction " << row - start;
             }
 
             // Write action rewards
             bool first = true;
             for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
                 if (first) {
-                    os << " [";
+                    writer << " [";
                     first = false;
                 } else {
-                    os << ", ";
+                    writer << ", ";
                 }
 
                 if (rewardModelEntry.second.hasStateActionRewards()) {
-                    writeValue(os, rewardModelEntry.second.getStateActionRewardVector().at(row), placeholders);
+                    writeValue(writer, rewardModelEntry.second.getStateActionRewardVector().at(row), placeholders);
                 } else {
-                    os << "0";
+                    writer << "0";
                 }
             }
             if (!first) {
-                os << "]";
+                writer << "]";
             }
-            os << '\n';
+            writer << '\n';
 
             // Write transitions
             for (auto it = matrix.begin(row); it != matrix.end(row); ++it) {
                 ValueType prob = it->getValue();
-                os << "\t\t" << it->getColumn() << " : ";
-                writeValue(os, prob, placeholders);
-                os << '\n';
+                writer << "\t\t" << it->getColumn() << " : ";
+                writeValue(writer, prob, placeholders);
+                writer << '\n';
             }
         }
     }  // end state iteration
+    writer.flush();
 }
 
 template<typename ValueType>
@@ -198,7 +234,7 @@ std::vector<std::string> getParameters(std::shared_ptr<storm::models::sparse::Mo
 }
 
 template<typename ValueType>
-std::unordered_map<ValueType, std::string> generatePlaceholders(std::shared_ptr<storm::models::sparse::Model<ValueType>>, std::vector<ValueType>) {
+std::unordered_map<ValueType, std::string> generatePlaceholders(std::shared_ptr<storm::models::sparse::Model<ValueType>>, std::vector<ValueType> const&) {
     return {};
 }
 
@@ -222,7 +258,7 @@ void createPlaceholder(std::unordered_map<storm::RationalFunction, std::string>&
 
 template<>
 std::unordered_map<storm::RationalFunction, std::string> generatePlaceholders(
-    std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> sparseModel, std::vector<storm::RationalFunction> exitRates) {
+    std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> sparseModel, std::vector<storm::RationalFunction> const& exitRates) {
     std::unordered_map<storm::RationalFunction, std::string> placeholders;
     size_t i = 0;
 
@@ -254,9 +290,9 @@ std::unordered_map<storm::RationalFunction, std::string> generatePlaceholders(
 }
 
 template<typename ValueType>
-void writeValue(std::ostream& os, ValueType value, std::unordered_map<ValueType, std::string> const& placeholders) {
+void writeValue(storm::utility::BufferedWriter& writer, ValueType const& value, std::unordered_map<ValueType, std::string> const& placeholders) {
     if (storm::utility::isConstant(value)) {
-        os << value;
+        writer << value;
         return;
     }
 
@@ -264,9 +300,9 @@ void writeValue(std::ostream& os, ValueType value, std::unordered_map<ValueType,
     auto it = placeholders.find(value);
     if (it != placeholders.end()) {
         // Use placeholder
-        os << "$" << it->second;
+        writer << "$" << it->second;
     } else {
-        os << value;
+        writer << value;
     }
 }
 
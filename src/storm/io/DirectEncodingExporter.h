@@ -3,6 +3,7 @@
 #include <iostream>
 #include <memory>
 
+#include "storm/io/BufferedWriter.h"
 #include "storm/models/sparse/Model.h"
 
 namespace storm {
@@ -40,15 +41,15 @@ std::vector<std::string> getParameters(std::shared_ptr<storm::models::sparse::Mo
  */
 template<typename ValueType>
 std::unordered_map<ValueType, std::string> generatePlaceholders(std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel,
-                                                                std::vector<ValueType> exitRates);
+                                                                std::vector<ValueType> const& exitRates);
 
 /*!
- * Write value to stream while using the placeholders.
- * @param os Output stream.
+ * Write value to the writer while using the placeholders.
+ * @param writer Buffered writer.
  * @param value Value.
  * @param placeholders Placeholders.
  */
 template<typename ValueType>
-void writeValue(std::ostream& os, ValueType value, std::unordered_map<ValueType, std::string> const& placeholders);
+void writeValue(storm::utility::BufferedWriter& writer, ValueType const& value, std::unordered_map<ValueType, std::string> const& placeholders);
 }  // namespace exporter
 }  // namespace storm
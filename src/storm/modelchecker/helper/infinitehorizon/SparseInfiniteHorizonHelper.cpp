@@ -1,5 +1,11 @@
 #include "SparseInfiniteHorizonHelper.h"
 
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+
 #include "storm/modelchecker/helper/infinitehorizon/internal/ComponentUtility.h"
 #include "storm/modelchecker/helper/infinitehorizon/internal/LraViHelper.h"
 
@@ -15,11 +21,13 @@
 #include "storm/solver/multiplier/Multiplier.h"
 
 #include "storm/utility/ProgressMeasurement.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/solver.h"
 #include "storm/utility/vector.h"
 
+#include "storm/environment/ParallelEnvironment.h"
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
@@ -168,11 +176,48 @@ std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>:
     progress.setMaxCount(_longRunComponentDecomposition->size());
     progress.startNewMeasurement(0);
     STORM_LOG_INFO("Computing long run average values for " << _longRunComponentDecomposition->size() << " " << componentString << " individually...");
+    uint64_t const numberOfComponents = _longRunComponentDecomposition->size();
+    uint64_t const numberOfThreads = std::min<uint64_t>(env.parallel().getNumberOfThreads(), numberOfComponents);
     std::vector<ValueType> componentLraValues;
-    componentLraValues.reserve(_longRunComponentDecomposition->size());
-    for (auto const& c : *_longRunComponentDecomposition) {
-        componentLraValues.push_back(computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c));
-        progress.updateProgress(componentLraValues.size());
+    if (env.parallel().isParallel() && numberOfThreads > 1 && isParallelComponentComputationSupported(underlyingSolverEnvironment)) {
+        STORM_LOG_INFO("Using " << numberOfThreads << " threads for the " << componentString << ".");
+        componentLraValues.resize(numberOfComponents, storm::utility::zero<ValueType>());
+        // Handle large components first to balance the load among the threads.
+        std::vector<uint64_t> componentOrder(numberOfComponents);
+        std::iota(componentOrder.begin(), componentOrder.end(), 0);
+        std::stable_sort(componentOrder.begin(), componentOrder.end(), [this](uint64_t lhs, uint64_t rhs) {
+            return (*_longRunComponentDecomposition)[lhs].size() > (*_longRunComponentDecomposition)[rhs].size();
+        });
+        std::atomic<uint64_t> nextTask(0);
+        auto runWorker = [&]() {
+            // Each worker has its own environment (and thus its own solvers). The solvers for a single component run sequentially.
+            Environment workerEnvironment = underlyingSolverEnvironment;
+            workerEnvironment.parallel().setNumberOfThreads(1);
+            for (uint64_t task = nextTask++; task < numberOfComponents; task = nextTask++) {
+                uint64_t const componentIndex = componentOrder[task];
+                // The components are disjoint, so the workers write the produced choices for different states.
+                componentLraValues[componentIndex] =
+                    computeLraForComponent(workerEnvironment, stateRewardsGetter, actionRewardsGetter, (*_longRunComponentDecomposition)[componentIndex]);
+            }
+        };
+#ifdef STORM_HAVE_INTELTBB
+        storm::utility::parallel::executeWithThreadLimit(numberOfThreads, [&]() {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfThreads, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t worker = range.begin(); worker < range.end(); ++worker) {
+                    runWorker();
+                }
+            });
+        });
+#else
+        runWorker();
+#endif
+        progress.updateProgress(numberOfComponents);
+    } else {
+        componentLraValues.reserve(numberOfComponents);
+        for (auto const& c : *_longRunComponentDecomposition) {
+            componentLraValues.push_back(computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c));
+            progress.updateProgress(componentLraValues.size());
+        }
     }
 
     // Solve the resulting SSP where end components are collapsed into single auxiliary states
@@ -180,6 +225,11 @@ std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>:
     return buildAndSolveSsp(underlyingSolverEnvironment, componentLraValues);
 }
 
+template<typename ValueType, bool Nondeterministic>
+bool SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::isParallelComponentComputationSupported(Environment const&) const {
+    return false;
+}
+
 template<typename ValueType, bool Nondeterministic>
 bool SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::isContinuousTime() const {
     STORM_LOG_ASSERT((_markovianStates == nullptr) || (_exitRates != nullptr), "Inconsistent information given: Have Markovian states but no exit rates.");
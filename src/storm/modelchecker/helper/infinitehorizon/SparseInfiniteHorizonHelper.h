@@ -123,6 +123,12 @@ class SparseInfiniteHorizonHelper : public SingleValueModelCheckerHelper<ValueTy
      */
     virtual void createDecomposition() = 0;
 
+    /*!
+     * @return true iff computeLraForComponent may be invoked concurrently for different components under the given environment.
+     * In this case, the components are solved in parallel if the environment allows for more than one thread.
+     */
+    virtual bool isParallelComponentComputationSupported(Environment const& env) const;
+
     /*!
      * @pre if scheduler production is enabled and Nondeterministic is true, a choice for each state within a component must be set such that the choices yield
      * optimal values w.r.t. the individual components.
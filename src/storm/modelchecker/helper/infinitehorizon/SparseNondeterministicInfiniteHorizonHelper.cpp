@@ -11,6 +11,9 @@
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
 #include "storm/utility/solver.h"
 #include "storm/utility/vector.h"
 
@@ -63,6 +66,16 @@ storm::storage::Scheduler<ValueType> SparseNondeterministicInfiniteHorizonHelper
     return scheduler;
 }
 
+template<typename ValueType>
+void SparseNondeterministicInfiniteHorizonHelper<ValueType>::initializeProducedOptimalChoices() {
+    if (this->isProduceSchedulerSet()) {
+        if (!this->_producedOptimalChoices.is_initialized()) {
+            this->_producedOptimalChoices.emplace();
+        }
+        this->_producedOptimalChoices->resize(this->_transitionMatrix.getRowGroupCount());
+    }
+}
+
 template<typename ValueType>
 void SparseNondeterministicInfiniteHorizonHelper<ValueType>::createDecomposition() {
     if (this->_longRunComponentDecomposition == nullptr) {
@@ -79,14 +92,10 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForC
                                                                                          ValueGetter const& actionRewardsGetter,
                                                                                          storm::storage::MaximalEndComponent const& component) {
     // For models with potential nondeterminisim, we compute the LRA for a maximal end component (MEC)
-
-    // Allocate memory for the nondeterministic choices.
-    if (this->isProduceSchedulerSet()) {
-        if (!this->_producedOptimalChoices.is_initialized()) {
-            this->_producedOptimalChoices.emplace();
-        }
-        this->_producedOptimalChoices->resize(this->_transitionMatrix.getRowGroupCount());
-    }
+    // The choices are allocated upfront, as components may be solved concurrently.
+    STORM_LOG_ASSERT(!this->isProduceSchedulerSet() || (this->_producedOptimalChoices.is_initialized() &&
+                                                        this->_producedOptimalChoices->size() == this->_transitionMatrix.getRowGroupCount()),
+                     "The produced optimal choices have not been allocated.");
 
     auto trivialResult = this->computeLraForTrivialMec(env, stateRewardsGetter, actionRewardsGetter, component);
     if (trivialResult.first) {
@@ -94,19 +103,7 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForC
     }
 
     // Solve nontrivial MEC with the method specified in the settings
-    storm::solver::LraMethod method = env.solver().lra().getNondetLraMethod();
-    if ((storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) && env.solver().lra().isNondetLraMethodSetFromDefault() &&
-        method != storm::solver::LraMethod::LinearProgramming) {
-        STORM_LOG_INFO(
-            "Selecting 'LP' as the solution technique for long-run properties to guarantee exact results. If you want to override this, please explicitly "
-            "specify a different LRA method.");
-        method = storm::solver::LraMethod::LinearProgramming;
-    } else if (env.solver().isForceSoundness() && env.solver().lra().isNondetLraMethodSetFromDefault() && method != storm::solver::LraMethod::ValueIteration) {
-        STORM_LOG_INFO(
-            "Selecting 'VI' as the solution technique for long-run properties to guarantee sound results. If you want to override this, please explicitly "
-            "specify a different LRA method.");
-        method = storm::solver::LraMethod::ValueIteration;
-    }
+    storm::solver::LraMethod method = getMethodForNontrivialMecs(env, true);
     STORM_LOG_ERROR_COND(!this->isProduceSchedulerSet() || method == storm::solver::LraMethod::ValueIteration,
                          "Scheduler generation not supported for the chosen LRA method. Try value-iteration.");
     if (method == storm::solver::LraMethod::LinearProgramming) {
@@ -118,6 +115,34 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForC
     }
 }
 
+template<typename ValueType>
+bool SparseNondeterministicInfiniteHorizonHelper<ValueType>::isParallelComponentComputationSupported(Environment const& env) const {
+    if (getMethodForNontrivialMecs(env, false) == storm::solver::LraMethod::LinearProgramming &&
+        storm::settings::getModule<storm::settings::modules::CoreSettings>().getLpSolver() == storm::solver::LpSolverType::Glpk) {
+        STORM_LOG_INFO("Solving the maximal end components sequentially as the LP solver glpk does not support multiple threads.");
+        return false;
+    }
+    return true;
+}
+
+template<typename ValueType>
+storm::solver::LraMethod SparseNondeterministicInfiniteHorizonHelper<ValueType>::getMethodForNontrivialMecs(Environment const& env, bool log) const {
+    storm::solver::LraMethod method = env.solver().lra().getNondetLraMethod();
+    if ((storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) && env.solver().lra().isNondetLraMethodSetFromDefault() &&
+        method != storm::solver::LraMethod::LinearProgramming) {
+        STORM_LOG_INFO_COND(!log,
+                            "Selecting 'LP' as the solution technique for long-run properties to guarantee exact results. If you want to override this, "
+                            "please explicitly specify a different LRA method.");
+        method = storm::solver::LraMethod::LinearProgramming;
+    } else if (env.solver().isForceSoundness() && env.solver().lra().isNondetLraMethodSetFromDefault() && method != storm::solver::LraMethod::ValueIteration) {
+        STORM_LOG_INFO_COND(!log,
+                            "Selecting 'VI' as the solution technique for long-run properties to guarantee sound results. If you want to override this, "
+                            "please explicitly specify a different LRA method.");
+        method = storm::solver::LraMethod::ValueIteration;
+    }
+    return method;
+}
+
 template<typename ValueType>
 std::pair<bool, ValueType> SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForTrivialMec(
     Environment const& env, ValueGetter const& stateRewardsGetter, ValueGetter const& actionRewardsGetter,
@@ -1,5 +1,6 @@
 #pragma once
 #include "storm/modelchecker/helper/infinitehorizon/SparseInfiniteHorizonHelper.h"
+#include "storm/solver/SolverSelectionOptions.h"
 
 namespace storm {
 
@@ -53,6 +54,13 @@ class SparseNondeterministicInfiniteHorizonHelper : public SparseInfiniteHorizon
     storm::storage::Scheduler<ValueType> extractScheduler() const;
 
     /*!
+     * If scheduler production is enabled, allocates the produced optimal choices for all states of the model.
+     * The computation of the long run average values does this itself. It only needs to be called before computeLraForComponent is called directly.
+     */
+    void initializeProducedOptimalChoices();
+
+    /*!
+     * @pre if scheduler production is enabled, the produced optimal choices have been allocated (e.g. by initializeProducedOptimalChoices()).
      * @param stateValuesGetter a function returning a value for a given state index
      * @param actionValuesGetter a function returning a value for a given (global) choice index
      * @return the (unique) optimal LRA value for the given component.
@@ -65,6 +73,16 @@ class SparseNondeterministicInfiniteHorizonHelper : public SparseInfiniteHorizon
    protected:
     virtual void createDecomposition() override;
 
+    /*!
+     * MECs can be solved concurrently unless they are solved with glpk, which is not thread-safe.
+     */
+    virtual bool isParallelComponentComputationSupported(Environment const& env) const override;
+
+    /*!
+     * @return the method that is used to solve nontrivial MECs under the given environment.
+     */
+    storm::solver::LraMethod getMethodForNontrivialMecs(Environment const& env, bool log) const;
+
     std::pair<bool, ValueType> computeLraForTrivialMec(Environment const& env, ValueGetter const& stateValuesGetter, ValueGetter const& actionValuesGetter,
                                                        storm::storage::MaximalEndComponent const& mec);
 
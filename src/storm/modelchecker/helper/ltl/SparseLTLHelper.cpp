@@ -65,7 +65,8 @@ std::map<std::string, storm::storage::BitVector> SparseLTLHelper<ValueType, Nond
 }
 
 template<typename ValueType, bool Nondeterministic>
-storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeAcceptingECs(automata::AcceptanceCondition const& acceptance,
+storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeAcceptingECs(Environment const& env,
+                                                                                            automata::AcceptanceCondition const& acceptance,
                                                                                             storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                             storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                             typename transformer::DAProduct<productModelType>::ptr product) {
@@ -117,7 +118,7 @@ storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeA
         }
 
         // Compute MECs in the allowed fragment
-        storm::storage::MaximalEndComponentDecomposition<ValueType> mecs(transitionMatrix, backwardTransitions, allowed);
+        storm::storage::MaximalEndComponentDecomposition<ValueType> mecs(env, transitionMatrix, backwardTransitions, &allowed);
         allMECs += mecs.size();
         for (const auto& mec : mecs) {
             bool accepting = true;
@@ -238,7 +239,7 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
     storm::storage::BitVector acceptingStates;
     if (Nondeterministic) {
         STORM_LOG_INFO("Computing MECs and checking for acceptance...");
-        acceptingStates = computeAcceptingECs(*product->getAcceptance(), product->getProductModel().getTransitionMatrix(),
+        acceptingStates = computeAcceptingECs(env, *product->getAcceptance(), product->getProductModel().getTransitionMatrix(),
                                               product->getProductModel().getBackwardTransitions(), product);
 
     } else {
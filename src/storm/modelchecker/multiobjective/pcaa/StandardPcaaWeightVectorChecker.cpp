@@ -4,6 +4,8 @@
 #include <set>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/multiobjective/preprocessing/SparseMultiObjectiveRewardAnalysis.h"
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
@@ -15,6 +17,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/helper/BatchValueIterationHelper.h"
 #include "storm/transformer/GoalStateMerger.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
@@ -355,6 +358,7 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::infiniteHorizonWeightedPh
     helper.provideLongRunComponentDecomposition(lraMecDecomposition->mecs);
     helper.setOptimizationDirection(storm::solver::OptimizationDirection::Maximize);
     helper.setProduceScheduler(true);
+    helper.initializeProducedOptimalChoices();
     for (uint64_t mecIndex = 0; mecIndex < lraMecDecomposition->mecs.size(); ++mecIndex) {
         auto const& mec = lraMecDecomposition->mecs[mecIndex];
         auto actionValueGetter = [&weightedActionRewardVector](uint64_t const& a) { return weightedActionRewardVector[a]; };
@@ -489,6 +493,12 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhase(
         std::vector<ValueType> weightedSumOfUncheckedObjectives = weightedResult;
         ValueType sumOfWeightsOfUncheckedObjectives = storm::utility::vector::sum_if(weightVector, objectivesWithNoUpperTimeBound);
 
+        // If the equation systems would be solved by value iteration anyway, we solve those of all total reward objectives together.
+        bool const batchTotalRewardObjectives =
+            (objectivesWithNoUpperTimeBound & ~lraObjectives).getNumberOfSetBits() > 1 &&
+            storm::solver::helper::BatchValueIterationHelper<ValueType>::isCompatibleWithLinearEquationSolver(env);
+        std::vector<uint64_t> batchedObjectives;
+
         for (uint_fast64_t const& objIndex : storm::utility::vector::getSortedIndices(weightVector)) {
             auto const& obj = this->objectives[objIndex];
             if (objectivesWithNoUpperTimeBound.get(objIndex)) {
@@ -506,13 +516,6 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhase(
                     }
                     objectiveResults[objIndex] = infiniteHorizonHelper.computeLongRunAverageValues(env, stateValueGetter, actionValueGetter);
                 } else {  // i.e. a total reward objective
-                    storm::utility::vector::selectVectorValues(deterministicStateRewards, this->optimalChoices, transitionMatrix.getRowGroupIndices(),
-                                                               actionRewards[objIndex]);
-                    storm::storage::BitVector statesWithRewards = ~storm::utility::vector::filterZero(deterministicStateRewards);
-                    // As maybestates we pick the states from which a state with reward is reachable
-                    storm::storage::BitVector maybeStates = storm::utility::graph::performProbGreater0(
-                        deterministicBackwardTransitions, storm::storage::BitVector(deterministicMatrix.getRowCount(), true), statesWithRewards);
-
                     // Compute the estimate for this objective
                     if (!storm::utility::isZero(weightVector[objIndex])) {
                         objectiveResults[objIndex] = weightedSumOfUncheckedObjectives;
@@ -526,6 +529,20 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhase(
                     // Make sure that the objectiveResult is initialized correctly
                     objectiveResults[objIndex].resize(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
 
+                    if (batchTotalRewardObjectives) {
+                        // The objective is solved below, together with the other total reward objectives.
+                        // Until then, it stays an unchecked objective for the estimates of the remaining objectives.
+                        batchedObjectives.push_back(objIndex);
+                        continue;
+                    }
+
+                    storm::utility::vector::selectVectorValues(deterministicStateRewards, this->optimalChoices, transitionMatrix.getRowGroupIndices(),
+                                                               actionRewards[objIndex]);
+                    storm::storage::BitVector statesWithRewards = ~storm::utility::vector::filterZero(deterministicStateRewards);
+                    // As maybestates we pick the states from which a state with reward is reachable
+                    storm::storage::BitVector maybeStates = storm::utility::graph::performProbGreater0(
+                        deterministicBackwardTransitions, storm::storage::BitVector(deterministicMatrix.getRowCount(), true), statesWithRewards);
+
                     if (!maybeStates.empty()) {
                         bool needEquationSystem =
                             linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
@@ -571,6 +588,57 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhase(
                 objectiveResults[objIndex] = std::vector<ValueType>(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
             }
         }
+
+        if (!batchedObjectives.empty()) {
+            unboundedIndividualPhaseBatch(env, deterministicMatrix, deterministicBackwardTransitions, batchedObjectives);
+        }
+    }
+}
+
+template<class SparseModelType>
+void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhaseBatch(
+    Environment const& env, storm::storage::SparseMatrix<ValueType> const& deterministicMatrix,
+    storm::storage::SparseMatrix<ValueType> const& deterministicBackwardTransitions, std::vector<uint64_t> const& objIndices) {
+    // As maybestates of an objective we pick the states from which a state with reward is reachable. The equation systems share the matrix
+    // restricted to the union of these states. An objective has value zero (and no reward) at the maybestates of the other objectives, as no
+    // state with reward is reachable from there. Hence, starting with zero for these states yields the same solution as considering its own
+    // maybestates only.
+    std::vector<std::vector<ValueType>> deterministicStateRewards;
+    std::vector<storm::storage::BitVector> objectiveMaybeStates;
+    storm::storage::BitVector maybeStates(deterministicMatrix.getRowCount(), false);
+    for (auto const& objIndex : objIndices) {
+        deterministicStateRewards.emplace_back(deterministicMatrix.getRowCount());
+        storm::utility::vector::selectVectorValues(deterministicStateRewards.back(), this->optimalChoices, transitionMatrix.getRowGroupIndices(),
+                                                   actionRewards[objIndex]);
+        storm::storage::BitVector statesWithRewards = ~storm::utility::vector::filterZero(deterministicStateRewards.back());
+        objectiveMaybeStates.push_back(storm::utility::graph::performProbGreater0(
+            deterministicBackwardTransitions, storm::storage::BitVector(deterministicMatrix.getRowCount(), true), statesWithRewards));
+        maybeStates |= objectiveMaybeStates.back();
+        storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], ~objectiveMaybeStates.back(), storm::utility::zero<ValueType>());
+    }
+    if (maybeStates.empty()) {
+        return;
+    }
+
+    // Prepare the solution vectors and the right-hand sides of the equation systems.
+    storm::storage::SparseMatrix<ValueType> submatrix = deterministicMatrix.getSubmatrix(true, maybeStates, maybeStates, false);
+    std::vector<std::vector<ValueType>> x, b;
+    for (uint64_t i = 0; i < objIndices.size(); ++i) {
+        x.push_back(storm::utility::vector::filterVector(objectiveResults[objIndices[i]], maybeStates));
+        b.push_back(storm::utility::vector::filterVector(deterministicStateRewards[i], maybeStates));
+    }
+
+    // Now solve the resulting equation systems, using the parameters of the native linear equation solver.
+    storm::solver::helper::BatchValueIterationHelper<ValueType> helper(submatrix);
+    auto statusIterationsPair = helper.solveEquations(env, x, b, env.solver().native().getRelativeTerminationCriterion(),
+                                                      storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()),
+                                                      env.solver().native().getMaximalNumberOfIterations());
+    STORM_LOG_WARN_COND(statusIterationsPair.first == storm::solver::SolverStatus::Converged,
+                        "Iterative solver for the individual objectives did not converge after " << statusIterationsPair.second << " iterations.");
+
+    // Set the results for the objectives accordingly
+    for (uint64_t i = 0; i < objIndices.size(); ++i) {
+        storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndices[i]], maybeStates, x[i]);
     }
 }
 
@@ -90,6 +90,19 @@ class StandardPcaaWeightVectorChecker : public PcaaWeightVectorChecker<SparseMod
      */
     void unboundedIndividualPhase(Environment const& env, std::vector<ValueType> const& weightVector);
 
+    /*!
+     * Computes the values of the given total reward objectives w.r.t. the scheduler computed in the unboundedWeightedPhase by solving their
+     * equation systems together, such that each iteration traverses the matrix induced by the scheduler only once.
+     * The current objective results are taken as initial values.
+     *
+     * @param deterministicMatrix the transition matrix induced by the scheduler
+     * @param deterministicBackwardTransitions the backward transitions of the induced matrix
+     * @param objIndices the indices of the (total reward) objectives to consider
+     */
+    void unboundedIndividualPhaseBatch(Environment const& env, storm::storage::SparseMatrix<ValueType> const& deterministicMatrix,
+                                       storm::storage::SparseMatrix<ValueType> const& deterministicBackwardTransitions,
+                                       std::vector<uint64_t> const& objIndices);
+
     /*!
      * For each time epoch (starting with the maximal stepBound occurring in the objectives), this method
      * - determines the objectives that are relevant in the current time epoch
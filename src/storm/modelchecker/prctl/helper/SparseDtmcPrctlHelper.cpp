@@ -176,7 +176,7 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
     } else {
         // Get all states that have probability 0 and 1 of satisfying the until-formula.
         std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 =
-            storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
+            storm::utility::graph::performProb01(env, backwardTransitions, phiStates, psiStates);
         storm::storage::BitVector statesWithProbability0 = std::move(statesWithProbability01.first);
         statesWithProbability1 = std::move(statesWithProbability01.second);
         maybeStates = ~(statesWithProbability0 | statesWithProbability1);
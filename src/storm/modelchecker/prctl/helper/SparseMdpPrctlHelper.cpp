@@ -507,7 +507,7 @@ QualitativeStateSetsUntilProbabilities getQualitativeStateSetsUntilProbabilities
 }
 
 template<typename ValueType>
-QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabilities(storm::solver::SolveGoal<ValueType> const& goal,
+QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType> const& goal,
                                                                                      storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                      storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                      storm::storage::BitVector const& phiStates,
@@ -518,10 +518,10 @@ QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabili
     std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
     if (goal.minimize()) {
         statesWithProbability01 =
-            storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+            storm::utility::graph::performProb01Min(env, transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
     } else {
         statesWithProbability01 =
-            storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+            storm::utility::graph::performProb01Max(env, transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
     }
     result.statesWithProbability0 = std::move(statesWithProbability01.first);
     result.statesWithProbability1 = std::move(statesWithProbability01.second);
@@ -531,7 +531,7 @@ QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabili
 }
 
 template<typename ValueType>
-QualitativeStateSetsUntilProbabilities getQualitativeStateSetsUntilProbabilities(storm::solver::SolveGoal<ValueType> const& goal,
+QualitativeStateSetsUntilProbabilities getQualitativeStateSetsUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType> const& goal,
                                                                                  storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                  storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
@@ -539,7 +539,7 @@ QualitativeStateSetsUntilProbabilities getQualitativeStateSetsUntilProbabilities
     if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
         return getQualitativeStateSetsUntilProbabilitiesFromHint<ValueType>(hint);
     } else {
-        return computeQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates);
+        return computeQualitativeStateSetsUntilProbabilities(env, goal, transitionMatrix, backwardTransitions, phiStates, psiStates);
     }
 }
 
@@ -652,7 +652,7 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
     // We need to identify the maybe states (states which have a probability for satisfying the until formula
     // that is strictly between 0 and 1) and the states that satisfy the formula with probablity 1 and 0, respectively.
     QualitativeStateSetsUntilProbabilities qualitativeStateSets =
-        getQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, hint);
+        getQualitativeStateSetsUntilProbabilities(env, goal, transitionMatrix, backwardTransitions, phiStates, psiStates, hint);
 
     STORM_LOG_INFO("Preprocessing: " << qualitativeStateSets.statesWithProbability1.getNumberOfSetBits() << " states with probability 1, "
                                      << qualitativeStateSets.statesWithProbability0.getNumberOfSetBits() << " with probability 0 ("
@@ -746,7 +746,7 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
     bool useMecBasedTechnique) {
     if (useMecBasedTechnique) {
         // TODO: does this really work for minimizing objectives?
-        storm::storage::MaximalEndComponentDecomposition<ValueType> mecDecomposition(transitionMatrix, backwardTransitions, psiStates);
+        storm::storage::MaximalEndComponentDecomposition<ValueType> mecDecomposition(env, transitionMatrix, backwardTransitions, &psiStates);
         storm::storage::BitVector statesInPsiMecs(transitionMatrix.getRowGroupCount());
         for (auto const& mec : mecDecomposition) {
             for (auto const& stateActionsPair : mec) {
@@ -1344,7 +1344,8 @@ std::unique_ptr<CheckResult> SparseMdpPrctlHelper<ValueType>::computeConditional
         fixedTargetStates = targetStates;
     } else {
         fixedTargetStates = storm::storage::BitVector(targetStates.size());
-        storm::storage::MaximalEndComponentDecomposition<ValueType> mecDecomposition(transitionMatrix, backwardTransitions, ~targetStates);
+        storm::storage::BitVector nonTargetStates = ~targetStates;
+        storm::storage::MaximalEndComponentDecomposition<ValueType> mecDecomposition(env, transitionMatrix, backwardTransitions, &nonTargetStates);
         for (auto const& mec : mecDecomposition) {
             for (auto const& stateActionsPair : mec) {
                 fixedTargetStates.set(stateActionsPair.first);
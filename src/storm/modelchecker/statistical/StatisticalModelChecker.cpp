@@ -0,0 +1,458 @@
+#include "storm/modelchecker/statistical/StatisticalModelChecker.h"
+
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+#include <boost/math/special_functions/erf.hpp>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/ParallelEnvironment.h"
+#include "storm/generator/CompressedState.h"
+#include "storm/logic/FragmentSpecification.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/StatisticalModelCheckingSettings.h"
+#include "storm/simulator/PrismProgramSimulator.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/random.h"
+
+#include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace modelchecker {
+
+namespace {
+// The minimal number of paths before the normal approximation is used to decide whether sampling can stop.
+uint64_t const minimalNumberOfPathsForNormalApproximation = 100;
+
+/*!
+ * Retrieves the reward that is collected when leaving the current state of the given simulator, i.e. the state reward
+ * plus the reward of the (unique) action.
+ */
+template<typename ValueType>
+ValueType getStepReward(storm::simulator::DiscreteTimePrismProgramSimulator<ValueType> const& simulator) {
+    if (simulator.getCurrentStateRewards().empty()) {
+        return storm::utility::zero<ValueType>();
+    }
+    ValueType result = simulator.getCurrentStateRewards().front();
+    if (!simulator.getChoices().empty() && !simulator.getChoices().front().getRewards().empty()) {
+        result += simulator.getChoices().front().getRewards().front();
+    }
+    return result;
+}
+}  // namespace
+
+template<typename ModelType>
+StatisticalModelChecker<ModelType>::Options::Options() {
+    auto const& settings = storm::settings::getModule<storm::settings::modules::StatisticalModelCheckingSettings>();
+    confidence = settings.getConfidence();
+    precision = settings.getPrecision();
+    useSprt = settings.isUseSprtSet();
+    indifference = settings.getIndifference();
+    maximalPathLength = settings.getMaximalPathLength();
+    batchSize = settings.getBatchSize();
+    seed = settings.isSeedSet() ? settings.getSeed() : static_cast<uint64_t>(std::chrono::system_clock::now().time_since_epoch().count());
+}
+
+template<typename ModelType>
+void StatisticalModelChecker<ModelType>::Statistics::printToStream(std::ostream& out) const {
+    double seconds = static_cast<double>(std::max<uint64_t>(timeInMilliseconds, 1)) / 1000.0;
+    out << "\nStatistical model checking statistics:\n";
+    out << "Threads: " << numberOfThreads << '\n';
+    out << "Sampled paths: " << numberOfPaths << " (" << numberOfTruncatedPaths << " truncated)\n";
+    out << "Simulated steps: " << numberOfSteps << '\n';
+    out << "Time: " << timeInMilliseconds << "ms\n";
+    out << "Throughput: " << static_cast<uint64_t>(numberOfPaths / seconds) << " paths/s, " << static_cast<uint64_t>(numberOfSteps / seconds)
+        << " steps/s\n";
+}
+
+template<typename ModelType>
+StatisticalModelChecker<ModelType>::StatisticalModelChecker(storm::prism::Program const& program, Options const& options)
+    : program(program.substituteConstantsFormulas()), options(options) {
+    STORM_LOG_THROW(this->program.getModelType() == storm::prism::Program::ModelType::DTMC, storm::exceptions::NotSupportedException,
+                    "Statistical model checking is only supported for DTMCs.");
+}
+
+template<typename ModelType>
+bool StatisticalModelChecker<ModelType>::canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
+    storm::logic::FragmentSpecification fragment = storm::logic::reachability();
+    fragment.setBoundedUntilFormulasAllowed(true);
+    fragment.setStepBoundedUntilFormulasAllowed(true);
+    fragment.setTimeBoundedUntilFormulasAllowed(true);
+    fragment.setRewardOperatorsAllowed(true);
+    fragment.setCumulativeRewardFormulasAllowed(true);
+    fragment.setStepBoundedCumulativeRewardFormulasAllowed(true);
+    fragment.setTimeBoundedCumulativeRewardFormulasAllowed(true);
+    fragment.setInstantaneousFormulasAllowed(true);
+    fragment.setReachabilityRewardFormulasAllowed(true);
+    return checkTask.getFormula().isInFragment(fragment) && checkTask.isOnlyInitialStatesRelevantSet();
+}
+
+template<typename ModelType>
+bool StatisticalModelChecker<ModelType>::canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
+    return canHandleStatic(checkTask);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeBoundedUntilProbabilities(
+    Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) {
+    ValueType result = estimate(env, createProbabilityEvaluator(checkTask.getFormula()), true, boost::none);
+    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(0, result);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeUntilProbabilities(Environment const& env,
+                                                                                           CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) {
+    ValueType result = estimate(env, createProbabilityEvaluator(checkTask.getFormula()), true, boost::none);
+    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(0, result);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeCumulativeRewards(
+    Environment const& env, storm::logic::RewardMeasureType, CheckTask<storm::logic::CumulativeRewardFormula, ValueType> const& checkTask) {
+    storm::logic::CumulativeRewardFormula const& rewardPathFormula = checkTask.getFormula();
+    STORM_LOG_THROW(!rewardPathFormula.isMultiDimensional() && !rewardPathFormula.getTimeBoundReference().isRewardBound(),
+                    storm::exceptions::NotSupportedException, "Statistical model checking only supports step-bounded cumulative reward formulas.");
+    STORM_LOG_THROW(rewardPathFormula.hasIntegerBound(), storm::exceptions::InvalidPropertyException, "Formula needs to have a discrete time bound.");
+    uint64_t const bound = rewardPathFormula.getNonStrictBound<uint64_t>();
+
+    PathEvaluator evaluator = [bound](Simulator& simulator, uint64_t& steps, bool&) {
+        ValueType reward = storm::utility::zero<ValueType>();
+        for (steps = 0; steps < bound; ++steps) {
+            ValueType stepReward = getStepReward(simulator);
+            if (simulator.isSinkState()) {
+                return reward + static_cast<ValueType>(bound - steps) * stepReward;
+            }
+            reward += stepReward;
+            simulator.step(0);
+        }
+        return reward;
+    };
+    ValueType result = estimate(env, evaluator, false, checkTask.isRewardModelSet() ? checkTask.getRewardModel() : "");
+    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(0, result);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeInstantaneousRewards(
+    Environment const& env, storm::logic::RewardMeasureType, CheckTask<storm::logic::InstantaneousRewardFormula, ValueType> const& checkTask) {
+    storm::logic::InstantaneousRewardFormula const& rewardPathFormula = checkTask.getFormula();
+    STORM_LOG_THROW(rewardPathFormula.hasIntegerBound(), storm::exceptions::InvalidPropertyException, "Formula needs to have a discrete time bound.");
+    uint64_t const bound = rewardPathFormula.getBound<uint64_t>();
+
+    PathEvaluator evaluator = [bound](Simulator& simulator, uint64_t& steps, bool&) {
+        for (steps = 0; steps < bound && !simulator.isSinkState(); ++steps) {
+            simulator.step(0);
+        }
+        return simulator.getCurrentStateRewards().empty() ? storm::utility::zero<ValueType>() : simulator.getCurrentStateRewards().front();
+    };
+    ValueType result = estimate(env, evaluator, false, checkTask.isRewardModelSet() ? checkTask.getRewardModel() : "");
+    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(0, result);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeReachabilityRewards(
+    Environment const& env, storm::logic::RewardMeasureType, CheckTask<storm::logic::EventuallyFormula, ValueType> const& checkTask) {
+    storm::expressions::Expression targetExpression = toExpression(checkTask.getFormula().getSubformula());
+    uint64_t const maximalPathLength = options.maximalPathLength;
+
+    PathEvaluator evaluator = [targetExpression, maximalPathLength](Simulator& simulator, uint64_t& steps, bool& truncated) {
+        ValueType reward = storm::utility::zero<ValueType>();
+        for (steps = 0;; ++steps) {
+            if (simulator.evaluateBooleanExpression(targetExpression)) {
+                return reward;
+            }
+            if (simulator.isSinkState()) {
+                // The target is not reached with probability one, so the expected reward is infinite.
+                return storm::utility::infinity<ValueType>();
+            }
+            if (steps == maximalPathLength) {
+                truncated = true;
+                return reward;
+            }
+            reward += getStepReward(simulator);
+            simulator.step(0);
+        }
+    };
+    ValueType result = estimate(env, evaluator, false, checkTask.isRewardModelSet() ? checkTask.getRewardModel() : "");
+    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(0, result);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::checkProbabilityOperatorFormula(
+    Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) {
+    if (options.useSprt && checkTask.isBoundSet()) {
+        ValueType threshold = checkTask.getBoundThreshold();
+        if (threshold - options.indifference > storm::utility::zero<ValueType>() && threshold + options.indifference < storm::utility::one<ValueType>()) {
+            PathEvaluator evaluator = createProbabilityEvaluator(checkTask.getFormula().getSubformula());
+            return std::make_unique<ExplicitQualitativeCheckResult>(0, decide(env, evaluator, checkTask.getBoundComparisonType(), threshold));
+        }
+        STORM_LOG_WARN("The indifference region around the bound " << threshold << " is not contained in (0,1). Estimating the probability instead.");
+    }
+    return AbstractModelChecker<ModelType>::checkProbabilityOperatorFormula(env, checkTask);
+}
+
+template<typename ModelType>
+typename StatisticalModelChecker<ModelType>::Statistics const& StatisticalModelChecker<ModelType>::getStatistics() const {
+    return statistics;
+}
+
+template<typename ModelType>
+typename ModelType::ValueType StatisticalModelChecker<ModelType>::estimate(Environment const& env, PathEvaluator const& evaluator, bool unitInterval,
+                                                                           boost::optional<std::string> const& rewardModelName) {
+    storm::utility::Stopwatch watch(true);
+    std::vector<std::unique_ptr<Simulator>> simulators = createSimulators(env, rewardModelName);
+    std::vector<std::vector<ValueType>> values(simulators.size());
+
+    // For values in [0,1], the number of paths is fixed by the Chernoff-Hoeffding bound.
+    uint64_t const requiredNumberOfPaths =
+        unitInterval ? static_cast<uint64_t>(std::ceil(std::log(2.0 / (1.0 - options.confidence)) / (2.0 * options.precision * options.precision))) : 0;
+    // Otherwise, we stop as soon as the confidence interval obtained from the normal approximation is small enough.
+    double const quantile = std::sqrt(2.0) * boost::math::erf_inv(options.confidence);
+
+    uint64_t numberOfValues = 0;
+    ValueType mean = storm::utility::zero<ValueType>();
+    ValueType sumOfSquaredDeviations = storm::utility::zero<ValueType>();
+    bool done = false;
+    while (!done) {
+        uint64_t pathsPerSimulator = options.batchSize;
+        if (unitInterval) {
+            pathsPerSimulator = std::min(pathsPerSimulator, (requiredNumberOfPaths - numberOfValues + simulators.size() - 1) / simulators.size());
+        }
+        sampleBatch(env, simulators, evaluator, pathsPerSimulator, values);
+
+        // The values are merged in a fixed order such that the result does not depend on the scheduling of the threads.
+        for (auto const& simulatorValues : values) {
+            for (auto const& value : simulatorValues) {
+                if (storm::utility::isInfinity(value)) {
+                    mean = value;
+                    done = true;
+                    break;
+                }
+                ++numberOfValues;
+                ValueType delta = value - mean;
+                mean += delta / numberOfValues;
+                sumOfSquaredDeviations += delta * (value - mean);
+            }
+            if (done) {
+                break;
+            }
+        }
+
+        if (unitInterval) {
+            done |= numberOfValues >= requiredNumberOfPaths;
+        } else if (!done && numberOfValues >= minimalNumberOfPathsForNormalApproximation) {
+            ValueType standardError = std::sqrt(sumOfSquaredDeviations / (numberOfValues - 1) / numberOfValues);
+            done = quantile * standardError <= options.precision;
+        }
+    }
+
+    finishQuery(watch);
+    return mean;
+}
+
+template<typename ModelType>
+bool StatisticalModelChecker<ModelType>::decide(Environment const& env, PathEvaluator const& evaluator, storm::logic::ComparisonType comparisonType,
+                                                ValueType const& threshold) {
+    storm::utility::Stopwatch watch(true);
+    std::vector<std::unique_ptr<Simulator>> simulators = createSimulators(env, boost::none);
+    std::vector<std::vector<ValueType>> values(simulators.size());
+
+    // We test the hypothesis p >= threshold + indifference against p <= threshold - indifference, where both errors
+    // are bounded by one minus the confidence.
+    ValueType const error = storm::utility::one<ValueType>() - options.confidence;
+    ValueType const upperProbability = threshold + options.indifference;
+    ValueType const lowerProbability = threshold - options.indifference;
+    ValueType const satisfiedStep = std::log(lowerProbability / upperProbability);
+    ValueType const violatedStep = std::log((1 - lowerProbability) / (1 - upperProbability));
+    ValueType const acceptLower = std::log((1 - error) / error);
+    ValueType const acceptUpper = std::log(error / (1 - error));
+
+    ValueType logLikelihoodRatio = storm::utility::zero<ValueType>();
+    boost::optional<bool> aboveThreshold;
+    while (!aboveThreshold) {
+        sampleBatch(env, simulators, evaluator, options.batchSize, values);
+
+        // The samples are processed in a fixed order such that the result does not depend on the scheduling of the threads.
+        for (auto const& simulatorValues : values) {
+            for (auto const& value : simulatorValues) {
+                logLikelihoodRatio += storm::utility::isZero(value) ? violatedStep : satisfiedStep;
+                if (logLikelihoodRatio >= acceptLower) {
+                    aboveThreshold = false;
+                    break;
+                } else if (logLikelihoodRatio <= acceptUpper) {
+                    aboveThreshold = true;
+                    break;
+                }
+            }
+            if (aboveThreshold) {
+                break;
+            }
+        }
+    }
+
+    finishQuery(watch);
+    bool lowerBoundQuery = comparisonType == storm::logic::ComparisonType::Greater || comparisonType == storm::logic::ComparisonType::GreaterEqual;
+    return lowerBoundQuery == aboveThreshold.get();
+}
+
+template<typename ModelType>
+void StatisticalModelChecker<ModelType>::sampleBatch(Environment const& env, std::vector<std::unique_ptr<Simulator>>& simulators,
+                                                     PathEvaluator const& evaluator, uint64_t pathsPerSimulator, std::vector<std::vector<ValueType>>& values) {
+    std::vector<uint64_t> steps(simulators.size(), 0);
+    std::vector<uint64_t> truncatedPaths(simulators.size(), 0);
+
+    auto sampleWithSimulator = [&](uint64_t index) {
+        Simulator& simulator = *simulators[index];
+        values[index].clear();
+        simulator.resetToInitial();
+        storm::generator::CompressedState const initialState = simulator.getCurrentState();
+        for (uint64_t path = 0; path < pathsPerSimulator; ++path) {
+            if (path > 0) {
+                simulator.resetToState(initialState);
+            }
+            uint64_t pathSteps = 0;
+            bool truncated = false;
+            values[index].push_back(evaluator(simulator, pathSteps, truncated));
+            steps[index] += pathSteps;
+            if (truncated) {
+                ++truncatedPaths[index];
+            }
+        }
+    };
+
+#ifdef STORM_HAVE_INTELTBB
+    storm::utility::parallel::executeWithThreadLimit(env, [&]() {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, simulators.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                sampleWithSimulator(index);
+            }
+        });
+    });
+#else
+    for (uint64_t index = 0; index < simulators.size(); ++index) {
+        sampleWithSimulator(index);
+    }
+#endif
+
+    for (uint64_t index = 0; index < simulators.size(); ++index) {
+        statistics.numberOfPaths += pathsPerSimulator;
+        statistics.numberOfSteps += steps[index];
+        statistics.numberOfTruncatedPaths += truncatedPaths[index];
+    }
+}
+
+template<typename ModelType>
+std::vector<std::unique_ptr<typename StatisticalModelChecker<ModelType>::Simulator>> StatisticalModelChecker<ModelType>::createSimulators(
+    Environment const& env, boost::optional<std::string> const& rewardModelName) {
+#ifdef STORM_HAVE_INTELTBB
+    uint64_t numberOfSimulators = std::max<uint64_t>(1, env.parallel().getNumberOfThreads());
+#else
+    uint64_t numberOfSimulators = 1;
+#endif
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    if (rewardModelName) {
+        generatorOptions.addRewardModel(rewardModelName.get());
+    }
+
+    std::vector<std::unique_ptr<Simulator>> simulators;
+    for (uint64_t index = 0; index < numberOfSimulators; ++index) {
+        simulators.push_back(std::make_unique<Simulator>(program, generatorOptions));
+        simulators.back()->setSeed(storm::utility::deriveSeed(options.seed, index));
+    }
+
+    statistics = Statistics();
+    statistics.numberOfThreads = numberOfSimulators;
+    return simulators;
+}
+
+template<typename ModelType>
+typename StatisticalModelChecker<ModelType>::PathEvaluator StatisticalModelChecker<ModelType>::createProbabilityEvaluator(
+    storm::logic::Formula const& pathFormula) const {
+    storm::expressions::Expression conditionExpression;
+    storm::expressions::Expression targetExpression;
+    uint64_t lowerBound = 0;
+    boost::optional<uint64_t> upperBound;
+    if (pathFormula.isBoundedUntilFormula()) {
+        storm::logic::BoundedUntilFormula const& boundedUntilFormula = pathFormula.asBoundedUntilFormula();
+        STORM_LOG_THROW(!boundedUntilFormula.isMultiDimensional() && !boundedUntilFormula.getTimeBoundReference().isRewardBound(),
+                        storm::exceptions::NotSupportedException, "Statistical model checking only supports step-bounded until formulas.");
+        conditionExpression = toExpression(boundedUntilFormula.getLeftSubformula());
+        targetExpression = toExpression(boundedUntilFormula.getRightSubformula());
+        if (boundedUntilFormula.hasLowerBound()) {
+            STORM_LOG_THROW(boundedUntilFormula.hasIntegerLowerBound(), storm::exceptions::InvalidPropertyException,
+                            "Formula lower step bound must be discrete/integral.");
+            lowerBound = boundedUntilFormula.getNonStrictLowerBound<uint64_t>();
+        }
+        if (boundedUntilFormula.hasUpperBound()) {
+            STORM_LOG_THROW(boundedUntilFormula.hasIntegerUpperBound(), storm::exceptions::InvalidPropertyException,
+                            "Formula needs to have discrete upper step bound.");
+            upperBound = boundedUntilFormula.getNonStrictUpperBound<uint64_t>();
+        }
+    } else if (pathFormula.isUntilFormula()) {
+        conditionExpression = toExpression(pathFormula.asUntilFormula().getLeftSubformula());
+        targetExpression = toExpression(pathFormula.asUntilFormula().getRightSubformula());
+    } else {
+        STORM_LOG_THROW(pathFormula.isEventuallyFormula(), storm::exceptions::NotSupportedException,
+                        "Statistical model checking does not support the formula: " << pathFormula << ".");
+        conditionExpression = program.getManager().boolean(true);
+        targetExpression = toExpression(pathFormula.asEventuallyFormula().getSubformula());
+    }
+
+    // Paths whose length is not bounded by the formula are truncated after the maximal path length.
+    uint64_t const maximalPathLength = upperBound ? upperBound.get() : options.maximalPathLength;
+    bool const truncate = !upperBound;
+    return [conditionExpression, targetExpression, lowerBound, maximalPathLength, truncate](Simulator& simulator, uint64_t& steps, bool& truncated) {
+        for (steps = 0;; ++steps) {
+            bool targetSatisfied = simulator.evaluateBooleanExpression(targetExpression);
+            if (targetSatisfied && steps >= lowerBound) {
+                return storm::utility::one<ValueType>();
+            }
+            if (!simulator.evaluateBooleanExpression(conditionExpression)) {
+                return storm::utility::zero<ValueType>();
+            }
+            if (steps == maximalPathLength) {
+                truncated = truncate;
+                return storm::utility::zero<ValueType>();
+            }
+            if (simulator.isSinkState()) {
+                // The path stays in the current state forever, so the lower bound is eventually met.
+                return targetSatisfied ? storm::utility::one<ValueType>() : storm::utility::zero<ValueType>();
+            }
+            simulator.step(0);
+        }
+    };
+}
+
+template<typename ModelType>
+storm::expressions::Expression StatisticalModelChecker<ModelType>::toExpression(storm::logic::Formula const& formula) const {
+    return formula.toExpression(program.getManager(), program.getLabelToExpressionMapping());
+}
+
+template<typename ModelType>
+void StatisticalModelChecker<ModelType>::finishQuery(storm::utility::Stopwatch const& watch) {
+    statistics.timeInMilliseconds = watch.getTimeInMilliseconds();
+    STORM_LOG_WARN_COND(statistics.numberOfTruncatedPaths == 0, statistics.numberOfTruncatedPaths
+                                                                    << " sampled paths were truncated after " << options.maximalPathLength
+                                                                    << " steps. The result may be imprecise.");
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+        statistics.printToStream(std::cout);
+    } else {
+        STORM_LOG_INFO("Sampled " << statistics.numberOfPaths << " paths with " << statistics.numberOfSteps << " steps in " << statistics.timeInMilliseconds
+                                  << "ms using " << statistics.numberOfThreads << " thread(s).");
+    }
+}
+
+template class StatisticalModelChecker<storm::models::sparse::Dtmc<double>>;
+
+}  // namespace modelchecker
+}  // namespace storm
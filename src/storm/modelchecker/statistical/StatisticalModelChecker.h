@@ -0,0 +1,153 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <ostream>
+
+#include <boost/optional.hpp>
+
+#include "storm/logic/ComparisonType.h"
+#include "storm/modelchecker/AbstractModelChecker.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/Stopwatch.h"
+
+namespace storm {
+
+class Environment;
+
+namespace simulator {
+template<typename ValueType>
+class DiscreteTimePrismProgramSimulator;
+}
+
+namespace modelchecker {
+
+/*!
+ * Checks properties of discrete-time PRISM programs by sampling paths from the initial state, i.e. without building the
+ * state space. Each thread (see the parallel environment) owns a simulator whose random number generator is seeded
+ * independently. For a fixed seed and a fixed number of threads, the results are reproducible.
+ *
+ * Quantitative queries are answered by an estimate that deviates from the exact value by at most the precision with
+ * (at least) the given confidence. For probabilities, the number of paths is fixed a priori by the Chernoff-Hoeffding
+ * (Okamoto) bound, for rewards the sampling stops as soon as the confidence interval obtained from the central limit
+ * theorem is small enough (Chow-Robbins). Probability operators with a bound can instead be decided by Wald's
+ * sequential probability ratio test, which typically needs far fewer paths if the value is not close to the bound.
+ */
+template<typename ModelType>
+class StatisticalModelChecker : public AbstractModelChecker<ModelType> {
+   public:
+    typedef typename ModelType::ValueType ValueType;
+
+    struct Options {
+        /*!
+         * Creates options with the values given in the statistical model checking settings.
+         */
+        Options();
+
+        /// The probability with which results have to be correct.
+        double confidence;
+        /// The maximal absolute error of estimates.
+        double precision;
+        /// If set, probability operators with a bound are decided by the sequential probability ratio test.
+        bool useSprt;
+        /// The half-width of the indifference region of the sequential probability ratio test.
+        double indifference;
+        /// The maximal length of paths whose length is not bounded by the property.
+        uint64_t maximalPathLength;
+        /// The number of paths each thread samples before the stopping rule is checked again.
+        uint64_t batchSize;
+        /// The seed from which the seeds of the random number generators of the threads are derived.
+        uint64_t seed;
+    };
+
+    struct Statistics {
+        void printToStream(std::ostream& out) const;
+
+        uint64_t numberOfThreads = 0;
+        uint64_t numberOfPaths = 0;
+        uint64_t numberOfSteps = 0;
+        uint64_t numberOfTruncatedPaths = 0;
+        uint64_t timeInMilliseconds = 0;
+    };
+
+    explicit StatisticalModelChecker(storm::prism::Program const& program, Options const& options = Options());
+
+    static bool canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask);
+    virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
+
+    virtual std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(Environment const& env,
+                                                                          CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> computeUntilProbabilities(Environment const& env,
+                                                                   CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> computeCumulativeRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType,
+                                                                  CheckTask<storm::logic::CumulativeRewardFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> computeInstantaneousRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType,
+                                                                     CheckTask<storm::logic::InstantaneousRewardFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> computeReachabilityRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType,
+                                                                    CheckTask<storm::logic::EventuallyFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> checkProbabilityOperatorFormula(
+        Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) override;
+
+    /*!
+     * Retrieves the statistics of the most recent query.
+     */
+    Statistics const& getStatistics() const;
+
+   private:
+    typedef storm::simulator::DiscreteTimePrismProgramSimulator<ValueType> Simulator;
+
+    /*!
+     * Evaluates a path that is sampled by the given simulator, which is in the initial state. The number of steps and
+     * whether the path was truncated are reported via the last two arguments.
+     */
+    typedef std::function<ValueType(Simulator&, uint64_t&, bool&)> PathEvaluator;
+
+    /*!
+     * Estimates the expected value of the given path evaluator.
+     *
+     * @param unitInterval If true, the values of all paths are known to be in [0,1].
+     * @param rewardModelName The reward model that the simulators have to provide (if any).
+     */
+    ValueType estimate(Environment const& env, PathEvaluator const& evaluator, bool unitInterval, boost::optional<std::string> const& rewardModelName);
+
+    /*!
+     * Decides whether the probability of the paths satisfying the given evaluator satisfies the given bound by means of
+     * the sequential probability ratio test.
+     */
+    bool decide(Environment const& env, PathEvaluator const& evaluator, storm::logic::ComparisonType comparisonType, ValueType const& threshold);
+
+    /*!
+     * Samples the given number of paths in each of the given simulators (in parallel) and stores the values in the
+     * corresponding vectors.
+     */
+    void sampleBatch(Environment const& env, std::vector<std::unique_ptr<Simulator>>& simulators, PathEvaluator const& evaluator, uint64_t pathsPerSimulator,
+                     std::vector<std::vector<ValueType>>& values);
+
+    /*!
+     * Creates one simulator per thread and resets the statistics.
+     */
+    std::vector<std::unique_ptr<Simulator>> createSimulators(Environment const& env, boost::optional<std::string> const& rewardModelName);
+
+    /*!
+     * Creates an evaluator that yields one for paths satisfying the given (until, bounded until or eventually) formula
+     * and zero otherwise.
+     */
+    PathEvaluator createProbabilityEvaluator(storm::logic::Formula const& pathFormula) const;
+
+    storm::expressions::Expression toExpression(storm::logic::Formula const& formula) const;
+
+    /*!
+     * Reports the statistics of the query that was started when the given stopwatch was started.
+     */
+    void finishQuery(storm::utility::Stopwatch const& watch);
+
+    // The program that is checked (with substituted constants and formulas).
+    storm::prism::Program program;
+
+    Options options;
+
+    Statistics statistics;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
@@ -38,6 +38,9 @@ const std::string buildOverlappingGuardsLabelOptionName = "build-overlapping-gua
 const std::string noSimplifyOptionName = "no-simplify";
 const std::string bitsForUnboundedVariablesOptionName = "int-bits";
 const std::string performLocationElimination = "location-elimination";
+const std::string compressStatesOptionName = "compress-states";
+const std::string symmetryReductionOptionName = "symmetry-reduction";
+const std::string partialOrderReductionOptionName = "partial-order-reduction";
 
 BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, prismCompatibilityOptionName, false,
@@ -79,6 +82,22 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
                                                    "If set, additional checks (if available) are performed during model exploration to debug the model.")
                         .setShortName(explorationChecksOptionShortName)
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, compressStatesOptionName, false,
+                                                   "If set, states are stored in a compressed form during explicit model building. This reduces the "
+                                                   "memory needed for large state spaces but slows down the exploration.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, symmetryReductionOptionName, false,
+                                                   "If set, states of PRISM programs that only differ by a permutation of symmetric modules are identified "
+                                                   "during explicit model building. Labels, rewards and properties need to be symmetric.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, partialOrderReductionOptionName, false,
+                                                   "If set, independent commands of PRISM MDPs that do not affect the labels are explored in only one "
+                                                   "interleaving during explicit model building. Preserves minimal and maximal probabilities of LTL "
+                                                   "properties without next operators.")
+                        .setIsAdvanced()
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, buildOutOfBoundsStateOptionName, false, "If set, a state for out-of-bounds valuations is added")
                         .setIsAdvanced()
                         .build());
@@ -120,6 +139,18 @@ bool BuildSettings::isPrismCompatibilityEnabled() const {
     return this->getOption(prismCompatibilityOptionName).getHasOptionBeenSet();
 }
 
+bool BuildSettings::isCompressStatesSet() const {
+    return this->getOption(compressStatesOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isSymmetryReductionSet() const {
+    return this->getOption(symmetryReductionOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isPartialOrderReductionSet() const {
+    return this->getOption(partialOrderReductionOptionName).getHasOptionBeenSet();
+}
+
 bool BuildSettings::isDontFixDeadlocksSet() const {
     return this->getOption(dontFixDeadlockOptionName).getHasOptionBeenSet();
 }
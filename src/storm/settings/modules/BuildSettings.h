@@ -42,6 +42,27 @@ class BuildSettings : public ModuleSettings {
      */
     bool isPrismCompatibilityEnabled() const;
 
+    /*!
+     * Retrieves whether states are to be stored in a compressed form during explicit model building.
+     *
+     * @return True iff the compress-states option was set.
+     */
+    bool isCompressStatesSet() const;
+
+    /*!
+     * Retrieves whether states that only differ by a permutation of symmetric modules are to be identified.
+     *
+     * @return True iff the symmetry-reduction option was set.
+     */
+    bool isSymmetryReductionSet() const;
+
+    /*!
+     * Retrieves whether a partial-order reduction is to be applied during explicit model building.
+     *
+     * @return True iff the partial-order-reduction option was set.
+     */
+    bool isPartialOrderReductionSet() const;
+
     /*!
      * Retrieves whether the dont-fix-deadlocks option was set.
      *
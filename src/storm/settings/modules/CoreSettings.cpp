@@ -31,6 +31,7 @@ const std::string CoreSettings::ddLibraryOptionName = "ddlib";
 const std::string CoreSettings::cudaOptionName = "cuda";
 const std::string CoreSettings::intelTbbOptionName = "enable-tbb";
 const std::string CoreSettings::intelTbbOptionShortName = "tbb";
+const std::string CoreSettings::threadsOptionName = "threads";
 
 CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility::Engine::Sparse) {
     std::vector<std::string> engines;
@@ -88,6 +89,13 @@ CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility
         storm::settings::OptionBuilder(moduleName, intelTbbOptionName, false, "Sets whether to use Intel TBB (if Storm was built with support for TBB).")
             .setShortName(intelTbbOptionShortName)
             .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, false,
+                                                   "Sets the number of threads used by parallel algorithms (if Storm was built with support for TBB).")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. If 0, the number of hardware threads is used.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 storm::solver::EquationSolverType CoreSettings::getEquationSolver() const {
@@ -164,6 +172,18 @@ bool CoreSettings::isUseIntelTbbSet() const {
     return this->getOption(intelTbbOptionName).getHasOptionBeenSet();
 }
 
+bool CoreSettings::isNumberOfThreadsSet() const {
+    return this->getOption(threadsOptionName).getHasOptionBeenSet();
+}
+
+uint64_t CoreSettings::getNumberOfThreads() const {
+    if (!isNumberOfThreadsSet() && isUseIntelTbbSet()) {
+        // For backwards compatibility, enabling TBB without specifying the number of threads uses all hardware threads.
+        return 0;
+    }
+    return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 bool CoreSettings::isUseCudaSet() const {
     return this->getOption(cudaOptionName).getHasOptionBeenSet();
 }
@@ -188,6 +208,8 @@ bool CoreSettings::check() const {
     return true;
 #else
     STORM_LOG_WARN_COND(!isUseIntelTbbSet(), "Enabling TBB is not supported in this version of Storm as it was not built with support for it.");
+    STORM_LOG_WARN_COND(getNumberOfThreads() == 1,
+                        "Using multiple threads is not supported in this version of Storm as it was not built with support for TBB.");
     return true;
 #endif
 }
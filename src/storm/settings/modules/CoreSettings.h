@@ -102,6 +102,21 @@ class CoreSettings : public ModuleSettings {
      */
     bool isUseIntelTbbSet() const;
 
+    /*!
+     * Retrieves whether the number of threads has been set.
+     *
+     * @return True iff the option was set.
+     */
+    bool isNumberOfThreadsSet() const;
+
+    /*!
+     * Retrieves the number of threads to use for parallel algorithms. A value of 0 means that the number of
+     * hardware threads is to be used.
+     *
+     * @return The number of threads.
+     */
+    uint64_t getNumberOfThreads() const;
+
     /*!
      * Retrieves whether the option to use CUDA is set.
      *
@@ -141,6 +156,7 @@ class CoreSettings : public ModuleSettings {
     static const std::string ddLibraryOptionName;
     static const std::string intelTbbOptionName;
     static const std::string intelTbbOptionShortName;
+    static const std::string threadsOptionName;
     static const std::string cudaOptionName;
 };
 
@@ -31,6 +31,8 @@ const std::string IOSettings::explicitOptionName = "explicit";
 const std::string IOSettings::explicitOptionShortName = "exp";
 const std::string IOSettings::explicitDrnOptionName = "explicit-drn";
 const std::string IOSettings::explicitDrnOptionShortName = "drn";
+const std::string IOSettings::explicitBinaryOptionName = "explicit-binary";
+const std::string IOSettings::explicitBinaryOptionShortName = "drb";
 const std::string IOSettings::explicitImcaOptionName = "explicit-imca";
 const std::string IOSettings::explicitImcaOptionShortName = "imca";
 const std::string IOSettings::prismInputOptionName = "prism";
@@ -74,7 +76,7 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueUnsignedInteger(0)
                                          .build())
                         .build());
-    std::vector<std::string> exportFormats({"auto", "dot", "drdd", "drn", "json"});
+    std::vector<std::string> exportFormats({"auto", "dot", "drdd", "drn", "drb", "json"});
     this->addOption(
         storm::settings::OptionBuilder(moduleName, exportBuildOptionName, false, "Exports the built model to a file.")
             .addArgument(storm::settings::ArgumentBuilder::createStringArgument("file", "The output file.").build())
@@ -143,6 +145,12 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                          .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, explicitBinaryOptionName, false, "Parses the model given in the binary DRB format.")
+                        .setShortName(explicitBinaryOptionShortName)
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("drb filename", "The name of the DRB file containing the model.")
+                                         .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
+                                         .build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, explicitImcaOptionName, false, "Parses the model given in the IMCA format.")
                         .setShortName(explicitImcaOptionShortName)
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("imca filename", "The name of the imca file containing the model.")
@@ -366,6 +374,14 @@ std::string IOSettings::getExplicitDRNFilename() const {
     return this->getOption(explicitDrnOptionName).getArgumentByName("drn filename").getValueAsString();
 }
 
+bool IOSettings::isExplicitBinarySet() const {
+    return this->getOption(explicitBinaryOptionName).getHasOptionBeenSet();
+}
+
+std::string IOSettings::getExplicitBinaryFilename() const {
+    return this->getOption(explicitBinaryOptionName).getArgumentByName("drb filename").getValueAsString();
+}
+
 bool IOSettings::isExplicitIMCASet() const {
     return this->getOption(explicitImcaOptionName).getHasOptionBeenSet();
 }
@@ -522,6 +538,7 @@ bool IOSettings::check() const {
     // Ensure that not two explicit input models were given.
     uint64_t numExplicitInputs = isExplicitSet() ? 1 : 0;
     numExplicitInputs += isExplicitDRNSet() ? 1 : 0;
+    numExplicitInputs += isExplicitBinarySet() ? 1 : 0;
     numExplicitInputs += isExplicitIMCASet() ? 1 : 0;
     STORM_LOG_THROW(numExplicitInputs <= 1, storm::exceptions::InvalidSettingsException, "Multiple explicit input models");
 
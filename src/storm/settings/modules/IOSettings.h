@@ -173,6 +173,20 @@ class IOSettings : public ModuleSettings {
      */
     bool isExplicitExportPlaceholdersDisabled() const;
 
+    /*!
+     * Retrieves whether the explicit option with the binary DRB format was set.
+     *
+     * @return True if the explicit option with the binary DRB format was set.
+     */
+    bool isExplicitBinarySet() const;
+
+    /*!
+     * Retrieves the name of the file that contains the model in the binary DRB format.
+     *
+     * @return The name of the DRB file that contains the model.
+     */
+    std::string getExplicitBinaryFilename() const;
+
     /*!
      * Retrieves whether the explicit option with IMCA was set.
      *
@@ -390,6 +404,8 @@ class IOSettings : public ModuleSettings {
     static const std::string explicitOptionShortName;
     static const std::string explicitDrnOptionName;
     static const std::string explicitDrnOptionShortName;
+    static const std::string explicitBinaryOptionName;
+    static const std::string explicitBinaryOptionShortName;
     static const std::string explicitImcaOptionName;
     static const std::string explicitImcaOptionShortName;
     static const std::string prismInputOptionName;
@@ -13,9 +13,10 @@ namespace modules {
 
 const std::string MultiplierSettings::moduleName = "multiplier";
 const std::string MultiplierSettings::multiplierTypeOptionName = "type";
+const std::string MultiplierSettings::compactMatrixOptionName = "compact";
 
 MultiplierSettings::MultiplierSettings() : ModuleSettings(moduleName) {
-    std::vector<std::string> multiplierTypes = {"native", "gmmxx"};
+    std::vector<std::string> multiplierTypes = {"native", "gmmxx", "simd"};
     this->addOption(storm::settings::OptionBuilder(moduleName, multiplierTypeOptionName, true, "Sets which type of multiplier is preferred.")
                         .setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a multiplier.")
@@ -23,6 +24,11 @@ MultiplierSettings::MultiplierSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("gmmxx")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, compactMatrixOptionName, true,
+                                                   "If set, the native multiplier operates on a compact representation of the matrix with 32-bit column indices. Solvers that own "
+                                                   "their matrix keep it only in this representation while iterating.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 storm::solver::MultiplierType MultiplierSettings::getMultiplierType() const {
@@ -31,6 +37,8 @@ storm::solver::MultiplierType MultiplierSettings::getMultiplierType() const {
         return storm::solver::MultiplierType::Native;
     } else if (type == "gmmxx") {
         return storm::solver::MultiplierType::Gmmxx;
+    } else if (type == "simd") {
+        return storm::solver::MultiplierType::Simd;
     }
 
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown multiplier type '" << type << "'.");
@@ -40,6 +48,10 @@ bool MultiplierSettings::isMultiplierTypeSetFromDefaultValue() const {
     return !this->getOption(multiplierTypeOptionName).getArgumentByName("name").getHasBeenSet() ||
            this->getOption(multiplierTypeOptionName).getArgumentByName("name").wasSetFromDefaultValue();
 }
+
+bool MultiplierSettings::isCompactMatrixSet() const {
+    return this->getOption(compactMatrixOptionName).getHasOptionBeenSet();
+}
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -21,11 +21,17 @@ class MultiplierSettings : public ModuleSettings {
 
     bool isMultiplierTypeSetFromDefaultValue() const;
 
+    /*!
+     * Retrieves whether the multiplier shall operate on a compact representation of the matrix (32-bit column indices, separate column and value arrays).
+     */
+    bool isCompactMatrixSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 
    private:
     static const std::string multiplierTypeOptionName;
+    static const std::string compactMatrixOptionName;
 };
 
 }  // namespace modules
@@ -0,0 +1,114 @@
+#include "storm/settings/modules/StatisticalModelCheckingSettings.h"
+#include "storm/settings/Argument.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/utility/Engine.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+const std::string StatisticalModelCheckingSettings::moduleName = "smc";
+const std::string StatisticalModelCheckingSettings::confidenceOptionName = "confidence";
+const std::string StatisticalModelCheckingSettings::precisionOptionName = "precision";
+const std::string StatisticalModelCheckingSettings::sprtOptionName = "sprt";
+const std::string StatisticalModelCheckingSettings::indifferenceOptionName = "indifference";
+const std::string StatisticalModelCheckingSettings::maximalPathLengthOptionName = "maxpathlength";
+const std::string StatisticalModelCheckingSettings::batchSizeOptionName = "batchsize";
+const std::string StatisticalModelCheckingSettings::seedOptionName = "seed";
+
+StatisticalModelCheckingSettings::StatisticalModelCheckingSettings() : ModuleSettings(moduleName) {
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, confidenceOptionName, true, "The confidence with which the computed estimates (or decisions) are correct.")
+            .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The confidence.")
+                             .setDefaultValueDouble(0.95)
+                             .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                             .build())
+            .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, true, "The maximal (absolute) error of the computed estimates.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The precision.")
+                                         .setDefaultValueDouble(0.01)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterValidator(0.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, sprtOptionName, true,
+                                                   "If set, probability operators with a bound are decided by a sequential probability ratio test.")
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, indifferenceOptionName, true,
+                                                   "The half-width of the indifference region around the bound used by the sequential probability ratio test.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The half-width.")
+                                         .setDefaultValueDouble(0.01)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 0.5))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, maximalPathLengthOptionName, true,
+                                                   "The maximal length of sampled paths for properties that do not bound the length of paths.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("length", "The maximal number of steps.")
+                                         .setDefaultValueUnsignedInteger(100000)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, batchSizeOptionName, true,
+                                                   "The number of paths each thread samples before the stopping rule is checked again.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of paths.")
+                                         .setDefaultValueUnsignedInteger(1000)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, seedOptionName, true, "The seed for the random number generators.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The seed.").build())
+                        .build());
+}
+
+double StatisticalModelCheckingSettings::getConfidence() const {
+    return this->getOption(confidenceOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+double StatisticalModelCheckingSettings::getPrecision() const {
+    return this->getOption(precisionOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+bool StatisticalModelCheckingSettings::isUseSprtSet() const {
+    return this->getOption(sprtOptionName).getHasOptionBeenSet();
+}
+
+double StatisticalModelCheckingSettings::getIndifference() const {
+    return this->getOption(indifferenceOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+uint64_t StatisticalModelCheckingSettings::getMaximalPathLength() const {
+    return this->getOption(maximalPathLengthOptionName).getArgumentByName("length").getValueAsUnsignedInteger();
+}
+
+uint64_t StatisticalModelCheckingSettings::getBatchSize() const {
+    return this->getOption(batchSizeOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool StatisticalModelCheckingSettings::isSeedSet() const {
+    return this->getOption(seedOptionName).getHasOptionBeenSet();
+}
+
+uint64_t StatisticalModelCheckingSettings::getSeed() const {
+    return this->getOption(seedOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+}
+
+bool StatisticalModelCheckingSettings::check() const {
+    bool optionsSet = this->getOption(confidenceOptionName).getHasOptionBeenSet() || this->getOption(precisionOptionName).getHasOptionBeenSet() ||
+                      this->getOption(sprtOptionName).getHasOptionBeenSet() || this->getOption(indifferenceOptionName).getHasOptionBeenSet() ||
+                      this->getOption(maximalPathLengthOptionName).getHasOptionBeenSet() || this->getOption(batchSizeOptionName).getHasOptionBeenSet() ||
+                      this->getOption(seedOptionName).getHasOptionBeenSet();
+    STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::CoreSettings>().getEngine() == storm::utility::Engine::Statistical || !optionsSet,
+                        "Statistical model checking engine is not selected, so setting options for it has no effect.");
+    return true;
+}
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
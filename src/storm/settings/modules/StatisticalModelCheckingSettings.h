@@ -0,0 +1,78 @@
+#pragma once
+
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+/*!
+ * This class represents the settings of the statistical model checking engine.
+ */
+class StatisticalModelCheckingSettings : public ModuleSettings {
+   public:
+    /*!
+     * Creates a new set of statistical model checking settings.
+     */
+    StatisticalModelCheckingSettings();
+
+    /*!
+     * Retrieves the confidence with which the estimates (or decisions) have to be correct.
+     */
+    double getConfidence() const;
+
+    /*!
+     * Retrieves the (absolute) precision of the estimates.
+     */
+    double getPrecision() const;
+
+    /*!
+     * Retrieves whether the sequential probability ratio test is to be used for probability operators with a bound.
+     */
+    bool isUseSprtSet() const;
+
+    /*!
+     * Retrieves the half-width of the indifference region around the bound of a probability operator that is used by
+     * the sequential probability ratio test.
+     */
+    double getIndifference() const;
+
+    /*!
+     * Retrieves the maximal length of a path for properties whose paths are not bounded.
+     */
+    uint64_t getMaximalPathLength() const;
+
+    /*!
+     * Retrieves the number of paths that each thread samples before the stopping rule is checked again.
+     */
+    uint64_t getBatchSize() const;
+
+    /*!
+     * Retrieves whether a seed for the random number generators was set.
+     */
+    bool isSeedSet() const;
+
+    /*!
+     * Retrieves the seed for the random number generators.
+     */
+    uint64_t getSeed() const;
+
+    virtual bool check() const override;
+
+    // The name of the module.
+    static const std::string moduleName;
+
+   private:
+    // Define the string names of the options as constants.
+    static const std::string confidenceOptionName;
+    static const std::string precisionOptionName;
+    static const std::string sprtOptionName;
+    static const std::string indifferenceOptionName;
+    static const std::string maximalPathLengthOptionName;
+    static const std::string batchSizeOptionName;
+    static const std::string seedOptionName;
+};
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
@@ -1,4 +1,8 @@
 #include "storm/simulator/DiscreteTimeSparseModelSimulator.h"
+
+#include <algorithm>
+#include <type_traits>
+
 #include "storm/models/sparse/Model.h"
 
 namespace storm {
@@ -9,13 +13,63 @@ DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::DiscreteTimeSparse
     : model(model), currentState(*model.getInitialStates().begin()), zeroRewards(model.getNumberOfRewardModels(), storm::utility::zero<ValueType>()) {
     STORM_LOG_WARN_COND(model.getInitialStates().getNumberOfSetBits() == 1,
                         "The model has multiple initial states. This simulator assumes it starts from the initial state with the lowest index.");
-    lastRewards = zeroRewards;
-    uint64_t i = 0;
     for (auto const& rewModPair : model.getRewardModels()) {
-        if (rewModPair.second.hasStateRewards()) {
-            lastRewards[i] += rewModPair.second.getStateReward(currentState);
+        stateRewardVectors.push_back(rewModPair.second.hasStateRewards() ? &rewModPair.second.getStateRewardVector() : nullptr);
+        stateActionRewardVectors.push_back(rewModPair.second.hasStateActionRewards() ? &rewModPair.second.getStateActionRewardVector() : nullptr);
+    }
+    lastRewards = zeroRewards;
+    addStateRewards(currentState, lastRewards);
+
+    // Prepare the sampling of successors.
+    auto const& matrix = model.getTransitionMatrix();
+    samplingThresholds.resize(matrix.getEntryCount());
+    if constexpr (std::is_same<ValueType, double>::value) {
+        aliases.resize(matrix.getEntryCount());
+        std::vector<uint64_t> small, large;
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            uint64_t const offset = matrix.begin(row) - matrix.begin();
+            uint64_t const size = matrix.getRow(row).getNumberOfEntries();
+            double rowSum = 0.0;
+            for (auto const& entry : matrix.getRow(row)) {
+                rowSum += entry.getValue();
+            }
+            // Scale the probabilities such that they are one on average and split the entries by whether they are below that.
+            small.clear();
+            large.clear();
+            for (uint64_t i = 0; i < size; ++i) {
+                samplingThresholds[offset + i] = matrix.begin(row)[i].getValue() * size / rowSum;
+                aliases[offset + i] = i;
+                (samplingThresholds[offset + i] < 1.0 ? small : large).push_back(i);
+            }
+            // Fill the slots of the small entries with the surplus of the large ones.
+            while (!small.empty() && !large.empty()) {
+                uint64_t smallEntry = small.back();
+                small.pop_back();
+                uint64_t largeEntry = large.back();
+                aliases[offset + smallEntry] = largeEntry;
+                samplingThresholds[offset + largeEntry] -= 1.0 - samplingThresholds[offset + smallEntry];
+                if (samplingThresholds[offset + largeEntry] < 1.0) {
+                    large.pop_back();
+                    small.push_back(largeEntry);
+                }
+            }
+            // The remaining entries fill their slot up to rounding errors.
+            for (uint64_t i : small) {
+                samplingThresholds[offset + i] = 1.0;
+            }
+            for (uint64_t i : large) {
+                samplingThresholds[offset + i] = 1.0;
+            }
+        }
+    } else {
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            uint64_t entry = matrix.begin(row) - matrix.begin();
+            ValueType sum = storm::utility::zero<ValueType>();
+            for (auto const& matrixEntry : matrix.getRow(row)) {
+                sum += matrixEntry.getValue();
+                samplingThresholds[entry++] = sum;
+            }
         }
-        ++i;
     }
 }
 
@@ -26,45 +80,22 @@ void DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::setSeed(uint6
 
 template<typename ValueType, typename RewardModelType>
 bool DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::randomStep() {
-    // TODO random_uint is slow
     if (model.getTransitionMatrix().getRowGroupSize(currentState) == 0) {
         return false;
     }
-    return step(generator.random_uint(0, model.getTransitionMatrix().getRowGroupSize(currentState) - 1));
+    return step(sampleAction(currentState));
 }
 
 template<typename ValueType, typename RewardModelType>
 bool DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::step(uint64_t action) {
-    // TODO lots of optimization potential.
-    //  E.g., do not sample random numbers if there is only a single transition
-    lastRewards = zeroRewards;
-    ValueType probability = generator.random();
     STORM_LOG_ASSERT(action < model.getTransitionMatrix().getRowGroupSize(currentState), "Action index higher than number of actions");
     uint64_t row = model.getTransitionMatrix().getRowGroupIndices()[currentState] + action;
-    uint64_t i = 0;
-    for (auto const& rewModPair : model.getRewardModels()) {
-        if (rewModPair.second.hasStateActionRewards()) {
-            lastRewards[i] += rewModPair.second.getStateActionReward(row);
-        }
-        ++i;
+    for (uint64_t i = 0; i < lastRewards.size(); ++i) {
+        lastRewards[i] = stateActionRewardVectors[i] ? (*stateActionRewardVectors[i])[row] : storm::utility::zero<ValueType>();
     }
-    ValueType sum = storm::utility::zero<ValueType>();
-    for (auto const& entry : model.getTransitionMatrix().getRow(row)) {
-        sum += entry.getValue();
-        if (sum >= probability) {
-            currentState = entry.getColumn();
-            i = 0;
-            for (auto const& rewModPair : model.getRewardModels()) {
-                if (rewModPair.second.hasStateRewards()) {
-                    lastRewards[i] += rewModPair.second.getStateReward(currentState);
-                }
-                ++i;
-            }
-            return true;
-        }
-    }
-    // This position should never be reached
-    return false;
+    currentState = sampleSuccessor(row);
+    addStateRewards(currentState, lastRewards);
+    return true;
 }
 
 template<typename ValueType, typename RewardModelType>
@@ -74,15 +105,15 @@ uint64_t DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::getCurren
 
 template<typename ValueType, typename RewardModelType>
 bool DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::resetToInitial() {
-    currentState = *model.getInitialStates().begin();
-    lastRewards = zeroRewards;
-    uint64_t i = 0;
-    for (auto const& rewModPair : model.getRewardModels()) {
-        if (rewModPair.second.hasStateRewards()) {
-            lastRewards[i] += rewModPair.second.getStateReward(currentState);
-        }
-        ++i;
-    }
+    return resetToState(*model.getInitialStates().begin());
+}
+
+template<typename ValueType, typename RewardModelType>
+bool DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::resetToState(uint64_t state) {
+    STORM_LOG_ASSERT(state < model.getNumberOfStates(), "State index out of range.");
+    currentState = state;
+    std::fill(lastRewards.begin(), lastRewards.end(), storm::utility::zero<ValueType>());
+    addStateRewards(currentState, lastRewards);
     return true;
 }
 
@@ -91,6 +122,99 @@ std::vector<ValueType> const& DiscreteTimeSparseModelSimulator<ValueType, Reward
     return lastRewards;
 }
 
+template<typename ValueType, typename RewardModelType>
+typename DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::PathBatch DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::createBatch(
+    uint64_t numberOfPaths) const {
+    PathBatch batch;
+    batch.states.resize(numberOfPaths);
+    batch.rewards.resize(zeroRewards.size(), std::vector<ValueType>(numberOfPaths));
+    batch.active.resize(numberOfPaths);
+    resetBatch(batch);
+    return batch;
+}
+
+template<typename ValueType, typename RewardModelType>
+void DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::resetBatch(PathBatch& batch) const {
+    uint64_t initialState = *model.getInitialStates().begin();
+    std::fill(batch.states.begin(), batch.states.end(), initialState);
+    for (uint64_t i = 0; i < batch.rewards.size(); ++i) {
+        ValueType initialReward = stateRewardVectors[i] ? (*stateRewardVectors[i])[initialState] : storm::utility::zero<ValueType>();
+        std::fill(batch.rewards[i].begin(), batch.rewards[i].end(), initialReward);
+    }
+    batch.active.fill();
+}
+
+template<typename ValueType, typename RewardModelType>
+uint64_t DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::randomStepBatch(PathBatch& batch) {
+    auto const& rowGroupIndices = model.getTransitionMatrix().getRowGroupIndices();
+    uint64_t numberOfSteps = 0;
+    for (auto path : batch.active) {
+        uint64_t state = batch.states[path];
+        if (rowGroupIndices[state] == rowGroupIndices[state + 1]) {
+            batch.active.set(path, false);
+            continue;
+        }
+        uint64_t row = rowGroupIndices[state] + sampleAction(state);
+        state = sampleSuccessor(row);
+        batch.states[path] = state;
+        for (uint64_t i = 0; i < batch.rewards.size(); ++i) {
+            if (stateActionRewardVectors[i]) {
+                batch.rewards[i][path] += (*stateActionRewardVectors[i])[row];
+            }
+            if (stateRewardVectors[i]) {
+                batch.rewards[i][path] += (*stateRewardVectors[i])[state];
+            }
+        }
+        ++numberOfSteps;
+    }
+    return numberOfSteps;
+}
+
+template<typename ValueType, typename RewardModelType>
+uint64_t DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::sampleSuccessor(uint64_t row) {
+    auto const& matrix = model.getTransitionMatrix();
+    auto rowBegin = matrix.begin(row);
+    uint64_t const size = matrix.end(row) - rowBegin;
+    STORM_LOG_ASSERT(size > 0, "Cannot sample from an empty row.");
+    if (size == 1) {
+        return rowBegin->getColumn();
+    }
+    uint64_t const offset = rowBegin - matrix.begin();
+    if constexpr (std::is_same<ValueType, double>::value) {
+        // A single uniform number selects both the slot and whether the slot's own entry or its alias is taken.
+        double scaled = generator.random() * size;
+        uint64_t slot = std::min(static_cast<uint64_t>(scaled), size - 1);
+        uint64_t entry = (scaled - slot < samplingThresholds[offset + slot]) ? slot : aliases[offset + slot];
+        return rowBegin[entry].getColumn();
+    } else {
+        ValueType probability = generator.random();
+        auto thresholdsBegin = samplingThresholds.begin() + offset;
+        auto it = std::lower_bound(thresholdsBegin, thresholdsBegin + size, probability);
+        // Due to numerical imprecisions, the sum of the row might be slightly below one.
+        uint64_t entry = std::min<uint64_t>(it - thresholdsBegin, size - 1);
+        return rowBegin[entry].getColumn();
+    }
+}
+
+template<typename ValueType, typename RewardModelType>
+uint64_t DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::sampleAction(uint64_t state) {
+    uint64_t numberOfActions = model.getTransitionMatrix().getRowGroupSize(state);
+    STORM_LOG_ASSERT(numberOfActions > 0, "Cannot sample an action of a deadlock state.");
+    if (numberOfActions == 1) {
+        return 0;
+    }
+    return generator.random_uint(0, numberOfActions - 1);
+}
+
+template<typename ValueType, typename RewardModelType>
+void DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::addStateRewards(uint64_t state, std::vector<ValueType>& rewards) const {
+    for (uint64_t i = 0; i < rewards.size(); ++i) {
+        if (stateRewardVectors[i]) {
+            rewards[i] += (*stateRewardVectors[i])[state];
+        }
+    }
+}
+
 template class DiscreteTimeSparseModelSimulator<double>;
 template class DiscreteTimeSparseModelSimulator<storm::RationalNumber>;
 
@@ -1,5 +1,6 @@
 #include <cstdint>
 #include "storm/models/sparse/Model.h"
+#include "storm/storage/BitVector.h"
 #include "storm/utility/random.h"
 
 namespace storm {
@@ -10,12 +11,27 @@ namespace simulator {
  * stored explicitly as a SparseModel.
  * Additional information about state, actions, should be obtained via the model itself.
  *
+ * Successors are sampled in constant time from alias tables (Vose's method) that are built for every row upon
+ * construction. For exact value types, a cumulative distribution per row is searched instead.
+ *
  * TODO: It may be nice to write a CPP wrapper that does not require to actually obtain such informations yourself.
  * @tparam ModelType
  */
 template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
 class DiscreteTimeSparseModelSimulator {
    public:
+    /**
+     * Many independent paths that are advanced together, stored as a structure of arrays.
+     */
+    struct PathBatch {
+        /// The current state of each path.
+        std::vector<uint64_t> states;
+        /// For each reward model, the reward accumulated by each path.
+        std::vector<std::vector<ValueType>> rewards;
+        /// The paths that are still advanced. Paths in deadlock states are deactivated, and users may deactivate paths as well.
+        storm::storage::BitVector active;
+    };
+
     DiscreteTimeSparseModelSimulator(storm::models::sparse::Model<ValueType, RewardModelType> const& model);
     void setSeed(uint64_t);
     bool step(uint64_t action);
@@ -23,13 +39,54 @@ class DiscreteTimeSparseModelSimulator {
     std::vector<ValueType> const& getLastRewards() const;
     uint64_t getCurrentState() const;
     bool resetToInitial();
+    /**
+     * Moves the simulator to the given state. The last rewards are the state rewards of that state.
+     */
+    bool resetToState(uint64_t state);
+
+    /**
+     * Creates a batch of paths that all start in the initial state. The reward of the initial state is accumulated.
+     *
+     * @param numberOfPaths The number of paths in the batch.
+     */
+    PathBatch createBatch(uint64_t numberOfPaths) const;
+    /**
+     * Resets all paths of the given batch to the initial state (without changing the number of paths).
+     */
+    void resetBatch(PathBatch& batch) const;
+    /**
+     * Advances every active path of the batch by one step with a uniformly chosen action and accumulates the rewards.
+     * This does not allocate memory.
+     *
+     * @return The number of paths that were advanced.
+     */
+    uint64_t randomStepBatch(PathBatch& batch);
 
    protected:
+    /**
+     * Samples a successor of the given row.
+     */
+    uint64_t sampleSuccessor(uint64_t row);
+    /**
+     * Samples an action of the given state uniformly. The state must have at least one action.
+     */
+    uint64_t sampleAction(uint64_t state);
+    void addStateRewards(uint64_t state, std::vector<ValueType>& rewards) const;
+
     storm::models::sparse::Model<ValueType, RewardModelType> const& model;
     uint64_t currentState;
     std::vector<ValueType> lastRewards;
     std::vector<ValueType> zeroRewards;
     storm::utility::RandomProbabilityGenerator<ValueType> generator;
+
+    // For each reward model, the state (action) reward vector, if there is any.
+    std::vector<std::vector<ValueType> const*> stateRewardVectors;
+    std::vector<std::vector<ValueType> const*> stateActionRewardVectors;
+    // For every matrix entry, the probability with which it is kept in its slot of the alias table (or its cumulative
+    // probability within its row, for exact value types).
+    std::vector<ValueType> samplingThresholds;
+    // For every matrix entry, the entry (relative to the start of its row) that is chosen if it is not kept.
+    std::vector<uint64_t> aliases;
 };
 }  // namespace simulator
-}  // namespace storm
\ No newline at end of file
+}  // namespace storm
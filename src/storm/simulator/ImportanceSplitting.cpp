@@ -0,0 +1,234 @@
+#include "storm/simulator/ImportanceSplitting.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <boost/math/special_functions/erf.hpp>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/ParallelEnvironment.h"
+#include "storm/generator/CompressedState.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/simulator/DiscreteTimeSparseModelSimulator.h"
+#include "storm/simulator/PrismProgramSimulator.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/random.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace simulator {
+
+void ImportanceSplittingResult::printToStream(std::ostream& out) const {
+    double seconds = static_cast<double>(std::max<uint64_t>(timeInMilliseconds, 1)) / 1000.0;
+    out << "\nImportance splitting statistics:\n";
+    out << "Estimate: " << estimate << " (confidence interval [" << lowerBound << ", " << upperBound << "])\n";
+    out << "Levels: " << levelProbabilities.size() << '\n';
+    out << "Threads: " << numberOfThreads << '\n';
+    out << "Sampled paths: " << numberOfPaths << " (" << numberOfTruncatedPaths << " truncated)\n";
+    out << "Simulated steps: " << numberOfSteps << '\n';
+    out << "Time: " << timeInMilliseconds << "ms\n";
+    out << "Throughput: " << static_cast<uint64_t>(numberOfSteps / seconds) << " steps/s\n";
+}
+
+template<typename SimulatorType>
+ImportanceSplittingEstimator<SimulatorType>::ImportanceSplittingEstimator(RareEvent<SimulatorType> const& event, ImportanceSplittingOptions const& options)
+    : event(event), options(options) {
+    STORM_LOG_THROW(options.effort > 0 && options.replications > 1, storm::exceptions::InvalidArgumentException,
+                    "Importance splitting needs a positive effort and at least two replications.");
+    STORM_LOG_THROW(options.confidence > 0.0 && options.confidence < 1.0, storm::exceptions::InvalidArgumentException,
+                    "The confidence has to be in (0,1).");
+}
+
+template<typename SimulatorType>
+ImportanceSplittingResult ImportanceSplittingEstimator<SimulatorType>::estimate(storm::Environment const& env) const {
+    storm::utility::Stopwatch watch(true);
+#ifdef STORM_HAVE_INTELTBB
+    uint64_t numberOfWorkers = std::min<uint64_t>(std::max<uint64_t>(1, env.parallel().getNumberOfThreads()), options.replications);
+#else
+    uint64_t numberOfWorkers = 1;
+#endif
+    // The last level is the one of the target states.
+    uint64_t const numberOfLevels = event.maximalImportance + 1;
+    std::vector<std::vector<double>> levelProbabilities(options.replications, std::vector<double>(numberOfLevels, 0.0));
+    std::vector<ImportanceSplittingResult> workerStatistics(numberOfWorkers);
+
+    // Worker w runs the replications w, w + numberOfWorkers, ... Each replication has its own seed.
+    auto runWorker = [&](uint64_t worker) {
+        std::unique_ptr<SimulatorType> simulator = event.createSimulator();
+        for (uint64_t replication = worker; replication < options.replications; replication += numberOfWorkers) {
+            simulator->setSeed(storm::utility::deriveSeed(options.seed, replication));
+            runReplication(*simulator, levelProbabilities[replication], workerStatistics[worker]);
+        }
+    };
+
+#ifdef STORM_HAVE_INTELTBB
+    storm::utility::parallel::executeWithThreadLimit(numberOfWorkers, [&]() {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfWorkers, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t worker = range.begin(); worker < range.end(); ++worker) {
+                runWorker(worker);
+            }
+        });
+    });
+#else
+    runWorker(0);
+#endif
+
+    ImportanceSplittingResult result;
+    result.numberOfThreads = numberOfWorkers;
+    for (auto const& statistics : workerStatistics) {
+        result.numberOfPaths += statistics.numberOfPaths;
+        result.numberOfSteps += statistics.numberOfSteps;
+        result.numberOfTruncatedPaths += statistics.numberOfTruncatedPaths;
+    }
+
+    // The estimates of the replications are independent and unbiased, so the confidence interval is obtained from the
+    // central limit theorem.
+    result.levelProbabilities.assign(numberOfLevels, 0.0);
+    double sumOfSquares = 0.0;
+    for (auto const& replicationProbabilities : levelProbabilities) {
+        double replicationEstimate = 1.0;
+        for (uint64_t level = 0; level < numberOfLevels; ++level) {
+            replicationEstimate *= replicationProbabilities[level];
+            result.levelProbabilities[level] += replicationProbabilities[level] / options.replications;
+        }
+        result.estimate += replicationEstimate;
+        sumOfSquares += replicationEstimate * replicationEstimate;
+    }
+    uint64_t const n = options.replications;
+    result.estimate /= n;
+    double variance = std::max(0.0, (sumOfSquares - n * result.estimate * result.estimate) / (n - 1));
+    double halfWidth = std::sqrt(2.0) * boost::math::erf_inv(options.confidence) * std::sqrt(variance / n);
+    result.lowerBound = std::max(0.0, result.estimate - halfWidth);
+    result.upperBound = std::min(1.0, result.estimate + halfWidth);
+    result.timeInMilliseconds = watch.getTimeInMilliseconds();
+
+    STORM_LOG_WARN_COND(result.numberOfTruncatedPaths == 0, result.numberOfTruncatedPaths << " sampled paths were truncated after "
+                                                                                          << options.maximalPathLength << " steps. The result may be imprecise.");
+    return result;
+}
+
+template<typename SimulatorType>
+void ImportanceSplittingEstimator<SimulatorType>::runReplication(SimulatorType& simulator, std::vector<double>& levelProbabilities,
+                                                                 ImportanceSplittingResult& statistics) const {
+    typedef typename std::decay<decltype(simulator.getCurrentState())>::type StateType;
+    // The states in which paths entered the current level, together with the number of steps taken until then.
+    std::vector<std::pair<StateType, uint64_t>> entranceStates, nextEntranceStates;
+    simulator.resetToInitial();
+    entranceStates.emplace_back(simulator.getCurrentState(), 0);
+
+    for (uint64_t level = 1; level <= levelProbabilities.size(); ++level) {
+        bool const isTargetLevel = level == levelProbabilities.size();
+        nextEntranceStates.clear();
+        for (uint64_t path = 0; path < options.effort; ++path) {
+            auto const& entrance = entranceStates[path % entranceStates.size()];
+            simulator.resetToState(entrance.first);
+            uint64_t steps = entrance.second;
+            for (uint64_t pathSteps = 0;; ++pathSteps) {
+                if (event.isTarget(simulator) || (!isTargetLevel && event.importance(simulator) >= level)) {
+                    nextEntranceStates.emplace_back(simulator.getCurrentState(), steps);
+                    break;
+                }
+                if (event.isFailure(simulator, steps) || (event.stepBound && steps >= event.stepBound.get())) {
+                    break;
+                }
+                if (pathSteps == options.maximalPathLength) {
+                    ++statistics.numberOfTruncatedPaths;
+                    break;
+                }
+                simulator.step(0);
+                ++steps;
+                ++statistics.numberOfSteps;
+            }
+        }
+        statistics.numberOfPaths += options.effort;
+        levelProbabilities[level - 1] = static_cast<double>(nextEntranceStates.size()) / options.effort;
+        if (nextEntranceStates.empty()) {
+            // The remaining levels are not reached, so their probabilities stay zero.
+            return;
+        }
+        std::swap(entranceStates, nextEntranceStates);
+    }
+}
+
+RareEvent<DiscreteTimeSparseModelSimulator<double, storm::models::sparse::StandardRewardModel<double>>> createRareEvent(
+    std::shared_ptr<storm::models::sparse::Model<double>> const& model, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, boost::optional<uint64_t> const& stepBound, boost::optional<std::vector<uint64_t>> const& importance) {
+    typedef DiscreteTimeSparseModelSimulator<double, storm::models::sparse::StandardRewardModel<double>> SimulatorType;
+    STORM_LOG_THROW(model->getType() == storm::models::ModelType::Dtmc, storm::exceptions::NotSupportedException,
+                    "Importance splitting is only supported for DTMCs.");
+
+    auto backwardTransitions = model->getBackwardTransitions();
+    storm::storage::BitVector relevantStates = stepBound ? storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates, true, stepBound.get())
+                                                         : storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates);
+    std::vector<uint_fast64_t> distances = storm::utility::graph::getDistances(backwardTransitions, psiStates, relevantStates);
+    uint64_t const initialState = *model->getInitialStates().begin();
+
+    auto stateImportance = std::make_shared<std::vector<uint64_t>>(model->getNumberOfStates(), 0);
+    uint64_t maximalImportance = 0;
+    if (importance) {
+        STORM_LOG_THROW(importance->size() == model->getNumberOfStates(), storm::exceptions::InvalidArgumentException,
+                        "The importance function needs one value per state.");
+        *stateImportance = importance.get();
+        for (auto state : psiStates) {
+            maximalImportance = std::max(maximalImportance, (*stateImportance)[state]);
+        }
+    } else if (relevantStates.get(initialState)) {
+        maximalImportance = distances[initialState];
+        for (auto state : relevantStates) {
+            (*stateImportance)[state] = maximalImportance - std::min<uint64_t>(distances[state], maximalImportance);
+        }
+    }
+
+    RareEvent<SimulatorType> event;
+    auto prototype = std::make_shared<SimulatorType>(*model);
+    // The simulators are copies of a prototype such that the sampling tables are built only once. The model is kept alive by the functions.
+    event.createSimulator = [model, prototype]() { return std::make_unique<SimulatorType>(*prototype); };
+    event.maximalImportance = maximalImportance;
+    event.importance = [stateImportance, maximalImportance](SimulatorType const& simulator) {
+        return std::min((*stateImportance)[simulator.getCurrentState()], maximalImportance);
+    };
+    event.isTarget = [psiStates](SimulatorType const& simulator) { return psiStates.get(simulator.getCurrentState()); };
+    auto distancesPointer = std::make_shared<std::vector<uint_fast64_t>>(std::move(distances));
+    event.isFailure = [relevantStates, distancesPointer, stepBound](SimulatorType const& simulator, uint64_t steps) {
+        uint64_t state = simulator.getCurrentState();
+        return !relevantStates.get(state) || (stepBound && steps + (*distancesPointer)[state] > stepBound.get());
+    };
+    event.stepBound = stepBound;
+    return event;
+}
+
+RareEvent<DiscreteTimePrismProgramSimulator<double>> createRareEvent(storm::prism::Program const& program, storm::expressions::Expression const& condition,
+                                                                     storm::expressions::Expression const& target, storm::expressions::Expression const& importance,
+                                                                     uint64_t maximalImportance, boost::optional<uint64_t> const& stepBound) {
+    typedef DiscreteTimePrismProgramSimulator<double> SimulatorType;
+    STORM_LOG_THROW(program.getModelType() == storm::prism::Program::ModelType::DTMC, storm::exceptions::NotSupportedException,
+                    "Importance splitting is only supported for DTMCs.");
+    STORM_LOG_THROW(importance.hasIntegerType(), storm::exceptions::InvalidArgumentException, "The importance function has to be an integer expression.");
+
+    RareEvent<SimulatorType> event;
+    auto preparedProgram = std::make_shared<storm::prism::Program>(program.substituteConstantsFormulas());
+    event.createSimulator = [preparedProgram]() { return std::make_unique<SimulatorType>(*preparedProgram, storm::generator::NextStateGeneratorOptions()); };
+    event.maximalImportance = maximalImportance;
+    event.importance = [importance, maximalImportance](SimulatorType const& simulator) {
+        int64_t value = simulator.evaluateIntegerExpression(importance);
+        return static_cast<uint64_t>(std::max<int64_t>(0, std::min<int64_t>(value, maximalImportance)));
+    };
+    event.isTarget = [target](SimulatorType const& simulator) { return simulator.evaluateBooleanExpression(target); };
+    event.isFailure = [condition](SimulatorType const& simulator, uint64_t) {
+        return !simulator.evaluateBooleanExpression(condition) || simulator.isSinkState();
+    };
+    event.stepBound = stepBound;
+    return event;
+}
+
+template class ImportanceSplittingEstimator<DiscreteTimeSparseModelSimulator<double, storm::models::sparse::StandardRewardModel<double>>>;
+template class ImportanceSplittingEstimator<DiscreteTimePrismProgramSimulator<double>>;
+
+}  // namespace simulator
+}  // namespace storm
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/prism/Program.h"
+
+namespace storm {
+
+class Environment;
+
+namespace simulator {
+
+template<typename ValueType, typename RewardModelType>
+class DiscreteTimeSparseModelSimulator;
+template<typename ValueType>
+class DiscreteTimePrismProgramSimulator;
+
+/**
+ * Describes a rare event, i.e. reaching target states (within a step bound) before a failure, together with an
+ * importance function that guides the splitting towards the target.
+ */
+template<typename SimulatorType>
+struct RareEvent {
+    /// Creates a simulator in the initial state. It is called once per thread.
+    std::function<std::unique_ptr<SimulatorType>()> createSimulator;
+    /// The importance of the current state of the simulator, which is at most the maximal importance.
+    std::function<uint64_t(SimulatorType const&)> importance;
+    /// The importance of target states.
+    uint64_t maximalImportance = 0;
+    /// Whether the current state of the simulator is a target state.
+    std::function<bool(SimulatorType const&)> isTarget;
+    /// Whether a path in the current state of the simulator, after the given number of steps, can no longer reach a target state.
+    std::function<bool(SimulatorType const&, uint64_t)> isFailure;
+    /// If set, target states have to be reached within this number of steps.
+    boost::optional<uint64_t> stepBound;
+};
+
+struct ImportanceSplittingOptions {
+    /// The number of paths that are started at each level of a replication.
+    uint64_t effort = 1000;
+    /// The number of independent replications from which the confidence interval is obtained.
+    uint64_t replications = 32;
+    /// The confidence of the confidence interval.
+    double confidence = 0.95;
+    /// The maximal length of paths (of a single level) whose length is not bounded by the event.
+    uint64_t maximalPathLength = 100000;
+    /// The seed from which the seeds of the replications are derived.
+    uint64_t seed = 0;
+};
+
+struct ImportanceSplittingResult {
+    void printToStream(std::ostream& out) const;
+
+    /// The estimated probability of the event.
+    double estimate = 0.0;
+    /// The bounds of the confidence interval.
+    double lowerBound = 0.0;
+    double upperBound = 0.0;
+    /// The mean conditional probability of reaching each level from the previous one.
+    std::vector<double> levelProbabilities;
+
+    uint64_t numberOfThreads = 0;
+    uint64_t numberOfPaths = 0;
+    uint64_t numberOfSteps = 0;
+    uint64_t numberOfTruncatedPaths = 0;
+    uint64_t timeInMilliseconds = 0;
+};
+
+/**
+ * Estimates the probability of rare events by fixed-effort importance splitting. The importance levels 1, ..., m
+ * (where m is the maximal importance) are crossed one after another: At each level, a fixed number of paths is started
+ * from the states in which the paths of the previous level entered the level (in round-robin order). A path stops
+ * once it enters the next level, reaches a target state, or fails. The product of the fractions of successful paths
+ * estimates the probability of the event. The replications are run in parallel (see the parallel environment), each
+ * with its own random number stream, so that the result does not depend on the number of threads.
+ */
+template<typename SimulatorType>
+class ImportanceSplittingEstimator {
+   public:
+    ImportanceSplittingEstimator(RareEvent<SimulatorType> const& event, ImportanceSplittingOptions const& options = ImportanceSplittingOptions());
+
+    ImportanceSplittingResult estimate(storm::Environment const& env) const;
+
+   private:
+    /**
+     * Runs a single replication with the given simulator and stores the conditional probabilities of the levels.
+     */
+    void runReplication(SimulatorType& simulator, std::vector<double>& levelProbabilities, ImportanceSplittingResult& statistics) const;
+
+    RareEvent<SimulatorType> event;
+    ImportanceSplittingOptions options;
+};
+
+/**
+ * Creates the event of reaching psi-states via phi-states in the given DTMC. If no importance is given, the importance
+ * of a state is derived from its graph distance to the psi-states, i.e. it is the distance of the initial state minus
+ * the distance of the state.
+ */
+RareEvent<DiscreteTimeSparseModelSimulator<double, storm::models::sparse::StandardRewardModel<double>>> createRareEvent(
+    std::shared_ptr<storm::models::sparse::Model<double>> const& model, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, boost::optional<uint64_t> const& stepBound = boost::none,
+    boost::optional<std::vector<uint64_t>> const& importance = boost::none);
+
+/**
+ * Creates the event of reaching target states via states satisfying the condition in the given (DTMC) program. The
+ * importance is given as an integer expression over the program variables, whose values are clamped to [0, maximalImportance].
+ */
+RareEvent<DiscreteTimePrismProgramSimulator<double>> createRareEvent(storm::prism::Program const& program, storm::expressions::Expression const& condition,
+                                                                     storm::expressions::Expression const& target, storm::expressions::Expression const& importance,
+                                                                     uint64_t maximalImportance, boost::optional<uint64_t> const& stepBound = boost::none);
+
+}  // namespace simulator
+}  // namespace storm
@@ -57,6 +57,25 @@ class DiscreteTimePrismProgramSimulator {
      * @return A vector with te number of rewards.
      */
     std::vector<ValueType> const& getLastRewards() const;
+    /**
+     * Accessor for the state rewards of the current state (without the reward of the last action).
+     * @return A vector with the number of rewards.
+     */
+    std::vector<ValueType> const& getCurrentStateRewards() const;
+    /**
+     * Evaluates the given boolean expression in the current state.
+     *
+     * @param expression The expression, which may only refer to variables of the program.
+     * @return true, if the expression holds in the current state.
+     */
+    bool evaluateBooleanExpression(storm::expressions::Expression const& expression) const;
+    /**
+     * Evaluates the given integer expression in the current state.
+     *
+     * @param expression The expression, which may only refer to variables of the program.
+     * @return The value of the expression in the current state.
+     */
+    int64_t evaluateIntegerExpression(storm::expressions::Expression const& expression) const;
     generator::CompressedState const& getCurrentState() const;
     expressions::SimpleValuation getCurrentStateAsValuation() const;
     std::vector<std::string> getCurrentStateLabelling() const;
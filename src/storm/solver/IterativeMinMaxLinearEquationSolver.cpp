@@ -507,12 +507,19 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsValueIteratio
     std::vector<ValueType>* newX = auxiliaryRowGroupVector.get();
     std::vector<ValueType>* currentX = &x;
 
+    // If the solver owns the matrix, the multiplier may keep it only in compact form while iterating.
+    bool const matrixTaken = this->localA && this->multiplierA->takeMatrix(env, *this->localA);
+
     this->startMeasureProgress();
     ValueIterationResult result =
         performValueIteration(env, dir, currentX, newX, b, storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()),
                               env.solver().minMax().getRelativeTerminationCriterion(), guarantee, 0, env.solver().minMax().getMaximalNumberOfIterations(),
                               env.solver().minMax().getMultiplicationStyle());
 
+    if (matrixTaken) {
+        this->multiplierA->restoreMatrix(*this->localA);
+    }
+
     // Swap the result into the output x.
     if (currentX == auxiliaryRowGroupVector.get()) {
         std::swap(x, *currentX);
@@ -372,6 +372,9 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsPower(Environment cons
     }
     std::vector<ValueType>* newX = this->cachedRowVector.get();
 
+    // If the solver owns the matrix, the multiplier may keep it only in compact form while iterating.
+    bool const matrixTaken = localA && this->multiplier->takeMatrix(env, *localA);
+
     // Forward call to power iteration implementation.
     this->startMeasureProgress();
     ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
@@ -379,6 +382,10 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsPower(Environment cons
         this->performPowerIteration(env, currentX, newX, b, precision, env.solver().native().getRelativeTerminationCriterion(), guarantee, 0,
                                     env.solver().native().getMaximalNumberOfIterations(), env.solver().native().getPowerMethodMultiplicationStyle());
 
+    if (matrixTaken) {
+        this->multiplier->restoreMatrix(*localA);
+    }
+
     // Swap the result in place.
     if (currentX == this->cachedRowVector.get()) {
         std::swap(x, *newX);
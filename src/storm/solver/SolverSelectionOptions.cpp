@@ -36,6 +36,8 @@ std::string toString(MultiplierType t) {
             return "Native";
         case MultiplierType::Gmmxx:
             return "Gmmxx";
+        case MultiplierType::Simd:
+            return "Simd";
     }
     return "invalid";
 }
@@ -68,7 +68,7 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
     if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
         STORM_LOG_TRACE("Creating SCC decomposition.");
         storm::utility::Stopwatch sccSw(true);
-        createSortedSccDecomposition(needAdaptPrecision);
+        createSortedSccDecomposition(env, needAdaptPrecision);
         sccSw.stop();
         STORM_LOG_INFO("SCC decomposition computed in "
                        << sccSw << ". Found " << this->sortedSccDecomposition->size() << " SCC(s) containing a total of " << x.size()
@@ -123,10 +123,10 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
 }
 
 template<typename ValueType>
-void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize) const {
+void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(storm::Environment const& env, bool needLongestChainSize) const {
     // Obtain the scc decomposition
     this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(
-        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
+        env, *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
     if (needLongestChainSize) {
         this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
     }
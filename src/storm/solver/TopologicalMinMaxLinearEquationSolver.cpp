@@ -60,7 +60,7 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(En
     if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
         STORM_LOG_TRACE("Creating SCC decomposition.");
         storm::utility::Stopwatch sccSw(true);
-        createSortedSccDecomposition(needAdaptPrecision);
+        createSortedSccDecomposition(env, needAdaptPrecision);
         sccSw.stop();
         STORM_LOG_INFO("SCC decomposition computed in "
                        << sccSw << ". Found " << this->sortedSccDecomposition->size() << " SCC(s) containing a total of " << x.size()
@@ -144,10 +144,10 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(En
 }
 
 template<typename ValueType>
-void TopologicalMinMaxLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize) const {
+void TopologicalMinMaxLinearEquationSolver<ValueType>::createSortedSccDecomposition(storm::Environment const& env, bool needLongestChainSize) const {
     // Obtain the scc decomposition
     this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(
-        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
+        env, *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
     if (needLongestChainSize) {
         this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
     }
@@ -34,7 +34,7 @@ class TopologicalMinMaxLinearEquationSolver : public StandardMinMaxLinearEquatio
     storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
 
     // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
-    void createSortedSccDecomposition(bool needLongestChainSize) const;
+    void createSortedSccDecomposition(storm::Environment const& env, bool needLongestChainSize) const;
 
     // Solves the SCC with the given index
     // ... for the case that the SCC is trivial
@@ -0,0 +1,144 @@
+#include "storm/solver/helper/BatchValueIterationHelper.h"
+
+#include <algorithm>
+
+#include "storm-config.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/solver/SolverSelectionOptions.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/ProgressMeasurement.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/vector.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+template<typename ValueType>
+BatchValueIterationHelper<ValueType>::BatchValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix) : matrix(matrix) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+std::pair<SolverStatus, uint64_t> BatchValueIterationHelper<ValueType>::solveEquations(Environment const& env, std::vector<std::vector<ValueType>>& x,
+                                                                                       std::vector<std::vector<ValueType>> const& b, bool relative,
+                                                                                       ValueType const& precision, uint64_t maxIterations,
+                                                                                       boost::optional<storm::solver::OptimizationDirection> const& dir,
+                                                                                       std::vector<std::vector<uint_fast64_t>>* choices) const {
+    STORM_LOG_THROW(dir.is_initialized() || matrix.hasTrivialRowGrouping(), storm::exceptions::InvalidArgumentException,
+                    "An optimization direction is required for matrices with nondeterminism.");
+    STORM_LOG_THROW(dir.is_initialized() || choices == nullptr, storm::exceptions::InvalidArgumentException,
+                    "Choices can only be tracked if an optimization direction is given.");
+    return performValueIteration(env, matrix, x, b, relative, precision, maxIterations, dir, choices);
+}
+
+template<typename ValueType>
+std::pair<SolverStatus, uint64_t> BatchValueIterationHelper<ValueType>::solveEquationsWithScheduler(
+    Environment const& env, std::vector<uint_fast64_t> const& scheduler, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b,
+    bool relative, ValueType const& precision, uint64_t maxIterations) const {
+    STORM_LOG_THROW(scheduler.size() == matrix.getRowGroupCount(), storm::exceptions::InvalidArgumentException, "The scheduler has an unexpected size.");
+
+    // Build the matrix and the vectors induced by the scheduler.
+    storm::storage::SparseMatrix<ValueType> inducedMatrix = matrix.selectRowsFromRowGroups(scheduler, false);
+    std::vector<std::vector<ValueType>> inducedB;
+    inducedB.reserve(b.size());
+    for (auto const& bi : b) {
+        inducedB.emplace_back(matrix.getRowGroupCount());
+        storm::utility::vector::selectVectorValues(inducedB.back(), scheduler, matrix.getRowGroupIndices(), bi);
+    }
+    return performValueIteration(env, inducedMatrix, x, inducedB, relative, precision, maxIterations, boost::none, nullptr);
+}
+
+template<typename ValueType>
+bool BatchValueIterationHelper<ValueType>::isCompatibleWithLinearEquationSolver(Environment const& env) {
+    return !storm::NumberTraits<ValueType>::IsExact && !env.solver().isForceExact() && !env.solver().isForceSoundness() &&
+           env.solver().getLinearEquationSolverType() == storm::solver::EquationSolverType::Native &&
+           env.solver().native().getMethod() == storm::solver::NativeLinearEquationSolverMethod::Power;
+}
+
+template<typename ValueType>
+std::pair<SolverStatus, uint64_t> BatchValueIterationHelper<ValueType>::performValueIteration(
+    Environment const& env, storm::storage::SparseMatrix<ValueType> const& A, std::vector<std::vector<ValueType>>& x,
+    std::vector<std::vector<ValueType>> const& b, bool relative, ValueType const& precision, uint64_t maxIterations,
+    boost::optional<storm::solver::OptimizationDirection> const& dir, std::vector<std::vector<uint_fast64_t>>* choices) const {
+    STORM_LOG_THROW(x.size() == b.size(), storm::exceptions::InvalidArgumentException, "The number of solution vectors and offset vectors differ.");
+    uint64_t const numberOfVectors = x.size();
+    if (numberOfVectors == 0) {
+        return {SolverStatus::Converged, 0};
+    }
+
+    // Bring the vectors into the interleaved representation.
+    std::vector<ValueType> currentX = interleave(x);
+    std::vector<ValueType> const interleavedB = interleave(b);
+    std::vector<ValueType> newX(currentX.size());
+    std::vector<uint_fast64_t> interleavedChoices;
+    if (choices) {
+        choices->resize(numberOfVectors);
+        for (auto& choicesOfVector : *choices) {
+            choicesOfVector.resize(A.getRowGroupCount(), 0);
+        }
+        interleavedChoices = interleave(*choices);
+    }
+
+    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, A);
+    std::vector<bool> converged(numberOfVectors, false);
+    uint64_t iterations = 0;
+    SolverStatus status = SolverStatus::InProgress;
+    storm::utility::ProgressMeasurement progress("iterations");
+    progress.startNewMeasurement(0);
+    while (status == SolverStatus::InProgress) {
+        // Compute x_i' = A*x_i + b_i (resp. x_i' = min/max(A*x_i + b_i)) for all vectors in a single pass over the matrix.
+        if (dir) {
+            multiplier->multiplyAndReduceBatch(env, dir.get(), A.getRowGroupIndices(), numberOfVectors, currentX, &interleavedB, newX,
+                                               choices ? &interleavedChoices : nullptr);
+        } else {
+            multiplier->multiplyBatch(env, numberOfVectors, currentX, &interleavedB, newX);
+        }
+        ++iterations;
+
+        // Determine which vectors converged.
+        std::fill(converged.begin(), converged.end(), true);
+        for (uint64_t index = 0; index < newX.size(); ++index) {
+            uint64_t const vectorIndex = index % numberOfVectors;
+            if (converged[vectorIndex] && !storm::utility::vector::equalModuloPrecision(currentX[index], newX[index], precision, relative)) {
+                converged[vectorIndex] = false;
+            }
+        }
+        std::swap(currentX, newX);
+
+        if (std::all_of(converged.begin(), converged.end(), [](bool c) { return c; })) {
+            status = SolverStatus::Converged;
+        } else if (iterations >= maxIterations) {
+            status = SolverStatus::MaximalIterationsExceeded;
+        } else if (storm::utility::resources::isTerminate()) {
+            status = SolverStatus::Aborted;
+        }
+        progress.updateProgress(iterations);
+    }
+
+    deinterleave(currentX, x);
+    if (choices) {
+        deinterleave(interleavedChoices, *choices);
+    }
+    STORM_LOG_INFO("Batch value iteration for " << numberOfVectors << " vectors terminated after " << iterations << " iterations (status: " << status
+                                                << ").");
+    return {status, iterations};
+}
+
+template class BatchValueIterationHelper<double>;
+#ifdef STORM_HAVE_CARL
+template class BatchValueIterationHelper<storm::RationalNumber>;
+#endif
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
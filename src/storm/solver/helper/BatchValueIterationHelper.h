@@ -0,0 +1,113 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <memory>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolverStatus.h"
+#include "storm/solver/multiplier/Multiplier.h"
+
+namespace storm {
+class Environment;
+
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+}
+
+namespace solver {
+namespace helper {
+
+/*!
+ * Performs value iteration for a batch of k equation systems x_i = A*x_i + b_i (or x_i = min/max(A*x_i + b_i)) that
+ * share the same matrix A. The k value vectors are stored interleaved such that each iteration traverses the matrix only
+ * once (instead of k times). This is useful when checking several properties on the same model. Each iteration is
+ * performed in parallel if the environment asks for it.
+ */
+template<typename ValueType>
+class BatchValueIterationHelper {
+   public:
+    BatchValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+    /*!
+     * @param env The environment (used to create the multiplier)
+     * @param x The initial values of the k vectors. After the call, these hold the solutions.
+     * @param b The values added to each matrix row (the b_i in A*x_i+b_i), one vector for each x_i
+     * @param relative Whether the convergence criterion is relative
+     * @param precision The precision used to determine convergence
+     * @param maxIterations The maximal number of iterations
+     * @param dir The optimization direction (the same for all vectors). If not given, the matrix must not have nondeterminism,
+     *            e.g. because it stems from a DTMC or from an MDP under a fixed scheduler (see solveEquationsWithScheduler).
+     * @param choices If given, the choices made in the last iteration are written to this vector (one vector of choices for each x_i).
+     * The choices are only changed if a strictly better choice was found. Requires an optimization direction.
+     * @return The status upon termination as well as the number of iterations. Iterations continue until all k vectors have converged.
+     */
+    std::pair<SolverStatus, uint64_t> solveEquations(Environment const& env, std::vector<std::vector<ValueType>>& x,
+                                                     std::vector<std::vector<ValueType>> const& b, bool relative, ValueType const& precision,
+                                                     uint64_t maxIterations, boost::optional<storm::solver::OptimizationDirection> const& dir = boost::none,
+                                                     std::vector<std::vector<uint_fast64_t>>* choices = nullptr) const;
+
+    /*!
+     * Solves the equation systems for the matrix (and the vectors b_i) that are induced by fixing the given scheduler,
+     * i.e., by selecting the row scheduler[j] in every row group j. The vectors b_i have one entry per row of the original matrix.
+     */
+    std::pair<SolverStatus, uint64_t> solveEquationsWithScheduler(Environment const& env, std::vector<uint_fast64_t> const& scheduler,
+                                                                  std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b,
+                                                                  bool relative, ValueType const& precision, uint64_t maxIterations) const;
+
+    /*!
+     * Retrieves whether the linear equation solver selected in the given environment performs plain (i.e., neither
+     * sound nor exact) value iteration. In this case, equation systems that would be passed to that solver may as well
+     * be solved by this helper, using the precision, termination criterion and iteration limit of the native solver.
+     */
+    static bool isCompatibleWithLinearEquationSolver(Environment const& env);
+
+    /*!
+     * Converts the given (equally sized) vectors into the interleaved representation, i.e., the j-th entry of the i-th
+     * vector is stored at position j * k + i.
+     */
+    template<typename T>
+    static std::vector<T> interleave(std::vector<std::vector<T>> const& vectors) {
+        std::vector<T> result;
+        if (vectors.empty()) {
+            return result;
+        }
+        uint64_t const numberOfVectors = vectors.size();
+        uint64_t const size = vectors.front().size();
+        result.reserve(numberOfVectors * size);
+        for (uint64_t j = 0; j < size; ++j) {
+            for (uint64_t i = 0; i < numberOfVectors; ++i) {
+                result.push_back(vectors[i][j]);
+            }
+        }
+        return result;
+    }
+
+    /*!
+     * Converts the given interleaved representation back to the vectors. The number of vectors is taken from the size of the given vectors.
+     */
+    template<typename T>
+    static void deinterleave(std::vector<T> const& interleaved, std::vector<std::vector<T>>& vectors) {
+        uint64_t const numberOfVectors = vectors.size();
+        for (uint64_t i = 0; i < numberOfVectors; ++i) {
+            vectors[i].resize(interleaved.size() / numberOfVectors);
+            for (uint64_t j = 0; j < vectors[i].size(); ++j) {
+                vectors[i][j] = interleaved[j * numberOfVectors + i];
+            }
+        }
+    }
+
+   private:
+    std::pair<SolverStatus, uint64_t> performValueIteration(Environment const& env, storm::storage::SparseMatrix<ValueType> const& A,
+                                                            std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b,
+                                                            bool relative, ValueType const& precision, uint64_t maxIterations,
+                                                            boost::optional<storm::solver::OptimizationDirection> const& dir,
+                                                            std::vector<std::vector<uint_fast64_t>>* choices) const;
+
+    storm::storage::SparseMatrix<ValueType> const& matrix;
+};
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
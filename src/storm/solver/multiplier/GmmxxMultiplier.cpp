@@ -3,14 +3,14 @@
 #include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
-#include "storm/settings/SettingsManager.h"
-#include "storm/settings/modules/CoreSettings.h"
+#include "storm/environment/ParallelEnvironment.h"
 #include "storm/storage/SparseMatrix.h"
 
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/constants.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace solver {
@@ -35,11 +35,7 @@ void GmmxxMultiplier<ValueType>::clearCache() const {
 
 template<typename ValueType>
 bool GmmxxMultiplier<ValueType>::parallelize(Environment const& env) const {
-#ifdef STORM_HAVE_INTELTBB
-    return storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
-#else
-    return false;
-#endif
+    return env.parallel().isParallel();
 }
 
 template<typename ValueType>
@@ -56,7 +52,7 @@ void GmmxxMultiplier<ValueType>::multiply(Environment const& env, std::vector<Va
         target = this->cachedVector.get();
     }
     if (parallelize(env)) {
-        multAddParallel(x, b, *target);
+        storm::utility::parallel::executeWithThreadLimit(env, [&]() { multAddParallel(x, b, *target); });
     } else {
         multAdd(x, b, *target);
     }
@@ -99,7 +95,7 @@ void GmmxxMultiplier<ValueType>::multiplyAndReduce(Environment const& env, Optim
         target = this->cachedVector.get();
     }
     if (parallelize(env)) {
-        multAddReduceParallel(dir, rowGroupIndices, x, b, *target, choices);
+        storm::utility::parallel::executeWithThreadLimit(env, [&]() { multAddReduceParallel(dir, rowGroupIndices, x, b, *target, choices); });
     } else {
         multAddReduceHelper(dir, rowGroupIndices, x, b, *target, choices, false);
     }
@@ -10,35 +10,273 @@
 #include "NativeMultiplier.h"
 #include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/multiplier/GmmxxMultiplier.h"
+#include "storm/solver/multiplier/SimdMultiplier.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace solver {
 
 template<typename ValueType>
-Multiplier<ValueType>::Multiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : matrix(matrix) {
+Multiplier<ValueType>::Multiplier(storm::storage::SparseMatrix<ValueType> const& matrix)
+    : compactMatrixNotApplicable(false), matrixTaken(false), matrix(matrix) {
     // Intentionally left empty.
 }
 
 template<typename ValueType>
 void Multiplier<ValueType>::clearCache() const {
     cachedVector.reset();
+    // While the matrix is moved into the compact matrix, the compact matrix is the only representation of the matrix.
+    if (!matrixTaken) {
+        compactMatrix.reset();
+    }
+}
+
+template<typename ValueType>
+bool Multiplier<ValueType>::takeMatrix(Environment const& env, storm::storage::SparseMatrix<ValueType>& ownedMatrix) {
+    STORM_LOG_ASSERT(&ownedMatrix == &this->matrix, "The given matrix is not the matrix of this multiplier.");
+    STORM_LOG_ASSERT(!matrixTaken, "The matrix has already been taken.");
+    if (!usesCompactMatrix(env) || !storm::storage::CompactSparseMatrix<ValueType>::isApplicable(ownedMatrix)) {
+        return false;
+    }
+    if (compactMatrix) {
+        ownedMatrix = storm::storage::SparseMatrix<ValueType>();
+    } else {
+        compactMatrix = std::make_unique<storm::storage::CompactSparseMatrix<ValueType>>(std::move(ownedMatrix));
+    }
+    matrixTaken = true;
+    STORM_LOG_TRACE("Moved the matrix into its compact representation using " << compactMatrix->getSizeInMemory() << " bytes.");
+    return true;
+}
+
+template<typename ValueType>
+void Multiplier<ValueType>::restoreMatrix(storm::storage::SparseMatrix<ValueType>& ownedMatrix) {
+    STORM_LOG_ASSERT(&ownedMatrix == &this->matrix, "The given matrix is not the matrix of this multiplier.");
+    STORM_LOG_ASSERT(matrixTaken, "The matrix has not been taken.");
+    ownedMatrix = compactMatrix->toSparseMatrix();
+    compactMatrix.reset();
+    matrixTaken = false;
+}
+
+template<typename ValueType>
+bool Multiplier<ValueType>::usesCompactMatrix(Environment const&) const {
+    return false;
+}
+
+template<typename ValueType>
+std::vector<uint64_t> const& Multiplier<ValueType>::getRowGroupIndices() const {
+    return matrixTaken ? compactMatrix->getRowGroupIndices() : this->matrix.getRowGroupIndices();
+}
+
+template<typename ValueType>
+storm::storage::CompactSparseMatrix<ValueType> const* Multiplier<ValueType>::getCompactMatrix() const {
+    if (!compactMatrix && !compactMatrixNotApplicable) {
+        if (storm::storage::CompactSparseMatrix<ValueType>::isApplicable(this->matrix)) {
+            compactMatrix = std::make_unique<storm::storage::CompactSparseMatrix<ValueType>>(this->matrix);
+            STORM_LOG_TRACE("Created compact matrix representation using " << compactMatrix->getSizeInMemory() << " bytes.");
+        } else {
+            compactMatrixNotApplicable = true;
+        }
+    }
+    return compactMatrix.get();
 }
 
 template<typename ValueType>
 void Multiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x,
                                               std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
-    multiplyAndReduce(env, dir, this->matrix.getRowGroupIndices(), x, b, result, choices);
+    multiplyAndReduce(env, dir, getRowGroupIndices(), x, b, result, choices);
 }
 
 template<typename ValueType>
 void Multiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x,
                                                          std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
-    multiplyAndReduceGaussSeidel(env, dir, this->matrix.getRowGroupIndices(), x, b, choices, backwards);
+    multiplyAndReduceGaussSeidel(env, dir, getRowGroupIndices(), x, b, choices, backwards);
+}
+
+template<typename ValueType>
+void Multiplier<ValueType>::multiplyBatch(Environment const& env, uint64_t numberOfVectors, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                          std::vector<ValueType>& result) const {
+    uint64_t const numberOfRows = matrixTaken ? compactMatrix->getRowCount() : this->matrix.getRowCount();
+    STORM_LOG_ASSERT(x.size() == numberOfVectors * (matrixTaken ? compactMatrix->getColumnCount() : this->matrix.getColumnCount()),
+                     "Unexpected size of input vector.");
+    std::vector<ValueType>* target = &result;
+    if (&x == &result) {
+        if (this->cachedVector) {
+            this->cachedVector->resize(numberOfVectors * numberOfRows);
+        } else {
+            this->cachedVector = std::make_unique<std::vector<ValueType>>(numberOfVectors * numberOfRows);
+        }
+        target = this->cachedVector.get();
+    } else {
+        result.resize(numberOfVectors * numberOfRows);
+    }
+
+    auto multiplyRows = [&](uint64_t firstRow, uint64_t lastRow) {
+        for (uint64_t row = firstRow; row < lastRow; ++row) {
+            multiplyRowBatch(row, numberOfVectors, x, b, target->data() + row * numberOfVectors);
+        }
+    };
+    if (env.parallel().isParallel()) {
+#ifdef STORM_HAVE_INTELTBB
+        storm::utility::parallel::executeWithThreadLimit(env, [&]() {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfRows, 100),
+                              [&](tbb::blocked_range<uint64_t> const& range) { multiplyRows(range.begin(), range.end()); });
+        });
+#else
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+        multiplyRows(0, numberOfRows);
+#endif
+    } else {
+        multiplyRows(0, numberOfRows);
+    }
+
+    if (&x == &result) {
+        std::swap(result, *this->cachedVector);
+    }
+}
+
+template<typename ValueType>
+void Multiplier<ValueType>::multiplyAndReduceBatch(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                   uint64_t numberOfVectors, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                                   std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+    STORM_LOG_ASSERT(x.size() == numberOfVectors * (matrixTaken ? compactMatrix->getColumnCount() : this->matrix.getColumnCount()),
+                     "Unexpected size of input vector.");
+    uint64_t const numberOfGroups = rowGroupIndices.size() - 1;
+    std::vector<ValueType>* target = &result;
+    if (&x == &result) {
+        if (this->cachedVector) {
+            this->cachedVector->resize(numberOfVectors * numberOfGroups);
+        } else {
+            this->cachedVector = std::make_unique<std::vector<ValueType>>(numberOfVectors * numberOfGroups);
+        }
+        target = this->cachedVector.get();
+    } else {
+        result.resize(numberOfVectors * numberOfGroups);
+    }
+
+    auto multiplyAndReduceGroups = [&](uint64_t firstGroup, uint64_t lastGroup) {
+        if (dir == storm::OptimizationDirection::Minimize) {
+            multAddReduceBatch<storm::utility::ElementLess<ValueType>>(rowGroupIndices, numberOfVectors, x, b, *target, choices, firstGroup, lastGroup);
+        } else {
+            multAddReduceBatch<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, numberOfVectors, x, b, *target, choices, firstGroup, lastGroup);
+        }
+    };
+    if (env.parallel().isParallel()) {
+#ifdef STORM_HAVE_INTELTBB
+        storm::utility::parallel::executeWithThreadLimit(env, [&]() {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfGroups, 100),
+                              [&](tbb::blocked_range<uint64_t> const& range) { multiplyAndReduceGroups(range.begin(), range.end()); });
+        });
+#else
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+        multiplyAndReduceGroups(0, numberOfGroups);
+#endif
+    } else {
+        multiplyAndReduceGroups(0, numberOfGroups);
+    }
+
+    if (&x == &result) {
+        std::swap(result, *this->cachedVector);
+    }
+}
+
+#ifdef STORM_HAVE_CARL
+template<>
+void Multiplier<storm::RationalFunction>::multiplyAndReduceBatch(Environment const&, OptimizationDirection const&, std::vector<uint64_t> const&, uint64_t,
+                                                                 std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const*,
+                                                                 std::vector<storm::RationalFunction>&, std::vector<uint_fast64_t>*) const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation not supported for this data type.");
+}
+#endif
+
+template<typename ValueType>
+void Multiplier<ValueType>::multiplyRowBatch(uint64_t row, uint64_t numberOfVectors, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                             ValueType* values) const {
+    if (b) {
+        std::copy(b->begin() + row * numberOfVectors, b->begin() + (row + 1) * numberOfVectors, values);
+    } else {
+        std::fill(values, values + numberOfVectors, storm::utility::zero<ValueType>());
+    }
+    if (matrixTaken) {
+        auto const& rowIndications = compactMatrix->getRowIndications();
+        auto const& columns = compactMatrix->getColumns();
+        auto const& matrixValues = compactMatrix->getValues();
+        for (uint64_t entry = rowIndications[row]; entry < rowIndications[row + 1]; ++entry) {
+            ValueType const* xIt = x.data() + columns[entry] * numberOfVectors;
+            for (uint64_t i = 0; i < numberOfVectors; ++i) {
+                values[i] += matrixValues[entry] * xIt[i];
+            }
+        }
+    } else {
+        for (auto const& entry : this->matrix.getRow(row)) {
+            ValueType const* xIt = x.data() + entry.getColumn() * numberOfVectors;
+            for (uint64_t i = 0; i < numberOfVectors; ++i) {
+                values[i] += entry.getValue() * xIt[i];
+            }
+        }
+    }
+}
+
+template<typename ValueType>
+template<typename Compare>
+void Multiplier<ValueType>::multAddReduceBatch(std::vector<uint64_t> const& rowGroupIndices, uint64_t numberOfVectors, std::vector<ValueType> const& x,
+                                               std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices,
+                                               uint64_t firstGroup, uint64_t lastGroup) const {
+    Compare compare;
+    // The values of the current row, the best values and selected choices so far and the values of the previously selected choices (for each vector).
+    std::vector<ValueType> rowValues(numberOfVectors), oldSelectedChoiceValues;
+    std::vector<uint64_t> selectedChoices;
+    if (choices) {
+        oldSelectedChoiceValues.resize(numberOfVectors);
+        selectedChoices.resize(numberOfVectors);
+    }
+
+    for (uint64_t group = firstGroup; group < lastGroup; ++group) {
+        uint64_t const groupStart = rowGroupIndices[group];
+        uint64_t const groupEnd = rowGroupIndices[group + 1];
+
+        // Only multiply and reduce if there is at least one row in the group.
+        if (groupStart == groupEnd) {
+            continue;
+        }
+
+        // The best values are computed directly in the result.
+        ValueType* currentValues = result.data() + group * numberOfVectors;
+        multiplyRowBatch(groupStart, numberOfVectors, x, b, currentValues);
+        if (choices) {
+            std::copy(currentValues, currentValues + numberOfVectors, oldSelectedChoiceValues.begin());
+            std::fill(selectedChoices.begin(), selectedChoices.end(), 0);
+        }
+        for (uint64_t row = groupStart + 1; row < groupEnd; ++row) {
+            multiplyRowBatch(row, numberOfVectors, x, b, rowValues.data());
+            for (uint64_t i = 0; i < numberOfVectors; ++i) {
+                if (choices && (*choices)[group * numberOfVectors + i] == row - groupStart) {
+                    oldSelectedChoiceValues[i] = rowValues[i];
+                }
+                if (compare(rowValues[i], currentValues[i])) {
+                    currentValues[i] = rowValues[i];
+                    if (choices) {
+                        selectedChoices[i] = row - groupStart;
+                    }
+                }
+            }
+        }
+
+        if (choices) {
+            // For correctly tracking choices, we only update if the new choice is strictly better than the old one.
+            for (uint64_t i = 0; i < numberOfVectors; ++i) {
+                if (compare(currentValues[i], oldSelectedChoiceValues[i])) {
+                    (*choices)[group * numberOfVectors + i] = selectedChoices[i];
+                }
+            }
+        }
+    }
 }
 
 template<typename ValueType>
@@ -102,6 +340,8 @@ std::unique_ptr<Multiplier<ValueType>> MultiplierFactory<ValueType>::create(Envi
             return std::make_unique<GmmxxMultiplier<ValueType>>(matrix);
         case MultiplierType::Native:
             return std::make_unique<NativeMultiplier<ValueType>>(matrix);
+        case MultiplierType::Simd:
+            return std::make_unique<SimdMultiplier<ValueType>>(matrix);
     }
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Unknown MultiplierType");
 }
@@ -5,6 +5,7 @@
 
 #include "storm/solver/MultiplicationStyle.h"
 #include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/CompactSparseMatrix.h"
 
 namespace storm {
 
@@ -93,6 +94,42 @@ class Multiplier {
                                               std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr,
                                               bool backwards = true) const = 0;
 
+    /*!
+     * Performs the matrix-vector multiplications x_i' = A*x_i + b_i for a batch of k vectors such that the matrix is
+     * traversed only once. All vectors are stored interleaved, i.e., the j-th entry of the i-th vector is stored
+     * at position j * k + i. The rows are processed in parallel if the environment asks for it.
+     *
+     * @param numberOfVectors The number k of vectors in the batch.
+     * @param x The (interleaved) input vectors. Its length must be k times the number of columns of A.
+     * @param b If non-null, these (interleaved) vectors are added after the multiplication. If given, its length must be
+     * k times the number of rows of A.
+     * @param result The target into which to write the (interleaved) results. Its length must be k times the number of
+     * rows of A. Can be the same as x.
+     */
+    virtual void multiplyBatch(Environment const& env, uint64_t numberOfVectors, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                               std::vector<ValueType>& result) const;
+
+    /*!
+     * Performs the matrix-vector multiplications x_i' = A*x_i + b_i for a batch of k (interleaved) vectors and then
+     * minimizes/maximizes over the row groups. The matrix is traversed only once. The row groups are processed in
+     * parallel if the environment asks for it.
+     *
+     * @param dir The direction for the reduction step (which is the same for all vectors of the batch).
+     * @param rowGroupIndices A vector storing the row groups over which to reduce.
+     * @param numberOfVectors The number k of vectors in the batch.
+     * @param x The (interleaved) input vectors. Its length must be k times the number of columns of A.
+     * @param b If non-null, these (interleaved) vectors are added after the multiplication. If given, its length must be
+     * k times the number of rows of A.
+     * @param result The target into which to write the (interleaved) results. Its length must be k times the number of
+     * row groups of A. Can be the same as x.
+     * @param choices If given, the choices made in the reduction process are written to this (interleaved) vector,
+     * i.e., the choice for row group j and vector i is stored at position j * k + i. As for a single vector, the choice
+     * is only updated if the new choice is strictly better.
+     */
+    virtual void multiplyAndReduceBatch(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                        uint64_t numberOfVectors, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                        std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr) const;
+
     /*!
      * Performs repeated matrix-vector multiplication, using x[0] = x and x[i + 1] = A*x[i] + b. After
      * performing the necessary multiplications, the result is written to the input vector x. Note that the
@@ -141,8 +178,56 @@ class Multiplier {
     virtual void multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2,
                               ValueType& val2) const;
 
+    /*!
+     * Moves the entries of the matrix of this multiplier into its compact representation (see CompactSparseMatrix), such that the matrix is
+     * kept in memory only once while the caller iterates. This is only done if the multiplier operates on the compact representation anyway.
+     * The given matrix has to be the matrix of this multiplier and needs to be owned by the caller. Until restoreMatrix is called, the matrix
+     * is empty and must not be accessed, and all multiplications are performed on the compact representation.
+     *
+     * @return true if the matrix has been moved. Otherwise, the matrix is left unchanged.
+     */
+    bool takeMatrix(Environment const& env, storm::storage::SparseMatrix<ValueType>& ownedMatrix);
+
+    /*!
+     * Moves the entries back into the given matrix, which has to be the matrix given to takeMatrix.
+     */
+    void restoreMatrix(storm::storage::SparseMatrix<ValueType>& ownedMatrix);
+
    protected:
+    /*!
+     * Retrieves whether this multiplier operates on the compact representation of the matrix in the given environment.
+     */
+    virtual bool usesCompactMatrix(Environment const& env) const;
+
+    /*!
+     * Retrieves the row groups of the matrix. They are taken from the compact representation while the matrix is moved into it.
+     */
+    std::vector<uint64_t> const& getRowGroupIndices() const;
+
+    /*!
+     * Retrieves the compact representation of the matrix (see CompactSparseMatrix), which is created on the first request.
+     * Multipliers that operate on the compact representation obtain it from here, so at most one copy of the matrix is kept.
+     * @return the compact matrix or nullptr if the matrix can not be represented compactly.
+     */
+    storm::storage::CompactSparseMatrix<ValueType> const* getCompactMatrix() const;
+
+    /*!
+     * Computes the values A_row*x_i + b_i of the given row for all k (interleaved) vectors and writes them to the given
+     * k consecutive values.
+     */
+    void multiplyRowBatch(uint64_t row, uint64_t numberOfVectors, std::vector<ValueType> const& x, std::vector<ValueType> const* b, ValueType* values) const;
+
+    template<typename Compare>
+    void multAddReduceBatch(std::vector<uint64_t> const& rowGroupIndices, uint64_t numberOfVectors, std::vector<ValueType> const& x,
+                            std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices, uint64_t firstGroup,
+                            uint64_t lastGroup) const;
+
     mutable std::unique_ptr<std::vector<ValueType>> cachedVector;
+    mutable std::unique_ptr<storm::storage::CompactSparseMatrix<ValueType>> compactMatrix;
+    // Set to true if the compact matrix was requested but the matrix can not be represented compactly.
+    mutable bool compactMatrixNotApplicable;
+    // Set to true while the entries of the matrix are moved into the compact matrix (see takeMatrix).
+    bool matrixTaken;
     storm::storage::SparseMatrix<ValueType> const& matrix;
 };
 
@@ -2,9 +2,8 @@
 
 #include "storm-config.h"
 
+#include "storm/environment/ParallelEnvironment.h"
 #include "storm/environment/solver/MultiplierEnvironment.h"
-#include "storm/settings/SettingsManager.h"
-#include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/storage/SparseMatrix.h"
 
@@ -13,6 +12,7 @@
 #include "storm/adapters/RationalNumberAdapter.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace solver {
@@ -24,11 +24,27 @@ NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<Value
 
 template<typename ValueType>
 bool NativeMultiplier<ValueType>::parallelize(Environment const& env) const {
-#ifdef STORM_HAVE_INTELTBB
-    return storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
-#else
-    return false;
-#endif
+    return env.parallel().isParallel();
+}
+
+template<typename ValueType>
+bool NativeMultiplier<ValueType>::usesCompactMatrix(Environment const& env) const {
+    return env.solver().multiplier().isCompactMatrixSet();
+}
+
+template<typename ValueType>
+storm::storage::CompactSparseMatrix<ValueType> const* NativeMultiplier<ValueType>::getRequestedCompactMatrix(Environment const& env) const {
+    if (this->matrixTaken) {
+        return this->compactMatrix.get();
+    }
+    if (!usesCompactMatrix(env)) {
+        return nullptr;
+    }
+    bool const knownToBeNotApplicable = this->compactMatrixNotApplicable;
+    auto compact = this->getCompactMatrix();
+    STORM_LOG_WARN_COND(compact != nullptr || knownToBeNotApplicable,
+                        "A compact matrix representation was requested but the matrix has too many columns. Falling back to the default representation.");
+    return compact;
 }
 
 template<typename ValueType>
@@ -43,10 +59,11 @@ void NativeMultiplier<ValueType>::multiply(Environment const& env, std::vector<V
         }
         target = this->cachedVector.get();
     }
+    auto compact = getRequestedCompactMatrix(env);
     if (parallelize(env)) {
-        multAddParallel(x, b, *target);
+        storm::utility::parallel::executeWithThreadLimit(env, [&]() { multAddParallel(compact, x, b, *target); });
     } else {
-        multAdd(x, b, *target);
+        multAdd(compact, x, b, *target);
     }
     if (&x == &result) {
         std::swap(result, *this->cachedVector);
@@ -56,7 +73,13 @@ void NativeMultiplier<ValueType>::multiply(Environment const& env, std::vector<V
 template<typename ValueType>
 void NativeMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b,
                                                       bool backwards) const {
-    if (backwards) {
+    if (auto compact = getRequestedCompactMatrix(env)) {
+        if (backwards) {
+            compact->multiplyWithVectorBackward(x, x, b);
+        } else {
+            compact->multiplyWithVectorForward(x, x, b);
+        }
+    } else if (backwards) {
         this->matrix.multiplyWithVectorBackward(x, x, b);
     } else {
         this->matrix.multiplyWithVectorForward(x, x, b);
@@ -76,10 +99,11 @@ void NativeMultiplier<ValueType>::multiplyAndReduce(Environment const& env, Opti
         }
         target = this->cachedVector.get();
     }
+    auto compact = getRequestedCompactMatrix(env);
     if (parallelize(env)) {
-        multAddReduceParallel(dir, rowGroupIndices, x, b, *target, choices);
+        storm::utility::parallel::executeWithThreadLimit(env, [&]() { multAddReduceParallel(compact, dir, rowGroupIndices, x, b, *target, choices); });
     } else {
-        multAddReduce(dir, rowGroupIndices, x, b, *target, choices);
+        multAddReduce(compact, dir, rowGroupIndices, x, b, *target, choices);
     }
     if (&x == &result) {
         std::swap(result, *this->cachedVector);
@@ -90,7 +114,13 @@ template<typename ValueType>
 void NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir,
                                                                std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
                                                                std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
-    if (backwards) {
+    if (auto compact = getRequestedCompactMatrix(env)) {
+        if (backwards) {
+            compact->multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+        } else {
+            compact->multiplyAndReduceForward(dir, rowGroupIndices, x, b, x, choices);
+        }
+    } else if (backwards) {
         this->matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
     } else {
         this->matrix.multiplyAndReduceForward(dir, rowGroupIndices, x, b, x, choices);
@@ -99,6 +129,10 @@ void NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const
 
 template<typename ValueType>
 void NativeMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
+    if (this->matrixTaken) {
+        value += this->compactMatrix->multiplyRowWithVector(rowIndex, x);
+        return;
+    }
     for (auto const& entry : this->matrix.getRow(rowIndex)) {
         value += entry.getValue() * x[entry.getColumn()];
     }
@@ -107,6 +141,11 @@ void NativeMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vec
 template<typename ValueType>
 void NativeMultiplier<ValueType>::multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2,
                                                ValueType& val2) const {
+    if (this->matrixTaken) {
+        val1 += this->compactMatrix->multiplyRowWithVector(rowIndex, x1);
+        val2 += this->compactMatrix->multiplyRowWithVector(rowIndex, x2);
+        return;
+    }
     for (auto const& entry : this->matrix.getRow(rowIndex)) {
         val1 += entry.getValue() * x1[entry.getColumn()];
         val2 += entry.getValue() * x2[entry.getColumn()];
@@ -114,36 +153,55 @@ void NativeMultiplier<ValueType>::multiplyRow2(uint64_t const& rowIndex, std::ve
 }
 
 template<typename ValueType>
-void NativeMultiplier<ValueType>::multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
-    this->matrix.multiplyWithVector(x, result, b);
+void NativeMultiplier<ValueType>::multAdd(storm::storage::CompactSparseMatrix<ValueType> const* compact, std::vector<ValueType> const& x,
+                                          std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+    if (compact) {
+        compact->multiplyWithVector(x, result, b);
+    } else {
+        this->matrix.multiplyWithVector(x, result, b);
+    }
 }
 
 template<typename ValueType>
-void NativeMultiplier<ValueType>::multAddReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
-                                                std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
-                                                std::vector<uint64_t>* choices) const {
-    this->matrix.multiplyAndReduce(dir, rowGroupIndices, x, b, result, choices);
+void NativeMultiplier<ValueType>::multAddReduce(storm::storage::CompactSparseMatrix<ValueType> const* compact, storm::solver::OptimizationDirection const& dir,
+                                                std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                                std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+    if (compact) {
+        compact->multiplyAndReduce(dir, rowGroupIndices, x, b, result, choices);
+    } else {
+        this->matrix.multiplyAndReduce(dir, rowGroupIndices, x, b, result, choices);
+    }
 }
 
 template<typename ValueType>
-void NativeMultiplier<ValueType>::multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+void NativeMultiplier<ValueType>::multAddParallel(storm::storage::CompactSparseMatrix<ValueType> const* compact, std::vector<ValueType> const& x,
+                                                  std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
 #ifdef STORM_HAVE_INTELTBB
-    this->matrix.multiplyWithVectorParallel(x, result, b);
+    if (compact) {
+        compact->multiplyWithVectorParallel(x, result, b);
+    } else {
+        this->matrix.multiplyWithVectorParallel(x, result, b);
+    }
 #else
     STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
-    multAdd(x, b, result);
+    multAdd(compact, x, b, result);
 #endif
 }
 
 template<typename ValueType>
-void NativeMultiplier<ValueType>::multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+void NativeMultiplier<ValueType>::multAddReduceParallel(storm::storage::CompactSparseMatrix<ValueType> const* compact,
+                                                        storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
                                                         std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
                                                         std::vector<uint64_t>* choices) const {
 #ifdef STORM_HAVE_INTELTBB
-    this->matrix.multiplyAndReduceParallel(dir, rowGroupIndices, x, b, result, choices);
+    if (compact) {
+        compact->multiplyAndReduceParallel(dir, rowGroupIndices, x, b, result, choices);
+    } else {
+        this->matrix.multiplyAndReduceParallel(dir, rowGroupIndices, x, b, result, choices);
+    }
 #else
     STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
-    multAddReduce(dir, rowGroupIndices, x, b, result, choices);
+    multAddReduce(compact, dir, rowGroupIndices, x, b, result, choices);
 #endif
 }
 
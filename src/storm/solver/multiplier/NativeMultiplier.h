@@ -2,6 +2,8 @@
 
 #include "storm/solver/multiplier/Multiplier.h"
 
+#include "storm/storage/CompactSparseMatrix.h"
+
 #include "storm/solver/OptimizationDirection.h"
 
 namespace storm {
@@ -31,17 +33,32 @@ class NativeMultiplier : public Multiplier<ValueType> {
     virtual void multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2,
                               ValueType& val2) const override;
 
+   protected:
+    virtual bool usesCompactMatrix(Environment const& env) const override;
+
    private:
     bool parallelize(Environment const& env) const;
 
-    void multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+    /*!
+     * Retrieves the compact representation of the matrix if requested by the environment (and applicable) or if the matrix has been
+     * moved into it (see takeMatrix) and nullptr otherwise. Unless the matrix is moved, the compact matrix is an additional copy that is
+     * created on the first request.
+     */
+    storm::storage::CompactSparseMatrix<ValueType> const* getRequestedCompactMatrix(Environment const& env) const;
+
+    void multAdd(storm::storage::CompactSparseMatrix<ValueType> const* compact, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                 std::vector<ValueType>& result) const;
+
+    void multAddReduce(storm::storage::CompactSparseMatrix<ValueType> const* compact, storm::solver::OptimizationDirection const& dir,
+                       std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                       std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
 
-    void multAddReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x,
-                       std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
+    void multAddParallel(storm::storage::CompactSparseMatrix<ValueType> const* compact, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                         std::vector<ValueType>& result) const;
+    void multAddReduceParallel(storm::storage::CompactSparseMatrix<ValueType> const* compact, storm::solver::OptimizationDirection const& dir,
+                               std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                               std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
 
-    void multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
-    void multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x,
-                               std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
 };
 
 }  // namespace solver
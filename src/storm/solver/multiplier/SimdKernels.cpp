@@ -0,0 +1,237 @@
+#include "storm/solver/multiplier/SimdKernels.h"
+
+#include <algorithm>
+#include <limits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define STORM_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace storm {
+namespace solver {
+namespace simd {
+
+std::string toString(InstructionSet const& instructionSet) {
+    switch (instructionSet) {
+        case InstructionSet::Portable:
+            return "portable";
+        case InstructionSet::Avx2:
+            return "AVX2";
+        case InstructionSet::Avx512:
+            return "AVX-512";
+    }
+    return "invalid";
+}
+
+bool isSupported(InstructionSet const& instructionSet) {
+    switch (instructionSet) {
+        case InstructionSet::Portable:
+            return true;
+#ifdef STORM_SIMD_X86
+        case InstructionSet::Avx2:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+        case InstructionSet::Avx512:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx512f");
+#endif
+        default:
+            return false;
+    }
+}
+
+InstructionSet getBestSupportedInstructionSet() {
+    static const InstructionSet bestInstructionSet = []() {
+        for (auto instructionSet : {InstructionSet::Avx512, InstructionSet::Avx2}) {
+            if (isSupported(instructionSet)) {
+                return instructionSet;
+            }
+        }
+        return InstructionSet::Portable;
+    }();
+    return bestInstructionSet;
+}
+
+uint64_t getMaximalColumnCount(InstructionSet const& instructionSet) {
+    if (instructionSet == InstructionSet::Portable) {
+        return static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()) + 1;
+    } else {
+        return static_cast<uint64_t>(std::numeric_limits<int32_t>::max()) + 1;
+    }
+}
+
+namespace {
+template<bool Backward>
+void multiplyRowsPortable(uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x, double const* summand,
+                          uint64_t firstRow, uint64_t lastRow, double* result) {
+    for (uint64_t i = 0, numberOfRows = lastRow - firstRow; i < numberOfRows; ++i) {
+        uint64_t const row = Backward ? lastRow - 1 - i : firstRow + i;
+        double rowValue = 0.0;
+        for (uint64_t entry = rowIndications[row], entryEnd = rowIndications[row + 1]; entry < entryEnd; ++entry) {
+            rowValue += values[entry] * x[columns[entry]];
+        }
+        result[row - firstRow] = summand ? summand[row] + rowValue : rowValue;
+    }
+}
+
+template<bool Maximize>
+double reducePortable(double const* values, uint64_t size) {
+    double result = values[0];
+    for (uint64_t i = 1; i < size; ++i) {
+        result = Maximize ? std::max(result, values[i]) : std::min(result, values[i]);
+    }
+    return result;
+}
+
+#ifdef STORM_SIMD_X86
+template<bool Backward>
+__attribute__((target("avx2,fma"))) void multiplyRowsAvx2(uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x,
+                                                          double const* summand, uint64_t firstRow, uint64_t lastRow, double* result) {
+    for (uint64_t i = 0, numberOfRows = lastRow - firstRow; i < numberOfRows; ++i) {
+        uint64_t const row = Backward ? lastRow - 1 - i : firstRow + i;
+        uint64_t entry = rowIndications[row];
+        uint64_t const entryEnd = rowIndications[row + 1];
+        double rowValue = 0.0;
+        if (entry + 4 <= entryEnd) {
+            __m256d accumulator = _mm256_setzero_pd();
+            for (; entry + 4 <= entryEnd; entry += 4) {
+                __m128i indices = _mm_loadu_si128(reinterpret_cast<__m128i const*>(columns + entry));
+                __m256d gathered = _mm256_i32gather_pd(x, indices, 8);
+                accumulator = _mm256_fmadd_pd(_mm256_loadu_pd(values + entry), gathered, accumulator);
+            }
+            __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(accumulator), _mm256_extractf128_pd(accumulator, 1));
+            rowValue = _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+        }
+        for (; entry < entryEnd; ++entry) {
+            rowValue += values[entry] * x[columns[entry]];
+        }
+        result[row - firstRow] = summand ? summand[row] + rowValue : rowValue;
+    }
+}
+
+template<bool Maximize>
+__attribute__((target("avx2"))) double reduceAvx2(double const* values, uint64_t size) {
+    if (size < 4) {
+        return reducePortable<Maximize>(values, size);
+    }
+    __m256d accumulator = _mm256_loadu_pd(values);
+    uint64_t i = 4;
+    for (; i + 4 <= size; i += 4) {
+        __m256d next = _mm256_loadu_pd(values + i);
+        accumulator = Maximize ? _mm256_max_pd(accumulator, next) : _mm256_min_pd(accumulator, next);
+    }
+    __m128d low = _mm256_castpd256_pd128(accumulator);
+    __m128d high = _mm256_extractf128_pd(accumulator, 1);
+    __m128d reduced = Maximize ? _mm_max_pd(low, high) : _mm_min_pd(low, high);
+    reduced = Maximize ? _mm_max_sd(reduced, _mm_unpackhi_pd(reduced, reduced)) : _mm_min_sd(reduced, _mm_unpackhi_pd(reduced, reduced));
+    double result = _mm_cvtsd_f64(reduced);
+    for (; i < size; ++i) {
+        result = Maximize ? std::max(result, values[i]) : std::min(result, values[i]);
+    }
+    return result;
+}
+
+template<bool Backward>
+__attribute__((target("avx512f"))) void multiplyRowsAvx512(uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x,
+                                                           double const* summand, uint64_t firstRow, uint64_t lastRow, double* result) {
+    for (uint64_t i = 0, numberOfRows = lastRow - firstRow; i < numberOfRows; ++i) {
+        uint64_t const row = Backward ? lastRow - 1 - i : firstRow + i;
+        uint64_t entry = rowIndications[row];
+        uint64_t const entryEnd = rowIndications[row + 1];
+        double rowValue = 0.0;
+        if (entry + 8 <= entryEnd) {
+            __m512d accumulator = _mm512_setzero_pd();
+            for (; entry + 8 <= entryEnd; entry += 8) {
+                __m256i indices = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(columns + entry));
+                __m512d gathered = _mm512_i32gather_pd(indices, x, 8);
+                accumulator = _mm512_fmadd_pd(_mm512_loadu_pd(values + entry), gathered, accumulator);
+            }
+            rowValue = _mm512_reduce_add_pd(accumulator);
+        }
+        if (entry + 4 <= entryEnd) {
+            __m128i indices = _mm_loadu_si128(reinterpret_cast<__m128i const*>(columns + entry));
+            __m256d products = _mm256_mul_pd(_mm256_loadu_pd(values + entry), _mm256_i32gather_pd(x, indices, 8));
+            __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(products), _mm256_extractf128_pd(products, 1));
+            rowValue += _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+            entry += 4;
+        }
+        for (; entry < entryEnd; ++entry) {
+            rowValue += values[entry] * x[columns[entry]];
+        }
+        result[row - firstRow] = summand ? summand[row] + rowValue : rowValue;
+    }
+}
+
+template<bool Maximize>
+__attribute__((target("avx512f"))) double reduceAvx512(double const* values, uint64_t size) {
+    if (size < 8) {
+        return reduceAvx2<Maximize>(values, size);
+    }
+    __m512d accumulator = _mm512_loadu_pd(values);
+    uint64_t i = 8;
+    for (; i + 8 <= size; i += 8) {
+        __m512d next = _mm512_loadu_pd(values + i);
+        accumulator = Maximize ? _mm512_max_pd(accumulator, next) : _mm512_min_pd(accumulator, next);
+    }
+    double result = Maximize ? _mm512_reduce_max_pd(accumulator) : _mm512_reduce_min_pd(accumulator);
+    for (; i < size; ++i) {
+        result = Maximize ? std::max(result, values[i]) : std::min(result, values[i]);
+    }
+    return result;
+}
+#endif
+
+template<bool Maximize>
+double reduce(InstructionSet const& instructionSet, double const* values, uint64_t size) {
+    switch (instructionSet) {
+#ifdef STORM_SIMD_X86
+        case InstructionSet::Avx512:
+            return reduceAvx512<Maximize>(values, size);
+        case InstructionSet::Avx2:
+            return reduceAvx2<Maximize>(values, size);
+#endif
+        default:
+            return reducePortable<Maximize>(values, size);
+    }
+}
+
+template<bool Backward>
+void multiplyRowsDispatch(InstructionSet const& instructionSet, uint64_t const* rowIndications, uint32_t const* columns, double const* values,
+                          double const* x, double const* summand, uint64_t firstRow, uint64_t lastRow, double* result) {
+    switch (instructionSet) {
+#ifdef STORM_SIMD_X86
+        case InstructionSet::Avx512:
+            multiplyRowsAvx512<Backward>(rowIndications, columns, values, x, summand, firstRow, lastRow, result);
+            return;
+        case InstructionSet::Avx2:
+            multiplyRowsAvx2<Backward>(rowIndications, columns, values, x, summand, firstRow, lastRow, result);
+            return;
+#endif
+        default:
+            multiplyRowsPortable<Backward>(rowIndications, columns, values, x, summand, firstRow, lastRow, result);
+    }
+}
+}  // namespace
+
+void multiplyRows(InstructionSet const& instructionSet, uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x,
+                  double const* summand, uint64_t firstRow, uint64_t lastRow, double* result) {
+    multiplyRowsDispatch<false>(instructionSet, rowIndications, columns, values, x, summand, firstRow, lastRow, result);
+}
+
+void multiplyRowsBackward(InstructionSet const& instructionSet, uint64_t const* rowIndications, uint32_t const* columns, double const* values,
+                          double const* x, double const* summand, uint64_t firstRow, uint64_t lastRow, double* result) {
+    multiplyRowsDispatch<true>(instructionSet, rowIndications, columns, values, x, summand, firstRow, lastRow, result);
+}
+
+double reduceMinimum(InstructionSet const& instructionSet, double const* values, uint64_t size) {
+    return reduce<false>(instructionSet, values, size);
+}
+
+double reduceMaximum(InstructionSet const& instructionSet, double const* values, uint64_t size) {
+    return reduce<true>(instructionSet, values, size);
+}
+
+}  // namespace simd
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace storm {
+namespace solver {
+namespace simd {
+
+/*!
+ * The instruction sets for which (double precision) kernels are available.
+ */
+enum class InstructionSet { Portable, Avx2, Avx512 };
+
+std::string toString(InstructionSet const& instructionSet);
+
+/*!
+ * Retrieves whether the given instruction set is supported by the CPU we are currently running on.
+ */
+bool isSupported(InstructionSet const& instructionSet);
+
+/*!
+ * Retrieves the most powerful instruction set supported by the CPU we are currently running on.
+ * The result is determined once and then cached.
+ */
+InstructionSet getBestSupportedInstructionSet();
+
+/*!
+ * Retrieves the largest number of columns for which the gather-based kernels of the given instruction set can be used.
+ * (The gather instructions take signed 32-bit indices.)
+ */
+uint64_t getMaximalColumnCount(InstructionSet const& instructionSet);
+
+/*!
+ * Multiplies the rows firstRow, ..., lastRow - 1 of a matrix in compressed row storage (structure of arrays) with the
+ * vector x. The value for row i is written to result[i - firstRow].
+ * Rows are processed in ascending order and each result is written immediately after the row has been processed.
+ * Hence, if result points into x (at position firstRow), this performs a (forward) Gauss-Seidel sweep.
+ *
+ * @param instructionSet The instruction set to use. Must be supported by the CPU.
+ * @param rowIndications The row indications of the matrix.
+ * @param columns The column of each matrix entry.
+ * @param values The value of each matrix entry.
+ * @param x The vector with which to multiply.
+ * @param summand If not null, summand[i] is added to the result of row i.
+ */
+void multiplyRows(InstructionSet const& instructionSet, uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x,
+                  double const* summand, uint64_t firstRow, uint64_t lastRow, double* result);
+
+/*!
+ * Same as multiplyRows, but the rows are processed in descending order, i.e., the value for row lastRow - 1 is computed (and written) first.
+ * Hence, if result points into x (at position firstRow), this performs a backward Gauss-Seidel sweep.
+ */
+void multiplyRowsBackward(InstructionSet const& instructionSet, uint64_t const* rowIndications, uint32_t const* columns, double const* values,
+                          double const* x, double const* summand, uint64_t firstRow, uint64_t lastRow, double* result);
+
+/*!
+ * Computes the minimum (or maximum) of the given (non-empty) array of values.
+ */
+double reduceMinimum(InstructionSet const& instructionSet, double const* values, uint64_t size);
+double reduceMaximum(InstructionSet const& instructionSet, double const* values, uint64_t size);
+
+}  // namespace simd
+}  // namespace solver
+}  // namespace storm
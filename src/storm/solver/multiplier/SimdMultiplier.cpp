@@ -0,0 +1,347 @@
+#include "storm/solver/multiplier/SimdMultiplier.h"
+
+#include "storm-config.h"
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/ParallelEnvironment.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+namespace storm {
+namespace solver {
+
+namespace {
+// The (maximal) number of rows whose values are computed at once before reducing the corresponding row groups.
+uint64_t const rowBlockSize = 1024;
+
+template<typename ValueType, typename Compare>
+ValueType reduceValuesScalar(ValueType const* values, uint64_t numberOfValues) {
+    Compare compare;
+    ValueType result = values[0];
+    for (uint64_t i = 1; i < numberOfValues; ++i) {
+        if (compare(values[i], result)) {
+            result = values[i];
+        }
+    }
+    return result;
+}
+
+template<typename ValueType, typename Compare>
+struct GroupValueReducer {
+    static ValueType reduce(simd::InstructionSet const&, bool, ValueType const* values, uint64_t numberOfValues) {
+        return reduceValuesScalar<ValueType, Compare>(values, numberOfValues);
+    }
+};
+
+template<typename Compare>
+struct GroupValueReducer<double, Compare> {
+    static double reduce(simd::InstructionSet const& instructionSet, bool minimize, double const* values, uint64_t numberOfValues) {
+        // For very small groups, the overhead of the vectorized reduction does not pay off.
+        if (numberOfValues < 4) {
+            return reduceValuesScalar<double, Compare>(values, numberOfValues);
+        }
+        return minimize ? simd::reduceMinimum(instructionSet, values, numberOfValues) : simd::reduceMaximum(instructionSet, values, numberOfValues);
+    }
+};
+}  // namespace
+
+template<typename ValueType>
+SimdMultiplier<ValueType>::SimdMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix)
+    : Multiplier<ValueType>(matrix), instructionSet(simd::getBestSupportedInstructionSet()) {
+    if (matrix.getColumnCount() > simd::getMaximalColumnCount(instructionSet)) {
+        STORM_LOG_INFO("The matrix has too many columns for the " << simd::toString(instructionSet) << " kernels. Using portable kernels instead.");
+        instructionSet = simd::InstructionSet::Portable;
+    }
+    STORM_LOG_TRACE("SIMD multiplier uses " << simd::toString(instructionSet) << " kernels.");
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::initialize() const {
+    STORM_LOG_THROW(this->getCompactMatrix() != nullptr, storm::exceptions::NotSupportedException,
+                    "The SIMD multiplier does not support matrices with " << this->matrix.getColumnCount() << " columns.");
+}
+
+template<typename ValueType>
+simd::InstructionSet const& SimdMultiplier<ValueType>::getInstructionSet() const {
+    return instructionSet;
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::setInstructionSet(simd::InstructionSet const& newInstructionSet) {
+    STORM_LOG_THROW(simd::isSupported(newInstructionSet), storm::exceptions::NotSupportedException,
+                    "The instruction set " << simd::toString(newInstructionSet) << " is not supported on this machine.");
+    uint64_t const numberOfColumns = this->matrixTaken ? this->compactMatrix->getColumnCount() : this->matrix.getColumnCount();
+    STORM_LOG_THROW(numberOfColumns <= simd::getMaximalColumnCount(newInstructionSet), storm::exceptions::InvalidArgumentException,
+                    "The matrix has too many columns for the " << simd::toString(newInstructionSet) << " kernels.");
+    instructionSet = newInstructionSet;
+}
+
+template<typename ValueType>
+bool SimdMultiplier<ValueType>::usesCompactMatrix(Environment const&) const {
+    return true;
+}
+
+template<typename ValueType>
+bool SimdMultiplier<ValueType>::parallelize(Environment const& env) const {
+    return env.parallel().isParallel();
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiplyRows(uint64_t firstRow, uint64_t lastRow, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                             ValueType* result) const {
+    for (uint64_t row = firstRow; row < lastRow; ++row) {
+        ValueType rowValue = b ? (*b)[row] : storm::utility::zero<ValueType>();
+        rowValue += this->compactMatrix->multiplyRowWithVector(row, x);
+        result[row - firstRow] = std::move(rowValue);
+    }
+}
+
+template<>
+void SimdMultiplier<double>::multiplyRows(uint64_t firstRow, uint64_t lastRow, std::vector<double> const& x, std::vector<double> const* b,
+                                          double* result) const {
+    simd::multiplyRows(instructionSet, this->compactMatrix->getRowIndications().data(), this->compactMatrix->getColumns().data(),
+                       this->compactMatrix->getValues().data(), x.data(), b ? b->data() : nullptr, firstRow, lastRow, result);
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiplyRowsBackward(uint64_t firstRow, uint64_t lastRow, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                                     ValueType* result) const {
+    for (uint64_t row = lastRow; row > firstRow; --row) {
+        ValueType rowValue = b ? (*b)[row - 1] : storm::utility::zero<ValueType>();
+        rowValue += this->compactMatrix->multiplyRowWithVector(row - 1, x);
+        result[row - 1 - firstRow] = std::move(rowValue);
+    }
+}
+
+template<>
+void SimdMultiplier<double>::multiplyRowsBackward(uint64_t firstRow, uint64_t lastRow, std::vector<double> const& x, std::vector<double> const* b,
+                                                  double* result) const {
+    simd::multiplyRowsBackward(instructionSet, this->compactMatrix->getRowIndications().data(), this->compactMatrix->getColumns().data(),
+                               this->compactMatrix->getValues().data(), x.data(), b ? b->data() : nullptr, firstRow, lastRow, result);
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                         std::vector<ValueType>& result) const {
+    initialize();
+    std::vector<ValueType>* target = &result;
+    if (&x == &result) {
+        if (this->cachedVector) {
+            this->cachedVector->resize(x.size());
+        } else {
+            this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+        }
+        target = this->cachedVector.get();
+    }
+    uint64_t const numberOfRows = this->compactMatrix->getRowCount();
+    if (parallelize(env)) {
+#ifdef STORM_HAVE_INTELTBB
+        storm::utility::parallel::executeWithThreadLimit(env, [&]() {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfRows, rowBlockSize), [&](tbb::blocked_range<uint64_t> const& range) {
+                multiplyRows(range.begin(), range.end(), x, b, target->data() + range.begin());
+            });
+        });
+#else
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+        multiplyRows(0, numberOfRows, x, b, target->data());
+#endif
+    } else {
+        multiplyRows(0, numberOfRows, x, b, target->data());
+    }
+    if (&x == &result) {
+        std::swap(result, *this->cachedVector);
+    }
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards) const {
+    initialize();
+    uint64_t const numberOfRows = this->compactMatrix->getRowCount();
+    STORM_LOG_ASSERT(numberOfRows == this->compactMatrix->getColumnCount(), "Expecting square matrix.");
+    if (backwards) {
+        // Rows are processed in descending order and written immediately, so this yields a backward Gauss-Seidel sweep.
+        multiplyRowsBackward(0, numberOfRows, x, b, x.data());
+    } else {
+        // Rows are processed in ascending order and written immediately, so this yields a forward Gauss-Seidel sweep.
+        multiplyRows(0, numberOfRows, x, b, x.data());
+    }
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                  std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                  std::vector<uint_fast64_t>* choices) const {
+    initialize();
+    std::vector<ValueType>* target = &result;
+    if (&x == &result) {
+        if (this->cachedVector) {
+            this->cachedVector->resize(x.size());
+        } else {
+            this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+        }
+        target = this->cachedVector.get();
+    }
+    uint64_t const numberOfGroups = rowGroupIndices.size() - 1;
+    if (parallelize(env)) {
+#ifdef STORM_HAVE_INTELTBB
+        storm::utility::parallel::executeWithThreadLimit(env, [&]() {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfGroups, 100), [&](tbb::blocked_range<uint64_t> const& range) {
+                multAddReduceGroups(dir, rowGroupIndices, x, b, *target, choices, range.begin(), range.end());
+            });
+        });
+#else
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+        multAddReduceGroups(dir, rowGroupIndices, x, b, *target, choices, 0, numberOfGroups);
+#endif
+    } else {
+        multAddReduceGroups(dir, rowGroupIndices, x, b, *target, choices, 0, numberOfGroups);
+    }
+    if (&x == &result) {
+        std::swap(result, *this->cachedVector);
+    }
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir,
+                                                             std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
+                                                             std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
+    initialize();
+    if (dir == storm::OptimizationDirection::Minimize) {
+        multAddReduceGaussSeidel<storm::utility::ElementLess<ValueType>>(rowGroupIndices, x, b, choices, backwards);
+    } else {
+        multAddReduceGaussSeidel<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, x, b, choices, backwards);
+    }
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
+    initialize();
+    value += this->compactMatrix->multiplyRowWithVector(rowIndex, x);
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multAddReduceGroups(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                    std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                    std::vector<uint64_t>* choices, uint64_t firstGroup, uint64_t lastGroup) const {
+    if (dir == storm::OptimizationDirection::Minimize) {
+        multAddReduceGroups<storm::utility::ElementLess<ValueType>>(dir, rowGroupIndices, x, b, result, choices, firstGroup, lastGroup);
+    } else {
+        multAddReduceGroups<storm::utility::ElementGreater<ValueType>>(dir, rowGroupIndices, x, b, result, choices, firstGroup, lastGroup);
+    }
+}
+
+template<typename ValueType>
+template<typename Compare>
+void SimdMultiplier<ValueType>::multAddReduceGroups(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                    std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                    std::vector<uint64_t>* choices, uint64_t firstGroup, uint64_t lastGroup) const {
+    std::vector<ValueType> rowValues;
+    uint64_t group = firstGroup;
+    while (group < lastGroup) {
+        // Collect the row groups of the current block. Each block consists of at least one row group.
+        uint64_t const blockStartRow = rowGroupIndices[group];
+        uint64_t blockEndGroup = group + 1;
+        while (blockEndGroup < lastGroup && rowGroupIndices[blockEndGroup + 1] - blockStartRow <= rowBlockSize) {
+            ++blockEndGroup;
+        }
+        uint64_t const blockEndRow = rowGroupIndices[blockEndGroup];
+
+        // Compute the values of all rows of the block at once and then reduce each row group.
+        rowValues.resize(blockEndRow - blockStartRow);
+        multiplyRows(blockStartRow, blockEndRow, x, b, rowValues.data());
+        for (; group < blockEndGroup; ++group) {
+            uint64_t const groupStart = rowGroupIndices[group];
+            uint64_t const numberOfRows = rowGroupIndices[group + 1] - groupStart;
+
+            // Only reduce if there is at least one row in the group.
+            if (numberOfRows > 0) {
+                result[group] = reduceGroup<Compare>(dir, rowValues.data() + (groupStart - blockStartRow), numberOfRows,
+                                                     choices ? &(*choices)[group] : nullptr, false);
+            }
+        }
+    }
+}
+
+template<typename ValueType>
+template<typename Compare>
+void SimdMultiplier<ValueType>::multAddReduceGaussSeidel(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
+                                                         std::vector<ValueType> const* b, std::vector<uint64_t>* choices, bool backwards) const {
+    OptimizationDirection const dir = std::is_same<Compare, storm::utility::ElementLess<ValueType>>::value ? OptimizationDirection::Minimize
+                                                                                                             : OptimizationDirection::Maximize;
+    std::vector<ValueType> rowValues;
+    uint64_t const numberOfGroups = rowGroupIndices.size() - 1;
+    for (uint64_t i = 0; i < numberOfGroups; ++i) {
+        uint64_t const group = backwards ? numberOfGroups - 1 - i : i;
+        uint64_t const groupStart = rowGroupIndices[group];
+        uint64_t const groupEnd = rowGroupIndices[group + 1];
+
+        // Only multiply and reduce if there is at least one row in the group.
+        if (groupStart < groupEnd) {
+            rowValues.resize(groupEnd - groupStart);
+            multiplyRows(groupStart, groupEnd, x, b, rowValues.data());
+            x[group] = reduceGroup<Compare>(dir, rowValues.data(), groupEnd - groupStart, choices ? &(*choices)[group] : nullptr, backwards);
+        }
+    }
+}
+
+template<typename ValueType>
+template<typename Compare>
+ValueType SimdMultiplier<ValueType>::reduceGroup(OptimizationDirection const& dir, ValueType const* rowValues, uint64_t numberOfRows, uint64_t* choice,
+                                                 bool backwards) const {
+    if (!choice) {
+        return GroupValueReducer<ValueType, Compare>::reduce(instructionSet, storm::solver::minimize(dir), rowValues, numberOfRows);
+    }
+
+    // For correctly tracking choices, we only update if the new choice is strictly better than the old one.
+    Compare compare;
+    uint64_t const oldChoice = *choice;
+    uint64_t selectedChoice = backwards ? numberOfRows - 1 : 0;
+    ValueType currentValue = rowValues[selectedChoice];
+    ValueType oldSelectedChoiceValue = currentValue;
+    for (uint64_t offset = 1; offset < numberOfRows; ++offset) {
+        uint64_t const row = backwards ? numberOfRows - 1 - offset : offset;
+        if (row == oldChoice) {
+            oldSelectedChoiceValue = rowValues[row];
+        }
+        if (compare(rowValues[row], currentValue)) {
+            currentValue = rowValues[row];
+            selectedChoice = row;
+        }
+    }
+    if (compare(currentValue, oldSelectedChoiceValue)) {
+        *choice = selectedChoice;
+    }
+    return currentValue;
+}
+
+#ifdef STORM_HAVE_CARL
+template<>
+void SimdMultiplier<storm::RationalFunction>::multAddReduceGroups(OptimizationDirection const&, std::vector<uint64_t> const&,
+                                                                  std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const*,
+                                                                  std::vector<storm::RationalFunction>&, std::vector<uint64_t>*, uint64_t, uint64_t) const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation not supported for this data type.");
+}
+
+template<>
+void SimdMultiplier<storm::RationalFunction>::multiplyAndReduceGaussSeidel(Environment const&, OptimizationDirection const&, std::vector<uint64_t> const&,
+                                                                           std::vector<storm::RationalFunction>&, std::vector<storm::RationalFunction> const*,
+                                                                           std::vector<uint_fast64_t>*, bool) const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation not supported for this data type.");
+}
+#endif
+
+template class SimdMultiplier<double>;
+#ifdef STORM_HAVE_CARL
+template class SimdMultiplier<storm::RationalNumber>;
+template class SimdMultiplier<storm::RationalFunction>;
+#endif
+
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "storm/solver/multiplier/Multiplier.h"
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/multiplier/SimdKernels.h"
+#include "storm/storage/CompactSparseMatrix.h"
+
+namespace storm {
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+}
+
+namespace solver {
+
+/*!
+ * A multiplier that operates on the compact copy of the matrix kept by the Multiplier base class (see CompactSparseMatrix).
+ * For double values, the row products are computed using explicitly vectorized kernels (AVX-512, AVX2 or a portable
+ * fallback) that are selected at runtime depending on the capabilities of the CPU. Row groups are reduced block-wise.
+ * For other value types, the portable kernels are used.
+ */
+template<typename ValueType>
+class SimdMultiplier : public Multiplier<ValueType> {
+   public:
+    SimdMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
+    virtual ~SimdMultiplier() = default;
+
+    virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                          std::vector<ValueType>& result) const override;
+    virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards = true) const override;
+    virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                   std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                   std::vector<uint_fast64_t>* choices = nullptr) const override;
+    virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                              std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr,
+                                              bool backwards = true) const override;
+    virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
+
+    /*!
+     * Retrieves the instruction set used by this multiplier.
+     */
+    simd::InstructionSet const& getInstructionSet() const;
+
+    /*!
+     * Sets the instruction set used by this multiplier. The instruction set has to be supported by the CPU and
+     * must be able to handle the number of columns of the matrix. This is mainly intended for testing purposes.
+     */
+    void setInstructionSet(simd::InstructionSet const& instructionSet);
+
+   protected:
+    virtual bool usesCompactMatrix(Environment const& env) const override;
+
+   private:
+    void initialize() const;
+
+    bool parallelize(Environment const& env) const;
+
+    /*!
+     * Computes the values of the rows firstRow, ..., lastRow - 1 (including the summand b if given) and writes them to
+     * result[0], ..., result[lastRow - firstRow - 1]. The rows are processed in ascending order.
+     */
+    void multiplyRows(uint64_t firstRow, uint64_t lastRow, std::vector<ValueType> const& x, std::vector<ValueType> const* b, ValueType* result) const;
+
+    /*!
+     * Same as multiplyRows, but the rows are processed in descending order.
+     */
+    void multiplyRowsBackward(uint64_t firstRow, uint64_t lastRow, std::vector<ValueType> const& x, std::vector<ValueType> const* b, ValueType* result) const;
+
+    /*!
+     * Multiplies and reduces the row groups firstGroup, ..., lastGroup - 1 (in ascending order).
+     */
+    void multAddReduceGroups(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x,
+                             std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices, uint64_t firstGroup,
+                             uint64_t lastGroup) const;
+
+    template<typename Compare>
+    void multAddReduceGroups(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x,
+                             std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices, uint64_t firstGroup,
+                             uint64_t lastGroup) const;
+
+    template<typename Compare>
+    void multAddReduceGaussSeidel(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b,
+                                  std::vector<uint64_t>* choices, bool backwards) const;
+
+    /*!
+     * Reduces the given row values of a single row group. The choice (if given) is only updated if the newly selected choice is strictly better.
+     * If backwards is set, the rows are considered from last to first (which only affects the choice that is selected in case of ties).
+     */
+    template<typename Compare>
+    ValueType reduceGroup(OptimizationDirection const& dir, ValueType const* rowValues, uint64_t numberOfRows, uint64_t* choice, bool backwards) const;
+
+    simd::InstructionSet instructionSet;
+};
+
+}  // namespace solver
+}  // namespace storm
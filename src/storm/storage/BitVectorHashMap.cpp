@@ -1,6 +1,7 @@
 #include "storm/storage/BitVectorHashMap.h"
 
 #include <algorithm>
+#include <cstring>
 #include <iostream>
 
 #include "storm/exceptions/InternalException.h"
@@ -8,6 +9,28 @@
 
 namespace storm {
 namespace storage {
+
+/*!
+ * Reads the eight fingerprints starting at the given position such that the fingerprint at position i + j ends up in
+ * the j-th byte (starting from the least significant one).
+ */
+inline uint64_t loadFingerprintGroup(uint8_t const* position) {
+    uint64_t group;
+    std::memcpy(&group, position, sizeof(group));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    group = __builtin_bswap64(group);
+#endif
+    return group;
+}
+
+/*!
+ * Retrieves a mask in which the highest bit of a byte is set if the corresponding byte of the given group is zero.
+ * Bytes above the first zero byte may also be marked spuriously, but the lowest marked byte is always correct.
+ */
+inline uint64_t getZeroBytes(uint64_t group) {
+    return (group - 0x0101010101010101ull) & ~group & 0x8080808080808080ull;
+}
+
 template<class ValueType, class Hash>
 BitVectorHashMap<ValueType, Hash>::BitVectorHashMapIterator::BitVectorHashMapIterator(BitVectorHashMap const& map, BitVector::const_iterator indexIt)
     : map(map), indexIt(indexIt) {
@@ -42,9 +65,14 @@ std::pair<storm::storage::BitVector, ValueType> BitVectorHashMap<ValueType, Hash
 }
 
 template<class ValueType, class Hash>
-BitVectorHashMap<ValueType, Hash>::BitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor)
+BitVectorHashMap<ValueType, Hash>::BitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor, bool compressKeys)
     : loadFactor(loadFactor), bucketSize(bucketSize), currentSize(1), numberOfElements(0) {
     STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
+    if (compressKeys && bucketSize > 64) {
+        // The buckets only need to hold the roots of the compression trees.
+        keyCompression = BitVectorTreeCompression(bucketSize);
+        this->bucketSize = 64;
+    }
 
     while (initialSize > 0) {
         ++currentSize;
@@ -52,14 +80,21 @@ BitVectorHashMap<ValueType, Hash>::BitVectorHashMap(uint64_t bucketSize, uint64_
     }
 
     // Create the underlying containers.
-    buckets = storm::storage::BitVector(bucketSize * (1ull << currentSize));
+    buckets = storm::storage::BitVector(this->bucketSize * (1ull << currentSize));
     occupied = storm::storage::BitVector(1ull << currentSize);
+    fingerprints = std::vector<uint8_t>((1ull << currentSize) + 7, 0);
     values = std::vector<ValueType>(1ull << currentSize);
 }
 
 template<class ValueType, class Hash>
 bool BitVectorHashMap<ValueType, Hash>::isBucketOccupied(uint_fast64_t bucket) const {
-    return occupied.get(bucket);
+    return fingerprints[bucket] != 0;
+}
+
+template<class ValueType, class Hash>
+uint8_t BitVectorHashMap<ValueType, Hash>::getFingerprint(uint64_t hash) {
+    // The bucket is determined by the highest bits of the hash, so we take the lowest ones.
+    return static_cast<uint8_t>(0x80 | (hash & 0x7f));
 }
 
 template<class ValueType, class Hash>
@@ -67,6 +102,11 @@ uint64_t BitVectorHashMap<ValueType, Hash>::size() const {
     return numberOfElements;
 }
 
+template<class ValueType, class Hash>
+bool BitVectorHashMap<ValueType, Hash>::isCompressingKeys() const {
+    return static_cast<bool>(keyCompression);
+}
+
 template<class ValueType, class Hash>
 uint64_t BitVectorHashMap<ValueType, Hash>::capacity() const {
     return 1ull << currentSize;
@@ -82,14 +122,21 @@ void BitVectorHashMap<ValueType, Hash>::increaseSize() {
     std::swap(oldBuckets, buckets);
     storm::storage::BitVector oldOccupied = storm::storage::BitVector(1ull << currentSize);
     std::swap(oldOccupied, occupied);
+    std::vector<uint8_t> oldFingerprints((1ull << currentSize) + 7, 0);
+    std::swap(oldFingerprints, fingerprints);
     std::vector<ValueType> oldValues = std::vector<ValueType>(1ull << currentSize);
     std::swap(oldValues, values);
 
-    // Now iterate through the elements and reinsert them in the new storage.
+    // Now iterate through the elements and reinsert them in the new storage. As all keys are distinct, each key is
+    // put into the first free bucket that is found.
     uint64_t oldSize = numberOfElements;
     numberOfElements = 0;
     for (auto bucketIndex : oldOccupied) {
-        findOrAddAndGetBucket(oldBuckets.get(bucketIndex * bucketSize, bucketSize), oldValues[bucketIndex]);
+        storm::storage::BitVector key = oldBuckets.get(bucketIndex * bucketSize, bucketSize);
+        uint64_t hash = hasher(key);
+        std::pair<bool, uint64_t> flagAndBucket = this->findBucket(key, hash);
+        STORM_LOG_ASSERT(!flagAndBucket.first, "Duplicate key in rehashing.");
+        insertIntoBucket(flagAndBucket.second, key, hash, oldValues[bucketIndex]);
     }
     STORM_LOG_ASSERT(oldSize == numberOfElements, "Size mismatch in rehashing. Size before was " << oldSize << " and new size is " << numberOfElements << ".");
 }
@@ -103,19 +150,33 @@ template<class ValueType, class Hash>
 std::pair<ValueType, uint64_t> BitVectorHashMap<ValueType, Hash>::findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value) {
     checkIncreaseSize();
 
-    std::pair<bool, uint64_t> flagAndBucket = this->findBucket(key);
+    storm::storage::BitVector compressedKey;
+    if (keyCompression) {
+        compressedKey = storm::storage::BitVector(bucketSize);
+        compressedKey.setFromInt(0, 64, keyCompression->compress(key));
+    }
+    storm::storage::BitVector const& storedKey = keyCompression ? compressedKey : key;
+
+    uint64_t hash = hasher(storedKey);
+    std::pair<bool, uint64_t> flagAndBucket = this->findBucket(storedKey, hash);
     if (flagAndBucket.first) {
         return std::make_pair(values[flagAndBucket.second], flagAndBucket.second);
     } else {
-        // Insert the new bits into the bucket.
-        buckets.set(flagAndBucket.second * bucketSize, key);
-        occupied.set(flagAndBucket.second);
-        values[flagAndBucket.second] = value;
-        ++numberOfElements;
+        insertIntoBucket(flagAndBucket.second, storedKey, hash, value);
         return std::make_pair(value, flagAndBucket.second);
     }
 }
 
+template<class ValueType, class Hash>
+void BitVectorHashMap<ValueType, Hash>::insertIntoBucket(uint64_t bucket, storm::storage::BitVector const& key, uint64_t hash, ValueType const& value) {
+    // Insert the new bits into the bucket.
+    buckets.set(bucket * bucketSize, key);
+    occupied.set(bucket);
+    fingerprints[bucket] = getFingerprint(hash);
+    values[bucket] = value;
+    ++numberOfElements;
+}
+
 template<class ValueType, class Hash>
 bool BitVectorHashMap<ValueType, Hash>::checkIncreaseSize() {
     // If the load of the map is too high, we increase the size.
@@ -128,7 +189,7 @@ bool BitVectorHashMap<ValueType, Hash>::checkIncreaseSize() {
 
 template<class ValueType, class Hash>
 ValueType BitVectorHashMap<ValueType, Hash>::getValue(storm::storage::BitVector const& key) const {
-    std::pair<bool, uint64_t> flagBucketPair = this->findBucket(key);
+    std::pair<bool, uint64_t> flagBucketPair = this->findBucketOfKey(key);
     STORM_LOG_ASSERT(flagBucketPair.first, "Unknown key.");
     return values[flagBucketPair.second];
 }
@@ -140,7 +201,16 @@ ValueType BitVectorHashMap<ValueType, Hash>::getValue(uint64_t bucket) const {
 
 template<class ValueType, class Hash>
 bool BitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const& key) const {
-    return findBucket(key).first;
+    return findBucketOfKey(key).first;
+}
+
+template<class ValueType, class Hash>
+std::pair<bool, ValueType> BitVectorHashMap<ValueType, Hash>::find(storm::storage::BitVector const& key) const {
+    std::pair<bool, uint64_t> flagBucketPair = this->findBucketOfKey(key);
+    if (flagBucketPair.first) {
+        return std::make_pair(true, values[flagBucketPair.second]);
+    }
+    return std::make_pair(false, ValueType());
 }
 
 template<class ValueType, class Hash>
@@ -159,25 +229,60 @@ uint64_t BitVectorHashMap<ValueType, Hash>::getCurrentShiftWidth() const {
 }
 
 template<class ValueType, class Hash>
-std::pair<bool, uint64_t> BitVectorHashMap<ValueType, Hash>::findBucket(storm::storage::BitVector const& key) const {
+std::pair<bool, uint64_t> BitVectorHashMap<ValueType, Hash>::findBucketOfKey(storm::storage::BitVector const& key) const {
+    if (keyCompression) {
+        std::pair<bool, uint64_t> flagRootPair = keyCompression->find(key);
+        if (!flagRootPair.first) {
+            // If a part of the key is unknown, the key cannot be contained.
+            return std::make_pair(false, 0ull);
+        }
+        storm::storage::BitVector compressedKey(bucketSize);
+        compressedKey.setFromInt(0, 64, flagRootPair.second);
+        return findBucket(compressedKey, hasher(compressedKey));
+    }
+    return findBucket(key, hasher(key));
+}
+
+template<class ValueType, class Hash>
+std::pair<bool, uint64_t> BitVectorHashMap<ValueType, Hash>::findBucket(storm::storage::BitVector const& key, uint64_t hash) const {
     STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
-    uint64_t bucket = hasher(key) >> this->getCurrentShiftWidth();
+    uint64_t const numberOfBuckets = 1ull << currentSize;
+    uint8_t const fingerprint = getFingerprint(hash);
+    uint64_t const broadcastFingerprint = 0x0101010101010101ull * fingerprint;
+    uint64_t bucket = hash >> this->getCurrentShiftWidth();
+
+    // Probe groups of eight buckets. Within a group, only buckets whose fingerprint matches need to be compared.
+    while (true) {
+        uint64_t group = loadFingerprintGroup(fingerprints.data() + bucket);
+        for (uint64_t candidates = getZeroBytes(group ^ broadcastFingerprint); candidates != 0; candidates &= candidates - 1) {
+            uint64_t candidate = bucket + (__builtin_ctzll(candidates) >> 3);
+            if (candidate < numberOfBuckets && fingerprints[candidate] == fingerprint && buckets.matches(candidate * bucketSize, key)) {
+                return std::make_pair(true, candidate);
+            }
+        }
 
-    while (isBucketOccupied(bucket)) {
-        if (buckets.matches(bucket * bucketSize, key)) {
-            return std::make_pair(true, bucket);
+        // Since no keys are ever removed, the key is not contained if there is a free bucket in the group. Note that
+        // the padding after the last bucket also looks like free buckets.
+        uint64_t freeBuckets = getZeroBytes(group);
+        if (freeBuckets != 0) {
+            uint64_t freeBucket = bucket + (__builtin_ctzll(freeBuckets) >> 3);
+            if (freeBucket < numberOfBuckets) {
+                return std::make_pair(false, freeBucket);
+            }
         }
-        ++bucket;
-        if (bucket == (1ull << currentSize)) {
+
+        bucket += 8;
+        if (bucket >= numberOfBuckets) {
             bucket = 0;
         }
     }
-
-    return std::make_pair(false, bucket);
 }
 
 template<class ValueType, class Hash>
 std::pair<storm::storage::BitVector, ValueType> BitVectorHashMap<ValueType, Hash>::getBucketAndValue(uint64_t bucket) const {
+    if (keyCompression) {
+        return std::make_pair(keyCompression->decompress(buckets.getAsInt(bucket * bucketSize, 64)), values[bucket]);
+    }
     return std::make_pair(buckets.get(bucket * bucketSize, bucketSize), values[bucket]);
 }
 
@@ -3,8 +3,12 @@
 
 #include <cstdint>
 #include <functional>
+#include <vector>
+
+#include <boost/optional.hpp>
 
 #include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorTreeCompression.h"
 
 namespace storm {
 namespace storage {
@@ -13,6 +17,12 @@ namespace storage {
  * This class represents a hash-map whose keys are bit vectors. The value type is arbitrary. Currently, only
  * queries and insertions are supported. Also, the keys must be bit vectors with a length that is a multiple of
  * 64.
+ *
+ * The keys are stored inline in one large bit vector and collisions are resolved by linear probing. For every
+ * bucket, a one-byte fingerprint of the hash value of its key is stored separately, which allows to probe eight
+ * buckets at once and to compare keys only if their fingerprints match. Optionally, keys that consist of several
+ * words can be stored in a tree-compressed form (see BitVectorTreeCompression), such that a bucket only holds the
+ * 64-bit root of the key's tree.
  */
 //        template<typename ValueType, typename Hash = std::hash<storm::storage::BitVector>>
 //        template<typename ValueType, typename Hash = FNV1aBitVectorHash>
@@ -56,8 +66,10 @@ class BitVectorHashMap {
      * @param initialSize The number of buckets that is initially available.
      * @param loadFactor The load factor that determines at which point the size of the underlying storage is
      * increased.
+     * @param compressKeys If set and the bucket size exceeds 64, the keys are stored in a tree-compressed form. This
+     * reduces the memory consumption if many keys share parts, but makes insertions and lookups more expensive.
      */
-    BitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.75);
+    BitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.75, bool compressKeys = false);
 
     BitVectorHashMap(BitVectorHashMap const&) = default;
     BitVectorHashMap(BitVectorHashMap&&) = default;
@@ -117,6 +129,16 @@ class BitVectorHashMap {
      */
     bool contains(storm::storage::BitVector const& key) const;
 
+    /*!
+     * Searches for the given key in the map. As the map is not modified, this may be called concurrently as long
+     * as no other thread modifies the map at the same time.
+     *
+     * @param key The key to search.
+     * @return A pair whose first component indicates whether the key is contained in the map and whose second
+     * component is the value associated with the key (if any).
+     */
+    std::pair<bool, ValueType> find(storm::storage::BitVector const& key) const;
+
     /*!
      * Retrieves an iterator to the elements of the map.
      *
@@ -138,6 +160,11 @@ class BitVectorHashMap {
      */
     uint64_t size() const;
 
+    /*!
+     * Retrieves whether the keys are stored in a compressed form.
+     */
+    bool isCompressingKeys() const;
+
     /*!
      * Retrieves the capacity of the underlying container.
      *
@@ -162,23 +189,40 @@ class BitVectorHashMap {
     bool isBucketOccupied(uint_fast64_t bucket) const;
 
     /*!
-     * Searches for the bucket with the given key.
+     * Searches for the given key and retrieves the bucket in which it is stored (if any).
+     *
+     * @param key The key to search for.
+     * @return A pair whose first component indicates whether the key is contained in the map and whose second
+     * component is the bucket in which it is stored (if any).
+     */
+    std::pair<bool, uint64_t> findBucketOfKey(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Searches for the bucket with the given key as it is stored in the buckets (i.e., after compression).
      *
      * @param key The key to search for.
+     * @param hash The hash value of the key.
      * @return A pair whose first component indicates whether the key is already contained in the map and whose
-     * second component indicates in which bucket the key is stored.
+     * second component indicates in which bucket the key is stored (or, if it is not contained, the first free
+     * bucket in which it can be stored).
      */
-    std::pair<bool, uint64_t> findBucket(storm::storage::BitVector const& key) const;
+    std::pair<bool, uint64_t> findBucket(storm::storage::BitVector const& key, uint64_t hash) const;
 
     /*!
-     * Inserts the given key-value pair without resizing the underlying storage. If that fails, this is
-     * indicated by the return value.
+     * Inserts the given key-value pair into the given (free) bucket.
      *
+     * @param bucket The free bucket into which to insert.
      * @param key The key to insert.
+     * @param hash The hash value of the key.
      * @param value The value to insert.
-     * @return True iff the key-value pair could be inserted without resizing the storage.
      */
-    bool insertWithoutIncreasingSize(storm::storage::BitVector const& key, ValueType const& value);
+    void insertIntoBucket(uint64_t bucket, storm::storage::BitVector const& key, uint64_t hash, ValueType const& value);
+
+    /*!
+     * Retrieves the fingerprint of a key with the given hash value. Fingerprints of keys are never zero, so a zero
+     * fingerprint marks a free bucket.
+     */
+    static uint8_t getFingerprint(uint64_t hash);
 
     /*!
      * Increases the size of the hash map and performs the necessary rehashing of all entries.
@@ -203,6 +247,9 @@ class BitVectorHashMap {
     // The size of one bucket.
     uint64_t bucketSize;
 
+    // If the keys are compressed, this stores the parts of the keys and the buckets only hold the roots of the trees.
+    boost::optional<BitVectorTreeCompression> keyCompression;
+
     // The number of buckets is 2^currentSize.
     uint64_t currentSize;
 
@@ -212,6 +259,10 @@ class BitVectorHashMap {
     // A bit vector that stores which buckets actually hold a value.
     storm::storage::BitVector occupied;
 
+    // The fingerprints of the keys stored in the buckets (or zero for free buckets). Seven zero bytes are appended
+    // such that groups of eight fingerprints can be read starting from any bucket.
+    std::vector<uint8_t> fingerprints;
+
     // A vector of the mapped-to values. The entry at position i is the "target" of the key in bucket i.
     std::vector<ValueType> values;
 
@@ -0,0 +1,149 @@
+#include "storm/storage/BitVectorTreeCompression.h"
+
+#include <limits>
+
+#include "storm/exceptions/OutOfRangeException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * Mixes the bits of the given node (using the finalizer of MurmurHash3) such that the lowest bits can be used to
+ * select a slot of the hash table.
+ */
+inline uint64_t hashTreeNode(uint64_t node) {
+    node ^= node >> 33;
+    node *= 0xff51afd7ed558ccdull;
+    node ^= node >> 33;
+    node *= 0xc4ceb9fe1a85ec53ull;
+    node ^= node >> 33;
+    return node;
+}
+
+BitVectorTreeCompression::BitVectorTreeCompression(uint64_t bitsPerBitVector) : numberOfWords(bitsPerBitVector / 64), slots(1024, 0) {
+    STORM_LOG_ASSERT(bitsPerBitVector % 64 == 0, "Size of bit vectors must be a multiple of 64.");
+    STORM_LOG_ASSERT(numberOfWords >= 2, "Tree compression requires bit vectors of at least two words.");
+
+    // Each level pairs up the nodes of the level below. If the number of nodes is odd, the last one is moved up.
+    levelSizes.push_back(numberOfWords);
+    while (levelSizes.back() > 2) {
+        levelSizes.push_back((levelSizes.back() + 1) / 2);
+    }
+}
+
+uint64_t BitVectorTreeCompression::compress(storm::storage::BitVector const& bitVector) {
+    STORM_LOG_ASSERT(bitVector.size() == numberOfWords * 64, "Size of bit vector does not match.");
+    std::vector<uint64_t> indices(numberOfWords);
+    for (uint64_t word = 0; word < numberOfWords; ++word) {
+        indices[word] = findOrAddNode(bitVector.getAsInt(word * 64, 64));
+    }
+    for (uint64_t level = 1; level < levelSizes.size(); ++level) {
+        uint64_t const lowerSize = levelSizes[level - 1];
+        for (uint64_t position = 0; position < levelSizes[level]; ++position) {
+            if (2 * position + 1 < lowerSize) {
+                indices[position] = findOrAddNode((indices[2 * position] << 32) | indices[2 * position + 1]);
+            } else {
+                indices[position] = indices[2 * position];
+            }
+        }
+    }
+    return (indices[0] << 32) | indices[1];
+}
+
+std::pair<bool, uint64_t> BitVectorTreeCompression::find(storm::storage::BitVector const& bitVector) const {
+    STORM_LOG_ASSERT(bitVector.size() == numberOfWords * 64, "Size of bit vector does not match.");
+    std::vector<uint64_t> indices(numberOfWords);
+    for (uint64_t word = 0; word < numberOfWords; ++word) {
+        uint32_t slotContent = slots[findSlot(bitVector.getAsInt(word * 64, 64))];
+        if (slotContent == 0) {
+            return std::make_pair(false, 0ull);
+        }
+        indices[word] = slotContent - 1;
+    }
+    for (uint64_t level = 1; level < levelSizes.size(); ++level) {
+        uint64_t const lowerSize = levelSizes[level - 1];
+        for (uint64_t position = 0; position < levelSizes[level]; ++position) {
+            if (2 * position + 1 < lowerSize) {
+                uint32_t slotContent = slots[findSlot((indices[2 * position] << 32) | indices[2 * position + 1])];
+                if (slotContent == 0) {
+                    return std::make_pair(false, 0ull);
+                }
+                indices[position] = slotContent - 1;
+            } else {
+                indices[position] = indices[2 * position];
+            }
+        }
+    }
+    return std::make_pair(true, (indices[0] << 32) | indices[1]);
+}
+
+storm::storage::BitVector BitVectorTreeCompression::decompress(uint64_t root) const {
+    std::vector<uint64_t> indices(numberOfWords);
+    indices[0] = root >> 32;
+    indices[1] = root & 0xffffffffull;
+
+    // Expand the nodes level by level. As the children of a node are stored at positions that are at least as large
+    // as the position of the node, we can proceed in place by going through the positions backwards.
+    for (uint64_t level = levelSizes.size() - 1; level > 0; --level) {
+        uint64_t const lowerSize = levelSizes[level - 1];
+        for (uint64_t position = levelSizes[level]; position > 0;) {
+            --position;
+            if (2 * position + 1 < lowerSize) {
+                uint64_t node = nodes[indices[position]];
+                indices[2 * position] = node >> 32;
+                indices[2 * position + 1] = node & 0xffffffffull;
+            } else {
+                indices[2 * position] = indices[position];
+            }
+        }
+    }
+
+    storm::storage::BitVector result(numberOfWords * 64);
+    for (uint64_t word = 0; word < numberOfWords; ++word) {
+        result.setFromInt(word * 64, 64, nodes[indices[word]]);
+    }
+    return result;
+}
+
+uint64_t BitVectorTreeCompression::getNumberOfNodes() const {
+    return nodes.size();
+}
+
+uint32_t BitVectorTreeCompression::findOrAddNode(uint64_t node) {
+    uint64_t slot = findSlot(node);
+    if (slots[slot] != 0) {
+        return slots[slot] - 1;
+    }
+
+    STORM_LOG_THROW(nodes.size() < std::numeric_limits<uint32_t>::max(), storm::exceptions::OutOfRangeException,
+                    "Too many distinct parts of bit vectors for tree compression.");
+    uint32_t index = static_cast<uint32_t>(nodes.size());
+    nodes.push_back(node);
+    slots[slot] = index + 1;
+
+    // Keep the load of the hash table below 3/4.
+    if (4 * nodes.size() >= 3 * slots.size()) {
+        increaseSize();
+    }
+    return index;
+}
+
+uint64_t BitVectorTreeCompression::findSlot(uint64_t node) const {
+    uint64_t const mask = slots.size() - 1;
+    uint64_t slot = hashTreeNode(node) & mask;
+    while (slots[slot] != 0 && nodes[slots[slot] - 1] != node) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+void BitVectorTreeCompression::increaseSize() {
+    slots = std::vector<uint32_t>(2 * slots.size(), 0);
+    for (uint64_t index = 0; index < nodes.size(); ++index) {
+        slots[findSlot(nodes[index])] = static_cast<uint32_t>(index + 1);
+    }
+}
+
+}  // namespace storage
+}  // namespace storm
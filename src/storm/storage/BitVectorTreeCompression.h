@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * This class compresses bit vectors of a fixed length (which must be a multiple of 64) by means of tree compression.
+ * The 64-bit words of a bit vector form the leaves of a binary tree whose inner nodes are the pairs of the indices of
+ * their children. Every word and every pair is stored only once and is identified by a 32-bit index. As a result,
+ * parts that occur in many bit vectors (for example the values of the variables of one module that are combined with
+ * many valuations of the other modules) are only stored once. A compressed bit vector is given by the 64-bit root of
+ * its tree, i.e., the pair of the indices of the two topmost nodes.
+ */
+class BitVectorTreeCompression {
+   public:
+    /*!
+     * Creates an empty compression for bit vectors of the given size.
+     *
+     * @param bitsPerBitVector The size of the bit vectors to compress. This value must be a multiple of 64 and at
+     * least 128.
+     */
+    BitVectorTreeCompression(uint64_t bitsPerBitVector);
+
+    /*!
+     * Compresses the given bit vector. Nodes of the tree that have not been stored before are added.
+     *
+     * @param bitVector The bit vector to compress.
+     * @return The root of the tree representing the bit vector.
+     */
+    uint64_t compress(storm::storage::BitVector const& bitVector);
+
+    /*!
+     * Compresses the given bit vector without adding nodes. As the compression is not modified, this may be called
+     * concurrently as long as no other thread modifies the compression at the same time.
+     *
+     * @param bitVector The bit vector to compress.
+     * @return A pair whose first component indicates whether all nodes of the tree representing the bit vector are
+     * already stored (which is the case if the bit vector was compressed before) and whose second component is the
+     * root of the tree (if any).
+     */
+    std::pair<bool, uint64_t> find(storm::storage::BitVector const& bitVector) const;
+
+    /*!
+     * Retrieves the bit vector represented by the tree with the given root.
+     *
+     * @param root The root of a tree that was obtained by compressing a bit vector.
+     * @return The bit vector.
+     */
+    storm::storage::BitVector decompress(uint64_t root) const;
+
+    /*!
+     * Retrieves the number of (leaf and inner) nodes that are stored.
+     */
+    uint64_t getNumberOfNodes() const;
+
+   private:
+    /*!
+     * Retrieves the index of the given node and adds the node if it is not yet stored.
+     */
+    uint32_t findOrAddNode(uint64_t node);
+
+    /*!
+     * Retrieves the slot of the hash table that holds the index of the given node or, if the node is not stored, the
+     * first free slot in which the index can be stored.
+     */
+    uint64_t findSlot(uint64_t node) const;
+
+    /*!
+     * Doubles the number of slots of the hash table and reinserts all nodes.
+     */
+    void increaseSize();
+
+    // The number of 64-bit words of the bit vectors to compress.
+    uint64_t numberOfWords;
+
+    // The number of nodes on each level of the trees (starting with the leaves). The topmost level has two nodes
+    // which form the root.
+    std::vector<uint64_t> levelSizes;
+
+    // The stored nodes. The index of a node is its position in this vector.
+    std::vector<uint64_t> nodes;
+
+    // An open-addressing hash table that maps nodes to their indices. A slot holds the index of a node plus one,
+    // so zero marks a free slot. The number of slots is a power of two.
+    std::vector<uint32_t> slots;
+};
+
+}  // namespace storage
+}  // namespace storm
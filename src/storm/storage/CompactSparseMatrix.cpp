@@ -0,0 +1,318 @@
+#include "storm/storage/CompactSparseMatrix.h"
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType>
+CompactSparseMatrix<ValueType>::CompactSparseMatrix(storm::storage::SparseMatrix<ValueType> const& matrix)
+    : rowCount(matrix.getRowCount()), columnCount(matrix.getColumnCount()), trivialRowGrouping(matrix.hasTrivialRowGrouping()) {
+    STORM_LOG_THROW(isApplicable(matrix), storm::exceptions::InvalidArgumentException,
+                    "Unable to create compact matrix: The number of columns (" << matrix.getColumnCount() << ") exceeds the number of representable columns.");
+    rowIndications.reserve(rowCount + 1);
+    columns.reserve(matrix.getEntryCount());
+    values.reserve(matrix.getEntryCount());
+
+    rowIndications.push_back(0);
+    for (index_type row = 0; row < rowCount; ++row) {
+        for (auto const& entry : matrix.getRow(row)) {
+            columns.push_back(static_cast<column_type>(entry.getColumn()));
+            values.push_back(entry.getValue());
+        }
+        rowIndications.push_back(columns.size());
+    }
+    if (trivialRowGrouping) {
+        rowGroupIndices = storm::utility::vector::buildVectorForRange<index_type>(0, rowCount + 1);
+    } else {
+        rowGroupIndices = matrix.getRowGroupIndices();
+    }
+}
+
+template<typename ValueType>
+CompactSparseMatrix<ValueType>::CompactSparseMatrix(storm::storage::SparseMatrix<ValueType>&& matrix)
+    : CompactSparseMatrix(static_cast<storm::storage::SparseMatrix<ValueType> const&>(matrix)) {
+    matrix = storm::storage::SparseMatrix<ValueType>();
+}
+
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> CompactSparseMatrix<ValueType>::toSparseMatrix() {
+    typedef typename storm::storage::SparseMatrix<ValueType>::index_type sparse_index_type;
+    std::vector<storm::storage::MatrixEntry<sparse_index_type, ValueType>> columnsAndValues;
+    columnsAndValues.reserve(columns.size());
+    for (index_type entry = 0; entry < columns.size(); ++entry) {
+        columnsAndValues.emplace_back(columns[entry], std::move(values[entry]));
+    }
+    std::vector<column_type>().swap(columns);
+    std::vector<value_type>().swap(values);
+
+    boost::optional<std::vector<sparse_index_type>> groups;
+    if (!trivialRowGrouping) {
+        groups = std::move(rowGroupIndices);
+    }
+    storm::storage::SparseMatrix<ValueType> result(columnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(groups));
+    rowCount = 0;
+    columnCount = 0;
+    rowIndications.clear();
+    rowGroupIndices.clear();
+    return result;
+}
+
+template<typename ValueType>
+bool CompactSparseMatrix<ValueType>::isApplicable(storm::storage::SparseMatrix<ValueType> const& matrix) {
+    return matrix.getColumnCount() <= static_cast<uint64_t>(std::numeric_limits<column_type>::max()) + 1;
+}
+
+template<typename ValueType>
+typename CompactSparseMatrix<ValueType>::index_type CompactSparseMatrix<ValueType>::getRowCount() const {
+    return rowCount;
+}
+
+template<typename ValueType>
+typename CompactSparseMatrix<ValueType>::index_type CompactSparseMatrix<ValueType>::getColumnCount() const {
+    return columnCount;
+}
+
+template<typename ValueType>
+typename CompactSparseMatrix<ValueType>::index_type CompactSparseMatrix<ValueType>::getEntryCount() const {
+    return columns.size();
+}
+
+template<typename ValueType>
+uint64_t CompactSparseMatrix<ValueType>::getSizeInMemory() const {
+    return sizeof(*this) + (rowIndications.size() + rowGroupIndices.size()) * sizeof(index_type) + columns.size() * sizeof(column_type) +
+           values.size() * sizeof(value_type);
+}
+
+template<typename ValueType>
+std::vector<typename CompactSparseMatrix<ValueType>::index_type> const& CompactSparseMatrix<ValueType>::getRowIndications() const {
+    return rowIndications;
+}
+
+template<typename ValueType>
+std::vector<typename CompactSparseMatrix<ValueType>::index_type> const& CompactSparseMatrix<ValueType>::getRowGroupIndices() const {
+    return rowGroupIndices;
+}
+
+template<typename ValueType>
+std::vector<typename CompactSparseMatrix<ValueType>::column_type> const& CompactSparseMatrix<ValueType>::getColumns() const {
+    return columns;
+}
+
+template<typename ValueType>
+std::vector<ValueType> const& CompactSparseMatrix<ValueType>::getValues() const {
+    return values;
+}
+
+template<typename ValueType>
+ValueType CompactSparseMatrix<ValueType>::multiplyRowWithVector(index_type row, std::vector<ValueType> const& vector) const {
+    ValueType result = storm::utility::zero<ValueType>();
+    for (index_type entry = rowIndications[row], entryEnd = rowIndications[row + 1]; entry < entryEnd; ++entry) {
+        result += values[entry] * vector[columns[entry]];
+    }
+    return result;
+}
+
+template<typename ValueType>
+void CompactSparseMatrix<ValueType>::multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                                        std::vector<ValueType> const* summand) const {
+    if (&vector == &result) {
+        STORM_LOG_WARN("Vectors are aliased. Using temporary, which is potentially slow.");
+        std::vector<ValueType> temporary(rowCount);
+        multiplyWithVectorForward(vector, temporary, summand);
+        std::swap(result, temporary);
+    } else {
+        multiplyWithVectorForward(vector, result, summand);
+    }
+}
+
+template<typename ValueType>
+void CompactSparseMatrix<ValueType>::multiplyWithVectorForward(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                                               std::vector<ValueType> const* summand) const {
+    for (index_type row = 0; row < rowCount; ++row) {
+        ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+        newValue += multiplyRowWithVector(row, vector);
+        result[row] = std::move(newValue);
+    }
+}
+
+template<typename ValueType>
+void CompactSparseMatrix<ValueType>::multiplyWithVectorBackward(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                                                std::vector<ValueType> const* summand) const {
+    for (index_type row = rowCount; row > 0; --row) {
+        ValueType newValue = summand ? (*summand)[row - 1] : storm::utility::zero<ValueType>();
+        newValue += multiplyRowWithVector(row - 1, vector);
+        result[row - 1] = std::move(newValue);
+    }
+}
+
+#ifdef STORM_HAVE_INTELTBB
+template<typename ValueType>
+void CompactSparseMatrix<ValueType>::multiplyWithVectorParallel(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                                                std::vector<ValueType> const* summand) const {
+    if (&vector == &result) {
+        STORM_LOG_WARN(
+            "Matrix-vector-multiplication invoked but the target vector uses the same memory as the input vector. This requires to allocate auxiliary memory.");
+        std::vector<ValueType> tmpVector(this->getRowCount());
+        multiplyWithVectorParallel(vector, tmpVector, summand);
+        result = std::move(tmpVector);
+    } else {
+        tbb::parallel_for(tbb::blocked_range<index_type>(0, rowCount, 100), [&](tbb::blocked_range<index_type> const& range) {
+            for (index_type row = range.begin(), rowEnd = range.end(); row < rowEnd; ++row) {
+                ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+                newValue += multiplyRowWithVector(row, vector);
+                result[row] = std::move(newValue);
+            }
+        });
+    }
+}
+#endif
+
+template<typename ValueType>
+template<typename Compare, bool Backward>
+void CompactSparseMatrix<ValueType>::multiplyAndReduceGroups(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
+                                                             std::vector<ValueType> const* summand, std::vector<ValueType>& result,
+                                                             std::vector<uint_fast64_t>* choices, uint64_t firstGroup, uint64_t lastGroup) const {
+    Compare compare;
+    auto getRowValue = [&](uint64_t row) {
+        ValueType rowValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+        rowValue += multiplyRowWithVector(row, vector);
+        return rowValue;
+    };
+
+    for (uint64_t i = firstGroup; i < lastGroup; ++i) {
+        uint64_t const group = Backward ? lastGroup - 1 - (i - firstGroup) : i;
+        uint64_t const groupStart = rowGroupIndices[group];
+        uint64_t const numberOfRows = rowGroupIndices[group + 1] - groupStart;
+
+        // Only multiply and reduce if there is at least one row in the group.
+        if (numberOfRows == 0) {
+            continue;
+        }
+
+        // For correctly tracking choices, we only update if the new choice is strictly better than the old one.
+        uint64_t const oldChoice = choices ? (*choices)[group] : 0;
+        uint64_t selectedChoice = Backward ? numberOfRows - 1 : 0;
+        ValueType currentValue = getRowValue(groupStart + selectedChoice);
+        ValueType oldSelectedChoiceValue = currentValue;
+
+        for (uint64_t offset = 1; offset < numberOfRows; ++offset) {
+            uint64_t const choice = Backward ? numberOfRows - 1 - offset : offset;
+            ValueType newValue = getRowValue(groupStart + choice);
+            if (choices && choice == oldChoice) {
+                oldSelectedChoiceValue = newValue;
+            }
+            if (compare(newValue, currentValue)) {
+                currentValue = std::move(newValue);
+                selectedChoice = choice;
+            }
+        }
+
+        if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+            (*choices)[group] = selectedChoice;
+        }
+        result[group] = std::move(currentValue);
+    }
+}
+
+template<typename ValueType>
+void CompactSparseMatrix<ValueType>::multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                       std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                                       std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+    if (&vector == &result) {
+        STORM_LOG_WARN("Vectors are aliased but are not allowed to be. Using temporary, which is potentially slow.");
+        std::vector<ValueType> temporary(vector.size());
+        multiplyAndReduceForward(dir, rowGroupIndices, vector, summand, temporary, choices);
+        std::swap(temporary, result);
+    } else {
+        multiplyAndReduceForward(dir, rowGroupIndices, vector, summand, result, choices);
+    }
+}
+
+template<typename ValueType>
+void CompactSparseMatrix<ValueType>::multiplyAndReduceForward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                              std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                                              std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+    if (dir == storm::OptimizationDirection::Minimize) {
+        multiplyAndReduceGroups<storm::utility::ElementLess<ValueType>, false>(rowGroupIndices, vector, summand, result, choices, 0, rowGroupIndices.size() - 1);
+    } else {
+        multiplyAndReduceGroups<storm::utility::ElementGreater<ValueType>, false>(rowGroupIndices, vector, summand, result, choices, 0,
+                                                                                  rowGroupIndices.size() - 1);
+    }
+}
+
+template<typename ValueType>
+void CompactSparseMatrix<ValueType>::multiplyAndReduceBackward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                               std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                                               std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+    if (dir == storm::OptimizationDirection::Minimize) {
+        multiplyAndReduceGroups<storm::utility::ElementLess<ValueType>, true>(rowGroupIndices, vector, summand, result, choices, 0, rowGroupIndices.size() - 1);
+    } else {
+        multiplyAndReduceGroups<storm::utility::ElementGreater<ValueType>, true>(rowGroupIndices, vector, summand, result, choices, 0,
+                                                                                 rowGroupIndices.size() - 1);
+    }
+}
+
+#ifdef STORM_HAVE_INTELTBB
+template<typename ValueType>
+void CompactSparseMatrix<ValueType>::multiplyAndReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                               std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                                               std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, rowGroupIndices.size() - 1, 100), [&](tbb::blocked_range<uint64_t> const& range) {
+        if (dir == storm::OptimizationDirection::Minimize) {
+            multiplyAndReduceGroups<storm::utility::ElementLess<ValueType>, false>(rowGroupIndices, vector, summand, result, choices, range.begin(),
+                                                                                   range.end());
+        } else {
+            multiplyAndReduceGroups<storm::utility::ElementGreater<ValueType>, false>(rowGroupIndices, vector, summand, result, choices, range.begin(),
+                                                                                      range.end());
+        }
+    });
+}
+#endif
+
+#ifdef STORM_HAVE_CARL
+template<>
+void CompactSparseMatrix<storm::RationalFunction>::multiplyAndReduceForward(storm::solver::OptimizationDirection const&, std::vector<uint64_t> const&,
+                                                                            std::vector<storm::RationalFunction> const&,
+                                                                            std::vector<storm::RationalFunction> const*,
+                                                                            std::vector<storm::RationalFunction>&, std::vector<uint_fast64_t>*) const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+}
+
+template<>
+void CompactSparseMatrix<storm::RationalFunction>::multiplyAndReduceBackward(storm::solver::OptimizationDirection const&, std::vector<uint64_t> const&,
+                                                                             std::vector<storm::RationalFunction> const&,
+                                                                             std::vector<storm::RationalFunction> const*,
+                                                                             std::vector<storm::RationalFunction>&, std::vector<uint_fast64_t>*) const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+}
+
+#ifdef STORM_HAVE_INTELTBB
+template<>
+void CompactSparseMatrix<storm::RationalFunction>::multiplyAndReduceParallel(storm::solver::OptimizationDirection const&, std::vector<uint64_t> const&,
+                                                                             std::vector<storm::RationalFunction> const&,
+                                                                             std::vector<storm::RationalFunction> const*,
+                                                                             std::vector<storm::RationalFunction>&, std::vector<uint_fast64_t>*) const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+}
+#endif
+#endif
+
+template class CompactSparseMatrix<double>;
+#ifdef STORM_HAVE_CARL
+template class CompactSparseMatrix<storm::RationalNumber>;
+template class CompactSparseMatrix<storm::RationalFunction>;
+#endif
+
+}  // namespace storage
+}  // namespace storm
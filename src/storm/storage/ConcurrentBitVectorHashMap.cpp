@@ -0,0 +1,231 @@
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType, typename Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::Table::Table(uint64_t bucketSize, uint64_t sizeExponent)
+    : sizeExponent(sizeExponent),
+      buckets(bucketSize << sizeExponent),
+      fingerprints(1ull << sizeExponent, 0),
+      values(1ull << sizeExponent),
+      numberOfElements(0) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType, typename Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, uint64_t numberOfSegments,
+                                                                        double loadFactor)
+    : bucketSize(bucketSize), loadFactor(loadFactor), hashBits(sizeof(decltype(hasher(storm::storage::BitVector()))) * 8), segmentBits(0), numberOfElements(0) {
+    STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
+    STORM_LOG_THROW(loadFactor > 0 && loadFactor < 1, storm::exceptions::InvalidArgumentException, "Load factor must be in the open interval (0,1).");
+    STORM_LOG_THROW(numberOfSegments > 0, storm::exceptions::InvalidArgumentException, "The number of segments must be positive.");
+
+    // The segments are selected by (at most 16 of) the highest bits of the hash values.
+    while ((1ull << segmentBits) < numberOfSegments && segmentBits < 16) {
+        ++segmentBits;
+    }
+
+    // Distribute the initial size over the segments.
+    uint64_t sizeExponent = 3;
+    uint64_t bucketsPerSegment = static_cast<uint64_t>(std::ceil(static_cast<double>(initialSize >> segmentBits) / loadFactor));
+    while ((1ull << sizeExponent) < bucketsPerSegment) {
+        ++sizeExponent;
+    }
+
+    segments = std::vector<Segment>(1ull << segmentBits);
+    for (auto& segment : segments) {
+        segment.table = std::make_unique<Table>(bucketSize, sizeExponent);
+    }
+}
+
+template<typename ValueType, typename Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getSegmentIndex(uint64_t hash) const {
+    return segmentBits == 0 ? 0 : hash >> (hashBits - segmentBits);
+}
+
+template<typename ValueType, typename Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getFirstBucket(uint64_t hash, uint64_t sizeExponent) const {
+    // Use the highest bits that are not used to select the segment. If the table has more buckets than there are such
+    // bits, the remaining (lowest) bits of the bucket are zero.
+    uint64_t const availableBits = hashBits - segmentBits;
+    uint64_t const remainingHash = hash & ((1ull << availableBits) - 1);
+    if (sizeExponent <= availableBits) {
+        return remainingHash >> (availableBits - sizeExponent);
+    }
+    return remainingHash << (sizeExponent - availableBits);
+}
+
+template<typename ValueType, typename Hash>
+uint8_t ConcurrentBitVectorHashMap<ValueType, Hash>::getFingerprint(uint64_t hash) {
+    // The highest bit is always set, which distinguishes fingerprints of keys from free and migrated buckets.
+    return static_cast<uint8_t>(0x80 | (hash & 0x7f));
+}
+
+template<typename ValueType, typename Hash>
+std::pair<bool, uint64_t> ConcurrentBitVectorHashMap<ValueType, Hash>::findBucket(Table const& table, storm::storage::BitVector const& key,
+                                                                                 uint64_t hash) const {
+    STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+    uint64_t const mask = (1ull << table.sizeExponent) - 1;
+    uint8_t const fingerprint = getFingerprint(hash);
+
+    // Since the load factor is below one, there always is a free bucket. Migrated buckets are skipped.
+    for (uint64_t bucket = getFirstBucket(hash, table.sizeExponent);; bucket = (bucket + 1) & mask) {
+        uint8_t const bucketFingerprint = table.fingerprints[bucket];
+        if (bucketFingerprint == 0) {
+            return std::make_pair(false, bucket);
+        }
+        if (bucketFingerprint == fingerprint && table.buckets.matches(bucket * bucketSize, key)) {
+            return std::make_pair(true, bucket);
+        }
+    }
+}
+
+template<typename ValueType, typename Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::insertIntoBucket(Table& table, uint64_t bucket, storm::storage::BitVector const& key, uint64_t hash,
+                                                                   ValueType const& value) const {
+    table.buckets.set(bucket * bucketSize, key);
+    table.fingerprints[bucket] = getFingerprint(hash);
+    table.values[bucket] = value;
+    ++table.numberOfElements;
+}
+
+template<typename ValueType, typename Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::migrate(Segment& segment, uint64_t numberOfBuckets) const {
+    if (!segment.oldTable) {
+        return;
+    }
+
+    Table& oldTable = *segment.oldTable;
+    uint64_t const oldNumberOfBuckets = 1ull << oldTable.sizeExponent;
+    uint64_t const end = std::min(oldNumberOfBuckets, segment.migrationPosition + numberOfBuckets);
+    for (; segment.migrationPosition < end; ++segment.migrationPosition) {
+        uint64_t const bucket = segment.migrationPosition;
+        if ((oldTable.fingerprints[bucket] & 0x80) == 0) {
+            continue;
+        }
+        storm::storage::BitVector key = oldTable.buckets.get(bucket * bucketSize, bucketSize);
+        uint64_t const hash = hasher(key);
+        std::pair<bool, uint64_t> flagBucketPair = findBucket(*segment.table, key, hash);
+        STORM_LOG_ASSERT(!flagBucketPair.first, "Duplicate key in migration.");
+        insertIntoBucket(*segment.table, flagBucketPair.second, key, hash, oldTable.values[bucket]);
+        oldTable.fingerprints[bucket] = migratedFingerprint;
+        --oldTable.numberOfElements;
+    }
+
+    if (segment.migrationPosition == oldNumberOfBuckets) {
+        STORM_LOG_ASSERT(oldTable.numberOfElements == 0, "Keys left behind in migration.");
+        segment.oldTable.reset();
+        segment.migrationPosition = 0;
+    }
+}
+
+template<typename ValueType, typename Hash>
+ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+    return findOrAdd(key, [&value]() { return value; }).first;
+}
+
+template<typename ValueType, typename Hash>
+std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key,
+                                                                                 std::function<ValueType()> const& getNewValue) {
+    uint64_t const hash = hasher(key);
+    Segment& segment = segments[getSegmentIndex(hash)];
+    std::lock_guard<std::mutex> lock(segment.mutex);
+
+    std::pair<bool, uint64_t> flagBucketPair = findBucket(*segment.table, key, hash);
+    if (flagBucketPair.first) {
+        return std::make_pair(segment.table->values[flagBucketPair.second], false);
+    }
+    if (segment.oldTable) {
+        std::pair<bool, uint64_t> oldFlagBucketPair = findBucket(*segment.oldTable, key, hash);
+        if (oldFlagBucketPair.first) {
+            return std::make_pair(segment.oldTable->values[oldFlagBucketPair.second], false);
+        }
+    }
+
+    // The key is inserted, so we move a few keys of the old table (if any) first.
+    migrate(segment, migrationStepSize);
+
+    // If the load of the segment is too high, the keys are moved to a table of twice the size step by step.
+    uint64_t const segmentSize = segment.table->numberOfElements + (segment.oldTable ? segment.oldTable->numberOfElements : 0);
+    if (segmentSize + 1 > loadFactor * (1ull << segment.table->sizeExponent)) {
+        STORM_LOG_TRACE("Increasing size of hash map segment from " << (1ull << segment.table->sizeExponent) << " to "
+                                                                    << (1ull << (segment.table->sizeExponent + 1)) << ".");
+        // A pending migration is finished at once, which is rare as the migration steps clearly outpace the insertions.
+        if (segment.oldTable) {
+            migrate(segment, 1ull << segment.oldTable->sizeExponent);
+        }
+        uint64_t const newSizeExponent = segment.table->sizeExponent + 1;
+        segment.oldTable = std::move(segment.table);
+        segment.table = std::make_unique<Table>(bucketSize, newSizeExponent);
+        migrate(segment, migrationStepSize);
+    }
+
+    flagBucketPair = findBucket(*segment.table, key, hash);
+    ValueType value = getNewValue();
+    insertIntoBucket(*segment.table, flagBucketPair.second, key, hash, value);
+    ++numberOfElements;
+    return std::make_pair(value, true);
+}
+
+template<typename ValueType, typename Hash>
+std::pair<bool, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::find(storm::storage::BitVector const& key) const {
+    uint64_t const hash = hasher(key);
+    Segment const& segment = segments[getSegmentIndex(hash)];
+    std::lock_guard<std::mutex> lock(segment.mutex);
+
+    std::pair<bool, uint64_t> flagBucketPair = findBucket(*segment.table, key, hash);
+    if (flagBucketPair.first) {
+        return std::make_pair(true, segment.table->values[flagBucketPair.second]);
+    }
+    if (segment.oldTable) {
+        flagBucketPair = findBucket(*segment.oldTable, key, hash);
+        if (flagBucketPair.first) {
+            return std::make_pair(true, segment.oldTable->values[flagBucketPair.second]);
+        }
+    }
+    return std::make_pair(false, ValueType());
+}
+
+template<typename ValueType, typename Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const& key) const {
+    return find(key).first;
+}
+
+template<typename ValueType, typename Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::size() const {
+    return numberOfElements.load();
+}
+
+template<typename ValueType, typename Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::capacity() const {
+    uint64_t result = 0;
+    for (auto const& segment : segments) {
+        std::lock_guard<std::mutex> lock(segment.mutex);
+        result += 1ull << segment.table->sizeExponent;
+    }
+    return result;
+}
+
+template<typename ValueType, typename Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getNumberOfMigratingSegments() const {
+    uint64_t result = 0;
+    for (auto const& segment : segments) {
+        std::lock_guard<std::mutex> lock(segment.mutex);
+        if (segment.oldTable) {
+            ++result;
+        }
+    }
+    return result;
+}
+
+template class ConcurrentBitVectorHashMap<uint64_t>;
+template class ConcurrentBitVectorHashMap<uint32_t>;
+}  // namespace storage
+}  // namespace storm
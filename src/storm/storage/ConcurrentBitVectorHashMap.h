@@ -0,0 +1,173 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * This class represents a hash map whose keys are bit vectors and that can be queried and extended by several threads
+ * at once. As for BitVectorHashMap, only queries and insertions are supported and the keys must be bit vectors with a
+ * length that is a multiple of 64.
+ *
+ * The map is split into segments, which are selected by the highest bits of the hash value of a key. Every segment is
+ * an open addressing table with linear probing and fingerprints (as in BitVectorHashMap) that is guarded by its own
+ * lock, so threads only wait for each other if they access the same segment. If a segment becomes too full, a table of
+ * twice the size is allocated. Instead of rehashing all keys at once, every subsequent insertion into the segment moves
+ * a few keys of the old table to the new one. Until all keys are moved, lookups consult both tables.
+ */
+template<typename ValueType, typename Hash = Murmur3BitVectorHash<ValueType>>
+class ConcurrentBitVectorHashMap {
+   public:
+    /*!
+     * Creates a new hash map.
+     *
+     * @param bucketSize The size of the keys that this map can hold. This value must be a multiple of 64.
+     * @param initialSize The number of keys for which space is initially available.
+     * @param numberOfSegments The number of segments, which is rounded up to the next power of two. It should clearly
+     * exceed the number of threads that access the map.
+     * @param loadFactor The load factor that determines at which point the size of a segment is increased.
+     */
+    ConcurrentBitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, uint64_t numberOfSegments = 64, double loadFactor = 0.75);
+
+    ConcurrentBitVectorHashMap(ConcurrentBitVectorHashMap const&) = delete;
+    ConcurrentBitVectorHashMap& operator=(ConcurrentBitVectorHashMap const&) = delete;
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the key is
+     * inserted with the given value. This may be called concurrently.
+     *
+     * @param key The key to search or insert.
+     * @param value The value that is inserted if the key is not already found in the map.
+     * @return The found value if the key is already contained in the map and the provided new value otherwise.
+     */
+    ValueType findOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+
+    /*!
+     * Searches for the given key in the map. If it is not found, the key is inserted with the value returned by the
+     * given function. The function is only called if the key is inserted, and no other thread can insert the same key
+     * in the meantime. This may be called concurrently.
+     *
+     * @param key The key to search or insert.
+     * @param getNewValue A function that returns the value of a new key.
+     * @return A pair whose first component is the value associated with the key and whose second component indicates
+     * whether the key was inserted.
+     */
+    std::pair<ValueType, bool> findOrAdd(storm::storage::BitVector const& key, std::function<ValueType()> const& getNewValue);
+
+    /*!
+     * Searches for the given key in the map. This may be called concurrently (also with insertions).
+     *
+     * @param key The key to search.
+     * @return A pair whose first component indicates whether the key is contained in the map and whose second
+     * component is the value associated with the key (if any).
+     */
+    std::pair<bool, ValueType> find(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Checks if the given key is already contained in the map.
+     *
+     * @param key The key to search
+     * @return True if the key is already contained in the map
+     */
+    bool contains(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Retrieves the size of the map in terms of the number of key-value pairs it stores.
+     *
+     * @return The size of the map.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the number of buckets of the (current) tables of all segments.
+     */
+    uint64_t capacity() const;
+
+    /*!
+     * Retrieves the number of segments whose keys are currently moved to a larger table.
+     */
+    uint64_t getNumberOfMigratingSegments() const;
+
+   private:
+    // An open addressing table whose buckets hold keys, their fingerprints and their values.
+    struct Table {
+        Table(uint64_t bucketSize, uint64_t sizeExponent);
+
+        // The number of buckets is 2^sizeExponent.
+        uint64_t sizeExponent;
+        storm::storage::BitVector buckets;
+        // The fingerprints of the keys in the buckets. Zero marks a free bucket and migratedFingerprint a bucket whose
+        // key has been moved to a larger table.
+        std::vector<uint8_t> fingerprints;
+        std::vector<ValueType> values;
+        uint64_t numberOfElements;
+    };
+
+    struct Segment {
+        mutable std::mutex mutex;
+        std::unique_ptr<Table> table;
+        // The previous table whose keys are moved to the current one (or nullptr if all keys have been moved).
+        std::unique_ptr<Table> oldTable;
+        // The next bucket of the old table whose key is moved.
+        uint64_t migrationPosition = 0;
+    };
+
+    uint64_t getSegmentIndex(uint64_t hash) const;
+
+    /*!
+     * Retrieves the bucket at which the search for a key with the given hash starts in a table of the given size.
+     */
+    uint64_t getFirstBucket(uint64_t hash, uint64_t sizeExponent) const;
+
+    static uint8_t getFingerprint(uint64_t hash);
+
+    /*!
+     * Searches for the given key in the given table.
+     *
+     * @return A pair whose first component indicates whether the key is contained in the table and whose second
+     * component is the bucket in which it is stored (or, if it is not contained, the first free bucket).
+     */
+    std::pair<bool, uint64_t> findBucket(Table const& table, storm::storage::BitVector const& key, uint64_t hash) const;
+
+    void insertIntoBucket(Table& table, uint64_t bucket, storm::storage::BitVector const& key, uint64_t hash, ValueType const& value) const;
+
+    /*!
+     * Moves the keys of (at most) the given number of buckets of the old table of the given segment to its current table.
+     */
+    void migrate(Segment& segment, uint64_t numberOfBuckets) const;
+
+    // The fingerprint of a bucket whose key has been moved to a larger table. It differs from all fingerprints of keys.
+    static const uint8_t migratedFingerprint = 1;
+
+    // The number of buckets of the old table whose keys are moved with every insertion into a segment.
+    static const uint64_t migrationStepSize = 16;
+
+    // The size of the keys.
+    uint64_t bucketSize;
+
+    // The load factor determining when the size of a segment is increased.
+    double loadFactor;
+
+    // The number of bits of a hash value and the number of its (highest) bits that select the segment.
+    uint64_t hashBits;
+    uint64_t segmentBits;
+
+    std::vector<Segment> segments;
+
+    // The number of elements in this map.
+    std::atomic<uint64_t> numberOfElements;
+
+    // Functor object that is used to perform the actual hashing.
+    Hash hasher;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -1,11 +1,15 @@
-#include <list>
+#include <algorithm>
+#include <iterator>
 #include <numeric>
-#include <queue>
 
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/ParallelEnvironment.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace storage {
@@ -43,6 +47,15 @@ MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(st
     performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, &states, &choices);
 }
 
+template<typename ValueType>
+MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(Environment const& env,
+                                                                              storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                              storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                              storm::storage::BitVector const* states,
+                                                                              storm::storage::BitVector const* choices) {
+    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, states, choices, &env);
+}
+
 template<typename ValueType>
 MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::models::sparse::NondeterministicModel<ValueType> const& model,
                                                                               storm::storage::BitVector const& states) {
@@ -71,26 +84,136 @@ MaximalEndComponentDecomposition<ValueType>& MaximalEndComponentDecomposition<Va
     return *this;
 }
 
+/*!
+ * Refines the given MEC candidate by first decomposing it into SCCs and then iteratively removing the states that have no
+ * choice whose successors all stay in the respective SCC. The given choices are only read, which allows for refining several
+ * (disjoint) candidates concurrently.
+ *
+ * @param candidate The MEC candidate to refine.
+ * @param includedChoices The choices that are still considered.
+ * @param newCandidates If the candidate is not an MEC, the (non-empty) refined candidates are appended to this vector.
+ * @param excludedChoices Is set to the choices of the candidate's states that were found to leave the candidate. The choices are
+ * numbered consecutively in the order of the candidate's states, i.e., the vector has one bit per choice of the candidate's states.
+ * @return True iff the candidate changed, i.e., iff the candidate is not an MEC.
+ */
+template<typename ValueType>
+bool refineEndComponentCandidate(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                 StateBlock const& candidate, storm::storage::BitVector const& includedChoices, std::vector<StateBlock>& newCandidates,
+                                 storm::storage::BitVector& excludedChoices) {
+    uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
+    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
+
+    // Number the choices of the candidate's states consecutively, so the excluded choices only take as many bits as the candidate has choices.
+    std::vector<uint_fast64_t> firstLocalChoice;
+    firstLocalChoice.reserve(candidate.size() + 1);
+    firstLocalChoice.push_back(0);
+    for (auto state : candidate) {
+        firstLocalChoice.push_back(firstLocalChoice.back() + nondeterministicChoiceIndices[state + 1] - nondeterministicChoiceIndices[state]);
+    }
+    excludedChoices = storm::storage::BitVector(firstLocalChoice.back());
+
+    storm::storage::BitVector candidateAsBitVector(numberOfStates);
+    candidateAsBitVector.set(candidate.begin(), candidate.end(), true);
+
+    // Get an SCC decomposition of the current MEC candidate.
+    StronglyConnectedComponentDecomposition<ValueType> sccs(
+        transitionMatrix, StronglyConnectedComponentDecompositionOptions().subsystem(&candidateAsBitVector).choices(&includedChoices).dropNaiveSccs());
+
+    // We need to do another iteration in case we have either more than once SCC or the SCC is smaller than
+    // the MEC canditate itself.
+    bool candidateChanged = sccs.size() != 1 || (sccs.size() > 0 && sccs[0].size() < candidate.size());
+
+    // Check for each of the SCCs whether there is at least one action for each state that does not leave the SCC.
+    storm::storage::BitVector statesToCheck(numberOfStates);
+    for (auto& scc : sccs) {
+        statesToCheck.set(scc.begin(), scc.end());
+
+        while (!statesToCheck.empty()) {
+            storm::storage::BitVector statesToRemove(numberOfStates);
+
+            for (auto state : statesToCheck) {
+                bool keepStateInMEC = false;
+                uint_fast64_t localChoice =
+                    firstLocalChoice[std::distance(candidate.begin(), std::lower_bound(candidate.begin(), candidate.end(), state))];
+
+                for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1];
+                     ++choice, ++localChoice) {
+                    // If the choice is not included any more or already known to leave the candidate, skip it.
+                    if (!includedChoices.get(choice) || excludedChoices.get(localChoice)) {
+                        continue;
+                    }
+
+                    bool choiceContainedInMEC = true;
+                    for (auto const& entry : transitionMatrix.getRow(choice)) {
+                        if (storm::utility::isZero(entry.getValue())) {
+                            continue;
+                        }
+
+                        if (!scc.containsState(entry.getColumn())) {
+                            // As SCCs only get smaller, the choice will not be contained in an MEC.
+                            excludedChoices.set(localChoice);
+                            choiceContainedInMEC = false;
+                            break;
+                        }
+                    }
+
+                    // If there is at least one choice whose successor states are fully contained in the MEC, we can leave the state in the MEC.
+                    if (choiceContainedInMEC) {
+                        keepStateInMEC = true;
+                    }
+                }
+
+                if (!keepStateInMEC) {
+                    statesToRemove.set(state, true);
+                }
+            }
+
+            // Now erase the states that have no option to stay inside the MEC with all successors.
+            candidateChanged |= !statesToRemove.empty();
+            for (uint_fast64_t state : statesToRemove) {
+                scc.erase(state);
+            }
+
+            // Now check which states should be reconsidered, because successors of them were removed.
+            statesToCheck.clear();
+            for (auto state : statesToRemove) {
+                for (auto const& entry : backwardTransitions.getRow(state)) {
+                    if (scc.containsState(entry.getColumn())) {
+                        statesToCheck.set(entry.getColumn());
+                    }
+                }
+            }
+        }
+    }
+
+    if (candidateChanged) {
+        for (StronglyConnectedComponent& scc : sccs) {
+            if (!scc.empty()) {
+                newCandidates.push_back(std::move(scc));
+            }
+        }
+    }
+    return candidateChanged;
+}
+
 template<typename ValueType>
 void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                                                          storm::storage::SparseMatrix<ValueType> backwardTransitions,
+                                                                                          storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                           storm::storage::BitVector const* states,
-                                                                                          storm::storage::BitVector const* choices) {
+                                                                                          storm::storage::BitVector const* choices, Environment const* env) {
     // Get some data for convenient access.
-    uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
     std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
 
-    // Initialize the maximal end component list to be the full state space.
-    std::list<StateBlock> endComponentStateSets;
+    // Initialize the list of MEC candidates to be the full state space.
+    std::vector<StateBlock> candidates;
     if (states) {
-        endComponentStateSets.emplace_back(states->begin(), states->end(), true);
+        candidates.emplace_back(states->begin(), states->end(), true);
     } else {
         std::vector<storm::storage::sparse::state_type> allStates;
         allStates.resize(transitionMatrix.getRowGroupCount());
         std::iota(allStates.begin(), allStates.end(), 0);
-        endComponentStateSets.emplace_back(allStates.begin(), allStates.end(), true);
+        candidates.emplace_back(allStates.begin(), allStates.end(), true);
     }
-    storm::storage::BitVector statesToCheck(numberOfStates);
     storm::storage::BitVector includedChoices;
     if (choices) {
         includedChoices = *choices;
@@ -104,105 +227,58 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
     } else {
         includedChoices = storm::storage::BitVector(transitionMatrix.getRowCount(), true);
     }
-    storm::storage::BitVector currMecAsBitVector(transitionMatrix.getRowGroupCount());
-
-    for (std::list<StateBlock>::const_iterator mecIterator = endComponentStateSets.begin(); mecIterator != endComponentStateSets.end();) {
-        StateBlock const& mec = *mecIterator;
-        currMecAsBitVector.clear();
-        currMecAsBitVector.set(mec.begin(), mec.end(), true);
-        // Keep track of whether the MEC changed during this iteration.
-        bool mecChanged = false;
-
-        // Get an SCC decomposition of the current MEC candidate.
-
-        StronglyConnectedComponentDecomposition<ValueType> sccs(
-            transitionMatrix, StronglyConnectedComponentDecompositionOptions().subsystem(&currMecAsBitVector).choices(&includedChoices).dropNaiveSccs());
-
-        // We need to do another iteration in case we have either more than once SCC or the SCC is smaller than
-        // the MEC canditate itself.
-        mecChanged |= sccs.size() != 1 || (sccs.size() > 0 && sccs[0].size() < mec.size());
-
-        // Check for each of the SCCs whether there is at least one action for each state that does not leave the SCC.
-        for (auto& scc : sccs) {
-            statesToCheck.set(scc.begin(), scc.end());
-
-            while (!statesToCheck.empty()) {
-                storm::storage::BitVector statesToRemove(numberOfStates);
-
-                for (auto state : statesToCheck) {
-                    bool keepStateInMEC = false;
-
-                    for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
-                        // If the choice is not part of our subsystem, skip it.
-                        if (choices && !choices->get(choice)) {
-                            continue;
-                        }
-
-                        // If the choice is not included any more, skip it.
-                        if (!includedChoices.get(choice)) {
-                            continue;
-                        }
-
-                        bool choiceContainedInMEC = true;
-                        for (auto const& entry : transitionMatrix.getRow(choice)) {
-                            if (storm::utility::isZero(entry.getValue())) {
-                                continue;
-                            }
-
-                            if (!scc.containsState(entry.getColumn())) {
-                                includedChoices.set(choice, false);
-                                choiceContainedInMEC = false;
-                                break;
-                            }
-                        }
 
-                        // If there is at least one choice whose successor states are fully contained in the MEC, we can leave the state in the MEC.
-                        if (choiceContainedInMEC) {
-                            keepStateInMEC = true;
-                        }
-                    }
-
-                    if (!keepStateInMEC) {
-                        statesToRemove.set(state, true);
-                    }
-                }
-
-                // Now erase the states that have no option to stay inside the MEC with all successors.
-                mecChanged |= !statesToRemove.empty();
-                for (uint_fast64_t state : statesToRemove) {
-                    scc.erase(state);
-                }
-
-                // Now check which states should be reconsidered, because successors of them were removed.
-                statesToCheck.clear();
-                for (auto state : statesToRemove) {
-                    for (auto const& entry : backwardTransitions.getRow(state)) {
-                        if (scc.containsState(entry.getColumn())) {
-                            statesToCheck.set(entry.getColumn());
-                        }
+    // The candidates are processed in rounds. In each round, all current candidates are refined. The candidates that did not change
+    // are MECs, the others are replaced by their refinements, which are processed in the next round. Since different candidates are
+    // disjoint, they can be refined independently of each other.
+    std::vector<StateBlock> endComponentStateSets;
+    while (!candidates.empty()) {
+        std::vector<std::vector<StateBlock>> newCandidates(candidates.size());
+        std::vector<storm::storage::BitVector> excludedChoices(candidates.size());
+        std::vector<char> candidateChanged(candidates.size());
+        auto refineCandidate = [&](uint_fast64_t index) {
+            candidateChanged[index] = refineEndComponentCandidate(transitionMatrix, backwardTransitions, candidates[index], includedChoices,
+                                                                  newCandidates[index], excludedChoices[index]);
+        };
+#ifdef STORM_HAVE_INTELTBB
+        if (env && env->parallel().isParallel()) {
+            storm::utility::parallel::executeWithThreadLimit(*env, [&]() {
+                tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, candidates.size()), [&](tbb::blocked_range<uint_fast64_t> const& range) {
+                    for (uint_fast64_t index = range.begin(); index < range.end(); ++index) {
+                        refineCandidate(index);
                     }
-                }
+                });
+            });
+        } else {
+            for (uint_fast64_t index = 0; index < candidates.size(); ++index) {
+                refineCandidate(index);
             }
         }
+#else
+        for (uint_fast64_t index = 0; index < candidates.size(); ++index) {
+            refineCandidate(index);
+        }
+#endif
 
-        // If the MEC changed, we delete it from the list of MECs and append the possible new MEC candidates to
-        // the list instead.
-        if (mecChanged) {
-            for (StronglyConnectedComponent& scc : sccs) {
-                if (!scc.empty()) {
-                    endComponentStateSets.push_back(std::move(scc));
+        // Collect the results in the order of the candidates, which yields the same order of MECs as a (sequential) worklist algorithm.
+        std::vector<StateBlock> nextCandidates;
+        for (uint_fast64_t index = 0; index < candidates.size(); ++index) {
+            uint_fast64_t localChoice = 0;
+            for (auto state : candidates[index]) {
+                for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice, ++localChoice) {
+                    if (excludedChoices[index].get(localChoice)) {
+                        includedChoices.set(choice, false);
+                    }
                 }
             }
-
-            std::list<StateBlock>::const_iterator eraseIterator(mecIterator);
-            ++mecIterator;
-            endComponentStateSets.erase(eraseIterator);
-        } else {
-            // Otherwise, we proceed with the next MEC candidate.
-            ++mecIterator;
+            if (candidateChanged[index]) {
+                std::move(newCandidates[index].begin(), newCandidates[index].end(), std::back_inserter(nextCandidates));
+            } else {
+                endComponentStateSets.push_back(std::move(candidates[index]));
+            }
         }
-
-    }  // End of loop over all MEC candidates.
+        candidates = std::move(nextCandidates);
+    }
 
     // Now that we computed the underlying state sets of the MECs, we need to properly identify the choices
     // contained in the MEC and store them as actual MECs.
@@ -6,6 +6,9 @@
 #include "storm/storage/MaximalEndComponent.h"
 
 namespace storm {
+
+class Environment;
+
 namespace storage {
 
 /*!
@@ -58,6 +61,21 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
                                      storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states,
                                      storm::storage::BitVector const& choices);
 
+    /*
+     * Creates an MEC decomposition of the given subsystem of given model (represented by a row-grouped matrix). If the
+     * environment allows for parallelism, independent MEC candidates are refined in parallel. The result is the same as
+     * for the sequential computation (including the order of the MECs).
+     *
+     * @param env The environment that determines whether (and with how many threads) the decomposition is computed in parallel.
+     * @param transitionMatrix The transition relation of model to decompose into MECs.
+     * @param backwardTransition The reversed transition relation.
+     * @param states If non-null, the states of the subsystem to decompose.
+     * @param choices If non-null, the choices of the subsystem to decompose.
+     */
+    MaximalEndComponentDecomposition(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const* states = nullptr,
+                                     storm::storage::BitVector const* choices = nullptr);
+
     /*!
      * Creates an MEC decomposition of the given subsystem in the given model.
      *
@@ -103,10 +121,12 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
      * @param backwardTransitions The reversed transition relation.
      * @param states The states of the subsystem to decompose.
      * @param choices The choices of the subsystem to decompose.
+     * @param env If non-null and the environment allows for parallelism, the MEC candidates are refined in parallel.
      */
     void performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                 storm::storage::SparseMatrix<ValueType> backwardTransitions, storm::storage::BitVector const* states = nullptr,
-                                                 storm::storage::BitVector const* choices = nullptr);
+                                                 storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                 storm::storage::BitVector const* states = nullptr, storm::storage::BitVector const* choices = nullptr,
+                                                 Environment const* env = nullptr);
 };
 }  // namespace storage
 }  // namespace storm
@@ -1,10 +1,18 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include <storm/utility/vector.h>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <numeric>
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/ParallelEnvironment.h"
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/exceptions/UnexpectedException.h"
 
@@ -21,6 +29,13 @@ StronglyConnectedComponentDecomposition<ValueType>::StronglyConnectedComponentDe
     performSccDecomposition(transitionMatrix, options);
 }
 
+template<typename ValueType>
+StronglyConnectedComponentDecomposition<ValueType>::StronglyConnectedComponentDecomposition(Environment const& env,
+                                                                                            storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                                            StronglyConnectedComponentDecompositionOptions const& options) {
+    performSccDecomposition(transitionMatrix, options, &env);
+}
+
 template<typename ValueType>
 StronglyConnectedComponentDecomposition<ValueType>::StronglyConnectedComponentDecomposition(StronglyConnectedComponentDecomposition const& other)
     : Decomposition(other) {
@@ -166,9 +181,375 @@ void performSccDecompositionGCM(storm::storage::SparseMatrix<ValueType> const& t
     }
 }
 
+#ifdef STORM_HAVE_INTELTBB
+/*!
+ * Calls the given function for all indices 0, ..., size - 1 in parallel.
+ */
+template<typename Function>
+void parallelForEachIndex(uint_fast64_t size, Function const& function) {
+    tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, size), [&](tbb::blocked_range<uint_fast64_t> const& range) {
+        for (uint_fast64_t index = range.begin(); index < range.end(); ++index) {
+            function(index);
+        }
+    });
+}
+
+/*!
+ * Calls the given function for all indices 0, ..., size - 1 in parallel, where each call may append values to the
+ * given vector. The values are returned in the order of the indices, i.e., the result does not depend on the scheduling.
+ */
+template<typename Function>
+std::vector<uint_fast64_t> parallelCollect(uint_fast64_t size, Function const& function) {
+    return tbb::parallel_reduce(
+        tbb::blocked_range<uint_fast64_t>(0, size, 256), std::vector<uint_fast64_t>(),
+        [&](tbb::blocked_range<uint_fast64_t> const& range, std::vector<uint_fast64_t> values) {
+            for (uint_fast64_t index = range.begin(); index < range.end(); ++index) {
+                function(index, values);
+            }
+            return values;
+        },
+        [](std::vector<uint_fast64_t> left, std::vector<uint_fast64_t> const& right) {
+            left.insert(left.end(), right.begin(), right.end());
+            return left;
+        });
+}
+
+/*!
+ * The transition relation as considered by the parallel SCC decomposition, stored in both directions. Self-loops,
+ * transitions with value zero, transitions leaving the subsystem and transitions of choices outside the subsystem are omitted.
+ */
+struct SccSearchGraph {
+    std::vector<uint_fast64_t> forwardIndices;
+    std::vector<uint_fast64_t> forwardColumns;
+    std::vector<uint_fast64_t> backwardIndices;
+    std::vector<uint_fast64_t> backwardColumns;
+    std::vector<uint8_t> hasSelfLoop;
+};
+
+/*!
+ * Builds the graph on which the parallel SCC decomposition operates.
+ */
+template<typename ValueType>
+SccSearchGraph buildSccSearchGraph(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const* subsystem,
+                                   storm::storage::BitVector const* choices) {
+    uint_fast64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+    auto forEachSuccessor = [&](uint_fast64_t state, auto const& function) {
+        for (uint64_t row = transitionMatrix.getRowGroupIndices()[state], rowEnd = transitionMatrix.getRowGroupIndices()[state + 1]; row != rowEnd; ++row) {
+            if (choices && !choices->get(row)) {
+                continue;
+            }
+            for (auto const& successor : transitionMatrix.getRow(row)) {
+                if ((!subsystem || subsystem->get(successor.getColumn())) && successor.getValue() != storm::utility::zero<ValueType>()) {
+                    function(successor.getColumn());
+                }
+            }
+        }
+    };
+
+    SccSearchGraph graph;
+    graph.forwardIndices.assign(numberOfStates + 1, 0);
+    graph.hasSelfLoop.assign(numberOfStates, 0);
+    parallelForEachIndex(numberOfStates, [&](uint_fast64_t state) {
+        if (!subsystem || subsystem->get(state)) {
+            forEachSuccessor(state, [&](uint_fast64_t successor) {
+                if (successor == state) {
+                    graph.hasSelfLoop[state] = 1;
+                } else {
+                    ++graph.forwardIndices[state + 1];
+                }
+            });
+        }
+    });
+    std::partial_sum(graph.forwardIndices.begin(), graph.forwardIndices.end(), graph.forwardIndices.begin());
+    graph.forwardColumns.resize(graph.forwardIndices.back());
+
+    // Fill the forward relation and count the predecessors of each state.
+    std::vector<std::atomic<uint_fast64_t>> counters(numberOfStates);
+    parallelForEachIndex(numberOfStates, [&](uint_fast64_t state) { counters[state].store(0); });
+    parallelForEachIndex(numberOfStates, [&](uint_fast64_t state) {
+        if (!subsystem || subsystem->get(state)) {
+            uint_fast64_t position = graph.forwardIndices[state];
+            forEachSuccessor(state, [&](uint_fast64_t successor) {
+                if (successor != state) {
+                    graph.forwardColumns[position++] = successor;
+                    counters[successor].fetch_add(1);
+                }
+            });
+        }
+    });
+
+    // Fill the backward relation. The order of the predecessors of a state depends on the scheduling, which is irrelevant for the search.
+    graph.backwardIndices.assign(numberOfStates + 1, 0);
+    for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+        graph.backwardIndices[state + 1] = graph.backwardIndices[state] + counters[state].load();
+    }
+    graph.backwardColumns.resize(graph.backwardIndices.back());
+    parallelForEachIndex(numberOfStates, [&](uint_fast64_t state) { counters[state].store(graph.backwardIndices[state]); });
+    parallelForEachIndex(numberOfStates, [&](uint_fast64_t state) {
+        for (uint_fast64_t index = graph.forwardIndices[state]; index < graph.forwardIndices[state + 1]; ++index) {
+            graph.backwardColumns[counters[graph.forwardColumns[index]].fetch_add(1)] = state;
+        }
+    });
+    return graph;
+}
+
+/*!
+ * Marks all states of the given partition that are reachable from the given state with respect to the given (forward
+ * or backward) relation. Each level of the search is expanded in parallel.
+ */
+void searchWithinPartition(uint_fast64_t startState, uint_fast64_t partition, std::vector<uint_fast64_t> const& partitions,
+                           std::vector<uint_fast64_t> const& indices, std::vector<uint_fast64_t> const& columns, std::vector<uint8_t>& reached) {
+    std::vector<uint_fast64_t> frontier = {startState};
+    reached[startState] = 1;
+    while (!frontier.empty()) {
+        std::vector<uint_fast64_t> candidates = parallelCollect(frontier.size(), [&](uint_fast64_t frontierIndex, std::vector<uint_fast64_t>& values) {
+            uint_fast64_t const state = frontier[frontierIndex];
+            for (uint_fast64_t index = indices[state]; index < indices[state + 1]; ++index) {
+                if (partitions[columns[index]] == partition && !reached[columns[index]]) {
+                    values.push_back(columns[index]);
+                }
+            }
+        });
+        frontier.clear();
+        for (auto const& candidate : candidates) {
+            if (!reached[candidate]) {
+                reached[candidate] = 1;
+                frontier.push_back(candidate);
+            }
+        }
+    }
+}
+
+/*!
+ * Computes a mapping of states to their SCCs in parallel. First, states that can not lie on a cycle with other states
+ * are iteratively removed (trimming). The remaining states are decomposed using forward-backward searches: the SCC of a
+ * pivot state is the intersection of its forward and backward reachable states and all other SCCs lie completely within
+ * one of the three remaining parts, which are then decomposed independently. Finally, the SCCs are sorted such that each SCC
+ * comes after all SCCs reachable from it, which is done level-wise, i.e., by increasing SCC depth (and by the smallest
+ * contained state for SCCs with the same depth).
+ *
+ * @param transitionMatrix The transition matrix of the system to decompose.
+ * @param subsystem An optional bit vector indicating which subsystem to consider.
+ * @param choices An optional bit vector indicating which choices belong to the subsystem.
+ * @param nonTrivialStates A bit vector where entries for non-trivial states (states that either have a selfloop or whose SCC is not a singleton) will be set to
+ * true
+ * @param stateToSccMapping A mapping from states to the SCC indices they belong to, which is filled by this function.
+ * @param sccDepths The depths of the SCCs are written to this vector.
+ * @return The number of SCCs.
+ */
+template<typename ValueType>
+uint_fast64_t performParallelSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const* subsystem,
+                                              storm::storage::BitVector const* choices, storm::storage::BitVector& nonTrivialStates,
+                                              std::vector<uint_fast64_t>& stateToSccMapping, std::vector<uint_fast64_t>& sccDepths) {
+    uint_fast64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+    uint_fast64_t const noValue = std::numeric_limits<uint_fast64_t>::max();
+    auto isInSubsystem = [&](uint_fast64_t state) { return !subsystem || subsystem->get(state); };
+    SccSearchGraph graph = buildSccSearchGraph(transitionMatrix, subsystem, choices);
+
+    // Each SCC is identified by its smallest state, which we call its representative.
+    std::vector<uint_fast64_t> representatives(numberOfStates, noValue);
+
+    // Remove states without predecessors or successors (among the remaining states). Each of these states forms an SCC on its own.
+    {
+        std::vector<std::atomic<uint_fast64_t>> remainingPredecessors(numberOfStates);
+        std::vector<std::atomic<uint_fast64_t>> remainingSuccessors(numberOfStates);
+        parallelForEachIndex(numberOfStates, [&](uint_fast64_t state) {
+            remainingPredecessors[state].store(graph.backwardIndices[state + 1] - graph.backwardIndices[state]);
+            remainingSuccessors[state].store(graph.forwardIndices[state + 1] - graph.forwardIndices[state]);
+        });
+        std::vector<uint_fast64_t> frontier = parallelCollect(numberOfStates, [&](uint_fast64_t state, std::vector<uint_fast64_t>& values) {
+            if (isInSubsystem(state) && (remainingPredecessors[state].load() == 0 || remainingSuccessors[state].load() == 0)) {
+                values.push_back(state);
+            }
+        });
+        for (auto const& state : frontier) {
+            representatives[state] = state;
+        }
+        while (!frontier.empty()) {
+            std::vector<uint_fast64_t> candidates = parallelCollect(frontier.size(), [&](uint_fast64_t frontierIndex, std::vector<uint_fast64_t>& values) {
+                uint_fast64_t const state = frontier[frontierIndex];
+                for (uint_fast64_t index = graph.forwardIndices[state]; index < graph.forwardIndices[state + 1]; ++index) {
+                    if (remainingPredecessors[graph.forwardColumns[index]].fetch_sub(1) == 1) {
+                        values.push_back(graph.forwardColumns[index]);
+                    }
+                }
+                for (uint_fast64_t index = graph.backwardIndices[state]; index < graph.backwardIndices[state + 1]; ++index) {
+                    if (remainingSuccessors[graph.backwardColumns[index]].fetch_sub(1) == 1) {
+                        values.push_back(graph.backwardColumns[index]);
+                    }
+                }
+            });
+            frontier.clear();
+            for (auto const& candidate : candidates) {
+                if (representatives[candidate] == noValue) {
+                    representatives[candidate] = candidate;
+                    frontier.push_back(candidate);
+                }
+            }
+        }
+    }
+
+    // Decompose the remaining states by forward-backward searches. All partitions of one round are processed in parallel.
+    {
+        std::vector<uint_fast64_t> partitions(numberOfStates, noValue);
+        std::vector<std::vector<uint_fast64_t>> currentPartitions;
+        std::vector<uint_fast64_t> remainingStates = parallelCollect(numberOfStates, [&](uint_fast64_t state, std::vector<uint_fast64_t>& values) {
+            if (isInSubsystem(state) && representatives[state] == noValue) {
+                values.push_back(state);
+            }
+        });
+        if (!remainingStates.empty()) {
+            for (auto const& state : remainingStates) {
+                partitions[state] = 0;
+            }
+            currentPartitions.push_back(std::move(remainingStates));
+        }
+        uint_fast64_t nextPartition = 1;
+        std::vector<uint8_t> forwardReached(numberOfStates, 0);
+        std::vector<uint8_t> backwardReached(numberOfStates, 0);
+        while (!currentPartitions.empty()) {
+            // The states of each partition are sorted, so the pivot (the first state) is the representative of its SCC.
+            // As the searches only write information about states of their own partition, they can run concurrently.
+            tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, currentPartitions.size(), 1), [&](tbb::blocked_range<uint_fast64_t> const& range) {
+                for (uint_fast64_t index = range.begin(); index < range.end(); ++index) {
+                    std::vector<uint_fast64_t> const& partitionStates = currentPartitions[index];
+                    if (partitionStates.size() > 1) {
+                        uint_fast64_t const pivot = partitionStates.front();
+                        searchWithinPartition(pivot, partitions[pivot], partitions, graph.forwardIndices, graph.forwardColumns, forwardReached);
+                        searchWithinPartition(pivot, partitions[pivot], partitions, graph.backwardIndices, graph.backwardColumns, backwardReached);
+                    }
+                }
+            });
+
+            // Split the partitions. This is done only after all searches have finished as it changes the partition of states.
+            std::vector<std::vector<std::vector<uint_fast64_t>>> splitPartitions(currentPartitions.size());
+            tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, currentPartitions.size(), 1), [&](tbb::blocked_range<uint_fast64_t> const& range) {
+                for (uint_fast64_t index = range.begin(); index < range.end(); ++index) {
+                    std::vector<uint_fast64_t> const& partitionStates = currentPartitions[index];
+                    uint_fast64_t const pivot = partitionStates.front();
+                    if (partitionStates.size() == 1) {
+                        representatives[pivot] = pivot;
+                        continue;
+                    }
+                    // The new partitions contain the states that are only forward reachable, only backward reachable and neither.
+                    splitPartitions[index].resize(3);
+                    for (auto const& state : partitionStates) {
+                        if (forwardReached[state] && backwardReached[state]) {
+                            representatives[state] = pivot;
+                        } else {
+                            uint_fast64_t const part = forwardReached[state] ? 0 : (backwardReached[state] ? 1 : 2);
+                            partitions[state] = nextPartition + 3 * index + part;
+                            splitPartitions[index][part].push_back(state);
+                        }
+                        forwardReached[state] = 0;
+                        backwardReached[state] = 0;
+                    }
+                }
+            });
+            nextPartition += 3 * currentPartitions.size();
+
+            currentPartitions.clear();
+            for (auto& parts : splitPartitions) {
+                for (auto& part : parts) {
+                    if (!part.empty()) {
+                        currentPartitions.push_back(std::move(part));
+                    }
+                }
+            }
+        }
+    }
+
+    // Determine the size of each SCC as well as the number of transitions leaving it.
+    std::vector<std::atomic<uint_fast64_t>> sccSizes(numberOfStates);
+    std::vector<std::atomic<uint_fast64_t>> remainingSccSuccessors(numberOfStates);
+    parallelForEachIndex(numberOfStates, [&](uint_fast64_t state) {
+        sccSizes[state].store(0);
+        remainingSccSuccessors[state].store(0);
+    });
+    parallelForEachIndex(numberOfStates, [&](uint_fast64_t state) {
+        if (isInSubsystem(state)) {
+            uint_fast64_t const representative = representatives[state];
+            sccSizes[representative].fetch_add(1);
+            uint_fast64_t leavingTransitions = 0;
+            for (uint_fast64_t index = graph.forwardIndices[state]; index < graph.forwardIndices[state + 1]; ++index) {
+                if (representatives[graph.forwardColumns[index]] != representative) {
+                    ++leavingTransitions;
+                }
+            }
+            if (leavingTransitions > 0) {
+                remainingSccSuccessors[representative].fetch_add(leavingTransitions);
+            }
+        }
+    });
+
+    // Each thread writes to different buckets of the bit vector.
+    parallelForEachIndex((numberOfStates + 63) / 64, [&](uint_fast64_t bucket) {
+        for (uint_fast64_t state = bucket * 64, stateEnd = std::min(state + 64, numberOfStates); state < stateEnd; ++state) {
+            if (isInSubsystem(state) && (graph.hasSelfLoop[state] || sccSizes[representatives[state]].load() > 1)) {
+                nonTrivialStates.set(state, true);
+            }
+        }
+    });
+
+    // Group the states by their SCC.
+    std::vector<uint_fast64_t> sccStateIndices(numberOfStates + 1, 0);
+    for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+        sccStateIndices[state + 1] = sccStateIndices[state] + sccSizes[state].load();
+    }
+    std::vector<uint_fast64_t> sccStates(sccStateIndices.back());
+    parallelForEachIndex(numberOfStates, [&](uint_fast64_t state) { sccSizes[state].store(sccStateIndices[state]); });
+    parallelForEachIndex(numberOfStates, [&](uint_fast64_t state) {
+        if (isInSubsystem(state)) {
+            sccStates[sccSizes[representatives[state]].fetch_add(1)] = state;
+        }
+    });
+
+    // Sort the SCCs level-wise, starting with the bottom SCCs. An SCC is part of the next level as soon as all transitions leaving it have been considered.
+    std::vector<uint_fast64_t> sccIndices(numberOfStates, noValue);
+    std::vector<uint_fast64_t> currentLevel = parallelCollect(numberOfStates, [&](uint_fast64_t state, std::vector<uint_fast64_t>& values) {
+        if (isInSubsystem(state) && representatives[state] == state && remainingSccSuccessors[state].load() == 0) {
+            values.push_back(state);
+        }
+    });
+    uint_fast64_t sccCount = 0;
+    uint_fast64_t depth = 0;
+    sccDepths.clear();
+    while (!currentLevel.empty()) {
+        for (auto const& representative : currentLevel) {
+            sccIndices[representative] = sccCount++;
+            sccDepths.push_back(depth);
+        }
+        std::vector<uint_fast64_t> nextLevel = parallelCollect(currentLevel.size(), [&](uint_fast64_t levelIndex, std::vector<uint_fast64_t>& values) {
+            uint_fast64_t const representative = currentLevel[levelIndex];
+            for (uint_fast64_t sccStateIndex = sccStateIndices[representative]; sccStateIndex < sccStateIndices[representative + 1]; ++sccStateIndex) {
+                uint_fast64_t const state = sccStates[sccStateIndex];
+                for (uint_fast64_t index = graph.backwardIndices[state]; index < graph.backwardIndices[state + 1]; ++index) {
+                    uint_fast64_t const predecessorRepresentative = representatives[graph.backwardColumns[index]];
+                    if (predecessorRepresentative != representative && remainingSccSuccessors[predecessorRepresentative].fetch_sub(1) == 1) {
+                        values.push_back(predecessorRepresentative);
+                    }
+                }
+            }
+        });
+        // Which thread completes an SCC depends on the scheduling, so we sort the level to obtain a deterministic order.
+        std::sort(nextLevel.begin(), nextLevel.end());
+        currentLevel = std::move(nextLevel);
+        ++depth;
+    }
+
+    parallelForEachIndex(numberOfStates, [&](uint_fast64_t state) {
+        if (isInSubsystem(state)) {
+            stateToSccMapping[state] = sccIndices[representatives[state]];
+        }
+    });
+    return sccCount;
+}
+#endif
+
 template<typename ValueType>
 void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                                                 StronglyConnectedComponentDecompositionOptions const& options) {
+                                                                                 StronglyConnectedComponentDecompositionOptions const& options,
+                                                                                 Environment const* env) {
     STORM_LOG_ASSERT(!options.choicesPtr || options.subsystemPtr, "Expecting subsystem if choices are given.");
 
     uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
@@ -179,7 +560,19 @@ void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition
 
     // Obtain a mapping from states to the SCC it belongs to
     std::vector<uint_fast64_t> stateToSccMapping(numberOfStates);
-    {
+    if (env && env->parallel().isParallel()) {
+#ifdef STORM_HAVE_INTELTBB
+        std::vector<uint_fast64_t> parallelSccDepths;
+        storm::utility::parallel::executeWithThreadLimit(*env, [&]() {
+            sccCount = performParallelSccDecomposition(transitionMatrix, options.subsystemPtr, options.choicesPtr, nonTrivialStates, stateToSccMapping,
+                                                       parallelSccDepths);
+        });
+        sccDepths = boost::none;
+        if (options.isComputeSccDepthsSet || options.areOnlyBottomSccsConsidered) {
+            sccDepths = std::move(parallelSccDepths);
+        }
+#endif
+    } else {
         // Set up the environment of the algorithm.
         // Start with the two stacks it maintains.
         // This is to reduce memory (re-)allocations
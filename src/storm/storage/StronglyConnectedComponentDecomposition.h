@@ -8,6 +8,9 @@
 #include "storm/storage/StronglyConnectedComponent.h"
 #include "storm/utility/constants.h"
 namespace storm {
+
+class Environment;
+
 namespace models {
 namespace sparse {
 // Forward declare the model class.
@@ -80,6 +83,20 @@ class StronglyConnectedComponentDecomposition : public Decomposition<StronglyCon
     StronglyConnectedComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                             StronglyConnectedComponentDecompositionOptions const& options = StronglyConnectedComponentDecompositionOptions());
 
+    /*
+     * Creates an SCC decomposition of the given subsystem in the given system. If the environment allows for parallelism,
+     * the SCCs are computed by a parallel algorithm (trimming of trivial SCCs followed by forward-backward searches). The
+     * resulting SCCs (and their depths) are the same as for the sequential computation and the SCCs are also sorted
+     * topologically (i.e., the successors of an SCC come first). However, the order of SCCs that do not depend on each
+     * other might differ from the sequential computation.
+     *
+     * @param env The environment that determines whether (and with how many threads) the decomposition is computed in parallel.
+     * @param transitionMatrix The transition matrix of the system to decompose.
+     * @param options options for the decomposition
+     */
+    StronglyConnectedComponentDecomposition(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                            StronglyConnectedComponentDecompositionOptions const& options = StronglyConnectedComponentDecompositionOptions());
+
     /*!
      * Creates an SCC decomposition by copying the given SCC decomposition.
      *
@@ -132,9 +149,10 @@ class StronglyConnectedComponentDecomposition : public Decomposition<StronglyCon
      * the vector of blocks of the decomposition.
      *
      * @param transitionMatrix The transition matrix of the system to decompose.
+     * @param env If non-null, the environment that determines whether the decomposition is computed in parallel.
      */
     void performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                 StronglyConnectedComponentDecompositionOptions const& options);
+                                 StronglyConnectedComponentDecompositionOptions const& options, Environment const* env = nullptr);
 
     boost::optional<std::vector<uint_fast64_t>> sccDepths;
 };
@@ -0,0 +1,143 @@
+#include "storm/storage/expressions/BytecodeCompiledExpression.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace expressions {
+
+BytecodeCompiledExpression::BytecodeCompiledExpression(std::vector<Instruction>&& instructions, uint64_t numberOfRegisters)
+    : instructions(std::move(instructions)), numberOfRegisters(numberOfRegisters) {
+    // Intentionally left empty.
+}
+
+double BytecodeCompiledExpression::evaluate(double const* booleanValues, double const* integerValues, double const* rationalValues,
+                                            double* registers) const {
+    return evaluate(booleanValues, integerValues, rationalValues, nullptr, registers);
+}
+
+double BytecodeCompiledExpression::evaluate(storm::storage::BitVector const& values, double* registers) const {
+    return evaluate(nullptr, nullptr, nullptr, &values, registers);
+}
+
+double BytecodeCompiledExpression::evaluate(double const* booleanValues, double const* integerValues, double const* rationalValues,
+                                            storm::storage::BitVector const* bitVector, double* registers) const {
+    Instruction const* const begin = instructions.data();
+    Instruction const* const end = begin + instructions.size();
+    for (Instruction const* instruction = begin; instruction != end; ++instruction) {
+        double& target = registers[instruction->target];
+        switch (instruction->opCode) {
+            case OpCode::LoadConstant:
+                target = instruction->constant;
+                break;
+            case OpCode::LoadBoolean:
+                target = booleanValues[instruction->first];
+                break;
+            case OpCode::LoadInteger:
+                target = integerValues[instruction->first];
+                break;
+            case OpCode::LoadRational:
+                target = rationalValues[instruction->first];
+                break;
+            case OpCode::LoadBooleanFromBitVector:
+                target = bitVector->get(instruction->first) ? 1.0 : 0.0;
+                break;
+            case OpCode::LoadIntegerFromBitVector:
+                target = static_cast<double>(bitVector->getAsInt(instruction->first, instruction->second)) + instruction->constant;
+                break;
+            case OpCode::Jump:
+                // Account for the increment of the loop.
+                instruction = begin + instruction->second - 1;
+                break;
+            case OpCode::JumpIfZero:
+                if (registers[instruction->first] == 0.0) {
+                    instruction = begin + instruction->second - 1;
+                }
+                break;
+            case OpCode::JumpIfNonZero:
+                if (registers[instruction->first] != 0.0) {
+                    instruction = begin + instruction->second - 1;
+                }
+                break;
+            case OpCode::Not:
+                target = registers[instruction->first] == 0.0 ? 1.0 : 0.0;
+                break;
+            case OpCode::Negate:
+                target = -registers[instruction->first];
+                break;
+            case OpCode::Floor:
+                target = std::floor(registers[instruction->first]);
+                break;
+            case OpCode::Ceil:
+                target = std::ceil(registers[instruction->first]);
+                break;
+            case OpCode::Plus:
+                target = registers[instruction->first] + registers[instruction->second];
+                break;
+            case OpCode::Minus:
+                target = registers[instruction->first] - registers[instruction->second];
+                break;
+            case OpCode::Times:
+                target = registers[instruction->first] * registers[instruction->second];
+                break;
+            case OpCode::Divide:
+                target = registers[instruction->first] / registers[instruction->second];
+                break;
+            case OpCode::Power:
+                target = std::pow(registers[instruction->first], registers[instruction->second]);
+                break;
+            case OpCode::Modulo:
+                target = std::fmod(registers[instruction->first], registers[instruction->second]);
+                break;
+            case OpCode::Min:
+                target = std::min(registers[instruction->first], registers[instruction->second]);
+                break;
+            case OpCode::Max:
+                target = std::max(registers[instruction->first], registers[instruction->second]);
+                break;
+            case OpCode::Xor:
+                target = (registers[instruction->first] != 0.0) != (registers[instruction->second] != 0.0) ? 1.0 : 0.0;
+                break;
+            case OpCode::Implies:
+                target = (registers[instruction->first] == 0.0 || registers[instruction->second] != 0.0) ? 1.0 : 0.0;
+                break;
+            case OpCode::Iff:
+            case OpCode::Equal:
+                target = registers[instruction->first] == registers[instruction->second] ? 1.0 : 0.0;
+                break;
+            case OpCode::NotEqual:
+                target = registers[instruction->first] != registers[instruction->second] ? 1.0 : 0.0;
+                break;
+            case OpCode::Less:
+                target = registers[instruction->first] < registers[instruction->second] ? 1.0 : 0.0;
+                break;
+            case OpCode::LessOrEqual:
+                target = registers[instruction->first] <= registers[instruction->second] ? 1.0 : 0.0;
+                break;
+            case OpCode::Greater:
+                target = registers[instruction->first] > registers[instruction->second] ? 1.0 : 0.0;
+                break;
+            case OpCode::GreaterOrEqual:
+                target = registers[instruction->first] >= registers[instruction->second] ? 1.0 : 0.0;
+                break;
+        }
+    }
+    return registers[0];
+}
+
+uint64_t BytecodeCompiledExpression::getNumberOfRegisters() const {
+    return numberOfRegisters;
+}
+
+std::vector<BytecodeCompiledExpression::Instruction> const& BytecodeCompiledExpression::getInstructions() const {
+    return instructions;
+}
+
+bool BytecodeCompiledExpression::isBytecodeCompiledExpression() const {
+    return true;
+}
+
+}  // namespace expressions
+}  // namespace storm
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/expressions/CompiledExpression.h"
+
+namespace storm {
+namespace storage {
+class BitVector;
+}
+
+namespace expressions {
+
+/*!
+ * An expression that is compiled to a sequence of instructions operating on registers. As in exprtk, all values
+ * (including boolean and integer ones) are represented as doubles, where booleans are encoded as 0 and 1. Evaluating
+ * the instructions avoids traversing the expression tree with a virtual call for every node.
+ *
+ * The values of variables are either taken from arrays indexed by the offsets of the variables or directly from a bit
+ * vector (such as a compressed state of a model) in which the variables are stored at fixed bit offsets.
+ */
+class BytecodeCompiledExpression : public CompiledExpression {
+   public:
+    enum class OpCode : uint8_t {
+        // Loads a constant or the value of a variable into the target register.
+        LoadConstant,
+        LoadBoolean,
+        LoadInteger,
+        LoadRational,
+        // Loads the value of a variable stored at the bit offset given by the first field from a bit vector. For integer
+        // variables, the second field holds the bit width and the constant the lower bound of the variable.
+        LoadBooleanFromBitVector,
+        LoadIntegerFromBitVector,
+        // Jumps to the given instruction (if the value in the first register is zero or non-zero, respectively).
+        Jump,
+        JumpIfZero,
+        JumpIfNonZero,
+        // Unary operations on the first register.
+        Not,
+        Negate,
+        Floor,
+        Ceil,
+        // Binary operations on the first and the second register.
+        Plus,
+        Minus,
+        Times,
+        Divide,
+        Power,
+        Modulo,
+        Min,
+        Max,
+        Xor,
+        Implies,
+        Iff,
+        Equal,
+        NotEqual,
+        Less,
+        LessOrEqual,
+        Greater,
+        GreaterOrEqual
+    };
+
+    struct Instruction {
+        OpCode opCode;
+
+        // The register into which the result is written.
+        uint32_t target;
+
+        // The first operand register (or, for loads of variables, the offset of the variable).
+        uint32_t first;
+
+        // The second operand register (or, for jumps, the index of the instruction to jump to).
+        uint32_t second;
+
+        // The value of a loaded constant.
+        double constant;
+    };
+
+    /*!
+     * Creates a compiled expression with the given instructions. The result of the expression must be written to the
+     * first register.
+     *
+     * @param instructions The instructions of the expression.
+     * @param numberOfRegisters The number of registers used by the instructions.
+     */
+    BytecodeCompiledExpression(std::vector<Instruction>&& instructions, uint64_t numberOfRegisters);
+
+    /*!
+     * Evaluates the expression with the given values of the variables. The values of variables are indexed by the
+     * offsets of the variables.
+     *
+     * @param booleanValues The values of the boolean variables.
+     * @param integerValues The values of the integer variables.
+     * @param rationalValues The values of the rational variables.
+     * @param registers The registers used for the evaluation. This needs to hold at least the number of registers of
+     * this expression.
+     * @return The value of the expression.
+     */
+    double evaluate(double const* booleanValues, double const* integerValues, double const* rationalValues, double* registers) const;
+
+    /*!
+     * Evaluates the expression with the values of the variables stored in the given bit vector. This requires that the
+     * expression was compiled for the layout of the bit vector (see ToBytecodeVisitor).
+     *
+     * @param values The bit vector storing the values of the variables.
+     * @param registers The registers used for the evaluation. This needs to hold at least the number of registers of
+     * this expression.
+     * @return The value of the expression.
+     */
+    double evaluate(storm::storage::BitVector const& values, double* registers) const;
+
+    /*!
+     * Retrieves the number of registers needed to evaluate the expression.
+     */
+    uint64_t getNumberOfRegisters() const;
+
+    /*!
+     * Retrieves the instructions of the expression.
+     */
+    std::vector<Instruction> const& getInstructions() const;
+
+    virtual bool isBytecodeCompiledExpression() const override;
+
+   private:
+    /*!
+     * Evaluates the expression by taking the values of variables from the given arrays or the given bit vector,
+     * depending on the load instructions.
+     */
+    double evaluate(double const* booleanValues, double const* integerValues, double const* rationalValues, storm::storage::BitVector const* bitVector,
+                    double* registers) const;
+
+    // The instructions of the expression.
+    std::vector<Instruction> instructions;
+
+    // The number of registers needed to evaluate the expression.
+    uint64_t numberOfRegisters;
+};
+
+}  // namespace expressions
+}  // namespace storm
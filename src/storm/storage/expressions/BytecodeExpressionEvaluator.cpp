@@ -0,0 +1,53 @@
+#include "storm/storage/expressions/BytecodeExpressionEvaluator.h"
+
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/ToBytecodeVisitor.h"
+
+namespace storm {
+namespace expressions {
+
+BytecodeExpressionEvaluator::BytecodeExpressionEvaluator(storm::expressions::ExpressionManager const& manager)
+    : ExpressionEvaluatorBase<double>(manager),
+      booleanValues(manager.getNumberOfBooleanVariables()),
+      integerValues(manager.getNumberOfIntegerVariables()),
+      rationalValues(manager.getNumberOfRationalVariables()) {
+    // Intentionally left empty.
+}
+
+bool BytecodeExpressionEvaluator::asBool(Expression const& expression) const {
+    return evaluate(expression) == 1.0;
+}
+
+int_fast64_t BytecodeExpressionEvaluator::asInt(Expression const& expression) const {
+    return static_cast<int_fast64_t>(evaluate(expression));
+}
+
+double BytecodeExpressionEvaluator::asRational(Expression const& expression) const {
+    return evaluate(expression);
+}
+
+void BytecodeExpressionEvaluator::setBooleanValue(storm::expressions::Variable const& variable, bool value) {
+    this->booleanValues[variable.getOffset()] = static_cast<double>(value);
+}
+
+void BytecodeExpressionEvaluator::setIntegerValue(storm::expressions::Variable const& variable, int_fast64_t value) {
+    this->integerValues[variable.getOffset()] = static_cast<double>(value);
+}
+
+void BytecodeExpressionEvaluator::setRationalValue(storm::expressions::Variable const& variable, double value) {
+    this->rationalValues[variable.getOffset()] = value;
+}
+
+double BytecodeExpressionEvaluator::evaluate(storm::expressions::Expression const& expression) const {
+    if (!expression.hasCompiledExpression() || !expression.getCompiledExpression().isBytecodeCompiledExpression()) {
+        expression.setCompiledExpression(ToBytecodeVisitor().compile(expression));
+    }
+    BytecodeCompiledExpression const& compiledExpression = expression.getCompiledExpression().asBytecodeCompiledExpression();
+    if (registers.size() < compiledExpression.getNumberOfRegisters()) {
+        registers.resize(compiledExpression.getNumberOfRegisters());
+    }
+    return compiledExpression.evaluate(booleanValues.data(), integerValues.data(), rationalValues.data(), registers.data());
+}
+
+}  // namespace expressions
+}  // namespace storm
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <vector>
+
+#include "storm/storage/expressions/BytecodeCompiledExpression.h"
+#include "storm/storage/expressions/ExpressionEvaluatorBase.h"
+
+namespace storm {
+namespace expressions {
+
+/*!
+ * An evaluator that compiles expressions to register bytecode (see BytecodeCompiledExpression) and evaluates them
+ * using the values of the variables stored in this evaluator. As the compiled expressions only refer to the offsets of
+ * the variables, they are cached in the expressions and can be shared by all evaluators of the same manager.
+ */
+class BytecodeExpressionEvaluator : public ExpressionEvaluatorBase<double> {
+   public:
+    /*!
+     * Creates an expression evaluator that is capable of evaluating expressions managed by the given manager.
+     *
+     * @param manager The manager responsible for the expressions.
+     */
+    BytecodeExpressionEvaluator(storm::expressions::ExpressionManager const& manager);
+
+    bool asBool(Expression const& expression) const override;
+    int_fast64_t asInt(Expression const& expression) const override;
+    double asRational(Expression const& expression) const override;
+
+    void setBooleanValue(storm::expressions::Variable const& variable, bool value) override;
+    void setIntegerValue(storm::expressions::Variable const& variable, int_fast64_t value) override;
+    void setRationalValue(storm::expressions::Variable const& variable, double value) override;
+
+   private:
+    /*!
+     * Evaluates the given expression, compiling it first if necessary.
+     *
+     * @param expression The expression that is to be evaluated.
+     */
+    double evaluate(storm::expressions::Expression const& expression) const;
+
+    // The values of the variables, indexed by their offsets.
+    std::vector<double> booleanValues;
+    std::vector<double> integerValues;
+    std::vector<double> rationalValues;
+
+    // The registers used during the evaluation.
+    mutable std::vector<double> registers;
+};
+
+}  // namespace expressions
+}  // namespace storm
@@ -5,7 +5,7 @@
 
 namespace storm {
 namespace expressions {
-ExpressionEvaluator<double>::ExpressionEvaluator(storm::expressions::ExpressionManager const& manager) : ExprtkExpressionEvaluator(manager) {
+ExpressionEvaluator<double>::ExpressionEvaluator(storm::expressions::ExpressionManager const& manager) : BytecodeExpressionEvaluator(manager) {
     // Intentionally left empty.
 }
 
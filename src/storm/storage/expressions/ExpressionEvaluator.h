@@ -4,6 +4,7 @@
 #include <unordered_map>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/storage/expressions/BytecodeExpressionEvaluator.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExprtkExpressionEvaluator.h"
 #include "storm/storage/expressions/ToRationalFunctionVisitor.h"
@@ -16,7 +17,7 @@ template<typename RationalType>
 class ExpressionEvaluator;
 
 template<>
-class ExpressionEvaluator<double> : public ExprtkExpressionEvaluator {
+class ExpressionEvaluator<double> : public BytecodeExpressionEvaluator {
    public:
     ExpressionEvaluator(storm::expressions::ExpressionManager const& manager);
 };
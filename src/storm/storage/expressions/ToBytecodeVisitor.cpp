@@ -0,0 +1,233 @@
+#include "storm/storage/expressions/ToBytecodeVisitor.h"
+
+#include <algorithm>
+
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace expressions {
+
+typedef BytecodeCompiledExpression::OpCode OpCode;
+
+ToBytecodeVisitor::ToBytecodeVisitor(std::unordered_map<Variable, BitVectorLocation> const& variableLocations) : variableLocations(variableLocations) {
+    // Intentionally left empty.
+}
+
+bool ToBytecodeVisitor::canCompile(Expression const& expression) const {
+    for (auto const& variable : expression.getVariables()) {
+        if (variableLocations) {
+            if (variableLocations->count(variable) == 0) {
+                return false;
+            }
+        } else if (!variable.hasBooleanType() && !variable.hasIntegerType() && !variable.hasRationalType()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<BytecodeCompiledExpression> ToBytecodeVisitor::compile(Expression const& expression) {
+    instructions.clear();
+    numberOfRegisters = 1;
+    expression.getBaseExpression().accept(*this, static_cast<uint32_t>(0));
+    return std::make_shared<BytecodeCompiledExpression>(std::move(instructions), numberOfRegisters);
+}
+
+uint64_t ToBytecodeVisitor::addInstruction(OpCode opCode, uint32_t target, uint32_t first, uint32_t second, double constant) {
+    numberOfRegisters = std::max<uint64_t>(numberOfRegisters, target + 1);
+    instructions.push_back({opCode, target, first, second, constant});
+    return instructions.size() - 1;
+}
+
+void ToBytecodeVisitor::addBinaryOperation(BaseExpression const& firstOperand, BaseExpression const& secondOperand, OpCode opCode, uint32_t target) {
+    firstOperand.accept(*this, target);
+    secondOperand.accept(*this, target + 1);
+    addInstruction(opCode, target, target, target + 1);
+}
+
+void ToBytecodeVisitor::setJumpTargetToNextInstruction(uint64_t jumpInstruction) {
+    instructions[jumpInstruction].second = static_cast<uint32_t>(instructions.size());
+}
+
+boost::any ToBytecodeVisitor::visit(IfThenElseExpression const& expression, boost::any const& data) {
+    uint32_t target = boost::any_cast<uint32_t>(data);
+    expression.getCondition()->accept(*this, target);
+    uint64_t jumpToElse = addInstruction(OpCode::JumpIfZero, target, target);
+    expression.getThenExpression()->accept(*this, target);
+    uint64_t jumpToEnd = addInstruction(OpCode::Jump, target);
+    setJumpTargetToNextInstruction(jumpToElse);
+    expression.getElseExpression()->accept(*this, target);
+    setJumpTargetToNextInstruction(jumpToEnd);
+    return boost::any();
+}
+
+boost::any ToBytecodeVisitor::visit(BinaryBooleanFunctionExpression const& expression, boost::any const& data) {
+    uint32_t target = boost::any_cast<uint32_t>(data);
+    switch (expression.getOperatorType()) {
+        case BinaryBooleanFunctionExpression::OperatorType::And: {
+            // If the first operand is false, the register already holds the result.
+            expression.getFirstOperand()->accept(*this, target);
+            uint64_t jumpToEnd = addInstruction(OpCode::JumpIfZero, target, target);
+            expression.getSecondOperand()->accept(*this, target);
+            setJumpTargetToNextInstruction(jumpToEnd);
+            break;
+        }
+        case BinaryBooleanFunctionExpression::OperatorType::Or: {
+            // If the first operand is true, the register already holds the result.
+            expression.getFirstOperand()->accept(*this, target);
+            uint64_t jumpToEnd = addInstruction(OpCode::JumpIfNonZero, target, target);
+            expression.getSecondOperand()->accept(*this, target);
+            setJumpTargetToNextInstruction(jumpToEnd);
+            break;
+        }
+        case BinaryBooleanFunctionExpression::OperatorType::Xor:
+            addBinaryOperation(*expression.getFirstOperand(), *expression.getSecondOperand(), OpCode::Xor, target);
+            break;
+        case BinaryBooleanFunctionExpression::OperatorType::Implies:
+            addBinaryOperation(*expression.getFirstOperand(), *expression.getSecondOperand(), OpCode::Implies, target);
+            break;
+        case BinaryBooleanFunctionExpression::OperatorType::Iff:
+            addBinaryOperation(*expression.getFirstOperand(), *expression.getSecondOperand(), OpCode::Iff, target);
+            break;
+    }
+    return boost::any();
+}
+
+boost::any ToBytecodeVisitor::visit(BinaryNumericalFunctionExpression const& expression, boost::any const& data) {
+    uint32_t target = boost::any_cast<uint32_t>(data);
+    OpCode opCode = OpCode::Plus;
+    switch (expression.getOperatorType()) {
+        case BinaryNumericalFunctionExpression::OperatorType::Plus:
+            opCode = OpCode::Plus;
+            break;
+        case BinaryNumericalFunctionExpression::OperatorType::Minus:
+            opCode = OpCode::Minus;
+            break;
+        case BinaryNumericalFunctionExpression::OperatorType::Times:
+            opCode = OpCode::Times;
+            break;
+        case BinaryNumericalFunctionExpression::OperatorType::Divide:
+            opCode = OpCode::Divide;
+            break;
+        case BinaryNumericalFunctionExpression::OperatorType::Power:
+            opCode = OpCode::Power;
+            break;
+        case BinaryNumericalFunctionExpression::OperatorType::Modulo:
+            opCode = OpCode::Modulo;
+            break;
+        case BinaryNumericalFunctionExpression::OperatorType::Max:
+            opCode = OpCode::Max;
+            break;
+        case BinaryNumericalFunctionExpression::OperatorType::Min:
+            opCode = OpCode::Min;
+            break;
+    }
+    addBinaryOperation(*expression.getFirstOperand(), *expression.getSecondOperand(), opCode, target);
+    return boost::any();
+}
+
+boost::any ToBytecodeVisitor::visit(BinaryRelationExpression const& expression, boost::any const& data) {
+    uint32_t target = boost::any_cast<uint32_t>(data);
+    OpCode opCode = OpCode::Equal;
+    switch (expression.getRelationType()) {
+        case BinaryRelationExpression::RelationType::Equal:
+            opCode = OpCode::Equal;
+            break;
+        case BinaryRelationExpression::RelationType::NotEqual:
+            opCode = OpCode::NotEqual;
+            break;
+        case BinaryRelationExpression::RelationType::Less:
+            opCode = OpCode::Less;
+            break;
+        case BinaryRelationExpression::RelationType::LessOrEqual:
+            opCode = OpCode::LessOrEqual;
+            break;
+        case BinaryRelationExpression::RelationType::Greater:
+            opCode = OpCode::Greater;
+            break;
+        case BinaryRelationExpression::RelationType::GreaterOrEqual:
+            opCode = OpCode::GreaterOrEqual;
+            break;
+    }
+    addBinaryOperation(*expression.getFirstOperand(), *expression.getSecondOperand(), opCode, target);
+    return boost::any();
+}
+
+boost::any ToBytecodeVisitor::visit(VariableExpression const& expression, boost::any const& data) {
+    uint32_t target = boost::any_cast<uint32_t>(data);
+    storm::expressions::Variable const& variable = expression.getVariable();
+    if (variableLocations) {
+        auto locationIt = variableLocations->find(variable);
+        STORM_LOG_THROW(locationIt != variableLocations->end(), storm::exceptions::NotSupportedException,
+                        "Cannot compile expression with variable '" << variable.getName() << "' whose value is not stored in the bit vector.");
+        BitVectorLocation const& location = locationIt->second;
+        if (variable.hasBooleanType()) {
+            addInstruction(OpCode::LoadBooleanFromBitVector, target, static_cast<uint32_t>(location.bitOffset));
+        } else {
+            STORM_LOG_THROW(variable.hasIntegerType(), storm::exceptions::NotSupportedException,
+                            "Cannot compile expression with variable '" << variable.getName() << "' of type " << variable.getType() << ".");
+            addInstruction(OpCode::LoadIntegerFromBitVector, target, static_cast<uint32_t>(location.bitOffset), static_cast<uint32_t>(location.bitWidth),
+                           static_cast<double>(location.lowerBound));
+        }
+        return boost::any();
+    }
+    uint32_t offset = static_cast<uint32_t>(variable.getOffset());
+    if (variable.hasBooleanType()) {
+        addInstruction(OpCode::LoadBoolean, target, offset);
+    } else if (variable.hasIntegerType()) {
+        addInstruction(OpCode::LoadInteger, target, offset);
+    } else if (variable.hasRationalType()) {
+        addInstruction(OpCode::LoadRational, target, offset);
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                        "Cannot compile expression with variable '" << variable.getName() << "' of type " << variable.getType() << ".");
+    }
+    return boost::any();
+}
+
+boost::any ToBytecodeVisitor::visit(UnaryBooleanFunctionExpression const& expression, boost::any const& data) {
+    uint32_t target = boost::any_cast<uint32_t>(data);
+    expression.getOperand()->accept(*this, target);
+    switch (expression.getOperatorType()) {
+        case UnaryBooleanFunctionExpression::OperatorType::Not:
+            addInstruction(OpCode::Not, target, target);
+            break;
+    }
+    return boost::any();
+}
+
+boost::any ToBytecodeVisitor::visit(UnaryNumericalFunctionExpression const& expression, boost::any const& data) {
+    uint32_t target = boost::any_cast<uint32_t>(data);
+    expression.getOperand()->accept(*this, target);
+    switch (expression.getOperatorType()) {
+        case UnaryNumericalFunctionExpression::OperatorType::Minus:
+            addInstruction(OpCode::Negate, target, target);
+            break;
+        case UnaryNumericalFunctionExpression::OperatorType::Floor:
+            addInstruction(OpCode::Floor, target, target);
+            break;
+        case UnaryNumericalFunctionExpression::OperatorType::Ceil:
+            addInstruction(OpCode::Ceil, target, target);
+            break;
+    }
+    return boost::any();
+}
+
+boost::any ToBytecodeVisitor::visit(BooleanLiteralExpression const& expression, boost::any const& data) {
+    addInstruction(OpCode::LoadConstant, boost::any_cast<uint32_t>(data), 0, 0, expression.getValue() ? 1.0 : 0.0);
+    return boost::any();
+}
+
+boost::any ToBytecodeVisitor::visit(IntegerLiteralExpression const& expression, boost::any const& data) {
+    addInstruction(OpCode::LoadConstant, boost::any_cast<uint32_t>(data), 0, 0, static_cast<double>(expression.getValue()));
+    return boost::any();
+}
+
+boost::any ToBytecodeVisitor::visit(RationalLiteralExpression const& expression, boost::any const& data) {
+    addInstruction(OpCode::LoadConstant, boost::any_cast<uint32_t>(data), 0, 0, expression.getValueAsDouble());
+    return boost::any();
+}
+
+}  // namespace expressions
+}  // namespace storm
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/storage/expressions/BytecodeCompiledExpression.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+#include "storm/storage/expressions/Expressions.h"
+
+namespace storm {
+namespace expressions {
+
+/*!
+ * Compiles expressions to a BytecodeCompiledExpression. The value of every subexpression is computed into a register
+ * whose index is passed as data to the visitor. Operands of a subexpression computed into register i are computed into
+ * registers i and i+1, so the number of needed registers is bounded by the depth of the expression. If-then-else
+ * expressions as well as conjunctions and disjunctions only evaluate the operands they depend on.
+ */
+class ToBytecodeVisitor : public ExpressionVisitor {
+   public:
+    // The location of the value of a boolean or integer variable in a bit vector. Integer values are stored as their
+    // difference to the lower bound of the variable.
+    struct BitVectorLocation {
+        uint64_t bitOffset;
+        uint64_t bitWidth;
+        int64_t lowerBound;
+    };
+
+    /*!
+     * Creates a visitor whose compiled expressions take the values of variables from arrays indexed by the offsets of
+     * the variables.
+     */
+    ToBytecodeVisitor() = default;
+
+    /*!
+     * Creates a visitor whose compiled expressions take the values of the given variables from a bit vector. Only
+     * expressions over these variables can be compiled.
+     *
+     * @param variableLocations The locations of the variables in the bit vector.
+     */
+    ToBytecodeVisitor(std::unordered_map<Variable, BitVectorLocation> const& variableLocations);
+
+    /*!
+     * Checks whether the given expression only refers to variables whose values are available to the compiled
+     * expressions.
+     */
+    bool canCompile(Expression const& expression) const;
+
+    std::shared_ptr<BytecodeCompiledExpression> compile(Expression const& expression);
+
+    virtual boost::any visit(IfThenElseExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(BinaryBooleanFunctionExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(BinaryNumericalFunctionExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(BinaryRelationExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(VariableExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(UnaryBooleanFunctionExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(UnaryNumericalFunctionExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(BooleanLiteralExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(IntegerLiteralExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(RationalLiteralExpression const& expression, boost::any const& data) override;
+
+   private:
+    /*!
+     * Adds an instruction and returns its index.
+     */
+    uint64_t addInstruction(BytecodeCompiledExpression::OpCode opCode, uint32_t target, uint32_t first = 0, uint32_t second = 0, double constant = 0.0);
+
+    /*!
+     * Adds the instructions that compute the given binary operation into the given register.
+     */
+    void addBinaryOperation(BaseExpression const& firstOperand, BaseExpression const& secondOperand, BytecodeCompiledExpression::OpCode opCode,
+                            uint32_t target);
+
+    /*!
+     * Lets the jump instruction with the given index jump to the next instruction that is added.
+     */
+    void setJumpTargetToNextInstruction(uint64_t jumpInstruction);
+
+    // The instructions added so far.
+    std::vector<BytecodeCompiledExpression::Instruction> instructions;
+
+    // The number of registers used so far.
+    uint64_t numberOfRegisters;
+
+    // If set, the values of variables are taken from a bit vector at these locations.
+    boost::optional<std::unordered_map<Variable, BitVectorLocation>> variableLocations;
+};
+
+}  // namespace expressions
+}  // namespace storm
@@ -5,8 +5,8 @@ namespace storage {
 namespace sparse {
 
 template<typename StateType>
-StateStorage<StateType>::StateStorage(uint64_t bitsPerState)
-    : stateToId(bitsPerState, 100000), initialStateIndices(), deadlockStateIndices(), bitsPerState(bitsPerState) {
+StateStorage<StateType>::StateStorage(uint64_t bitsPerState, bool compressStates)
+    : stateToId(bitsPerState, 100000, 0.75, compressStates), initialStateIndices(), deadlockStateIndices(), bitsPerState(bitsPerState) {
     // Intentionally left empty.
 }
 
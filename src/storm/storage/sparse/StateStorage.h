@@ -11,8 +11,9 @@ namespace sparse {
 // A structure holding information about the reachable state space while building it.
 template<typename StateType>
 struct StateStorage {
-    // Creates an empty state storage structure for storing states of the given bit width.
-    StateStorage(uint64_t bitsPerState);
+    // Creates an empty state storage structure for storing states of the given bit width. If requested, the states
+    // are stored in a (tree-)compressed form, which saves memory for large state spaces at the expense of time.
+    StateStorage(uint64_t bitsPerState, bool compressStates = false);
 
     // This member stores all the states and maps them to their unique indices.
     storm::storage::BitVectorHashMap<StateType> stateToId;
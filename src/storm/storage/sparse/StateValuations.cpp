@@ -283,8 +283,9 @@ bool StateValuations::assertValuation(StateValuation const& valuation) const {
     return true;
 }
 
-StateValuations::StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations)
-    : variableToIndexMap(variableToIndexMap), valuations(valuations) {
+StateValuations::StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations,
+                                 std::shared_ptr<storm::expressions::ExpressionManager const> const& manager)
+    : variableToIndexMap(variableToIndexMap), valuations(valuations), manager(manager) {
     // Intentionally left empty
 }
 
@@ -307,7 +308,7 @@ std::size_t StateValuations::hash() const {
 }
 
 StateValuations StateValuations::selectStates(storm::storage::BitVector const& selectedStates) const {
-    return StateValuations(variableToIndexMap, storm::utility::vector::filterVector(valuations, selectedStates));
+    return StateValuations(variableToIndexMap, storm::utility::vector::filterVector(valuations, selectedStates), manager);
 }
 
 StateValuations StateValuations::selectStates(std::vector<storm::storage::sparse::state_type> const& selectedStates) const {
@@ -320,7 +321,7 @@ StateValuations StateValuations::selectStates(std::vector<storm::storage::sparse
             selectedValuations.emplace_back();
         }
     }
-    return StateValuations(variableToIndexMap, std::move(selectedValuations));
+    return StateValuations(variableToIndexMap, std::move(selectedValuations), manager);
 }
 
 StateValuations StateValuations::blowup(const std::vector<uint64_t>& mapNewToOld) const {
@@ -328,7 +329,7 @@ StateValuations StateValuations::blowup(const std::vector<uint64_t>& mapNewToOld
     for (auto const& oldState : mapNewToOld) {
         newValuations.push_back(valuations[oldState]);
     }
-    return StateValuations(variableToIndexMap, std::move(newValuations));
+    return StateValuations(variableToIndexMap, std::move(newValuations), manager);
 }
 
 StateValuationsBuilder::StateValuationsBuilder() : booleanVarCount(0), integerVarCount(0), rationalVarCount(0), labelCount(0) {
@@ -353,6 +354,10 @@ void StateValuationsBuilder::addObservationLabel(const std::string& label) {
     currentStateValuations.observationLabels[label] = labelCount++;
 }
 
+void StateValuationsBuilder::setExpressionManager(std::shared_ptr<storm::expressions::ExpressionManager const> const& manager) {
+    currentStateValuations.manager = manager;
+}
+
 void StateValuationsBuilder::addState(storm::storage::sparse::state_type const& state, std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues,
                                       std::vector<storm::RationalNumber>&& rationalValues, std::vector<int64_t>&& observationLabelValues) {
     if (state > currentStateValuations.valuations.size()) {
@@ -137,7 +137,8 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
     virtual std::size_t hash() const;
 
    private:
-    StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations);
+    StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations,
+                    std::shared_ptr<storm::expressions::ExpressionManager const> const& manager);
     bool assertValuation(StateValuation const& valuation) const;
     StateValuation const& getValuation(storm::storage::sparse::state_type const& stateIndex) const;
 
@@ -145,6 +146,8 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
     std::map<std::string, uint64_t> observationLabels;
     // A mapping from state indices to their variable valuations.
     std::vector<StateValuation> valuations;
+    // If set, the manager of the variables, which is kept alive by these valuations.
+    std::shared_ptr<storm::expressions::ExpressionManager const> manager;
 };
 
 class StateValuationsBuilder {
@@ -158,6 +161,12 @@ class StateValuationsBuilder {
 
     void addObservationLabel(std::string const& label);
 
+    /*!
+     * Lets the state valuations (and all valuations derived from them) keep the given manager of the variables alive.
+     * This is needed if the manager is not owned by anything else, e.g. if the variables were declared while parsing a model.
+     */
+    void setExpressionManager(std::shared_ptr<storm::expressions::ExpressionManager const> const& manager);
+
     /*!
      * Adds a new state.
      * The variable values have to be given in the same order as the variables have been added.
@@ -16,6 +16,7 @@
 #include "storm/modelchecker/CheckTask.h"
 #include "storm/modelchecker/prctl/SymbolicDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SymbolicMdpPrctlModelChecker.h"
+#include "storm/modelchecker/statistical/StatisticalModelChecker.h"
 
 #include "storm/storage/SymbolicModelDescription.h"
 #include "storm/storage/jani/Property.h"
@@ -50,6 +51,8 @@ std::string toString(Engine const& engine) {
             return "jit";
         case Engine::Exploration:
             return "expl";
+        case Engine::Statistical:
+            return "smc";
         case Engine::AbstractionRefinement:
             return "abs";
         case Engine::Automatic:
@@ -95,6 +98,8 @@ storm::builder::BuilderType getBuilderType(Engine const& engine) {
             return storm::builder::BuilderType::Jit;
         case Engine::Exploration:
             return storm::builder::BuilderType::Explicit;
+        case Engine::Statistical:
+            return storm::builder::BuilderType::Explicit;
         case Engine::AbstractionRefinement:
             return storm::builder::BuilderType::Dd;
         default:
@@ -160,6 +165,12 @@ bool canHandle(storm::utility::Engine const& engine, storm::storage::SymbolicMod
                     return false;
             }
             break;
+        case Engine::Statistical:
+            if constexpr (std::is_same<ValueType, double>::value) {
+                return modelType == ModelType::DTMC &&
+                       storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<ValueType>>::canHandleStatic(checkTask);
+            }
+            return false;
         default:
             STORM_LOG_ERROR("The selected engine " << engine << " is not considered.");
     }
@@ -36,6 +36,7 @@ enum class Engine {
     DdSparse,
     Jit,
     Exploration,
+    Statistical,
     AbstractionRefinement,
     Automatic,
     Unknown
@@ -2,7 +2,10 @@
 #include "storm-config.h"
 #include "utility/OsDetection.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/ParallelEnvironment.h"
 
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
@@ -23,6 +26,7 @@
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 #include <queue>
 
@@ -1069,6 +1073,292 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min
                             psiStates);
 }
 
+#ifdef STORM_HAVE_INTELTBB
+/*!
+ * Performs a level-synchronous breadth-first search. In every level, the states of the current frontier are expanded
+ * in parallel by calling collectCandidates(state, candidates), which must only read shared data. The candidates that are not yet
+ * visited are then marked as visited (sequentially) and they form the next frontier if explore(candidate) holds.
+ *
+ * @param visitedStates The states visited so far. Candidates are added to this set.
+ * @param frontier The initial frontier.
+ * @param maximalLevels If given, at most this many levels are expanded.
+ */
+template<typename CollectFunction, typename ExploreFunction>
+void performLevelSynchronousSearch(storm::Environment const& env, storm::storage::BitVector& visitedStates, std::vector<uint_fast64_t>&& frontier,
+                                   boost::optional<uint_fast64_t> const& maximalLevels, CollectFunction const& collectCandidates,
+                                   ExploreFunction const& explore) {
+    uint_fast64_t level = 0;
+    std::vector<uint_fast64_t> candidates;
+    while (!frontier.empty() && (!maximalLevels || level < maximalLevels.get())) {
+        storm::utility::parallel::executeWithThreadLimit(env, [&]() {
+            // The join concatenates the candidates of adjacent ranges, so the order of the candidates does not depend on the scheduling.
+            candidates = tbb::parallel_reduce(
+                tbb::blocked_range<uint_fast64_t>(0, frontier.size(), 256), std::vector<uint_fast64_t>(),
+                [&](tbb::blocked_range<uint_fast64_t> const& range, std::vector<uint_fast64_t> localCandidates) {
+                    for (uint_fast64_t index = range.begin(); index < range.end(); ++index) {
+                        collectCandidates(frontier[index], localCandidates);
+                    }
+                    return localCandidates;
+                },
+                [](std::vector<uint_fast64_t> left, std::vector<uint_fast64_t> const& right) {
+                    left.insert(left.end(), right.begin(), right.end());
+                    return left;
+                });
+        });
+
+        frontier.clear();
+        for (auto const& candidate : candidates) {
+            if (!visitedStates.get(candidate)) {
+                visitedStates.set(candidate);
+                if (explore(candidate)) {
+                    frontier.push_back(candidate);
+                }
+            }
+        }
+        ++level;
+    }
+}
+
+/*!
+ * Performs a level-synchronous backward search from the psi states through the phi states.
+ */
+template<typename T>
+storm::storage::BitVector performProbGreater0Parallel(storm::Environment const& env, storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                                      storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                      bool useStepBound, uint_fast64_t maximalSteps) {
+    storm::storage::BitVector statesWithProbabilityGreater0(psiStates);
+    performLevelSynchronousSearch(
+        env, statesWithProbabilityGreater0, std::vector<uint_fast64_t>(psiStates.begin(), psiStates.end()),
+        useStepBound ? boost::optional<uint_fast64_t>(maximalSteps) : boost::none,
+        [&](uint_fast64_t state, std::vector<uint_fast64_t>& candidates) {
+            for (auto const& predecessorEntry : backwardTransitions.getRow(state)) {
+                if (phiStates.get(predecessorEntry.getColumn()) && !statesWithProbabilityGreater0.get(predecessorEntry.getColumn())) {
+                    candidates.push_back(predecessorEntry.getColumn());
+                }
+            }
+        },
+        [](uint_fast64_t) { return true; });
+    return statesWithProbabilityGreater0;
+}
+#endif
+
+template<typename T>
+storm::storage::BitVector getReachableStates(storm::Environment const& env, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                             storm::storage::BitVector const& initialStates, storm::storage::BitVector const& constraintStates,
+                                             storm::storage::BitVector const& targetStates, bool useStepBound, uint_fast64_t maximalSteps,
+                                             boost::optional<storm::storage::BitVector> const& choiceFilter) {
+#ifdef STORM_HAVE_INTELTBB
+    if (env.parallel().isParallel()) {
+        storm::storage::BitVector reachableStates(initialStates);
+        std::vector<uint_fast64_t> frontier;
+        for (auto state : initialStates) {
+            if (constraintStates.get(state)) {
+                frontier.push_back(state);
+            }
+        }
+        performLevelSynchronousSearch(
+            env, reachableStates, std::move(frontier), useStepBound ? boost::optional<uint_fast64_t>(maximalSteps) : boost::none,
+            [&](uint_fast64_t state, std::vector<uint_fast64_t>& candidates) {
+                uint64_t row = transitionMatrix.getRowGroupIndices()[state];
+                if (choiceFilter) {
+                    row = choiceFilter->getNextSetIndex(row);
+                }
+                uint64_t const rowGroupEnd = transitionMatrix.getRowGroupIndices()[state + 1];
+                while (row < rowGroupEnd) {
+                    for (auto const& successor : transitionMatrix.getRow(row)) {
+                        if (!storm::utility::isZero(successor.getValue()) && !reachableStates.get(successor.getColumn()) &&
+                            (targetStates.get(successor.getColumn()) || constraintStates.get(successor.getColumn()))) {
+                            candidates.push_back(successor.getColumn());
+                        }
+                    }
+                    ++row;
+                    if (choiceFilter) {
+                        row = choiceFilter->getNextSetIndex(row);
+                    }
+                }
+            },
+            // Target states are included, but not explored further.
+            [&](uint_fast64_t state) { return !targetStates.get(state); });
+        return reachableStates;
+    }
+#endif
+    return getReachableStates(transitionMatrix, initialStates, constraintStates, targetStates, useStepBound, maximalSteps, choiceFilter);
+}
+
+template<typename T>
+storm::storage::BitVector performProbGreater0(storm::Environment const& env, storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                              storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound,
+                                              uint_fast64_t maximalSteps) {
+#ifdef STORM_HAVE_INTELTBB
+    if (env.parallel().isParallel()) {
+        return performProbGreater0Parallel(env, backwardTransitions, phiStates, psiStates, useStepBound, maximalSteps);
+    }
+#endif
+    return performProbGreater0(backwardTransitions, phiStates, psiStates, useStepBound, maximalSteps);
+}
+
+template<typename T>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::Environment const& env,
+                                                                              storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                                                              storm::storage::BitVector const& phiStates,
+                                                                              storm::storage::BitVector const& psiStates) {
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
+    result.first = performProbGreater0(env, backwardTransitions, phiStates, psiStates);
+    result.second = performProbGreater0(env, backwardTransitions, ~psiStates, ~result.first);
+    result.second.complement();
+    result.first.complement();
+    return result;
+}
+
+template<typename T>
+storm::storage::BitVector performProbGreater0E(storm::Environment const& env, storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                               storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound,
+                                               uint_fast64_t maximalSteps) {
+#ifdef STORM_HAVE_INTELTBB
+    if (env.parallel().isParallel()) {
+        // The backward transitions of a nondeterministic model abstract from the choices, so the search coincides with the deterministic one.
+        return performProbGreater0Parallel(env, backwardTransitions, phiStates, psiStates, useStepBound, maximalSteps);
+    }
+#endif
+    return performProbGreater0E(backwardTransitions, phiStates, psiStates, useStepBound, maximalSteps);
+}
+
+template<typename T>
+storm::storage::BitVector performProb0A(storm::Environment const& env, storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+    storm::storage::BitVector statesWithProbability0 = performProbGreater0E(env, backwardTransitions, phiStates, psiStates);
+    statesWithProbability0.complement();
+    return statesWithProbability0;
+}
+
+template<typename T>
+storm::storage::BitVector performProb1E(storm::Environment const& env, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+#ifdef STORM_HAVE_INTELTBB
+    if (env.parallel().isParallel()) {
+        storm::storage::BitVector currentStates(phiStates.size(), true);
+
+        // Perform the loop as long as the set of states gets larger.
+        while (true) {
+            storm::storage::BitVector nextStates(psiStates);
+            // As the condition on the predecessors is monotone in the set of next states, checking a predecessor whenever one of its successors
+            // is added to the next states yields the same set as the sequential depth-first search.
+            performLevelSynchronousSearch(
+                env, nextStates, std::vector<uint_fast64_t>(psiStates.begin(), psiStates.end()), boost::none,
+                [&](uint_fast64_t state, std::vector<uint_fast64_t>& candidates) {
+                    for (auto const& predecessorEntry : backwardTransitions.getRow(state)) {
+                        uint_fast64_t const predecessor = predecessorEntry.getColumn();
+                        if (!phiStates.get(predecessor) || nextStates.get(predecessor)) {
+                            continue;
+                        }
+                        for (uint_fast64_t row = nondeterministicChoiceIndices[predecessor]; row < nondeterministicChoiceIndices[predecessor + 1]; ++row) {
+                            if (!choiceConstraint || choiceConstraint.get().get(row)) {
+                                bool allSuccessorsInCurrentStates = true;
+                                bool hasNextStateSuccessor = false;
+                                for (auto const& successorEntry : transitionMatrix.getRow(row)) {
+                                    if (!currentStates.get(successorEntry.getColumn())) {
+                                        allSuccessorsInCurrentStates = false;
+                                        break;
+                                    } else if (nextStates.get(successorEntry.getColumn())) {
+                                        hasNextStateSuccessor = true;
+                                    }
+                                }
+                                if (allSuccessorsInCurrentStates && hasNextStateSuccessor) {
+                                    candidates.push_back(predecessor);
+                                    break;
+                                }
+                            }
+                        }
+                    }
+                },
+                [](uint_fast64_t) { return true; });
+
+            // Check whether we need to perform an additional iteration.
+            if (currentStates == nextStates) {
+                break;
+            }
+            currentStates = std::move(nextStates);
+        }
+        return currentStates;
+    }
+#endif
+    return performProb1E(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, choiceConstraint);
+}
+
+template<typename T>
+storm::storage::BitVector performProb0E(storm::Environment const& env, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates) {
+#ifdef STORM_HAVE_INTELTBB
+    if (env.parallel().isParallel()) {
+        storm::storage::BitVector statesWithProbabilityGreater0(psiStates);
+        // As the condition on the predecessors is monotone in the set of visited states, checking a predecessor whenever one of its successors
+        // is added yields the same set as the sequential depth-first search.
+        performLevelSynchronousSearch(
+            env, statesWithProbabilityGreater0, std::vector<uint_fast64_t>(psiStates.begin(), psiStates.end()), boost::none,
+            [&](uint_fast64_t state, std::vector<uint_fast64_t>& candidates) {
+                for (auto const& predecessorEntry : backwardTransitions.getRow(state)) {
+                    uint_fast64_t const predecessor = predecessorEntry.getColumn();
+                    if (!phiStates.get(predecessor) || statesWithProbabilityGreater0.get(predecessor)) {
+                        continue;
+                    }
+                    bool allChoicesHaveSuccessorWithProbabilityGreater0 = true;
+                    for (uint_fast64_t row = nondeterministicChoiceIndices[predecessor]; row < nondeterministicChoiceIndices[predecessor + 1]; ++row) {
+                        bool hasSuccessorWithProbabilityGreater0 = false;
+                        for (auto const& successorEntry : transitionMatrix.getRow(row)) {
+                            if (statesWithProbabilityGreater0.get(successorEntry.getColumn())) {
+                                hasSuccessorWithProbabilityGreater0 = true;
+                                break;
+                            }
+                        }
+                        if (!hasSuccessorWithProbabilityGreater0) {
+                            allChoicesHaveSuccessorWithProbabilityGreater0 = false;
+                            break;
+                        }
+                    }
+                    if (allChoicesHaveSuccessorWithProbabilityGreater0) {
+                        candidates.push_back(predecessor);
+                    }
+                }
+            },
+            [](uint_fast64_t) { return true; });
+        statesWithProbabilityGreater0.complement();
+        return statesWithProbabilityGreater0;
+    }
+#endif
+    return performProb0E(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
+}
+
+template<typename T>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::Environment const& env,
+                                                                                 storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                                 storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                                                                 storm::storage::BitVector const& phiStates,
+                                                                                 storm::storage::BitVector const& psiStates) {
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
+    result.first = performProb0A(env, backwardTransitions, phiStates, psiStates);
+    result.second = performProb1E(env, transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
+    return result;
+}
+
+template<typename T>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::Environment const& env,
+                                                                                 storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                                 storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                                                                 storm::storage::BitVector const& phiStates,
+                                                                                 storm::storage::BitVector const& psiStates) {
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
+    result.first = performProb0E(env, transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
+    // See the variant without environment for why calling performProb0A is valid here.
+    result.second = performProb0A(env, backwardTransitions, ~psiStates, result.first);
+    return result;
+}
+
 template<storm::dd::DdType Type, typename ValueType>
 storm::dd::Bdd<Type> computeSchedulerProbGreater0E(storm::models::symbolic::NondeterministicModel<Type, ValueType> const& model,
                                                    storm::dd::Bdd<Type> const& transitionMatrix, storm::dd::Bdd<Type> const& phiStates,
@@ -1897,7 +2187,7 @@ template std::vector<uint_fast64_t> getDistances(storm::storage::SparseMatrix<do
 
 template storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<double> const& backwardTransitions,
                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                       bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+                                                       bool useStepBound, uint_fast64_t maximalSteps);
 
 template storm::storage::BitVector performProb1(storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                                 storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0);
@@ -1931,7 +2221,7 @@ template void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStat
 
 template storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<double> const& backwardTransitions,
                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                        bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+                                                        bool useStepBound, uint_fast64_t maximalSteps);
 
 template storm::storage::BitVector performProb0A(storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                                  storm::storage::BitVector const& psiStates);
@@ -2020,6 +2310,48 @@ template ExplicitGameProb01Result performProb1(storm::storage::SparseMatrix<doub
 
 template std::vector<uint_fast64_t> getTopologicalSort(storm::storage::SparseMatrix<double> const& matrix, std::vector<uint64_t> const& firstStates);
 
+template storm::storage::BitVector getReachableStates(storm::Environment const& env, storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                      storm::storage::BitVector const& initialStates, storm::storage::BitVector const& constraintStates,
+                                                      storm::storage::BitVector const& targetStates, bool useStepBound, uint_fast64_t maximalSteps,
+                                                      boost::optional<storm::storage::BitVector> const& choiceFilter);
+
+template storm::storage::BitVector performProbGreater0(storm::Environment const& env, storm::storage::SparseMatrix<double> const& backwardTransitions,
+                                                       storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                       bool useStepBound, uint_fast64_t maximalSteps);
+
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::Environment const& env,
+                                                                                       storm::storage::SparseMatrix<double> const& backwardTransitions,
+                                                                                       storm::storage::BitVector const& phiStates,
+                                                                                       storm::storage::BitVector const& psiStates);
+
+template storm::storage::BitVector performProbGreater0E(storm::Environment const& env, storm::storage::SparseMatrix<double> const& backwardTransitions,
+                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                        bool useStepBound, uint_fast64_t maximalSteps);
+
+template storm::storage::BitVector performProb0A(storm::Environment const& env, storm::storage::SparseMatrix<double> const& backwardTransitions,
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+template storm::storage::BitVector performProb1E(storm::Environment const& env, storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                 storm::storage::BitVector const& psiStates,
+                                                 boost::optional<storm::storage::BitVector> const& choiceConstraint);
+
+template storm::storage::BitVector performProb0E(storm::Environment const& env, storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseMatrix<double> const& backwardTransitions,
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
+    storm::Environment const& env, storm::storage::SparseMatrix<double> const& transitionMatrix,
+    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<double> const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
+    storm::Environment const& env, storm::storage::SparseMatrix<double> const& transitionMatrix,
+    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<double> const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
 // Instantiations for storm::RationalNumber.
 #ifdef STORM_HAVE_CARL
 template storm::storage::BitVector getReachableStates(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
@@ -2041,7 +2373,7 @@ template std::vector<uint_fast64_t> getDistances(storm::storage::SparseMatrix<st
 
 template storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                       bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+                                                       bool useStepBound, uint_fast64_t maximalSteps);
 
 template storm::storage::BitVector performProb1(storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
@@ -2077,7 +2409,7 @@ template void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStat
 
 template storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                        bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+                                                        bool useStepBound, uint_fast64_t maximalSteps);
 
 template storm::storage::BitVector performProb0A(storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
                                                  storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
@@ -2149,6 +2481,49 @@ template ExplicitGameProb01Result performProb1(storm::storage::SparseMatrix<stor
 
 template std::vector<uint_fast64_t> getTopologicalSort(storm::storage::SparseMatrix<storm::RationalNumber> const& matrix,
                                                        std::vector<uint64_t> const& firstStates);
+template storm::storage::BitVector getReachableStates(storm::Environment const& env,
+                                                      storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                      storm::storage::BitVector const& initialStates, storm::storage::BitVector const& constraintStates,
+                                                      storm::storage::BitVector const& targetStates, bool useStepBound, uint_fast64_t maximalSteps,
+                                                      boost::optional<storm::storage::BitVector> const& choiceFilter);
+
+template storm::storage::BitVector performProbGreater0(storm::Environment const& env,
+                                                       storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                       storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                       bool useStepBound, uint_fast64_t maximalSteps);
+
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(
+    storm::Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates);
+
+template storm::storage::BitVector performProbGreater0E(storm::Environment const& env,
+                                                        storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                        bool useStepBound, uint_fast64_t maximalSteps);
+
+template storm::storage::BitVector performProb0A(storm::Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+template storm::storage::BitVector performProb1E(storm::Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                 boost::optional<storm::storage::BitVector> const& choiceConstraint);
+
+template storm::storage::BitVector performProb0E(storm::Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
+    storm::Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
+    storm::Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
 // End of instantiations for storm::RationalNumber.
 
 template storm::storage::BitVector getReachableStates(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
@@ -2170,7 +2545,7 @@ template std::vector<uint_fast64_t> getDistances(storm::storage::SparseMatrix<st
 
 template storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                       bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+                                                       bool useStepBound, uint_fast64_t maximalSteps);
 
 template storm::storage::BitVector performProb1(storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
@@ -2196,7 +2571,7 @@ template void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStat
 
 template storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                        bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+                                                        bool useStepBound, uint_fast64_t maximalSteps);
 
 template storm::storage::BitVector performProb0A(storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
                                                  storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
@@ -2254,6 +2629,51 @@ template std::pair<storm::storage::BitVector, storm::storage::BitVector> perform
 
 template std::vector<uint_fast64_t> getTopologicalSort(storm::storage::SparseMatrix<storm::RationalFunction> const& matrix,
                                                        std::vector<uint64_t> const& firstStates);
+
+template storm::storage::BitVector getReachableStates(storm::Environment const& env,
+                                                      storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                      storm::storage::BitVector const& initialStates, storm::storage::BitVector const& constraintStates,
+                                                      storm::storage::BitVector const& targetStates, bool useStepBound, uint_fast64_t maximalSteps,
+                                                      boost::optional<storm::storage::BitVector> const& choiceFilter);
+
+template storm::storage::BitVector performProbGreater0(storm::Environment const& env,
+                                                       storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                       storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                       bool useStepBound, uint_fast64_t maximalSteps);
+
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(
+    storm::Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates);
+
+template storm::storage::BitVector performProbGreater0E(storm::Environment const& env,
+                                                        storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                        bool useStepBound, uint_fast64_t maximalSteps);
+
+template storm::storage::BitVector performProb0A(storm::Environment const& env,
+                                                 storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+template storm::storage::BitVector performProb1E(storm::Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                 boost::optional<storm::storage::BitVector> const& choiceConstraint);
+
+template storm::storage::BitVector performProb0E(storm::Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
+    storm::Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
+    storm::Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
 #endif
 
 // Instantiations for CUDD.
@@ -18,6 +18,8 @@
 #include "storm/solver/OptimizationDirection.h"
 
 namespace storm {
+class Environment;
+
 namespace storage {
 class BitVector;
 template<typename VT>
@@ -78,6 +80,18 @@ storm::storage::BitVector getReachableStates(storm::storage::SparseMatrix<T> con
                                              bool useStepBound = false, uint_fast64_t maximalSteps = 0,
                                              boost::optional<storm::storage::BitVector> const& choiceFilter = boost::none);
 
+/*!
+ * Computes the same set of states as the variant without environment. If the environment allows for parallelism, a
+ * level-synchronous breadth-first search is performed in which the frontier of each level is expanded in parallel.
+ *
+ * @param env The environment that determines the number of threads to use.
+ */
+template<typename T>
+storm::storage::BitVector getReachableStates(storm::Environment const& env, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                             storm::storage::BitVector const& initialStates, storm::storage::BitVector const& constraintStates,
+                                             storm::storage::BitVector const& targetStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0,
+                                             boost::optional<storm::storage::BitVector> const& choiceFilter = boost::none);
+
 /*!
  * Retrieves a set of states that covers als BSCCs of the system in the sense that for every BSCC exactly
  * one state is included in the cover.
@@ -138,6 +152,17 @@ template<typename T>
 storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                               storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
 
+/*!
+ * Computes the same set of states as the variant without environment. If the environment allows for parallelism, the
+ * backward search is level-synchronous and the frontier of each level is expanded in parallel.
+ *
+ * @param env The environment that determines the number of threads to use.
+ */
+template<typename T>
+storm::storage::BitVector performProbGreater0(storm::Environment const& env, storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                              storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false,
+                                              uint_fast64_t maximalSteps = 0);
+
 /*!
  * Computes the set of states of the given model for which all paths lead to
  * the given set of target states and only visit states from the filter set
@@ -202,6 +227,18 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(st
                                                                               storm::storage::BitVector const& phiStates,
                                                                               storm::storage::BitVector const& psiStates);
 
+/*!
+ * Computes the same sets of states as the variant without environment, but uses the parallel backward search if the
+ * environment allows for parallelism.
+ *
+ * @param env The environment that determines the number of threads to use.
+ */
+template<typename T>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::Environment const& env,
+                                                                              storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                                                              storm::storage::BitVector const& phiStates,
+                                                                              storm::storage::BitVector const& psiStates);
+
 /*!
  * Computes the set of states that has a positive probability of reaching psi states after only passing
  * through phi states before.
@@ -379,6 +416,21 @@ template<typename T>
 storm::storage::BitVector performProb0A(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                         storm::storage::BitVector const& psiStates);
 
+/*!
+ * Computes the same sets of states as the respective variants without environment. If the environment allows for
+ * parallelism, the backward search is level-synchronous and the frontier of each level is expanded in parallel.
+ *
+ * @param env The environment that determines the number of threads to use.
+ */
+template<typename T>
+storm::storage::BitVector performProbGreater0E(storm::Environment const& env, storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                               storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                               bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+
+template<typename T>
+storm::storage::BitVector performProb0A(storm::Environment const& env, storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
 /*!
  * Computes the sets of states that have probability 1 of satisfying phi until psi under at least
  * one possible resolution of non-determinism in a non-deterministic model. Stated differently,
@@ -399,6 +451,20 @@ storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& t
                                         storm::storage::BitVector const& psiStates,
                                         boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
 
+/*!
+ * Computes the same set of states as the variant without environment. If the environment allows for parallelism, the
+ * backward search within each iteration of the fixpoint computation is level-synchronous and the frontier of each
+ * level is expanded in parallel.
+ *
+ * @param env The environment that determines the number of threads to use.
+ */
+template<typename T>
+storm::storage::BitVector performProb1E(storm::Environment const& env, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates,
+                                        boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
+
 /*!
  * Computes the sets of states that have probability 1 of satisfying phi until psi under at least
  * one possible resolution of non-determinism in a non-deterministic model. Stated differently,
@@ -423,6 +489,18 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max
                                                                                  storm::storage::BitVector const& phiStates,
                                                                                  storm::storage::BitVector const& psiStates);
 
+/*!
+ * Computes the same sets of states as the variant without environment, but uses the parallel searches if the
+ * environment allows for parallelism.
+ */
+template<typename T>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::Environment const& env,
+                                                                                 storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                                 storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                                                                 storm::storage::BitVector const& phiStates,
+                                                                                 storm::storage::BitVector const& psiStates);
+
 /*!
  * Computes the sets of states that have probability 0 or 1, respectively, of satisfying phi
  * until psi in a non-deterministic model in which all non-deterministic choices are resolved
@@ -482,6 +560,18 @@ storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<T> const& t
                                         storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                         storm::storage::BitVector const& psiStates);
 
+/*!
+ * Computes the same set of states as the variant without environment. If the environment allows for parallelism, the
+ * backward search is level-synchronous and the frontier of each level is expanded in parallel.
+ *
+ * @param env The environment that determines the number of threads to use.
+ */
+template<typename T>
+storm::storage::BitVector performProb0E(storm::Environment const& env, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates);
+
 /*!
  * Computes the sets of states that have probability 1 of satisfying phi until psi under all
  * possible resolutions of non-determinism in a non-deterministic model. Stated differently,
@@ -512,6 +602,18 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min
                                                                                  storm::storage::BitVector const& phiStates,
                                                                                  storm::storage::BitVector const& psiStates);
 
+/*!
+ * Computes the same sets of states as the variant without environment. If the environment allows for parallelism,
+ * both backward searches are performed in parallel.
+ */
+template<typename T>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::Environment const& env,
+                                                                                 storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                                 storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                                                                 storm::storage::BitVector const& phiStates,
+                                                                                 storm::storage::BitVector const& psiStates);
+
 /*!
  * Computes the sets of states that have probability 0 or 1, respectively, of satisfying phi
  * until psi in a non-deterministic model in which all non-deterministic choices are resolved
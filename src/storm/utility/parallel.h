@@ -0,0 +1,62 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/ParallelEnvironment.h"
+
+namespace storm {
+namespace utility {
+namespace parallel {
+
+#ifdef STORM_HAVE_INTELTBB
+/*!
+ * Retrieves the task arena with the given number of threads. Arenas are created on first use and kept alive, so
+ * repeated calls (e.g. once per iteration of a fixpoint computation) do not pay for setting up a new arena.
+ */
+inline tbb::task_arena& getTaskArena(uint64_t numberOfThreads) {
+    static std::mutex arenasMutex;
+    static std::map<uint64_t, std::unique_ptr<tbb::task_arena>> arenas;
+    std::lock_guard<std::mutex> lock(arenasMutex);
+    auto& arena = arenas[numberOfThreads];
+    if (!arena) {
+        arena = std::make_unique<tbb::task_arena>(static_cast<int>(numberOfThreads));
+    }
+    return *arena;
+}
+#endif
+
+/*!
+ * Executes the given function such that parallel (TBB) algorithms invoked by it use at most the given number of
+ * threads. If Storm was built without TBB, the function is simply called.
+ */
+template<typename Function>
+void executeWithThreadLimit(uint64_t numberOfThreads, Function const& function) {
+#ifdef STORM_HAVE_INTELTBB
+    if (tbb::this_task_arena::max_concurrency() == static_cast<int>(numberOfThreads)) {
+        // We are already running in an arena with the requested concurrency (e.g. the caller imposed the limit).
+        function();
+    } else {
+        getTaskArena(numberOfThreads).execute(function);
+    }
+#else
+    (void)numberOfThreads;
+    function();
+#endif
+}
+
+/*!
+ * Executes the given function such that parallel (TBB) algorithms invoked by it use at most the number of threads
+ * specified in the given environment. If Storm was built without TBB, the function is simply called.
+ */
+template<typename Function>
+void executeWithThreadLimit(storm::Environment const& env, Function const& function) {
+    executeWithThreadLimit(env.parallel().getNumberOfThreads(), function);
+}
+
+}  // namespace parallel
+}  // namespace utility
+}  // namespace storm
@@ -45,5 +45,12 @@ ExponentialDistributionGenerator::ExponentialDistributionGenerator(double rate)
 double ExponentialDistributionGenerator::random(boost::mt19937& engine) {
     return distribution(engine);
 }
+
+uint64_t deriveSeed(uint64_t seed, uint64_t index) {
+    uint64_t result = seed + (index + 1) * 0x9e3779b97f4a7c15ull;
+    result = (result ^ (result >> 30)) * 0xbf58476d1ce4e5b9ull;
+    result = (result ^ (result >> 27)) * 0x94d049bb133111ebull;
+    return result ^ (result >> 31);
+}
 }  // namespace utility
 }  // namespace storm
@@ -59,5 +59,11 @@ class ExponentialDistributionGenerator {
     boost::random::exponential_distribution<> distribution;
 };
 
+/*!
+ * Derives the seed of the random number stream with the given index from the given seed (SplitMix64), such that the
+ * streams of different indices are independent.
+ */
+uint64_t deriveSeed(uint64_t seed, uint64_t index);
+
 }  // namespace utility
 }  // namespace storm
\ No newline at end of file
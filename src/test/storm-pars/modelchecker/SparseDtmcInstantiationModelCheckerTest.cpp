@@ -0,0 +1,88 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include <carl/core/VariablePool.h>
+
+#include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
+#include "storm/api/storm.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/environment/Environment.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+
+namespace {
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> buildModel(std::string const& programFile, std::string const& formulaAsString, std::shared_ptr<storm::logic::Formula const>& formula) {
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        program = storm::utility::prism::preprocess(program, "");
+        std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        formula = formulas.front();
+        return storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    }
+
+    storm::utility::parametric::Valuation<storm::RationalFunction> makeValuation(std::vector<std::pair<std::string, double>> const& values) {
+        storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+        for (auto const& value : values) {
+            storm::RationalFunctionVariable variable = carl::VariablePool::getInstance().findVariableWithName(value.first);
+            EXPECT_NE(variable, carl::Variable::NO_VARIABLE);
+            valuation.emplace(variable, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(value.second));
+        }
+        return valuation;
+    }
+
+    void compareWithIndividualChecks(storm::models::sparse::Dtmc<storm::RationalFunction> const& dtmc, storm::logic::Formula const& formula, std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> const& valuations) {
+        storm::Environment env;
+        storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> batchChecker(dtmc);
+        batchChecker.specifyFormula(storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction>(formula, false));
+        std::vector<std::vector<double>> batchResults = batchChecker.checkBatch(env, valuations);
+        ASSERT_EQ(valuations.size(), batchResults.size());
+
+        storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> checker(dtmc);
+        checker.specifyFormula(storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction>(formula, false));
+        for (uint64_t i = 0; i < valuations.size(); ++i) {
+            auto result = checker.check(env, valuations[i]);
+            auto const& expected = result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+            ASSERT_EQ(expected.size(), batchResults[i].size());
+            for (uint64_t state = 0; state < expected.size(); ++state) {
+                if (storm::utility::isInfinity(expected[state])) {
+                    EXPECT_TRUE(storm::utility::isInfinity(batchResults[i][state])) << "Valuation #" << i << ", state " << state;
+                } else {
+                    EXPECT_NEAR(expected[state], batchResults[i][state], 1e-6) << "Valuation #" << i << ", state " << state;
+                }
+            }
+        }
+    }
+}
+
+TEST(SparseDtmcInstantiationModelCheckerTest, BrpProbBatch) {
+    carl::VariablePool::getInstance().clear();
+    std::shared_ptr<storm::logic::Formula const> formula;
+    auto dtmc = buildModel(STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm", "P=? [F s=5 ]", formula);
+
+    std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> valuations;
+    for (double pL : {0.1, 0.5, 0.8, 0.99}) {
+        for (double pK : {0.2, 0.9}) {
+            valuations.push_back(makeValuation({{"pL", pL}, {"pK", pK}}));
+        }
+    }
+    // A valuation that does not preserve the graph structure
+    valuations.push_back(makeValuation({{"pL", 1.0}, {"pK", 0.5}}));
+    compareWithIndividualChecks(*dtmc, *formula, valuations);
+}
+
+TEST(SparseDtmcInstantiationModelCheckerTest, DieRewardBatch) {
+    carl::VariablePool::getInstance().clear();
+    std::shared_ptr<storm::logic::Formula const> formula;
+    auto dtmc = buildModel(STORM_TEST_RESOURCES_DIR "/pdtmc/parametric_die.pm", "R{\"coin_flips\"}=? [F s=7 ]", formula);
+
+    // More valuations than solved at once
+    std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> valuations;
+    for (uint64_t i = 1; i < 100; ++i) {
+        valuations.push_back(makeValuation({{"p", static_cast<double>(i) / 100.0}}));
+    }
+    compareWithIndividualChecks(*dtmc, *formula, valuations);
+}
+
+#endif
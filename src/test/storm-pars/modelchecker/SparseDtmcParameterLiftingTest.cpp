@@ -10,6 +10,7 @@
 
 #include "storm-parsers/api/storm-parsers.h"
 
+#include "storm/environment/ParallelEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/storage/jani/Property.h"
 #include "storm-pars/transformer/SparseParametricDtmcSimplifier.h"
@@ -99,6 +100,49 @@ namespace {
         EXPECT_EQ(storm::modelchecker::RegionResult::AllViolated, regionChecker->analyzeRegion(this->env(), allVioRegion, storm::modelchecker::RegionResultHypothesis::Unknown,storm::modelchecker::RegionResult::Unknown, true));
     }
 
+    TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_ParallelRefinement) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+        std::string formulaAsString = "P<=0.84 [F s=5 ]";
+        std::string constantsAsString = ""; //e.g. pL=0.9,TOACK=0.5
+
+        // Program and formula
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        program = storm::utility::prism::preprocess(program, constantsAsString);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+        auto rewParameters = storm::models::sparse::getRewardParameters(*model);
+        modelParameters.insert(rewParameters.begin(), rewParameters.end());
+        auto task = storm::api::createTask<storm::RationalFunction>(formulas[0], true);
+        auto region = storm::api::parseRegion<storm::RationalFunction>("0.4<=pL<=0.9,0.5<=pK<=0.95", modelParameters);
+        boost::optional<storm::RationalFunction> coverageThreshold = storm::utility::convertNumber<storm::RationalFunction>(0.1);
+
+        auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task);
+        auto sequentialResult = regionChecker->performRegionRefinement(this->env(), region, coverageThreshold, 6ull);
+
+        storm::Environment parallelEnv = this->env();
+        parallelEnv.parallel().setNumberOfThreads(4);
+        storm::modelchecker::ParallelRegionRefinement<storm::RationalFunction> parallelRefinement([&]() { return storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(parallelEnv, model, task); }, 4);
+        auto parallelResult = parallelRefinement.performRegionRefinement(parallelEnv, region, coverageThreshold, 6ull);
+
+        // The parallel refinement yields the same regions in the same order.
+        auto const& sequentialRegions = sequentialResult->getRegionResults();
+        auto const& parallelRegions = parallelResult->getRegionResults();
+        ASSERT_EQ(sequentialRegions.size(), parallelRegions.size());
+        EXPECT_LT(1ull, parallelRegions.size());
+        for (uint64_t i = 0; i < sequentialRegions.size(); ++i) {
+            EXPECT_EQ(sequentialRegions[i].first.toString(), parallelRegions[i].first.toString());
+            EXPECT_EQ(sequentialRegions[i].second, parallelRegions[i].second);
+        }
+
+        auto analysisResult = parallelRefinement.analyzeRegions(parallelEnv, {region, region}, {storm::modelchecker::RegionResultHypothesis::Unknown, storm::modelchecker::RegionResultHypothesis::Unknown});
+        ASSERT_EQ(2ull, analysisResult->getRegionResults().size());
+        EXPECT_EQ(analysisResult->getRegionResults()[0].second, analysisResult->getRegionResults()[1].second);
+    }
+
     TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_no_simplification) {
         typedef typename TestFixture::ValueType ValueType;
 
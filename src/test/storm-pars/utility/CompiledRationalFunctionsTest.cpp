@@ -0,0 +1,108 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include <carl/core/VariablePool.h>
+
+#include "storm-pars/utility/CompiledRationalFunctions.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/constants.h"
+
+namespace {
+    class CompiledRationalFunctionsTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            p = carl::freshRealVariable("p");
+            q = carl::freshRealVariable("q");
+            auto cache = std::make_shared<storm::RawPolynomialCache>();
+            storm::RationalFunction fp(storm::Polynomial(storm::RawPolynomial(p), cache));
+            storm::RationalFunction fq(storm::Polynomial(storm::RawPolynomial(q), cache));
+            storm::RationalFunction one(1);
+            storm::RationalFunction half(storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.5));
+
+            functions.push_back(fp);
+            functions.push_back(one - fp);
+            functions.push_back(fp * fq);
+            // A univariate polynomial with a gap between the exponents (Horner form)
+            functions.push_back(fp * fp * fp * fp - fp * half + half);
+            // A multivariate polynomial with a constant denominator
+            functions.push_back((fp * fp * fq + fq * fq + one) * half);
+            // A rational function with a non-constant denominator
+            functions.push_back((fp + fq) / (one + fp * fq));
+            functions.push_back(storm::RationalFunction(storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.75)));
+            // A function that occurs twice
+            functions.push_back(fp * fq);
+        }
+
+        double evaluateExactly(storm::RationalFunction const& function, double pValue, double qValue) const {
+            storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+            valuation.emplace(p, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(pValue));
+            valuation.emplace(q, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(qValue));
+            return storm::utility::convertNumber<double>(function.evaluate(valuation));
+        }
+
+        storm::RationalFunctionVariable p, q;
+        std::vector<storm::RationalFunction> functions;
+    };
+
+    TEST_F(CompiledRationalFunctionsTest, SinglePoint) {
+        storm::utility::parametric::CompiledRationalFunctions compiled(functions);
+        ASSERT_EQ(functions.size(), compiled.getNumberOfFunctions());
+        ASSERT_EQ(2ull, compiled.getVariables().size());
+
+        std::vector<double> result;
+        for (double pValue : {0.0, 0.2, 0.5, 0.9}) {
+            for (double qValue : {0.1, 0.3, 1.0}) {
+                std::vector<double> point(2);
+                point[compiled.getVariables()[0] == p ? 0 : 1] = pValue;
+                point[compiled.getVariables()[0] == p ? 1 : 0] = qValue;
+                compiled.evaluate(point, result);
+                ASSERT_EQ(functions.size(), result.size());
+                for (uint64_t i = 0; i < functions.size(); ++i) {
+                    EXPECT_NEAR(evaluateExactly(functions[i], pValue, qValue), result[i], 1e-12) << "Function " << functions[i] << " at p=" << pValue << ", q=" << qValue;
+                }
+            }
+        }
+
+        storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+        valuation.emplace(p, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.25));
+        STORM_SILENT_EXPECT_THROW(compiled.evaluate(valuation, result), storm::exceptions::InvalidArgumentException);
+        valuation.emplace(q, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.75));
+        compiled.evaluate(valuation, result);
+        for (uint64_t i = 0; i < functions.size(); ++i) {
+            EXPECT_NEAR(evaluateExactly(functions[i], 0.25, 0.75), result[i], 1e-12);
+        }
+    }
+
+    TEST_F(CompiledRationalFunctionsTest, Batch) {
+        storm::utility::parametric::CompiledRationalFunctions compiled(functions);
+        uint64_t pIndex = compiled.getVariables()[0] == p ? 0 : 1;
+
+        // More points than evaluated at once such that the last batch is only partially filled.
+        uint64_t const numberOfPoints = 150;
+        std::vector<double> points(2 * numberOfPoints);
+        for (uint64_t point = 0; point < numberOfPoints; ++point) {
+            points[pIndex * numberOfPoints + point] = static_cast<double>(point) / numberOfPoints;
+            points[(1 - pIndex) * numberOfPoints + point] = 1.0 - static_cast<double>(point * point) / (numberOfPoints * numberOfPoints);
+        }
+        std::vector<double> result;
+        compiled.evaluateBatch(points, numberOfPoints, result);
+        ASSERT_EQ(functions.size() * numberOfPoints, result.size());
+
+        std::vector<double> singleResult;
+        for (uint64_t point = 0; point < numberOfPoints; ++point) {
+            double pValue = points[pIndex * numberOfPoints + point];
+            double qValue = points[(1 - pIndex) * numberOfPoints + point];
+            compiled.evaluate(std::vector<double>({points[point], points[numberOfPoints + point]}), singleResult);
+            for (uint64_t i = 0; i < functions.size(); ++i) {
+                EXPECT_NEAR(evaluateExactly(functions[i], pValue, qValue), result[i * numberOfPoints + point], 1e-12);
+                // Batch and single evaluation execute the same instructions.
+                EXPECT_DOUBLE_EQ(singleResult[i], result[i * numberOfPoints + point]);
+            }
+        }
+    }
+}
+
+#endif
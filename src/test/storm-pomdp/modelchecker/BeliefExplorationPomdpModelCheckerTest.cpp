@@ -123,6 +123,21 @@ namespace {
         static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {options.refine = true; options.refinePrecision = precision();}
     };
     
+    class ParallelRefineDoubleVIEnvironment {
+    public:
+        typedef double ValueType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+            return env;
+        }
+        static bool const isExactModelChecking = false;
+        static ValueType precision() { return storm::utility::convertNumber<ValueType>(0.005); }
+        static PreprocessingType const preprocessingType = PreprocessingType::None;
+        static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {options.refine = true; options.refinePrecision = precision(); options.numberOfThreads = 4;}
+    };
+    
     class DefaultDoubleOVIEnvironment {
     public:
         typedef double ValueType;
@@ -241,6 +256,7 @@ namespace {
             FineDoubleVIEnvironment,
             RefineDoubleVIEnvironment,
             PreprocessedRefineDoubleVIEnvironment,
+            ParallelRefineDoubleVIEnvironment,
             DefaultDoubleOVIEnvironment,
             DefaultRationalPIEnvironment,
             PreprocessedDefaultRationalPIEnvironment
@@ -0,0 +1,89 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm-pomdp/modelchecker/PointBasedPomdpModelChecker.h"
+#include "storm-pomdp/transformer/MakePOMDPCanonic.h"
+#include "storm/api/storm.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace {
+    class PointBasedPomdpModelCheckerTest : public ::testing::Test {
+    protected:
+        typedef storm::pomdp::modelchecker::PointBasedPomdpModelChecker<storm::models::sparse::Pomdp<double>> CheckerType;
+
+        struct Input {
+            std::shared_ptr<storm::models::sparse::Pomdp<double>> model;
+            std::shared_ptr<storm::logic::Formula const> formula;
+        };
+
+        Input buildPrism(std::string const& programFile, std::string const& formulaAsString, std::string const& constantsAsString) const {
+            storm::prism::Program program = storm::api::parseProgram(programFile);
+            program = storm::utility::prism::preprocess(program, constantsAsString);
+            Input input;
+            input.formula = storm::api::parsePropertiesForPrismProgram(formulaAsString, program).front().getRawFormula();
+            input.model = storm::api::buildSparseModel<double>(program, {input.formula})->template as<storm::models::sparse::Pomdp<double>>();
+            storm::transformer::MakePOMDPCanonic<double> makeCanonic(*input.model);
+            input.model = makeCanonic.transform();
+            EXPECT_TRUE(input.model->isCanonic());
+            return input;
+        }
+
+        void checkBounds(std::string const& programFile, std::string const& formulaAsString, std::string const& constantsAsString, double expected) const {
+            auto data = buildPrism(programFile, formulaAsString, constantsAsString);
+            CheckerType::Options options;
+            options.precision = 1e-3;
+            CheckerType checker(data.model, options);
+            auto result = checker.check(*data.formula);
+            EXPECT_LE(result.lowerBound, expected + 1e-6);
+            EXPECT_GE(result.upperBound, expected - 1e-6);
+            EXPECT_LE(result.diff(), 0.05) << "Result [" << result.lowerBound << ", " << result.upperBound << "] is not precise enough. If (only) this fails, the result bounds are still correct, but they might be unexpectedly imprecise.\n";
+        }
+    };
+
+    TEST_F(PointBasedPomdpModelCheckerTest, simple_Pmax) {
+        checkBounds(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Pmax=? [F \"goal\" ]", "slippery=0", 0.7);
+    }
+
+    TEST_F(PointBasedPomdpModelCheckerTest, simple_Pmin) {
+        checkBounds(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Pmin=? [F \"goal\" ]", "slippery=0", 0.3);
+    }
+
+    TEST_F(PointBasedPomdpModelCheckerTest, simple_slippery_Pmax) {
+        checkBounds(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Pmax=? [F \"goal\" ]", "slippery=0.4", 0.7);
+    }
+
+    TEST_F(PointBasedPomdpModelCheckerTest, simple_Rmax) {
+        checkBounds(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Rmax=? [F s>4 ]", "slippery=0", 29.0 / 50.0);
+    }
+
+    TEST_F(PointBasedPomdpModelCheckerTest, simple_Rmin) {
+        checkBounds(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Rmin=? [F s>4 ]", "slippery=0", 19.0 / 50.0);
+    }
+
+    TEST_F(PointBasedPomdpModelCheckerTest, maze2_Rmin) {
+        checkBounds(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "R[exp]min=? [F \"goal\"]", "sl=0", 74.0 / 91.0);
+    }
+
+    TEST_F(PointBasedPomdpModelCheckerTest, maze2_Rmax) {
+        // The values on the fully observable MDP are infinite
+        auto data = buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "R[exp]max=? [F \"goal\"]", "sl=0");
+        CheckerType checker(data.model);
+        STORM_SILENT_EXPECT_THROW(checker.check(*data.formula), storm::exceptions::NotSupportedException);
+    }
+
+    TEST_F(PointBasedPomdpModelCheckerTest, refuel_Pmax_anytime) {
+        auto data = buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/refuel.prism", "Pmax=?[\"notbad\" U \"goal\"]", "N=4");
+        CheckerType::Options options;
+        options.precision = 1e-3;
+        options.trialLimit = 1;
+        auto firstResult = CheckerType(data.model, options).check(*data.formula);
+        options.trialLimit = 50;
+        auto result = CheckerType(data.model, options).check(*data.formula);
+        // More trials can only improve the bounds
+        EXPECT_LE(firstResult.lowerBound, result.lowerBound + 1e-6);
+        EXPECT_GE(firstResult.upperBound, result.upperBound - 1e-6);
+        EXPECT_LE(result.lowerBound, 38.0 / 155.0 + 1e-6);
+        EXPECT_GE(result.upperBound, 38.0 / 155.0 - 1e-6);
+    }
+}
@@ -218,3 +218,114 @@ TEST(ExplicitPrismModelBuilderTest, CallbackActionMask) {
     EXPECT_EQ(13ul, model->getNumberOfStates());
     EXPECT_EQ(20ul, model->getNumberOfTransitions());
 }
+
+TEST(ExplicitPrismModelBuilderTest, Parallel) {
+    storm::builder::ExplicitModelBuilder<double>::Options sequentialOptions;
+    sequentialOptions.numberOfThreads = 1;
+    storm::builder::ExplicitModelBuilder<double>::Options parallelOptions;
+    parallelOptions.numberOfThreads = 4;
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    generatorOptions.setBuildAllRewardModels();
+
+    for (std::string const& file : {STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm",
+                                    STORM_TEST_RESOURCES_DIR "/mdp/firewire3-0.5.nm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(file);
+        auto sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, sequentialOptions).build();
+        auto parallelModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, parallelOptions).build();
+
+        // The states have to be numbered exactly as in the sequential exploration.
+        ASSERT_EQ(sequentialModel->getNumberOfStates(), parallelModel->getNumberOfStates());
+        EXPECT_EQ(sequentialModel->getInitialStates(), parallelModel->getInitialStates());
+        EXPECT_TRUE(sequentialModel->getTransitionMatrix() == parallelModel->getTransitionMatrix());
+        EXPECT_TRUE(sequentialModel->getStateLabeling() == parallelModel->getStateLabeling());
+        for (auto const& rewardModel : sequentialModel->getRewardModels()) {
+            ASSERT_TRUE(parallelModel->hasRewardModel(rewardModel.first));
+            auto const& parallelRewardModel = parallelModel->getRewardModel(rewardModel.first);
+            EXPECT_EQ(rewardModel.second.getOptionalStateRewardVector(), parallelRewardModel.getOptionalStateRewardVector());
+            EXPECT_EQ(rewardModel.second.getOptionalStateActionRewardVector(), parallelRewardModel.getOptionalStateActionRewardVector());
+        }
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, CompressedStates) {
+    // States of this model need more than 64 bits, so they are actually compressed.
+    std::string input = R"(dtmc
+module counters
+    a : [0..1000000000] init 0;
+    b : [0..1000000000] init 0;
+    c : [0..1000000000] init 0;
+    [] a < 20 -> 0.5 : (a'=a+1) + 0.5 : (a'=a+1) & (b'=mod(b+1, 10));
+    [] a = 20 & c < 5 -> (a'=0) & (c'=c+1);
+    [] a = 20 & c = 5 -> true;
+endmodule
+label "done" = c = 5;
+)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(input, "testfile");
+    storm::builder::ExplicitModelBuilder<double>::Options options;
+    storm::builder::ExplicitModelBuilder<double>::Options compressedOptions;
+    compressedOptions.compressStates = true;
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+
+    auto model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, options).build();
+    auto compressedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, compressedOptions).build();
+    EXPECT_EQ(1215ul, compressedModel->getNumberOfStates());
+    EXPECT_EQ(model->getNumberOfStates(), compressedModel->getNumberOfStates());
+    EXPECT_TRUE(model->getTransitionMatrix() == compressedModel->getTransitionMatrix());
+    EXPECT_TRUE(model->getStateLabeling() == compressedModel->getStateLabeling());
+}
+
+TEST(ExplicitPrismModelBuilderTest, SymmetryReduction) {
+    std::string input = R"(mdp
+module process1
+    x1 : [0..2] init 0;
+    [] x1 < 2 -> 0.5 : (x1'=x1+1) + 0.5 : true;
+    [] x1 = 2 -> true;
+endmodule
+module process2 = process1 [x1=x2] endmodule
+module process3 = process1 [x1=x3] endmodule
+label "done" = x1 = 2 & x2 = 2 & x3 = 2;
+)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(input, "testfile");
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+
+    auto model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(27ul, model->getNumberOfStates());
+
+    // Only the multisets of the counter values remain.
+    generatorOptions.setSymmetryReduction();
+    auto reducedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(10ul, reducedModel->getNumberOfStates());
+    EXPECT_EQ(30ul, reducedModel->getNumberOfChoices());
+    EXPECT_EQ(1ul, reducedModel->getStates("done").getNumberOfSetBits());
+}
+
+TEST(ExplicitPrismModelBuilderTest, PartialOrderReduction) {
+    // The counters are invisible, so their increments only need to be explored in one interleaving.
+    std::string input = R"(mdp
+module process1
+    w1 : [0..3] init 0;
+    d1 : bool init false;
+    [] w1 < 2 -> 0.5 : (w1'=w1+1) + 0.5 : (w1'=w1+2);
+    [] w1 >= 2 & !d1 -> (d1'=true);
+    [] d1 -> true;
+endmodule
+module process2 = process1 [w1=w2, d1=d2] endmodule
+module process3 = process1 [w1=w3, d1=d3] endmodule
+label "done" = d1 & d2 & d3;
+)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(input, "testfile");
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+
+    auto model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(216ul, model->getNumberOfStates());
+    EXPECT_EQ(8ul, model->getStates("done").getNumberOfSetBits());
+
+    generatorOptions.setPartialOrderReduction();
+    auto reducedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(138ul, reducedModel->getNumberOfStates());
+    EXPECT_EQ(8ul, reducedModel->getStates("done").getNumberOfSetBits());
+}
@@ -4,6 +4,9 @@
 #if defined STORM_HAVE_HYPRO || defined STORM_HAVE_Z3_OPTIMIZE
 
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
+#include "storm/environment/ParallelEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/modelchecker/multiobjective/multiObjectiveModelChecking.h"
 
 #include "storm-parsers/api/storm-parsers.h"
@@ -107,6 +110,37 @@ TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, team3with3objectives) {
                 storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
 
+TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, team3with3objectivesBatch) {
+    if (!storm::test::z3AtLeastVersion(4, 8, 5)) {
+        GTEST_SKIP() << "Test disabled since it triggers a bug in the installed version of z3.";
+    }
+
+    // With value iteration as linear equation solver, the individual objectives are solved together (in parallel).
+    storm::Environment env;
+    env.modelchecker().multi().setMethod(storm::modelchecker::multiobjective::MultiObjectiveMethod::Pcaa);
+    env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+    env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Power);
+    env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-9));
+    env.parallel().setNumberOfThreads(2);
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/multiobj_team3.nm";
+    std::string formulasAsString = "multi(Pmax=? [ F \"task1_compl\" ], R{\"w_1_total\"}>=2.210204082 [ C ], P>=0.5 [ F \"task2_compl\" ])";  // numerical
+
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, "");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    uint_fast64_t const initState = *mdp->getInitialStates().begin();
+
+    std::unique_ptr<storm::modelchecker::CheckResult> result =
+        storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(env, *mdp, formulas[0]->asMultiObjectiveFormula());
+    ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
+    EXPECT_NEAR(0.7448979591841851, result->asExplicitQuantitativeCheckResult<double>()[initState],
+                storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+}
+
 TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, scheduler) {
     if (!storm::test::z3AtLeastVersion(4, 8, 5)) {
         GTEST_SKIP() << "Test disabled since it triggers a bug in the installed version of z3.";
@@ -21,6 +21,7 @@
 #include "storm/settings/modules/GeneralSettings.h"
 
 #include "storm-parsers/parser/AutoParser.h"
+#include "storm/environment/ParallelEnvironment.h"
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/settings/modules/NativeEquationSolverSettings.h"
 
@@ -39,6 +40,18 @@ class SparseValueTypeValueIterationEnvironment {
     }
 };
 
+class SparseValueTypeParallelValueIterationEnvironment {
+   public:
+    static const bool isExact = false;
+    typedef double ValueType;
+    typedef storm::models::sparse::Mdp<ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env = SparseValueTypeValueIterationEnvironment::createEnvironment();
+        env.parallel().setNumberOfThreads(4);
+        return env;
+    }
+};
+
 class SparseValueTypeLinearProgrammingEnvironment {
    public:
     static const bool isExact = false;
@@ -119,7 +132,7 @@ class LraMdpPrctlModelCheckerTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<SparseValueTypeValueIterationEnvironment, SparseValueTypeLinearProgrammingEnvironment, SparseSoundEnvironment
+typedef ::testing::Types<SparseValueTypeValueIterationEnvironment, SparseValueTypeParallelValueIterationEnvironment, SparseValueTypeLinearProgrammingEnvironment, SparseSoundEnvironment
 #ifdef STORM_HAVE_Z3_OPTIMIZE
                          ,
                          SparseRationalLinearProgrammingEnvironment
@@ -15,6 +15,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
 
+#include "storm/environment/ParallelEnvironment.h"
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
@@ -30,6 +31,15 @@ class DoubleViEnvironment {
         return env;
     }
 };
+class DoubleParallelViEnvironment {
+   public:
+    typedef double ValueType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env = DoubleViEnvironment::createEnvironment();
+        env.parallel().setNumberOfThreads(4);
+        return env;
+    }
+};
 class DoubleSoundViEnvironment {
    public:
     typedef double ValueType;
@@ -109,7 +119,7 @@ class SchedulerGenerationMdpPrctlModelCheckerTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<DoubleViEnvironment, DoubleSoundViEnvironment, DoublePIEnvironment, RationalPIEnvironment
+typedef ::testing::Types<DoubleViEnvironment, DoubleParallelViEnvironment, DoubleSoundViEnvironment, DoublePIEnvironment, RationalPIEnvironment
                          // RationalRationalSearchEnvironment
                          >
     TestingTypes;
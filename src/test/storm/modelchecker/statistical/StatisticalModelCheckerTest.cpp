@@ -0,0 +1,88 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/ParallelEnvironment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/statistical/StatisticalModelChecker.h"
+
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace {
+typedef storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<double>> Checker;
+
+Checker::Options createOptions() {
+    Checker::Options options;
+    options.confidence = 0.99;
+    options.precision = 0.01;
+    options.useSprt = false;
+    options.seed = 42;
+    return options;
+}
+}  // namespace
+
+TEST(StatisticalModelCheckerTest, Die) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::parser::FormulaParser formulaParser(program);
+    Checker::Options options = createOptions();
+    Checker checker(program, options);
+    storm::Environment env;
+
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F \"one\"]");
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_NEAR(1.0 / 6.0, result->asExplicitQuantitativeCheckResult<double>()[0], options.precision);
+    EXPECT_EQ(0ull, checker.getStatistics().numberOfTruncatedPaths);
+
+    formula = formulaParser.parseSingleFormulaFromString("P=? [F<=3 \"done\"]");
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_NEAR(0.75, result->asExplicitQuantitativeCheckResult<double>()[0], options.precision);
+
+    formula = formulaParser.parseSingleFormulaFromString("R=? [F \"done\"]");
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_NEAR(11.0 / 3.0, result->asExplicitQuantitativeCheckResult<double>()[0], options.precision);
+
+    formula = formulaParser.parseSingleFormulaFromString("R=? [C<=2]");
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_NEAR(2.0, result->asExplicitQuantitativeCheckResult<double>()[0], options.precision);
+}
+
+TEST(StatisticalModelCheckerTest, DieSprt) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::parser::FormulaParser formulaParser(program);
+    Checker::Options options = createOptions();
+    options.useSprt = true;
+    options.indifference = 0.01;
+    Checker checker(program, options);
+    storm::Environment env;
+
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P>=0.2 [F \"one\"]");
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_FALSE(result->asExplicitQualitativeCheckResult()[0]);
+
+    formula = formulaParser.parseSingleFormulaFromString("P<0.2 [F \"one\"]");
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[0]);
+}
+
+TEST(StatisticalModelCheckerTest, DieMultiThreaded) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::parser::FormulaParser formulaParser(program);
+    Checker::Options options = createOptions();
+    storm::Environment env;
+    env.parallel().setNumberOfThreads(4);
+
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F \"two\"]");
+    Checker checker(program, options);
+    double first = checker.check(env, storm::modelchecker::CheckTask<>(*formula, true))->asExplicitQuantitativeCheckResult<double>()[0];
+    EXPECT_NEAR(1.0 / 6.0, first, options.precision);
+
+    // The same seed and number of threads yield the same estimate.
+    Checker otherChecker(program, options);
+    double second = otherChecker.check(env, storm::modelchecker::CheckTask<>(*formula, true))->asExplicitQuantitativeCheckResult<double>()[0];
+    EXPECT_EQ(first, second);
+}
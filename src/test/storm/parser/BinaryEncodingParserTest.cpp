@@ -0,0 +1,97 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+#include "storm-parsers/parser/BinaryEncodingParser.h"
+#include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/BinaryEncodingExporter.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace {
+
+std::shared_ptr<storm::models::sparse::Model<double>> exportAndParse(std::shared_ptr<storm::models::sparse::Model<double>> const& model) {
+    std::string filename = (std::filesystem::temp_directory_path() / "storm-binary-encoding-test.drb").string();
+    std::ofstream stream(filename, std::ios::binary);
+    storm::exporter::binaryExportSparseModel(stream, model);
+    stream.close();
+    auto result = storm::parser::BinaryEncodingParser<double>::parseModel(filename);
+    std::remove(filename.c_str());
+    return result;
+}
+
+void expectEqualModels(storm::models::sparse::Model<double> const& expected, storm::models::sparse::Model<double> const& actual) {
+    EXPECT_EQ(expected.getType(), actual.getType());
+    EXPECT_EQ(expected.getNumberOfStates(), actual.getNumberOfStates());
+    EXPECT_EQ(expected.getNumberOfChoices(), actual.getNumberOfChoices());
+    EXPECT_TRUE(expected.getTransitionMatrix() == actual.getTransitionMatrix());
+    EXPECT_EQ(expected.getStateLabeling(), actual.getStateLabeling());
+    EXPECT_EQ(expected.getNumberOfRewardModels(), actual.getNumberOfRewardModels());
+    for (auto const& rewardModel : expected.getRewardModels()) {
+        ASSERT_TRUE(actual.hasRewardModel(rewardModel.first));
+        auto const& actualRewardModel = actual.getRewardModel(rewardModel.first);
+        ASSERT_EQ(rewardModel.second.hasStateRewards(), actualRewardModel.hasStateRewards());
+        ASSERT_EQ(rewardModel.second.hasStateActionRewards(), actualRewardModel.hasStateActionRewards());
+        if (rewardModel.second.hasStateRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateRewardVector(), actualRewardModel.getStateRewardVector());
+        }
+        if (rewardModel.second.hasStateActionRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), actualRewardModel.getStateActionRewardVector());
+        }
+    }
+}
+
+}  // namespace
+
+TEST(BinaryEncodingParserTest, DtmcRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+    auto parsedModel = exportAndParse(model);
+    expectEqualModels(*model, *parsedModel);
+    EXPECT_EQ(4650ul, parsedModel->getStates("observeIGreater1").getNumberOfSetBits());
+}
+
+TEST(BinaryEncodingParserTest, CtmcRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn");
+    auto parsedModel = exportAndParse(model);
+    expectEqualModels(*model, *parsedModel);
+}
+
+TEST(BinaryEncodingParserTest, MarkovAutomatonRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn");
+    auto parsedModel = exportAndParse(model);
+    expectEqualModels(*model, *parsedModel);
+    auto ma = model->as<storm::models::sparse::MarkovAutomaton<double>>();
+    auto parsedMa = parsedModel->as<storm::models::sparse::MarkovAutomaton<double>>();
+    EXPECT_EQ(ma->getMarkovianStates(), parsedMa->getMarkovianStates());
+    EXPECT_EQ(ma->getExitRates(), parsedMa->getExitRates());
+}
+
+TEST(BinaryEncodingParserTest, MdpWithValuationsRoundTrip) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    storm::generator::NextStateGeneratorOptions options;
+    options.setBuildAllLabels();
+    options.setBuildAllRewardModels();
+    options.setBuildChoiceLabels();
+    options.setBuildStateValuations();
+    auto model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    auto parsedModel = exportAndParse(model);
+    expectEqualModels(*model, *parsedModel);
+
+    ASSERT_TRUE(parsedModel->hasChoiceLabeling());
+    EXPECT_EQ(model->getChoiceLabeling(), parsedModel->getChoiceLabeling());
+    ASSERT_TRUE(parsedModel->hasStateValuations());
+    for (uint64_t state = 0; state < model->getNumberOfStates(); ++state) {
+        EXPECT_EQ(model->getStateValuations().toString(state), parsedModel->getStateValuations().toString(state));
+    }
+}
+
+TEST(BinaryEncodingParserTest, WrongFormat) {
+    STORM_SILENT_ASSERT_THROW(storm::parser::BinaryEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn"),
+                              storm::exceptions::WrongFormatException);
+}
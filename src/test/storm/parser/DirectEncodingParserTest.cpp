@@ -87,3 +87,34 @@ TEST(DirectEncodingParserTest, MarkovAutomatonParsing) {
     ASSERT_TRUE(modelPtr->hasLabel("one_job_finished"));
     ASSERT_EQ(6ul, modelPtr->getStates("one_job_finished").getNumberOfSetBits());
 }
+
+TEST(DirectEncodingParserTest, ParallelParsing) {
+    storm::parser::DirectEncodingParserOptions sequentialOptions, parallelOptions;
+    sequentialOptions.numberOfThreads = 1;
+    parallelOptions.numberOfThreads = 4;
+    for (std::string file : {"/dtmc/crowds-5-5.drn", "/mdp/two_dice.drn", "/ctmc/cluster2.drn", "/ma/jobscheduler.drn"}) {
+        auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR + file, sequentialOptions);
+        auto parallelModel = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR + file, parallelOptions);
+        ASSERT_EQ(model->getType(), parallelModel->getType());
+        EXPECT_TRUE(model->getTransitionMatrix() == parallelModel->getTransitionMatrix());
+        EXPECT_EQ(model->getStateLabeling(), parallelModel->getStateLabeling());
+        ASSERT_EQ(model->getNumberOfRewardModels(), parallelModel->getNumberOfRewardModels());
+        for (auto const& rewardModel : model->getRewardModels()) {
+            auto const& parallelRewardModel = parallelModel->getRewardModel(rewardModel.first);
+            ASSERT_EQ(rewardModel.second.hasStateRewards(), parallelRewardModel.hasStateRewards());
+            ASSERT_EQ(rewardModel.second.hasStateActionRewards(), parallelRewardModel.hasStateActionRewards());
+            if (rewardModel.second.hasStateRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateRewardVector(), parallelRewardModel.getStateRewardVector());
+            }
+            if (rewardModel.second.hasStateActionRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), parallelRewardModel.getStateActionRewardVector());
+            }
+        }
+        if (model->isOfType(storm::models::ModelType::MarkovAutomaton)) {
+            auto ma = model->as<storm::models::sparse::MarkovAutomaton<double>>();
+            auto parallelMa = parallelModel->as<storm::models::sparse::MarkovAutomaton<double>>();
+            EXPECT_EQ(ma->getMarkovianStates(), parallelMa->getMarkovianStates());
+            EXPECT_EQ(ma->getExitRates(), parallelMa->getExitRates());
+        }
+    }
+}
@@ -0,0 +1,84 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/simulator/DiscreteTimeSparseModelSimulator.h"
+
+namespace {
+std::shared_ptr<storm::models::sparse::Model<double>> buildDie() {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P=? [F \"one\"]; R=? [F \"done\"]", program));
+    return storm::api::buildSparseModel<double>(program, formulas);
+}
+}  // namespace
+
+TEST(DiscreteTimeSparseModelSimulatorTest, KnuthYaoDie) {
+    auto model = buildDie();
+    storm::simulator::DiscreteTimeSparseModelSimulator<double> simulator(*model);
+    simulator.setSeed(42);
+
+    storm::storage::BitVector const& one = model->getStates("one");
+    storm::storage::BitVector const& done = model->getStates("done");
+    uint64_t const numberOfPaths = 20000;
+    uint64_t ones = 0;
+    double flips = 0.0;
+    for (uint64_t path = 0; path < numberOfPaths; ++path) {
+        simulator.resetToInitial();
+        EXPECT_EQ(0.0, simulator.getLastRewards()[0]);
+        while (!done.get(simulator.getCurrentState())) {
+            EXPECT_TRUE(simulator.randomStep());
+            EXPECT_EQ(1.0, simulator.getLastRewards()[0]);
+            flips += simulator.getLastRewards()[0];
+        }
+        if (one.get(simulator.getCurrentState())) {
+            ++ones;
+        }
+    }
+    EXPECT_NEAR(1.0 / 6.0, static_cast<double>(ones) / numberOfPaths, 0.01);
+    EXPECT_NEAR(11.0 / 3.0, flips / numberOfPaths, 0.05);
+}
+
+TEST(DiscreteTimeSparseModelSimulatorTest, KnuthYaoDieBatch) {
+    auto model = buildDie();
+    storm::simulator::DiscreteTimeSparseModelSimulator<double> simulator(*model);
+    simulator.setSeed(42);
+
+    storm::storage::BitVector const& one = model->getStates("one");
+    storm::storage::BitVector const& done = model->getStates("done");
+    uint64_t const numberOfPaths = 20000;
+    auto batch = simulator.createBatch(numberOfPaths);
+    EXPECT_EQ(numberOfPaths, batch.active.getNumberOfSetBits());
+    ASSERT_EQ(1ul, batch.rewards.size());
+
+    uint64_t steps = 0;
+    while (!batch.active.empty()) {
+        // Stop the paths once the die has a value.
+        for (auto path : batch.active) {
+            if (done.get(batch.states[path])) {
+                batch.active.set(path, false);
+            }
+        }
+        steps += simulator.randomStepBatch(batch);
+    }
+
+    uint64_t ones = 0;
+    double flips = 0.0;
+    for (uint64_t path = 0; path < numberOfPaths; ++path) {
+        EXPECT_TRUE(done.get(batch.states[path]));
+        if (one.get(batch.states[path])) {
+            ++ones;
+        }
+        flips += batch.rewards[0][path];
+    }
+    EXPECT_EQ(static_cast<double>(steps), flips);
+    EXPECT_NEAR(1.0 / 6.0, static_cast<double>(ones) / numberOfPaths, 0.01);
+    EXPECT_NEAR(11.0 / 3.0, flips / numberOfPaths, 0.05);
+
+    simulator.resetBatch(batch);
+    EXPECT_EQ(numberOfPaths, batch.active.getNumberOfSetBits());
+    EXPECT_EQ(0.0, batch.rewards[0][0]);
+}
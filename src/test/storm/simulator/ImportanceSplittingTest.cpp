@@ -0,0 +1,103 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <cmath>
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/builder.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/ParallelEnvironment.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/simulator/DiscreteTimeSparseModelSimulator.h"
+#include "storm/simulator/ImportanceSplitting.h"
+#include "storm/simulator/PrismProgramSimulator.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+
+namespace {
+// A gambler with one coin who wins a round with probability 0.3 and stops when broke or when having 20 coins.
+std::string const gamblerProgram = R"(dtmc
+module gambler
+    x : [0..20] init 1;
+    [] x>0 & x<20 -> 0.3 : (x'=x+1) + 0.7 : (x'=x-1);
+    [] x=0 | x=20 -> true;
+endmodule
+label "goal" = x=20;
+label "broke" = x=0;
+)";
+
+// The probability to reach 20 coins before going broke.
+double gamblerProbability() {
+    double ratio = 0.7 / 0.3;
+    return (ratio - 1.0) / (std::pow(ratio, 20) - 1.0);
+}
+
+storm::simulator::ImportanceSplittingOptions createOptions() {
+    storm::simulator::ImportanceSplittingOptions options;
+    options.effort = 1000;
+    options.replications = 16;
+    options.confidence = 0.99;
+    options.seed = 42;
+    return options;
+}
+}  // namespace
+
+TEST(ImportanceSplittingTest, GamblerSparse) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(gamblerProgram, "gambler.pm");
+    storm::builder::BuilderOptions builderOptions;
+    builderOptions.setBuildAllLabels();
+    auto model = storm::api::buildSparseModel<double>(program, builderOptions);
+    storm::storage::BitVector psiStates = model->getStates("goal");
+    storm::storage::BitVector phiStates = ~model->getStates("broke");
+
+    auto event = storm::simulator::createRareEvent(model, phiStates, psiStates);
+    EXPECT_EQ(19ull, event.maximalImportance);
+    storm::simulator::ImportanceSplittingEstimator<storm::simulator::DiscreteTimeSparseModelSimulator<double>> estimator(event, createOptions());
+
+    storm::Environment env;
+    env.parallel().setNumberOfThreads(4);
+    auto result = estimator.estimate(env);
+    double const expected = gamblerProbability();
+    EXPECT_NEAR(expected, result.estimate, 0.2 * expected);
+    EXPECT_LE(result.lowerBound, result.estimate);
+    EXPECT_GE(result.upperBound, result.estimate);
+    EXPECT_EQ(20ul, result.levelProbabilities.size());
+    EXPECT_EQ(0ull, result.numberOfTruncatedPaths);
+
+    // The estimate does not depend on the number of threads.
+    env.parallel().setNumberOfThreads(1);
+    EXPECT_EQ(result.estimate, estimator.estimate(env).estimate);
+}
+
+TEST(ImportanceSplittingTest, GamblerSparseStepBounded) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(gamblerProgram, "gambler.pm");
+    storm::builder::BuilderOptions builderOptions;
+    builderOptions.setBuildAllLabels();
+    auto model = storm::api::buildSparseModel<double>(program, builderOptions);
+    storm::storage::BitVector psiStates = model->getStates("goal");
+    storm::storage::BitVector phiStates = ~model->getStates("broke");
+
+    // The goal can only be reached by winning 19 rounds in a row.
+    auto event = storm::simulator::createRareEvent(model, phiStates, psiStates, 19ull);
+    storm::simulator::ImportanceSplittingEstimator<storm::simulator::DiscreteTimeSparseModelSimulator<double>> estimator(event, createOptions());
+    auto result = estimator.estimate(storm::Environment());
+    double const expected = std::pow(0.3, 19);
+    EXPECT_NEAR(expected, result.estimate, 0.2 * expected);
+}
+
+TEST(ImportanceSplittingTest, GamblerPrism) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(gamblerProgram, "gambler.pm");
+    storm::expressions::ExpressionManager& manager = program.getManager();
+    storm::expressions::Expression x = manager.getVariableExpression("x");
+
+    auto event = storm::simulator::createRareEvent(program, x > manager.integer(0), x == manager.integer(20), x - manager.integer(1), 19);
+    storm::simulator::ImportanceSplittingOptions options = createOptions();
+    options.effort = 200;
+    storm::simulator::ImportanceSplittingEstimator<storm::simulator::DiscreteTimePrismProgramSimulator<double>> estimator(event, options);
+
+    storm::Environment env;
+    env.parallel().setNumberOfThreads(4);
+    auto result = estimator.estimate(env);
+    double const expected = gamblerProbability();
+    EXPECT_NEAR(expected, result.estimate, 0.3 * expected);
+}
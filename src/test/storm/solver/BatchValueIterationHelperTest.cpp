@@ -0,0 +1,94 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/ParallelEnvironment.h"
+#include "storm/solver/helper/BatchValueIterationHelper.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+// Two transient states s1, s2 (plus an implicit goal and sink). In s1, one can either move to s2 or the sink (each with
+// probability 0.5), or move to the goal directly. From s2, one moves to s1 or the goal (each with probability 0.5).
+storm::storage::SparseMatrix<double> createMatrix() {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 1, 0.5);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 0, 0.5);
+    return builder.build(3, 2, 2);
+}
+}  // namespace
+
+TEST(BatchValueIterationHelperTest, MinMax) {
+    storm::Environment env;
+    auto matrix = createMatrix();
+    storm::solver::helper::BatchValueIterationHelper<double> helper(matrix);
+
+    // The first property considers reaching the goal, the second one reaching the sink.
+    std::vector<std::vector<double>> b = {{0.0, 1.0, 0.5}, {0.5, 0.0, 0.0}};
+    std::vector<std::vector<double>> x(2, std::vector<double>(2, 0.0));
+    std::vector<std::vector<uint_fast64_t>> choices;
+    auto result = helper.solveEquations(env, x, b, false, 1e-10, 10000, storm::OptimizationDirection::Maximize, &choices);
+    EXPECT_EQ(storm::solver::SolverStatus::Converged, result.first);
+    EXPECT_NEAR(1.0, x[0][0], 1e-8);
+    EXPECT_NEAR(1.0, x[0][1], 1e-8);
+    EXPECT_NEAR(2.0 / 3.0, x[1][0], 1e-8);
+    EXPECT_NEAR(1.0 / 3.0, x[1][1], 1e-8);
+    EXPECT_EQ(1ull, choices[0][0]);
+    EXPECT_EQ(0ull, choices[1][0]);
+
+    x.assign(2, std::vector<double>(2, 0.0));
+    result = helper.solveEquations(env, x, b, false, 1e-10, 10000, storm::OptimizationDirection::Minimize, &choices);
+    EXPECT_EQ(storm::solver::SolverStatus::Converged, result.first);
+    EXPECT_NEAR(1.0 / 3.0, x[0][0], 1e-8);
+    EXPECT_NEAR(2.0 / 3.0, x[0][1], 1e-8);
+    EXPECT_NEAR(0.0, x[1][0], 1e-8);
+    EXPECT_NEAR(0.0, x[1][1], 1e-8);
+}
+
+TEST(BatchValueIterationHelperTest, FixedScheduler) {
+    storm::Environment env;
+    auto matrix = createMatrix();
+    storm::solver::helper::BatchValueIterationHelper<double> helper(matrix);
+
+    std::vector<std::vector<double>> b = {{0.0, 1.0, 0.5}, {0.5, 0.0, 0.0}};
+    std::vector<std::vector<double>> x(2, std::vector<double>(2, 0.0));
+    auto result = helper.solveEquationsWithScheduler(env, {0, 0}, x, b, false, 1e-10, 10000);
+    EXPECT_EQ(storm::solver::SolverStatus::Converged, result.first);
+    EXPECT_NEAR(1.0 / 3.0, x[0][0], 1e-8);
+    EXPECT_NEAR(2.0 / 3.0, x[0][1], 1e-8);
+    EXPECT_NEAR(2.0 / 3.0, x[1][0], 1e-8);
+    EXPECT_NEAR(1.0 / 3.0, x[1][1], 1e-8);
+
+    // The induced matrix has no nondeterminism, so it can be solved without an optimization direction.
+    std::vector<std::vector<double>> inducedB = {{0.0, 0.5}, {0.5, 0.0}};
+    std::vector<std::vector<double>> y(2, std::vector<double>(2, 0.0));
+    auto inducedMatrix = matrix.selectRowsFromRowGroups({0, 0}, false);
+    storm::solver::helper::BatchValueIterationHelper<double> inducedHelper(inducedMatrix);
+    result = inducedHelper.solveEquations(env, y, inducedB, false, 1e-10, 10000);
+    EXPECT_EQ(storm::solver::SolverStatus::Converged, result.first);
+    for (uint64_t i = 0; i < 2; ++i) {
+        for (uint64_t j = 0; j < 2; ++j) {
+            EXPECT_NEAR(x[i][j], y[i][j], 1e-8);
+        }
+    }
+}
+
+TEST(BatchValueIterationHelperTest, Parallel) {
+    storm::Environment env;
+    storm::Environment parallelEnv;
+    parallelEnv.parallel().setNumberOfThreads(2);
+    auto matrix = createMatrix();
+    storm::solver::helper::BatchValueIterationHelper<double> helper(matrix);
+
+    std::vector<std::vector<double>> b = {{0.0, 1.0, 0.5}, {0.5, 0.0, 0.0}};
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<std::vector<double>> x(2, std::vector<double>(2, 0.0)), y = x;
+        std::vector<std::vector<uint_fast64_t>> choices, parallelChoices;
+        auto result = helper.solveEquations(env, x, b, false, 1e-10, 10000, dir, &choices);
+        auto parallelResult = helper.solveEquations(parallelEnv, y, b, false, 1e-10, 10000, dir, &parallelChoices);
+        EXPECT_EQ(result, parallelResult);
+        EXPECT_EQ(x, y);
+        EXPECT_EQ(choices, parallelChoices);
+    }
+}
@@ -19,6 +19,18 @@ class NativeEnvironment {
     }
 };
 
+class NativeCompactEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+        env.solver().multiplier().setCompactMatrix(true);
+        return env;
+    }
+};
+
 class GmmxxEnvironment {
    public:
     typedef double ValueType;
@@ -30,6 +42,17 @@ class GmmxxEnvironment {
     }
 };
 
+class SimdEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Simd);
+        return env;
+    }
+};
+
 template<typename TestType>
 class MultiplierTest : public ::testing::Test {
    public:
@@ -49,7 +72,7 @@ class MultiplierTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<NativeEnvironment, GmmxxEnvironment> TestingTypes;
+typedef ::testing::Types<NativeEnvironment, NativeCompactEnvironment, GmmxxEnvironment, SimdEnvironment> TestingTypes;
 
 TYPED_TEST_SUITE(MultiplierTest, TestingTypes, );
 
@@ -123,4 +146,73 @@ TYPED_TEST(MultiplierTest, repeatedMultiplyAndReduceTest) {
     EXPECT_NEAR(x[0], this->parseNumber("0.923808265834023387639"), this->precision());
 }
 
+TYPED_TEST(MultiplierTest, multiplyAndReduceBatchTest) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("0.9")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("0.099")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, this->parseNumber("0.001")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.newRowGroup(2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 1, this->parseNumber("1")));
+    ASSERT_NO_THROW(builder.newRowGroup(3));
+    ASSERT_NO_THROW(builder.addNextValue(3, 2, this->parseNumber("1")));
+    ASSERT_NO_THROW(builder.addNextValue(4, 0, this->parseNumber("0.3")));
+    ASSERT_NO_THROW(builder.addNextValue(4, 2, this->parseNumber("0.7")));
+
+    storm::storage::SparseMatrix<ValueType> A;
+    ASSERT_NO_THROW(A = builder.build());
+
+    std::vector<std::vector<ValueType>> xs = {{this->parseNumber("0"), this->parseNumber("1"), this->parseNumber("0")},
+                                              {this->parseNumber("0.2"), this->parseNumber("0.5"), this->parseNumber("0.9")},
+                                              {this->parseNumber("1"), this->parseNumber("0"), this->parseNumber("0.5")}};
+    std::vector<std::vector<ValueType>> bs = {std::vector<ValueType>(5, this->parseNumber("0")),
+                                              {this->parseNumber("0.1"), this->parseNumber("0.2"), this->parseNumber("0.3"), this->parseNumber("0.4"),
+                                               this->parseNumber("0.5")},
+                                              {this->parseNumber("0.5"), this->parseNumber("0"), this->parseNumber("0"), this->parseNumber("0.2"),
+                                               this->parseNumber("0")}};
+    uint64_t const numberOfVectors = xs.size();
+    std::vector<ValueType> x(numberOfVectors * A.getColumnCount()), b(numberOfVectors * A.getRowCount());
+    for (uint64_t i = 0; i < numberOfVectors; ++i) {
+        for (uint64_t j = 0; j < A.getColumnCount(); ++j) {
+            x[j * numberOfVectors + i] = xs[i][j];
+        }
+        for (uint64_t j = 0; j < A.getRowCount(); ++j) {
+            b[j * numberOfVectors + i] = bs[i][j];
+        }
+    }
+
+    auto factory = storm::solver::MultiplierFactory<ValueType>();
+    auto multiplier = factory.create(this->env(), A);
+
+    // Multiplication without reduction.
+    std::vector<ValueType> batchResult;
+    ASSERT_NO_THROW(multiplier->multiplyBatch(this->env(), numberOfVectors, x, &b, batchResult));
+    for (uint64_t i = 0; i < numberOfVectors; ++i) {
+        std::vector<ValueType> result(A.getRowCount());
+        multiplier->multiply(this->env(), xs[i], &bs[i], result);
+        for (uint64_t j = 0; j < A.getRowCount(); ++j) {
+            EXPECT_NEAR(result[j], batchResult[j * numberOfVectors + i], this->precision());
+        }
+    }
+
+    // Multiplication with reduction and choice tracking.
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<uint_fast64_t> batchChoices(numberOfVectors * A.getRowGroupCount(), 0);
+        ASSERT_NO_THROW(multiplier->multiplyAndReduceBatch(this->env(), dir, A.getRowGroupIndices(), numberOfVectors, x, &b, batchResult, &batchChoices));
+        for (uint64_t i = 0; i < numberOfVectors; ++i) {
+            std::vector<ValueType> result(A.getRowGroupCount());
+            std::vector<uint_fast64_t> choices(A.getRowGroupCount(), 0);
+            multiplier->multiplyAndReduce(this->env(), dir, xs[i], &bs[i], result, &choices);
+            for (uint64_t j = 0; j < A.getRowGroupCount(); ++j) {
+                EXPECT_NEAR(result[j], batchResult[j * numberOfVectors + i], this->precision());
+                EXPECT_EQ(choices[j], batchChoices[j * numberOfVectors + i]);
+            }
+        }
+    }
+}
+
 }  // namespace
\ No newline at end of file
@@ -0,0 +1,182 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+
+#include "storm/environment/Environment.h"
+#include "storm/solver/multiplier/SimdKernels.h"
+#include "storm/solver/multiplier/SimdMultiplier.h"
+#include "storm/storage/CompactSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+std::vector<storm::solver::simd::InstructionSet> getSupportedInstructionSets() {
+    std::vector<storm::solver::simd::InstructionSet> result;
+    for (auto instructionSet :
+         {storm::solver::simd::InstructionSet::Portable, storm::solver::simd::InstructionSet::Avx2, storm::solver::simd::InstructionSet::Avx512}) {
+        if (storm::solver::simd::isSupported(instructionSet)) {
+            result.push_back(instructionSet);
+        }
+    }
+    return result;
+}
+
+// Creates a nondeterministic matrix whose rows have different lengths (such that all kernel remainders are exercised)
+// and whose row groups contain rows with equal values (such that ties have to be resolved).
+storm::storage::SparseMatrix<double> createMatrix() {
+    uint64_t const numberOfGroups = 50;
+    uint64_t const numberOfColumns = 50;
+    storm::storage::SparseMatrixBuilder<double> builder(0, numberOfColumns, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < numberOfGroups; ++group) {
+        builder.newRowGroup(row);
+        for (uint64_t choice = 0; choice < 1 + (group % 7); ++choice) {
+            uint64_t const rowLength = 1 + ((group + choice) % 19);
+            if (choice > 0 && group % 3 == 0) {
+                // Duplicate the first row of the group.
+                uint64_t const firstRowLength = 1 + (group % 19);
+                for (uint64_t i = 0; i < firstRowLength; ++i) {
+                    builder.addNextValue(row, (group + 2 * i) % numberOfColumns, 1.0 / firstRowLength);
+                }
+            } else {
+                for (uint64_t i = 0; i < rowLength; ++i) {
+                    builder.addNextValue(row, (group + choice + 2 * i) % numberOfColumns, 1.0 / rowLength);
+                }
+            }
+            ++row;
+        }
+    }
+    return builder.build();
+}
+
+std::vector<double> createVector(uint64_t size) {
+    std::vector<double> result(size);
+    for (uint64_t i = 0; i < size; ++i) {
+        result[i] = static_cast<double>((i * 37) % 11) / 10.0;
+    }
+    return result;
+}
+}  // namespace
+
+TEST(SimdKernels, MultiplyRows) {
+    auto matrix = createMatrix();
+    storm::storage::CompactSparseMatrix<double> compact(matrix);
+    auto x = createVector(matrix.getColumnCount());
+    auto b = createVector(matrix.getRowCount());
+    std::vector<double> expected(matrix.getRowCount());
+    matrix.multiplyWithVector(x, expected, &b);
+
+    for (auto instructionSet : getSupportedInstructionSets()) {
+        std::vector<double> result(matrix.getRowCount());
+        storm::solver::simd::multiplyRows(instructionSet, compact.getRowIndications().data(), compact.getColumns().data(), compact.getValues().data(),
+                                          x.data(), b.data(), 0, matrix.getRowCount(), result.data());
+        for (uint64_t row = 0; row < expected.size(); ++row) {
+            EXPECT_NEAR(expected[row], result[row], 1e-15) << "Row " << row << " using " << storm::solver::simd::toString(instructionSet);
+        }
+    }
+}
+
+TEST(SimdKernels, Reduce) {
+    auto values = createVector(37);
+    for (auto instructionSet : getSupportedInstructionSets()) {
+        for (uint64_t size = 1; size <= values.size(); ++size) {
+            EXPECT_EQ(*std::min_element(values.begin(), values.begin() + size), storm::solver::simd::reduceMinimum(instructionSet, values.data(), size));
+            EXPECT_EQ(*std::max_element(values.begin(), values.begin() + size), storm::solver::simd::reduceMaximum(instructionSet, values.data(), size));
+        }
+    }
+}
+
+TEST(SimdMultiplier, MultiplyAndReduce) {
+    storm::Environment env;
+    auto matrix = createMatrix();
+    auto x = createVector(matrix.getColumnCount());
+    auto b = createVector(matrix.getRowCount());
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> expected(matrix.getRowGroupCount());
+        std::vector<uint64_t> expectedChoices(matrix.getRowGroupCount(), 0);
+        matrix.multiplyAndReduce(dir, matrix.getRowGroupIndices(), x, &b, expected, &expectedChoices);
+
+        for (auto instructionSet : getSupportedInstructionSets()) {
+            storm::solver::SimdMultiplier<double> multiplier(matrix);
+            multiplier.setInstructionSet(instructionSet);
+            std::vector<double> result(matrix.getRowGroupCount());
+            std::vector<uint64_t> choices(matrix.getRowGroupCount(), 0);
+            multiplier.multiplyAndReduce(env, dir, matrix.getRowGroupIndices(), x, &b, result, &choices);
+            for (uint64_t group = 0; group < expected.size(); ++group) {
+                EXPECT_NEAR(expected[group], result[group], 1e-15) << "Group " << group << " using " << storm::solver::simd::toString(instructionSet);
+                EXPECT_EQ(expectedChoices[group], choices[group]) << "Group " << group << " using " << storm::solver::simd::toString(instructionSet);
+            }
+
+            // Without choices, the vectorized reduction is used.
+            std::vector<double> resultWithoutChoices(matrix.getRowGroupCount());
+            multiplier.multiplyAndReduce(env, dir, matrix.getRowGroupIndices(), x, &b, resultWithoutChoices);
+            for (uint64_t group = 0; group < expected.size(); ++group) {
+                EXPECT_NEAR(expected[group], resultWithoutChoices[group], 1e-15);
+            }
+        }
+    }
+}
+
+TEST(SimdMultiplier, MultiplyAndReduceGaussSeidel) {
+    storm::Environment env;
+    auto matrix = createMatrix();
+    auto b = createVector(matrix.getRowCount());
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        for (bool backwards : {true, false}) {
+            std::vector<double> expected = createVector(matrix.getRowGroupCount());
+            std::vector<uint64_t> expectedChoices(matrix.getRowGroupCount(), 0);
+            if (backwards) {
+                matrix.multiplyAndReduceBackward(dir, matrix.getRowGroupIndices(), expected, &b, expected, &expectedChoices);
+            } else {
+                matrix.multiplyAndReduceForward(dir, matrix.getRowGroupIndices(), expected, &b, expected, &expectedChoices);
+            }
+
+            for (auto instructionSet : getSupportedInstructionSets()) {
+                storm::solver::SimdMultiplier<double> multiplier(matrix);
+                multiplier.setInstructionSet(instructionSet);
+                std::vector<double> x = createVector(matrix.getRowGroupCount());
+                std::vector<uint64_t> choices(matrix.getRowGroupCount(), 0);
+                multiplier.multiplyAndReduceGaussSeidel(env, dir, matrix.getRowGroupIndices(), x, &b, &choices, backwards);
+                for (uint64_t group = 0; group < expected.size(); ++group) {
+                    EXPECT_NEAR(expected[group], x[group], 1e-12) << "Group " << group << " using " << storm::solver::simd::toString(instructionSet);
+                    EXPECT_EQ(expectedChoices[group], choices[group]) << "Group " << group << " using " << storm::solver::simd::toString(instructionSet);
+                }
+            }
+        }
+    }
+}
+
+TEST(SimdMultiplier, MultiplyGaussSeidel) {
+    storm::Environment env;
+    uint64_t const size = 50;
+    storm::storage::SparseMatrixBuilder<double> builder(size, size);
+    for (uint64_t row = 0; row < size; ++row) {
+        uint64_t const rowLength = 1 + (row % 19);
+        for (uint64_t i = 0; i < rowLength; ++i) {
+            builder.addNextValue(row, (row + 2 * i) % size, 1.0 / rowLength);
+        }
+    }
+    auto matrix = builder.build();
+    auto b = createVector(size);
+
+    for (bool backwards : {true, false}) {
+        std::vector<double> expected = createVector(size);
+        if (backwards) {
+            matrix.multiplyWithVectorBackward(expected, expected, &b);
+        } else {
+            matrix.multiplyWithVectorForward(expected, expected, &b);
+        }
+
+        for (auto instructionSet : getSupportedInstructionSets()) {
+            storm::solver::SimdMultiplier<double> multiplier(matrix);
+            multiplier.setInstructionSet(instructionSet);
+            std::vector<double> x = createVector(size);
+            multiplier.multiplyGaussSeidel(env, x, &b, backwards);
+            for (uint64_t row = 0; row < size; ++row) {
+                EXPECT_NEAR(expected[row], x[row], 1e-12) << "Row " << row << " using " << storm::solver::simd::toString(instructionSet);
+            }
+        }
+    }
+}
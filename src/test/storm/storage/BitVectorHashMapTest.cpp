@@ -67,3 +67,78 @@ TEST(BitVectorHashMapTest, FindOrAdd) {
     EXPECT_EQ(5ul, map.findOrAdd(fifth, 0));
     EXPECT_EQ(6ul, map.findOrAdd(sixth, 0));
 }
+
+TEST(BitVectorHashMapTest, ManyKeys) {
+    // Use keys of two buckets and enough of them to trigger several resizes of the map.
+    storm::storage::BitVectorHashMap<uint32_t> map(128, 10);
+    uint64_t const numberOfKeys = 20000;
+    auto createKey = [](uint64_t index) {
+        storm::storage::BitVector key(128);
+        key.setFromInt(0, 64, index * 7919);
+        key.setFromInt(64, 64, index % 3);
+        return key;
+    };
+
+    for (uint64_t index = 0; index < numberOfKeys; ++index) {
+        EXPECT_FALSE(map.contains(createKey(index)));
+        EXPECT_EQ(index, map.findOrAdd(createKey(index), index));
+    }
+    EXPECT_EQ(numberOfKeys, map.size());
+    EXPECT_GE(map.capacity(), numberOfKeys);
+
+    for (uint64_t index = 0; index < numberOfKeys; ++index) {
+        EXPECT_EQ(index, map.findOrAdd(createKey(index), 0));
+        EXPECT_EQ(index, map.getValue(createKey(index)));
+        auto found = map.find(createKey(index));
+        EXPECT_TRUE(found.first);
+        EXPECT_EQ(index, found.second);
+    }
+    EXPECT_FALSE(map.find(createKey(numberOfKeys)).first);
+    EXPECT_EQ(numberOfKeys, map.size());
+
+    uint64_t numberOfIteratedKeys = 0;
+    for (auto const& keyValuePair : map) {
+        EXPECT_EQ(createKey(keyValuePair.second), keyValuePair.first);
+        ++numberOfIteratedKeys;
+    }
+    EXPECT_EQ(numberOfKeys, numberOfIteratedKeys);
+}
+
+TEST(BitVectorHashMapTest, CompressedKeys) {
+    // Keys of five words where the first word takes only few values and the others are shared by many keys.
+    storm::storage::BitVectorHashMap<uint64_t> map(320, 10, 0.75, true);
+    EXPECT_TRUE(map.isCompressingKeys());
+    uint64_t const numberOfKeys = 10000;
+    auto createKey = [](uint64_t index) {
+        storm::storage::BitVector key(320);
+        key.setFromInt(0, 64, index % 10);
+        key.setFromInt(64, 64, index / 10);
+        key.setFromInt(192, 64, index % 7);
+        key.setFromInt(256, 64, 0xffffffffffffffffull);
+        return key;
+    };
+
+    for (uint64_t index = 0; index < numberOfKeys; ++index) {
+        EXPECT_EQ(index, map.findOrAdd(createKey(index), index));
+    }
+    EXPECT_EQ(numberOfKeys, map.size());
+
+    for (uint64_t index = 0; index < numberOfKeys; ++index) {
+        EXPECT_EQ(index, map.findOrAdd(createKey(index), 0));
+        EXPECT_TRUE(map.contains(createKey(index)));
+        EXPECT_EQ(index, map.getValue(createKey(index)));
+    }
+    EXPECT_FALSE(map.contains(createKey(numberOfKeys)));
+    EXPECT_FALSE(map.find(createKey(numberOfKeys)).first);
+    EXPECT_EQ(numberOfKeys, map.size());
+
+    uint64_t numberOfIteratedKeys = 0;
+    for (auto const& keyValuePair : map) {
+        EXPECT_EQ(createKey(keyValuePair.second), keyValuePair.first);
+        ++numberOfIteratedKeys;
+    }
+    EXPECT_EQ(numberOfKeys, numberOfIteratedKeys);
+
+    // Keys of a single word are not compressed.
+    EXPECT_FALSE(storm::storage::BitVectorHashMap<uint64_t>(64, 10, 0.75, true).isCompressingKeys());
+}
@@ -0,0 +1,124 @@
+#include "storm/storage/CompactSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+#include "test/storm_gtest.h"
+
+namespace {
+storm::storage::SparseMatrix<double> createNondeterministicMatrix() {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.9);
+    builder.addNextValue(0, 1, 0.099);
+    builder.addNextValue(0, 2, 0.001);
+    builder.addNextValue(1, 1, 0.5);
+    builder.addNextValue(1, 2, 0.5);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 1, 1.0);
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 2, 1.0);
+    builder.addNextValue(4, 0, 0.3);
+    builder.addNextValue(4, 2, 0.7);
+    return builder.build();
+}
+}  // namespace
+
+TEST(CompactSparseMatrix, Creation) {
+    auto matrix = createNondeterministicMatrix();
+    ASSERT_TRUE(storm::storage::CompactSparseMatrix<double>::isApplicable(matrix));
+    storm::storage::CompactSparseMatrix<double> compact(matrix);
+
+    EXPECT_EQ(matrix.getRowCount(), compact.getRowCount());
+    EXPECT_EQ(matrix.getColumnCount(), compact.getColumnCount());
+    EXPECT_EQ(matrix.getEntryCount(), compact.getEntryCount());
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        auto entryIndex = compact.getRowIndications()[row];
+        for (auto const& entry : matrix.getRow(row)) {
+            EXPECT_EQ(entry.getColumn(), compact.getColumns()[entryIndex]);
+            EXPECT_EQ(entry.getValue(), compact.getValues()[entryIndex]);
+            ++entryIndex;
+        }
+        EXPECT_EQ(compact.getRowIndications()[row + 1], entryIndex);
+    }
+}
+
+TEST(CompactSparseMatrix, MoveAndRestore) {
+    auto matrix = createNondeterministicMatrix();
+    auto original = matrix;
+    storm::storage::CompactSparseMatrix<double> compact(std::move(matrix));
+    EXPECT_EQ(0ull, matrix.getEntryCount());
+    EXPECT_EQ(original.getRowGroupIndices(), compact.getRowGroupIndices());
+
+    auto restored = compact.toSparseMatrix();
+    EXPECT_EQ(original, restored);
+    EXPECT_EQ(0ull, compact.getEntryCount());
+}
+
+TEST(CompactSparseMatrix, MatrixVectorMultiply) {
+    auto matrix = createNondeterministicMatrix();
+    storm::storage::CompactSparseMatrix<double> compact(matrix);
+
+    std::vector<double> x = {0.2, 0.5, 0.9};
+    std::vector<double> b = {0.1, 0.2, 0.3, 0.4, 0.5};
+    std::vector<double> expected(matrix.getRowCount()), result(matrix.getRowCount());
+    matrix.multiplyWithVector(x, expected, &b);
+    compact.multiplyWithVector(x, result, &b);
+    for (uint64_t row = 0; row < expected.size(); ++row) {
+        EXPECT_NEAR(expected[row], result[row], 1e-15);
+    }
+
+    // The result may be the input vector, even if the matrix is not square.
+    std::vector<double> aliased = x;
+    compact.multiplyWithVector(aliased, aliased, &b);
+    ASSERT_EQ(expected.size(), aliased.size());
+    for (uint64_t row = 0; row < expected.size(); ++row) {
+        EXPECT_NEAR(expected[row], aliased[row], 1e-15);
+    }
+
+    // Gauss-Seidel style multiplications (on a square matrix).
+    storm::storage::SparseMatrixBuilder<double> builder(3, 3);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 2, 0.5);
+    builder.addNextValue(1, 0, 0.3);
+    builder.addNextValue(1, 1, 0.7);
+    builder.addNextValue(2, 2, 1.0);
+    auto squareMatrix = builder.build();
+    storm::storage::CompactSparseMatrix<double> compactSquare(squareMatrix);
+    std::vector<double> expectedGs = {0.0, 0.0, 1.0};
+    std::vector<double> resultGs = expectedGs;
+    squareMatrix.multiplyWithVectorBackward(expectedGs, expectedGs);
+    compactSquare.multiplyWithVectorBackward(resultGs, resultGs);
+    for (uint64_t row = 0; row < expectedGs.size(); ++row) {
+        EXPECT_NEAR(expectedGs[row], resultGs[row], 1e-15);
+    }
+    squareMatrix.multiplyWithVectorForward(expectedGs, expectedGs);
+    compactSquare.multiplyWithVectorForward(resultGs, resultGs);
+    for (uint64_t row = 0; row < expectedGs.size(); ++row) {
+        EXPECT_NEAR(expectedGs[row], resultGs[row], 1e-15);
+    }
+}
+
+TEST(CompactSparseMatrix, MultiplyAndReduce) {
+    auto matrix = createNondeterministicMatrix();
+    storm::storage::CompactSparseMatrix<double> compact(matrix);
+    std::vector<double> x = {0.2, 0.5, 0.9};
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> expected(3), result(3);
+        std::vector<uint64_t> expectedChoices(3, 0), resultChoices(3, 0);
+        matrix.multiplyAndReduce(dir, matrix.getRowGroupIndices(), x, nullptr, expected, &expectedChoices);
+        compact.multiplyAndReduce(dir, matrix.getRowGroupIndices(), x, nullptr, result, &resultChoices);
+        for (uint64_t group = 0; group < expected.size(); ++group) {
+            EXPECT_NEAR(expected[group], result[group], 1e-15);
+            EXPECT_EQ(expectedChoices[group], resultChoices[group]);
+        }
+
+        std::vector<double> expectedGs = x, resultGs = x;
+        expectedChoices.assign(3, 0);
+        resultChoices.assign(3, 0);
+        matrix.multiplyAndReduceBackward(dir, matrix.getRowGroupIndices(), expectedGs, nullptr, expectedGs, &expectedChoices);
+        compact.multiplyAndReduceBackward(dir, matrix.getRowGroupIndices(), resultGs, nullptr, resultGs, &resultChoices);
+        for (uint64_t group = 0; group < expectedGs.size(); ++group) {
+            EXPECT_NEAR(expectedGs[group], resultGs[group], 1e-15);
+            EXPECT_EQ(expectedChoices[group], resultChoices[group]);
+        }
+    }
+}
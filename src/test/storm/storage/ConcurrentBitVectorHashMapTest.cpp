@@ -0,0 +1,118 @@
+#include "test/storm_gtest.h"
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+namespace {
+storm::storage::BitVector getKey(uint64_t index) {
+    storm::storage::BitVector key(128);
+    key.setFromInt(0, 64, index);
+    key.setFromInt(64, 64, index * 31 + 7);
+    return key;
+}
+}  // namespace
+
+TEST(ConcurrentBitVectorHashMapTest, FindOrAdd) {
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(128, 3, 4);
+
+    for (uint64_t index = 0; index < 1000; ++index) {
+        EXPECT_EQ(index, map.findOrAdd(getKey(index), index));
+    }
+    EXPECT_EQ(1000ul, map.size());
+
+    for (uint64_t index = 0; index < 1000; ++index) {
+        EXPECT_EQ(index, map.findOrAdd(getKey(index), 5000));
+        std::pair<bool, uint64_t> flagValuePair = map.find(getKey(index));
+        EXPECT_TRUE(flagValuePair.first);
+        EXPECT_EQ(index, flagValuePair.second);
+    }
+    EXPECT_EQ(1000ul, map.size());
+    EXPECT_FALSE(map.contains(getKey(1000)));
+    EXPECT_GE(map.capacity(), 1000ul);
+
+    // The value is only computed for new keys.
+    uint64_t numberOfCalls = 0;
+    std::pair<uint64_t, bool> valueInsertedPair = map.findOrAdd(getKey(17), [&numberOfCalls]() { return ++numberOfCalls; });
+    EXPECT_EQ(17ul, valueInsertedPair.first);
+    EXPECT_FALSE(valueInsertedPair.second);
+    valueInsertedPair = map.findOrAdd(getKey(1000), [&numberOfCalls]() { return ++numberOfCalls; });
+    EXPECT_EQ(1ul, valueInsertedPair.first);
+    EXPECT_TRUE(valueInsertedPair.second);
+    EXPECT_EQ(1ul, numberOfCalls);
+}
+
+TEST(ConcurrentBitVectorHashMapTest, IncrementalMigration) {
+    // With a single segment, every growth step leaves keys in the old table that are only moved by later insertions.
+    storm::storage::ConcurrentBitVectorHashMap<uint32_t> map(128, 8, 1);
+    uint64_t initialCapacity = map.capacity();
+
+    uint64_t index = 0;
+    while (map.getNumberOfMigratingSegments() == 0) {
+        map.findOrAdd(getKey(index), index);
+        ++index;
+    }
+    EXPECT_GT(map.capacity(), initialCapacity);
+
+    // All keys are found while the segment is migrating.
+    for (uint64_t other = 0; other < index; ++other) {
+        std::pair<bool, uint32_t> flagValuePair = map.find(getKey(other));
+        EXPECT_TRUE(flagValuePair.first);
+        EXPECT_EQ(other, flagValuePair.second);
+    }
+
+    // Further insertions complete the migration.
+    for (uint64_t other = index; other < index + 16; ++other) {
+        map.findOrAdd(getKey(other), other);
+    }
+    EXPECT_EQ(0ul, map.getNumberOfMigratingSegments());
+    for (uint64_t other = 0; other < index + 16; ++other) {
+        EXPECT_EQ(other, map.findOrAdd(getKey(other), 0));
+    }
+    EXPECT_EQ(index + 16, map.size());
+}
+
+TEST(ConcurrentBitVectorHashMapTest, ConcurrentFindOrAdd) {
+    uint64_t const numberOfThreads = 4;
+    uint64_t const numberOfKeys = 20000;
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(128, 16, 8);
+
+    // All threads insert all keys (in different orders), so every key is inserted exactly once and all threads agree
+    // on its value.
+    std::vector<std::vector<uint64_t>> values(numberOfThreads, std::vector<uint64_t>(numberOfKeys));
+    std::vector<std::vector<uint64_t>> insertions(numberOfThreads);
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        threads.emplace_back([&, thread]() {
+            for (uint64_t step = 0; step < numberOfKeys; ++step) {
+                uint64_t index = thread % 2 == 0 ? step : numberOfKeys - 1 - step;
+                std::pair<uint64_t, bool> valueInsertedPair = map.findOrAdd(getKey(index), [&]() { return thread * numberOfKeys + index; });
+                values[thread][index] = valueInsertedPair.first;
+                if (valueInsertedPair.second) {
+                    insertions[thread].push_back(index);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(numberOfKeys, map.size());
+    uint64_t numberOfInsertions = 0;
+    for (auto const& threadInsertions : insertions) {
+        numberOfInsertions += threadInsertions.size();
+    }
+    EXPECT_EQ(numberOfKeys, numberOfInsertions);
+    for (uint64_t index = 0; index < numberOfKeys; ++index) {
+        uint64_t value = values[0][index];
+        EXPECT_EQ(index, value % numberOfKeys);
+        for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+            EXPECT_EQ(value, values[thread][index]);
+        }
+        EXPECT_EQ(value, map.find(getKey(index)).second);
+    }
+}
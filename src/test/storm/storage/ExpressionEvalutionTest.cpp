@@ -1,7 +1,10 @@
+#include "storm/storage/BitVector.h"
+#include "storm/storage/expressions/BytecodeExpressionEvaluator.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/ExprtkExpressionEvaluator.h"
 #include "storm/storage/expressions/SimpleValuation.h"
+#include "storm/storage/expressions/ToBytecodeVisitor.h"
 #include "test/storm_gtest.h"
 
 TEST(ExpressionEvaluation, NaiveEvaluation) {
@@ -60,3 +63,129 @@ TEST(ExpressionEvaluation, ExprTkEvaluation) {
         EXPECT_NEAR(3 * zValue, eval.asRational(iteExpression), 1e-6);
     }
 }
+
+TEST(ExpressionEvaluation, BytecodeEvaluation) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+
+    storm::expressions::Variable x;
+    storm::expressions::Variable y;
+    storm::expressions::Variable z;
+    ASSERT_NO_THROW(x = manager->declareBooleanVariable("x"));
+    ASSERT_NO_THROW(y = manager->declareIntegerVariable("y"));
+    ASSERT_NO_THROW(z = manager->declareRationalVariable("z"));
+
+    storm::expressions::Expression iteExpression = storm::expressions::ite(x, y + z, manager->integer(3) * z);
+    storm::expressions::BytecodeExpressionEvaluator eval(*manager);
+
+    eval.setRationalValue(z, 5.5);
+    eval.setBooleanValue(x, true);
+    for (int_fast64_t i = 0; i < 1000; ++i) {
+        eval.setIntegerValue(y, 3 + i);
+        EXPECT_NEAR(8.5 + i, eval.asRational(iteExpression), 1e-6);
+    }
+
+    eval.setBooleanValue(x, false);
+    for (int_fast64_t i = 0; i < 1000; ++i) {
+        double zValue = i / static_cast<double>(10);
+        eval.setRationalValue(z, zValue);
+        EXPECT_NEAR(3 * zValue, eval.asRational(iteExpression), 1e-6);
+    }
+
+    // Compare all operators against the exprtk-based evaluator.
+    storm::expressions::Expression one = manager->integer(1);
+    storm::expressions::Expression two = manager->integer(2);
+    std::vector<storm::expressions::Expression> booleanExpressions = {
+        x && y > two,
+        x || y <= two,
+        !x,
+        storm::expressions::xclusiveor(x, y == two),
+        storm::expressions::implies(x, y != two),
+        storm::expressions::iff(x, y >= two),
+        (y < two && !(z > manager->rational(0.5))) || x,
+        storm::expressions::ite(y > two, x, !x)};
+    std::vector<storm::expressions::Expression> integerExpressions = {
+        y + two,
+        y - two * y,
+        -y,
+        storm::expressions::minimum(y, two),
+        storm::expressions::maximum(y, two),
+        storm::expressions::modulo(y + manager->integer(7), manager->integer(3)),
+        storm::expressions::pow(two, y),
+        storm::expressions::floor(z),
+        storm::expressions::ceil(z),
+        storm::expressions::ite(x, y, storm::expressions::ite(y > one, y * y, two))};
+    std::vector<storm::expressions::Expression> rationalExpressions = {
+        z / two,
+        z * y - z,
+        storm::expressions::ite(x && y > one, z, -z) + manager->rational(0.25)};
+
+    storm::expressions::ExprtkExpressionEvaluator exprtkEval(*manager);
+    for (bool xValue : {false, true}) {
+        for (int_fast64_t yValue = -3; yValue <= 5; ++yValue) {
+            for (double zValue : {-1.5, 0.0, 0.5, 2.25}) {
+                eval.setBooleanValue(x, xValue);
+                eval.setIntegerValue(y, yValue);
+                eval.setRationalValue(z, zValue);
+                exprtkEval.setBooleanValue(x, xValue);
+                exprtkEval.setIntegerValue(y, yValue);
+                exprtkEval.setRationalValue(z, zValue);
+                for (auto const& expression : booleanExpressions) {
+                    EXPECT_EQ(exprtkEval.asBool(expression), eval.asBool(expression)) << expression;
+                }
+                for (auto const& expression : integerExpressions) {
+                    EXPECT_EQ(exprtkEval.asInt(expression), eval.asInt(expression)) << expression;
+                }
+                for (auto const& expression : rationalExpressions) {
+                    EXPECT_NEAR(exprtkEval.asRational(expression), eval.asRational(expression), 1e-6) << expression;
+                }
+            }
+        }
+    }
+}
+
+TEST(ExpressionEvaluation, BytecodeEvaluationFromBitVector) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+
+    storm::expressions::Variable x = manager->declareBooleanVariable("x");
+    storm::expressions::Variable y = manager->declareIntegerVariable("y");
+    storm::expressions::Variable w = manager->declareIntegerVariable("w");
+    storm::expressions::Variable z = manager->declareRationalVariable("z");
+
+    // The bit vector stores x at bit 3, y in [-3, 12] at bits 10-13 and w in [0, 100] at bits 40-46.
+    std::unordered_map<storm::expressions::Variable, storm::expressions::ToBytecodeVisitor::BitVectorLocation> locations;
+    locations[x] = {3, 1, 0};
+    locations[y] = {10, 4, -3};
+    locations[w] = {40, 7, 0};
+    storm::expressions::ToBytecodeVisitor visitor(locations);
+
+    storm::expressions::Expression two = manager->integer(2);
+    std::vector<storm::expressions::Expression> expressions = {x && y > two,
+                                                               storm::expressions::ite(x, y * w, w - y),
+                                                               storm::expressions::modulo(w + y + manager->integer(3), manager->integer(5)),
+                                                               !x || w >= y * y};
+    EXPECT_FALSE(visitor.canCompile(x && z > manager->rational(0.5)));
+    for (auto const& expression : expressions) {
+        EXPECT_TRUE(visitor.canCompile(expression));
+    }
+
+    storm::expressions::BytecodeExpressionEvaluator eval(*manager);
+    storm::storage::BitVector state(64);
+    std::vector<double> registers;
+    for (bool xValue : {false, true}) {
+        for (int_fast64_t yValue = -3; yValue <= 12; ++yValue) {
+            for (int_fast64_t wValue : {0, 1, 17, 100}) {
+                state.set(3, xValue);
+                state.setFromInt(10, 4, yValue + 3);
+                state.setFromInt(40, 7, wValue);
+                eval.setBooleanValue(x, xValue);
+                eval.setIntegerValue(y, yValue);
+                eval.setIntegerValue(w, wValue);
+                for (auto const& expression : expressions) {
+                    std::shared_ptr<storm::expressions::BytecodeCompiledExpression> compiledExpression = visitor.compile(expression);
+                    registers.resize(compiledExpression->getNumberOfRegisters());
+                    EXPECT_EQ(eval.asRational(expression), compiledExpression->evaluate(state, registers.data())) << expression;
+                }
+            }
+        }
+    }
+}
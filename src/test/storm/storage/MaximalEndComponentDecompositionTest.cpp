@@ -2,6 +2,8 @@
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/ParallelEnvironment.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -179,3 +181,33 @@ TEST(MaximalEndComponentDecomposition, Example2) {
     EXPECT_TRUE((mecDecomposition[1].getChoicesForState(0) == storm::storage::MaximalEndComponent::set_type{0, 1}));
     EXPECT_TRUE((mecDecomposition[1].getChoicesForState(1) == storm::storage::MaximalEndComponent::set_type{3}));
 }
+
+TEST(MaximalEndComponentDecomposition, Parallel) {
+    std::string prismModelPath = STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm";
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(prismModelPath);
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+
+    std::shared_ptr<storm::models::sparse::Model<double>> model =
+        storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = model->as<storm::models::sparse::Mdp<double>>();
+
+    storm::Environment env;
+    env.parallel().setNumberOfThreads(4);
+    auto backwardTransitions = mdp->getBackwardTransitions();
+    storm::storage::BitVector subsystem = ~mdp->getStates("finished");
+
+    for (storm::storage::BitVector const* states : {static_cast<storm::storage::BitVector const*>(nullptr), &subsystem}) {
+        storm::storage::MaximalEndComponentDecomposition<double> expected =
+            states ? storm::storage::MaximalEndComponentDecomposition<double>(*mdp, *states) : storm::storage::MaximalEndComponentDecomposition<double>(*mdp);
+        storm::storage::MaximalEndComponentDecomposition<double> mecDecomposition(env, mdp->getTransitionMatrix(), backwardTransitions, states);
+
+        // The MECs (and their order) have to coincide with the ones of the sequential computation.
+        ASSERT_EQ(expected.size(), mecDecomposition.size());
+        for (uint64_t mecIndex = 0; mecIndex < expected.size(); ++mecIndex) {
+            ASSERT_TRUE(expected[mecIndex].getStateSet() == mecDecomposition[mecIndex].getStateSet());
+            for (auto const& stateChoicesPair : expected[mecIndex]) {
+                EXPECT_TRUE(stateChoicesPair.second == mecDecomposition[mecIndex].getChoicesForState(stateChoicesPair.first));
+            }
+        }
+    }
+}
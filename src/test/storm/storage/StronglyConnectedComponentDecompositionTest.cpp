@@ -1,9 +1,14 @@
 #include "storm-config.h"
 #include "storm-parsers/parser/AutoParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/ParallelEnvironment.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/storage/SymbolicModelDescription.h"
 #include "test/storm_gtest.h"
 
 TEST(StronglyConnectedComponentDecomposition, SmallSystemFromMatrix) {
@@ -90,3 +95,62 @@ TEST(StronglyConnectedComponentDecomposition, FullSystem2) {
 
     markovAutomaton = nullptr;
 }
+
+TEST(StronglyConnectedComponentDecomposition, Parallel) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::sparse::Model<double>> model =
+        storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+    storm::storage::SparseMatrix<double> const& matrix = model->getTransitionMatrix();
+
+    storm::Environment env;
+    env.parallel().setNumberOfThreads(4);
+    storm::storage::BitVector subsystem = ~model->getStates("observe0Greater1");
+
+    for (bool useSubsystem : {false, true}) {
+        storm::storage::StronglyConnectedComponentDecompositionOptions options;
+        options.computeSccDepths();
+        if (useSubsystem) {
+            options.subsystem(&subsystem);
+        }
+        storm::storage::StronglyConnectedComponentDecomposition<double> sequential(matrix, options);
+        storm::storage::StronglyConnectedComponentDecomposition<double> parallel(env, matrix, options);
+
+        // The SCCs might be ordered differently, so we compare them (and their depths) independent of the order.
+        ASSERT_EQ(sequential.size(), parallel.size());
+        std::map<storm::storage::StronglyConnectedComponent::container_type, uint_fast64_t> sequentialDepths;
+        for (uint_fast64_t sccIndex = 0; sccIndex < sequential.size(); ++sccIndex) {
+            sequentialDepths[sequential[sccIndex].getStates()] = sequential.getSccDepth(sccIndex);
+        }
+        std::vector<uint_fast64_t> stateToSccIndex(matrix.getRowGroupCount());
+        for (uint_fast64_t sccIndex = 0; sccIndex < parallel.size(); ++sccIndex) {
+            auto sequentialDepthIt = sequentialDepths.find(parallel[sccIndex].getStates());
+            ASSERT_TRUE(sequentialDepthIt != sequentialDepths.end());
+            EXPECT_EQ(sequentialDepthIt->second, parallel.getSccDepth(sccIndex));
+            for (auto const& state : parallel[sccIndex]) {
+                stateToSccIndex[state] = sccIndex;
+            }
+        }
+        EXPECT_EQ(sequential.getMaxSccDepth(), parallel.getMaxSccDepth());
+
+        // Check that the SCCs are sorted topologically.
+        for (uint_fast64_t state = 0; state < matrix.getRowGroupCount(); ++state) {
+            if (useSubsystem && !subsystem.get(state)) {
+                continue;
+            }
+            for (auto const& entry : matrix.getRowGroup(state)) {
+                if (!useSubsystem || subsystem.get(entry.getColumn())) {
+                    EXPECT_LE(stateToSccIndex[entry.getColumn()], stateToSccIndex[state]);
+                }
+            }
+        }
+
+        options.dropNaiveSccs().onlyBottomSccs();
+        sequential = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, options);
+        parallel = storm::storage::StronglyConnectedComponentDecomposition<double>(env, matrix, options);
+        ASSERT_EQ(sequential.size(), parallel.size());
+        for (uint_fast64_t sccIndex = 0; sccIndex < parallel.size(); ++sccIndex) {
+            EXPECT_EQ(1ull, sequentialDepths.count(parallel[sccIndex].getStates()));
+        }
+    }
+}
@@ -1,6 +1,7 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include "storm/io/BufferedWriter.h"
 #include "storm/io/file.h"
 
 TEST(FileTest, GetLine) {
@@ -21,3 +22,28 @@ TEST(FileTest, GetLineEmpty) {
     std::string str;
     EXPECT_FALSE(storm::utility::getline(stream, str));
 }
+
+TEST(FileTest, BufferedWriter) {
+    std::stringstream stream;
+    {
+        // Use a small buffer such that it is flushed several times.
+        storm::utility::BufferedWriter writer(stream, 16);
+        writer << "state " << 42ul << ' ' << -7 << " " << 0.1 << " " << 1.0 / 3.0 << " " << 1e-300 << " " << std::string(40, 'x');
+    }
+    EXPECT_EQ("state 42 -7 0.1 0.3333333333333333 1e-300 " + std::string(40, 'x'), stream.str());
+
+    // Doubles are written such that they are parsed back to the same value.
+    std::stringstream doubleStream;
+    std::vector<double> values = {0.1, 1.0 / 3.0, 2.0 / 7.0, 123456.789, 2.2250738585072014e-308, 1.7976931348623157e308};
+    {
+        storm::utility::BufferedWriter writer(doubleStream);
+        for (auto const& value : values) {
+            writer << value << '\n';
+        }
+    }
+    for (auto const& value : values) {
+        std::string line;
+        ASSERT_TRUE(storm::utility::getline(doubleStream, line));
+        EXPECT_EQ(value, std::stod(line));
+    }
+}
@@ -4,6 +4,8 @@
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/DdPrismModelBuilder.h"
 #include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/ParallelEnvironment.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -772,3 +774,57 @@ TEST(GraphTest, ExplicitProb01MinMax) {
     EXPECT_EQ(993ull, statesWithProbability01.first.getNumberOfSetBits());
     EXPECT_EQ(16ull, statesWithProbability01.second.getNumberOfSetBits());
 }
+
+TEST(GraphTest, ExplicitParallel) {
+    storm::Environment env;
+    env.parallel().setNumberOfThreads(4);
+
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::sparse::Model<double>> model =
+        storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+    ASSERT_TRUE(model->getType() == storm::models::ModelType::Dtmc);
+
+    storm::storage::BitVector allStates(model->getNumberOfStates(), true);
+    auto const& transitionMatrix = model->getTransitionMatrix();
+    auto backwardTransitions = model->getBackwardTransitions();
+    for (auto const& label : {"observe0Greater1", "observeIGreater1", "observeOnlyTrueSender"}) {
+        storm::storage::BitVector psiStates = model->getStates(label);
+        auto statesWithProbability01 = storm::utility::graph::performProb01(env, backwardTransitions, allStates, psiStates);
+        auto expected = storm::utility::graph::performProb01(backwardTransitions, allStates, psiStates);
+        EXPECT_EQ(expected.first, statesWithProbability01.first);
+        EXPECT_EQ(expected.second, statesWithProbability01.second);
+
+        for (uint_fast64_t steps : {0, 1, 5, 20}) {
+            EXPECT_EQ(storm::utility::graph::performProbGreater0(backwardTransitions, allStates, psiStates, true, steps),
+                      storm::utility::graph::performProbGreater0(env, backwardTransitions, allStates, psiStates, true, steps));
+            EXPECT_EQ(storm::utility::graph::getReachableStates(transitionMatrix, model->getInitialStates(), allStates, psiStates, true, steps),
+                      storm::utility::graph::getReachableStates(env, transitionMatrix, model->getInitialStates(), allStates, psiStates, true, steps));
+        }
+        EXPECT_EQ(storm::utility::graph::getReachableStates(transitionMatrix, model->getInitialStates(), allStates, psiStates),
+                  storm::utility::graph::getReachableStates(env, transitionMatrix, model->getInitialStates(), allStates, psiStates));
+    }
+
+    modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    program = modelDescription.preprocess().asPrismProgram();
+    model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+    ASSERT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+
+    allStates = storm::storage::BitVector(model->getNumberOfStates(), true);
+    backwardTransitions = model->getBackwardTransitions();
+    auto const& mdpTransitionMatrix = model->getTransitionMatrix();
+    for (auto const& label : {"all_coins_equal_0", "all_coins_equal_1"}) {
+        storm::storage::BitVector psiStates = model->getStates(label);
+        auto statesWithProbability01 = storm::utility::graph::performProb01Min(env, mdpTransitionMatrix, mdpTransitionMatrix.getRowGroupIndices(),
+                                                                               backwardTransitions, allStates, psiStates);
+        auto expected = storm::utility::graph::performProb01Min(*model->as<storm::models::sparse::Mdp<double>>(), allStates, psiStates);
+        EXPECT_EQ(expected.first, statesWithProbability01.first);
+        EXPECT_EQ(expected.second, statesWithProbability01.second);
+
+        statesWithProbability01 = storm::utility::graph::performProb01Max(env, mdpTransitionMatrix, mdpTransitionMatrix.getRowGroupIndices(),
+                                                                          backwardTransitions, allStates, psiStates);
+        expected = storm::utility::graph::performProb01Max(*model->as<storm::models::sparse::Mdp<double>>(), allStates, psiStates);
+        EXPECT_EQ(expected.first, statesWithProbability01.first);
+        EXPECT_EQ(expected.second, statesWithProbability01.second);
+    }
+}